@@ -5,19 +5,23 @@
 
 #include "component.hpp"
 
+#include <typeinfo>
+#include <utilities/allocation_tracker.hpp>
+#include <utilities/profiler.hpp>
+
 Component::Component(const unsigned int prescaler, ClockGenerator* clock_generator, const unsigned int fast_prescaler)
     : clock_generator_(clock_generator) {
   power_port_ = new PowerPort();
-  clock_generator_->RegisterComponent(this);
   prescaler_ = (prescaler > 0) ? prescaler : 1;
   fast_prescaler_ = (fast_prescaler > 0) ? fast_prescaler : 1;
+  clock_generator_->RegisterComponent(this);
 }
 
 Component::Component(const unsigned int prescaler, ClockGenerator* clock_generator, PowerPort* power_port, const unsigned int fast_prescaler)
     : clock_generator_(clock_generator), power_port_(power_port) {
-  clock_generator_->RegisterComponent(this);
   prescaler_ = (prescaler > 0) ? prescaler : 1;
   fast_prescaler_ = (fast_prescaler > 0) ? fast_prescaler : 1;
+  clock_generator_->RegisterComponent(this);
 }
 
 Component::Component(const Component& object) {
@@ -33,7 +37,10 @@ Component::~Component() { clock_generator_->RemoveComponent(this); }
 
 void Component::Tick(const unsigned int count) {
   if (count % prescaler_ > 0) return;
+  ScopedExecutionCost scoped_cost(tick_cost_);
   if (power_port_->GetIsOn()) {
+    PROFILE_SCOPE(typeid(*this).name());
+    ALLOCATION_SCOPE(typeid(*this).name());
     MainRoutine(count);
   } else {
     PowerOffRoutine();
@@ -42,6 +49,7 @@ void Component::Tick(const unsigned int count) {
 
 void Component::FastTick(const unsigned int fast_count) {
   if (fast_count % fast_prescaler_ > 0) return;
+  ScopedExecutionCost scoped_cost(fast_tick_cost_);
   if (power_port_->GetIsOn()) {
     FastUpdate();
   } else {
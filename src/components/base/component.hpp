@@ -8,6 +8,8 @@
 
 #include <components/ports/power_port.hpp>
 #include <environment/global/clock_generator.hpp>
+#include <utilities/checkpoint.hpp>
+#include <utilities/execution_cost.hpp>
 #include <utilities/macros.hpp>
 
 #include "interface_tickable.hpp"
@@ -17,7 +19,7 @@
  * @brief Base class for component emulation. All components have to inherit this.
  * @details Component ha clock and power on/off features
  */
-class Component : public ITickable {
+class Component : public ITickable, public ICheckpointable {
  public:
   /**
    * @fn Component
@@ -59,6 +61,41 @@ class Component : public ITickable {
    * @brief The methods to input fast clock. This will be called periodically.
    */
   virtual void FastTick(const unsigned int fast_count);
+  /**
+   * @fn GetPrescaler
+   * @brief Return frequency scale factor for normal update
+   */
+  virtual unsigned int GetPrescaler() const { return prescaler_; }
+  /**
+   * @fn GetFastPrescaler
+   * @brief Return frequency scale factor for fast update
+   */
+  virtual unsigned int GetFastPrescaler() const { return fast_prescaler_; }
+
+  // Getters
+  /**
+   * @fn GetTickCost
+   * @brief Return measured execution cost of Tick (MainRoutine or PowerOffRoutine)
+   */
+  inline const ExecutionCost& GetTickCost() const { return tick_cost_; }
+  /**
+   * @fn GetFastTickCost
+   * @brief Return measured execution cost of FastTick (FastUpdate or PowerOffRoutine)
+   */
+  inline const ExecutionCost& GetFastTickCost() const { return fast_tick_cost_; }
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the power port state into the checkpoint
+   * @note Components which have internal states (e.g. noise generators) should override this function and call it at first
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const { power_port_->SaveCheckpoint(writer); }
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the power port state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) { power_port_->LoadCheckpoint(reader); }
 
  protected:
   unsigned int prescaler_;           //!< Frequency scale factor for normal update
@@ -86,6 +123,10 @@ class Component : public ITickable {
 
   ClockGenerator* clock_generator_;  //!< Clock generator
   PowerPort* power_port_;            //!< Power port
+
+ private:
+  ExecutionCost tick_cost_;       //!< Execution cost of Tick
+  ExecutionCost fast_tick_cost_;  //!< Execution cost of FastTick
 };
 
 #endif  // S2E_COMPONENTS_BASE_COMPONENT_HPP_
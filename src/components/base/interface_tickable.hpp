@@ -23,6 +23,16 @@ class ITickable {
    * @note Usec ase: Calculate high-frequency disturbances
    */
   virtual void FastTick(const unsigned int fast_count) = 0;
+  /**
+   * @fn GetPrescaler
+   * @brief Return frequency scale factor of Tick. The clock generator calls Tick only when the count is a multiple of it.
+   */
+  virtual unsigned int GetPrescaler() const { return 1; }
+  /**
+   * @fn GetFastPrescaler
+   * @brief Return frequency scale factor of FastTick. The clock generator calls FastTick only when the count is a multiple of it.
+   */
+  virtual unsigned int GetFastPrescaler() const { return 1; }
 
   // Whether or not high-frequency disturbances need to be calculated
   /**
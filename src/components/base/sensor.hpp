@@ -10,6 +10,7 @@
 #include <math_physics/math/vector.hpp>
 #include <math_physics/randomization/normal_randomization.hpp>
 #include <math_physics/randomization/random_walk.hpp>
+#include <utilities/checkpoint.hpp>
 
 /**
  * @class Sensor
@@ -50,6 +51,17 @@ class Sensor {
    * @return Observed value with noise at the component frame
    */
   libra::Vector<N> Measure(const libra::Vector<N> true_value_c);
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the noise state into the checkpoint
+   * @note Not virtual. The inheriting component calls this function in its SaveCheckpoint function
+   */
+  void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the noise state from the checkpoint
+   */
+  void LoadCheckpoint(CheckpointReader& reader);
 
  private:
   libra::Matrix<N, N> scale_factor_;            //!< Scale factor matrix
@@ -41,6 +41,24 @@ libra::Vector<N> Sensor<N>::Measure(const libra::Vector<N> true_value_c) {
   return Clip(calc_value_c);
 }
 
+template <size_t N>
+void Sensor<N>::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(bias_noise_c_);
+  for (size_t i = 0; i < N; ++i) {
+    writer.Write(normal_random_noise_c_[i]);
+  }
+  random_walk_noise_c_.SaveCheckpoint(writer);
+}
+
+template <size_t N>
+void Sensor<N>::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(bias_noise_c_);
+  for (size_t i = 0; i < N; ++i) {
+    reader.Read(normal_random_noise_c_[i]);
+  }
+  random_walk_noise_c_.LoadCheckpoint(reader);
+}
+
 template <size_t N>
 libra::Vector<N> Sensor<N>::Clip(const libra::Vector<N> input_c) {
   libra::Vector<N> output_c;
@@ -32,6 +32,18 @@ std::string AngularVelocityObserver::GetLogValue() const {
   return str_tmp;
 }
 
+void AngularVelocityObserver::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  Sensor<3>::SaveCheckpoint(writer);
+  writer.Write(angular_velocity_b_rad_s_);
+}
+
+void AngularVelocityObserver::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  Sensor<3>::LoadCheckpoint(reader);
+  reader.Read(angular_velocity_b_rad_s_);
+}
+
 AngularVelocityObserver InitializeAngularVelocityObserver(ClockGenerator* clock_generator, const std::string file_name, double component_step_time_s,
                                                           const Attitude& attitude) {
   IniAccess ini_file(file_name);
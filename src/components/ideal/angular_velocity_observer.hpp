@@ -52,6 +52,18 @@ class AngularVelocityObserver : public Component, public Sensor<3>, public ILogg
    */
   virtual std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
   // Getter
   /**
    * @fn GetAngularVelocity_b_rad_s
@@ -47,6 +47,20 @@ std::string AttitudeObserver::GetLogValue() const {
   return str_tmp;
 }
 
+void AttitudeObserver::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(observed_quaternion_i2b_);
+  writer.Write(angle_noise_);
+  writer.Write(direction_noise_);
+}
+
+void AttitudeObserver::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(observed_quaternion_i2b_);
+  reader.Read(angle_noise_);
+  reader.Read(direction_noise_);
+}
+
 AttitudeObserver InitializeAttitudeObserver(ClockGenerator* clock_generator, const std::string file_name, const Attitude& attitude) {
   // General
   IniAccess ini_file(file_name);
@@ -53,6 +53,18 @@ class AttitudeObserver : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
   /**
    * @fn GetQuaternion_i2c
    * @brief Return observed quaternion from the inertial frame to the body-fixed frame
@@ -85,6 +85,26 @@ std::string ForceGenerator::GetLogValue() const {
   return str_tmp;
 }
 
+void ForceGenerator::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(ordered_force_b_N_);
+  writer.Write(generated_force_b_N_);
+  writer.Write(generated_force_i_N_);
+  writer.Write(generated_force_rtn_N_);
+  writer.Write(magnitude_noise_);
+  writer.Write(direction_noise_);
+}
+
+void ForceGenerator::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(ordered_force_b_N_);
+  reader.Read(generated_force_b_N_);
+  reader.Read(generated_force_i_N_);
+  reader.Read(generated_force_rtn_N_);
+  reader.Read(magnitude_noise_);
+  reader.Read(direction_noise_);
+}
+
 libra::Quaternion ForceGenerator::GenerateDirectionNoiseQuaternion(libra::Vector<3> true_direction, const double error_standard_deviation_rad) {
   libra::Vector<3> random_direction;
   random_direction[0] = direction_noise_;
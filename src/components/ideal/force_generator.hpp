@@ -59,6 +59,18 @@ class ForceGenerator : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   // Getter
   /**
    * @fn GetGeneratedForce_b_N
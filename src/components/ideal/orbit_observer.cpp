@@ -71,6 +71,24 @@ std::string OrbitObserver::GetLogValue() const {
   return str_tmp;
 }
 
+void OrbitObserver::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(observed_position_i_m_);
+  writer.Write(observed_velocity_i_m_s_);
+  for (size_t i = 0; i < 6; i++) {
+    writer.Write(normal_random_noise_[i]);
+  }
+}
+
+void OrbitObserver::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(observed_position_i_m_);
+  reader.Read(observed_velocity_i_m_s_);
+  for (size_t i = 0; i < 6; i++) {
+    reader.Read(normal_random_noise_[i]);
+  }
+}
+
 NoiseFrame SetNoiseFrame(const std::string noise_frame) {
   if (noise_frame == "INERTIAL") {
     return NoiseFrame::kInertial;
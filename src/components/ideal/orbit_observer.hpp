@@ -65,6 +65,18 @@ class OrbitObserver : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
   /**
    * @fn GetPosition_i_m
    * @brief Return observed position
@@ -58,6 +58,22 @@ std::string TorqueGenerator::GetLogValue() const {
   return str_tmp;
 }
 
+void TorqueGenerator::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(ordered_torque_b_Nm_);
+  writer.Write(generated_torque_b_Nm_);
+  writer.Write(magnitude_noise_);
+  writer.Write(direction_noise_);
+}
+
+void TorqueGenerator::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(ordered_torque_b_Nm_);
+  reader.Read(generated_torque_b_Nm_);
+  reader.Read(magnitude_noise_);
+  reader.Read(direction_noise_);
+}
+
 libra::Quaternion TorqueGenerator::GenerateDirectionNoiseQuaternion(libra::Vector<3> true_direction, const double error_standard_deviation_rad) {
   libra::Vector<3> random_direction;
   random_direction[0] = direction_noise_;
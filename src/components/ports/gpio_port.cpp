@@ -24,3 +24,7 @@ int GpioPort::DigitalWrite(const bool is_high) {
 }
 
 bool GpioPort::DigitalRead() { return high_low_state_; }
+
+void GpioPort::SaveCheckpoint(CheckpointWriter& writer) const { writer.Write(high_low_state_); }
+
+void GpioPort::LoadCheckpoint(CheckpointReader& reader) { reader.Read(high_low_state_); }
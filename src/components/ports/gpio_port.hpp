@@ -7,6 +7,7 @@
 #define S2E_COMPONENTS_PORTS_GPIO_PORT_HPP_
 
 #include <components/base/interface_gpio_component.hpp>
+#include <utilities/checkpoint.hpp>
 
 #define GPIO_HIGH true
 #define GPIO_LOW false
@@ -15,7 +16,7 @@
  * @class GpioPort
  * @brief Class to emulate GPIO(General Purpose Input and Output) port
  */
-class GpioPort {
+class GpioPort : public ICheckpointable {
  public:
   /**
    * @fn GpioPort
@@ -45,6 +46,19 @@ class GpioPort {
    */
   bool DigitalRead();
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the High/Low state into the checkpoint
+   */
+  void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the High/Low state from the checkpoint
+   * @note The component is not notified since its state is restored by itself
+   */
+  void LoadCheckpoint(CheckpointReader& reader) override;
+
  private:
   const unsigned int kPortId;  //!< Port ID
   IGPIOCompo* component_;      //!< Component which has the GPIO port
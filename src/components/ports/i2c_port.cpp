@@ -93,3 +93,40 @@ unsigned char I2cPort::ReadCommand(const unsigned char i2c_address, unsigned cha
   }
   return length;
 }
+
+void I2cPort::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(saved_register_address_);
+  SaveRegisterMap(device_registers_, writer);
+  SaveRegisterMap(command_buffer_, writer);
+}
+
+void I2cPort::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(saved_register_address_);
+  LoadRegisterMap(device_registers_, reader);
+  LoadRegisterMap(command_buffer_, reader);
+}
+
+void I2cPort::SaveRegisterMap(const std::map<std::pair<unsigned char, unsigned char>, unsigned char>& registers, CheckpointWriter& writer) {
+  writer.Write((uint64_t)registers.size());
+  for (const auto& value : registers) {
+    writer.Write(value.first.first);
+    writer.Write(value.first.second);
+    writer.Write(value.second);
+  }
+}
+
+void I2cPort::LoadRegisterMap(std::map<std::pair<unsigned char, unsigned char>, unsigned char>& registers, CheckpointReader& reader) {
+  uint64_t size = 0;
+  reader.Read(size);
+  if (!reader.IsGood()) return;
+  registers.clear();
+  for (uint64_t i = 0; i < size && reader.IsGood(); i++) {
+    unsigned char i2c_address = 0;
+    unsigned char register_address = 0;
+    unsigned char value = 0;
+    reader.Read(i2c_address);
+    reader.Read(register_address);
+    reader.Read(value);
+    registers[std::make_pair(i2c_address, register_address)] = value;
+  }
+}
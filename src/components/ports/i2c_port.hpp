@@ -7,13 +7,14 @@
 #define S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
 
 #include <map>
+#include <utilities/checkpoint.hpp>
 
 /**
  * @class I2cPort
  * @brief Class to emulate I2C(Inter-Integrated Circuit) communication port
  * @details The class has the register to store the parameters
  */
-class I2cPort {
+class I2cPort : public ICheckpointable {
  public:
   /**
    * @fn I2cPort
@@ -96,6 +97,18 @@ class I2cPort {
    */
   unsigned char ReadCommand(const unsigned char i2c_address, unsigned char* rx_data, const unsigned char length);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the device registers and the command buffer into the checkpoint
+   */
+  void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the device registers and the command buffer from the checkpoint
+   */
+  void LoadCheckpoint(CheckpointReader& reader) override;
+
  private:
   const int kDefaultCmdBufferSize = 0xff;        //!< Default command buffer size
   unsigned char max_register_number_ = 0xff;     //!< Maximum register number
@@ -106,6 +119,17 @@ class I2cPort {
 
   /** @brief Buffer for the command from OnBoardComputer : <pair(i2c_address, cmd_buffer_length), value>  **/
   std::map<std::pair<unsigned char, unsigned char>, unsigned char> command_buffer_;
+
+  /**
+   * @fn SaveRegisterMap
+   * @brief Write the register map into the checkpoint
+   */
+  static void SaveRegisterMap(const std::map<std::pair<unsigned char, unsigned char>, unsigned char>& registers, CheckpointWriter& writer);
+  /**
+   * @fn LoadRegisterMap
+   * @brief Restore the register map from the checkpoint
+   */
+  static void LoadRegisterMap(std::map<std::pair<unsigned char, unsigned char>, unsigned char>& registers, CheckpointReader& reader);
 };
 
 #endif  // S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
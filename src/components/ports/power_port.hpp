@@ -7,13 +7,14 @@
 #define S2E_COMPONENTS_PORTS_POWER_PORT_HPP_
 
 #include <string>
+#include <utilities/checkpoint.hpp>
 
 /**
  * @class PowerPort
  * @brief Class to emulate electrical power port
  * @details When the power switch is turned off, the component doesn't work same with the real world.
  */
-class PowerPort {
+class PowerPort : public ICheckpointable {
  public:
   /**
    * @fn PowerPort
@@ -113,6 +114,28 @@ class PowerPort {
    */
   void InitializeWithInitializeFile(const std::string file_name);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the voltage, the power consumption, and the power switch state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const {
+    writer.Write(assumed_power_consumption_W_);
+    writer.Write(voltage_V_);
+    writer.Write(current_consumption_A_);
+    writer.Write(is_on_);
+  }
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the voltage, the power consumption, and the power switch state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) {
+    reader.Read(assumed_power_consumption_W_);
+    reader.Read(voltage_V_);
+    reader.Read(current_consumption_A_);
+    reader.Read(is_on_);
+  }
+
  private:
   // PCU setting parameters
   const int kPortId;        //!< ID of the power port
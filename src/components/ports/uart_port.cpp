@@ -36,3 +36,13 @@ int UartPort::ReadTx(unsigned char* buffer, const unsigned int offset, const uns
 int UartPort::ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
   return rx_buffer_->Read(buffer, offset, data_length);
 }
+
+void UartPort::SaveCheckpoint(CheckpointWriter& writer) const {
+  rx_buffer_->SaveCheckpoint(writer);
+  tx_buffer_->SaveCheckpoint(writer);
+}
+
+void UartPort::LoadCheckpoint(CheckpointReader& reader) {
+  rx_buffer_->LoadCheckpoint(reader);
+  tx_buffer_->LoadCheckpoint(reader);
+}
@@ -13,7 +13,7 @@
  * @brief Class to emulate UART communication port
  * @details The distinction of the area should be done where the upper port ID is assigned.
  */
-class UartPort {
+class UartPort : public ICheckpointable {
  public:
   /**
    * @fn UartPort
@@ -71,6 +71,18 @@ class UartPort {
    */
   int ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the RX and TX buffers into the checkpoint
+   */
+  void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the RX and TX buffers from the checkpoint
+   */
+  void LoadCheckpoint(CheckpointReader& reader) override;
+
  private:
   const static unsigned int kDefaultBufferSize = 1024;  //!< Default buffer size
 
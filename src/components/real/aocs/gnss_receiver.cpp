@@ -237,6 +237,44 @@ std::string GnssReceiver::GetLogValue() const  // For logs
   return str_tmp;
 }
 
+void GnssReceiver::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(position_ecef_m_);
+  writer.Write(velocity_ecef_m_s_);
+  writer.Write(geodetic_position_);
+  writer.Write(utc_);
+  writer.Write(gps_time_week_);
+  writer.Write(gps_time_s_);
+  writer.Write(is_gnss_visible_);
+  writer.Write(visible_satellite_number_);
+  writer.Write(gnss_information_list_);
+  for (size_t i = 0; i < 3; i++) {
+    writer.Write(position_random_noise_ecef_m_[i]);
+  }
+  for (size_t i = 0; i < 3; i++) {
+    writer.Write(velocity_random_noise_ecef_m_s_[i]);
+  }
+}
+
+void GnssReceiver::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(position_ecef_m_);
+  reader.Read(velocity_ecef_m_s_);
+  reader.Read(geodetic_position_);
+  reader.Read(utc_);
+  reader.Read(gps_time_week_);
+  reader.Read(gps_time_s_);
+  reader.Read(is_gnss_visible_);
+  reader.Read(visible_satellite_number_);
+  reader.Read(gnss_information_list_);
+  for (size_t i = 0; i < 3; i++) {
+    reader.Read(position_random_noise_ecef_m_[i]);
+  }
+  for (size_t i = 0; i < 3; i++) {
+    reader.Read(velocity_random_noise_ecef_m_s_[i]);
+  }
+}
+
 AntennaModel SetAntennaModel(const std::string antenna_model) {
   if (antenna_model == "SIMPLE") {
     return AntennaModel ::kSimple;
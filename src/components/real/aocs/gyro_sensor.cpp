@@ -45,6 +45,18 @@ std::string GyroSensor::GetLogValue() const {
   return str_tmp;
 }
 
+void GyroSensor::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  Sensor<kGyroDimension>::SaveCheckpoint(writer);
+  writer.Write(angular_velocity_c_rad_s_);
+}
+
+void GyroSensor::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  Sensor<kGyroDimension>::LoadCheckpoint(reader);
+  reader.Read(angular_velocity_c_rad_s_);
+}
+
 GyroSensor InitGyroSensor(ClockGenerator* clock_generator, int sensor_id, const std::string file_name, double component_step_time_s,
                           const Dynamics* dynamics) {
   IniAccess gyro_conf(file_name);
@@ -71,6 +71,18 @@ class GyroSensor : public Component, public Sensor<kGyroDimension>, public ILogg
    */
   virtual std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
   /**
    * @fn GetMeasuredAngularVelocity_c_rad_s
    * @brief Return observed angular velocity of the component frame with respect to the inertial frame
@@ -47,6 +47,18 @@ std::string Magnetometer::GetLogValue() const {
   return str_tmp;
 }
 
+void Magnetometer::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  Sensor<kMagnetometerDimension>::SaveCheckpoint(writer);
+  writer.Write(magnetic_field_c_nT_);
+}
+
+void Magnetometer::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  Sensor<kMagnetometerDimension>::LoadCheckpoint(reader);
+  reader.Read(magnetic_field_c_nT_);
+}
+
 Magnetometer InitMagnetometer(ClockGenerator* clock_generator, int sensor_id, const std::string file_name, double component_step_time_s,
                               const GeomagneticField* geomagnetic_field) {
   IniAccess magsensor_conf(file_name);
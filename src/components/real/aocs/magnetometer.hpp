@@ -71,6 +71,18 @@ class Magnetometer : public Component, public Sensor<kMagnetometerDimension>, pu
    */
   virtual std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
   /**
    * @fn GetMeasuredMagneticField_c_nT
    * @brief Return observed magnetic field on the component frame
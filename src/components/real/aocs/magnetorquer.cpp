@@ -111,6 +111,28 @@ std::string Magnetorquer::GetLogValue() const {
   return str_tmp;
 }
 
+void Magnetorquer::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(torque_b_Nm_);
+  writer.Write(output_magnetic_moment_c_Am2_);
+  writer.Write(output_magnetic_moment_b_Am2_);
+  for (size_t i = 0; i < kMtqDimension; i++) {
+    writer.Write(random_noise_c_Am2_[i]);
+  }
+  random_walk_c_Am2_.SaveCheckpoint(writer);
+}
+
+void Magnetorquer::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(torque_b_Nm_);
+  reader.Read(output_magnetic_moment_c_Am2_);
+  reader.Read(output_magnetic_moment_b_Am2_);
+  for (size_t i = 0; i < kMtqDimension; i++) {
+    reader.Read(random_noise_c_Am2_[i]);
+  }
+  random_walk_c_Am2_.LoadCheckpoint(reader);
+}
+
 Magnetorquer InitMagnetorquer(ClockGenerator* clock_generator, int actuator_id, const std::string file_name, double component_step_time_s,
                               const GeomagneticField* geomagnetic_field) {
   IniAccess magtorquer_conf(file_name);
@@ -227,6 +227,38 @@ std::string ReactionWheel::GetLogValue() const {
   return str_tmp;
 }
 
+void ReactionWheel::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(acceleration_delay_buffer_);
+  writer.Write(drive_flag_);
+  writer.Write(target_acceleration_rad_s2_);
+  writer.Write(generated_angular_acceleration_rad_s2_);
+  writer.Write(angular_velocity_rpm_);
+  writer.Write(angular_velocity_rad_s_);
+  writer.Write(output_torque_b_Nm_);
+  writer.Write(angular_momentum_b_Nms_);
+  writer.Write(delayed_acceleration_rad_s2_.GetOutput());
+  ode_angular_velocity_.SaveCheckpoint(writer);
+  rw_jitter_.SaveCheckpoint(writer);
+}
+
+void ReactionWheel::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(acceleration_delay_buffer_);
+  reader.Read(drive_flag_);
+  reader.Read(target_acceleration_rad_s2_);
+  reader.Read(generated_angular_acceleration_rad_s2_);
+  reader.Read(angular_velocity_rpm_);
+  reader.Read(angular_velocity_rad_s_);
+  reader.Read(output_torque_b_Nm_);
+  reader.Read(angular_momentum_b_Nms_);
+  double delayed_acceleration_rad_s2 = 0.0;
+  reader.Read(delayed_acceleration_rad_s2);
+  delayed_acceleration_rad_s2_.SetOutput(delayed_acceleration_rad_s2);
+  ode_angular_velocity_.LoadCheckpoint(reader);
+  rw_jitter_.LoadCheckpoint(reader);
+}
+
 // In order to share processing among initialization functions, variables should also be shared.
 // These variables have internal linkages and cannot be referenced from the outside.
 namespace {
@@ -42,6 +42,55 @@ ReactionWheelJitter::ReactionWheelJitter(std::vector<std::vector<double>> radial
 
 ReactionWheelJitter::~ReactionWheelJitter() {}
 
+void ReactionWheelJitter::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(jitter_force_rotation_phase_);
+  writer.Write(jitter_torque_rotation_phase_);
+  writer.Write(unfiltered_jitter_force_n_c_);
+  writer.Write(unfiltered_jitter_force_n_1_c_);
+  writer.Write(unfiltered_jitter_force_n_2_c_);
+  writer.Write(unfiltered_jitter_torque_n_c_);
+  writer.Write(unfiltered_jitter_torque_n_1_c_);
+  writer.Write(unfiltered_jitter_torque_n_2_c_);
+  writer.Write(filtered_jitter_force_n_c_);
+  writer.Write(filtered_jitter_force_n_1_c_);
+  writer.Write(filtered_jitter_force_n_2_c_);
+  writer.Write(filtered_jitter_torque_n_c_);
+  writer.Write(filtered_jitter_torque_n_1_c_);
+  writer.Write(filtered_jitter_torque_n_2_c_);
+  writer.Write(jitter_force_b_N_);
+  writer.Write(jitter_torque_b_Nm_);
+}
+
+void ReactionWheelJitter::LoadCheckpoint(CheckpointReader& reader) {
+  std::vector<double> jitter_force_rotation_phase;
+  std::vector<double> jitter_torque_rotation_phase;
+  reader.Read(jitter_force_rotation_phase);
+  reader.Read(jitter_torque_rotation_phase);
+  if (!reader.IsGood()) return;
+  if (jitter_force_rotation_phase.size() != jitter_force_rotation_phase_.size() ||
+      jitter_torque_rotation_phase.size() != jitter_torque_rotation_phase_.size()) {
+    // The harmonics coefficients are different from the checkpoint
+    reader.SetFailed();
+    return;
+  }
+  jitter_force_rotation_phase_ = jitter_force_rotation_phase;
+  jitter_torque_rotation_phase_ = jitter_torque_rotation_phase;
+  reader.Read(unfiltered_jitter_force_n_c_);
+  reader.Read(unfiltered_jitter_force_n_1_c_);
+  reader.Read(unfiltered_jitter_force_n_2_c_);
+  reader.Read(unfiltered_jitter_torque_n_c_);
+  reader.Read(unfiltered_jitter_torque_n_1_c_);
+  reader.Read(unfiltered_jitter_torque_n_2_c_);
+  reader.Read(filtered_jitter_force_n_c_);
+  reader.Read(filtered_jitter_force_n_1_c_);
+  reader.Read(filtered_jitter_force_n_2_c_);
+  reader.Read(filtered_jitter_torque_n_c_);
+  reader.Read(filtered_jitter_torque_n_1_c_);
+  reader.Read(filtered_jitter_torque_n_2_c_);
+  reader.Read(jitter_force_b_N_);
+  reader.Read(jitter_torque_b_Nm_);
+}
+
 void ReactionWheelJitter::CalcJitter(double angular_velocity_rad) {
   // Clear jitter in component frame
   unfiltered_jitter_force_n_c_ *= 0.0;
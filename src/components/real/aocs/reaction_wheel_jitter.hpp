@@ -9,13 +9,14 @@
 #pragma once
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <utilities/checkpoint.hpp>
 #include <vector>
 
 /*
  * @class ReactionWheelJitter
  * @brief Class to calculate RW high-frequency jitter effect
  */
-class ReactionWheelJitter {
+class ReactionWheelJitter : public ICheckpointable {
  public:
   /**
    * @fn ReactionWheelJitter
@@ -76,6 +77,19 @@ class ReactionWheelJitter {
     return considers_structural_resonance_ ? filtered_jitter_torque_n_c_ : unfiltered_jitter_torque_n_c_;
   }
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the rotation phases and the histories of the difference equation into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the rotation phases and the histories of the difference equation from the checkpoint
+   * @note The randomly initialized rotation phases are overwritten, so the restored jitter is reproducible
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
  private:
   std::vector<std::vector<double>> radial_force_harmonics_coefficients_;   //!< Coefficients for radial force harmonics
   std::vector<std::vector<double>> radial_torque_harmonics_coefficients_;  //!< Coefficients for radial torque harmonics
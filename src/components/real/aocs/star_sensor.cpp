@@ -198,6 +198,30 @@ std::string StarSensor::GetLogValue() const {
   return str_tmp;
 }
 
+void StarSensor::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(measured_quaternion_i2c_);
+  writer.Write(rotation_noise_);
+  writer.Write(orthogonal_direction_noise_);
+  writer.Write(sight_direction_noise_);
+  writer.Write(delay_buffer_);
+  writer.Write(buffer_position_);
+  writer.Write(update_count_);
+  writer.Write(error_flag_);
+}
+
+void StarSensor::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(measured_quaternion_i2c_);
+  reader.Read(rotation_noise_);
+  reader.Read(orthogonal_direction_noise_);
+  reader.Read(sight_direction_noise_);
+  reader.Read(delay_buffer_);
+  reader.Read(buffer_position_);
+  reader.Read(update_count_);
+  reader.Read(error_flag_);
+}
+
 double StarSensor::CalAngleVector_rad(const Vector<3>& vector1, const Vector<3>& vector2) {
   libra::Vector<3> vect1_normal = vector1.CalcNormalizedVector();
   libra::Vector<3> vect2_normal = vector2.CalcNormalizedVector();
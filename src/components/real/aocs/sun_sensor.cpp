@@ -151,6 +151,30 @@ string SunSensor::GetLogValue() const {
   return str_tmp;
 }
 
+void SunSensor::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(sun_direction_true_c_);
+  writer.Write(measured_sun_direction_c_);
+  writer.Write(alpha_rad_);
+  writer.Write(beta_rad_);
+  writer.Write(solar_illuminance_W_m2_);
+  writer.Write(sun_detected_flag_);
+  writer.Write(random_noise_alpha_);
+  writer.Write(random_noise_beta_);
+}
+
+void SunSensor::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(sun_direction_true_c_);
+  reader.Read(measured_sun_direction_c_);
+  reader.Read(alpha_rad_);
+  reader.Read(beta_rad_);
+  reader.Read(solar_illuminance_W_m2_);
+  reader.Read(sun_detected_flag_);
+  reader.Read(random_noise_alpha_);
+  reader.Read(random_noise_beta_);
+}
+
 SunSensor InitSunSensor(ClockGenerator* clock_generator, int ss_id, std::string file_name, const SolarRadiationPressureEnvironment* srp_environment,
                         const LocalCelestialInformation* local_celestial_information) {
   IniAccess ss_conf(file_name);
@@ -78,6 +78,18 @@ class SunSensor : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
   // Getter
   inline bool GetSunDetectedFlag() const { return sun_detected_flag_; };
   inline const libra::Vector<3> GetMeasuredSunDirection_c() const { return measured_sun_direction_c_; };
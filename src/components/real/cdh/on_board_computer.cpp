@@ -21,6 +21,20 @@ OnBoardComputer::OnBoardComputer(int prescaler, ClockGenerator* clock_generator,
 
 OnBoardComputer::~OnBoardComputer() {}
 
+void OnBoardComputer::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  SaveCheckpointableMap(uart_ports_, writer);
+  SaveCheckpointableMap(i2c_ports_, writer);
+  SaveCheckpointableMap(gpio_ports_, writer);
+}
+
+void OnBoardComputer::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  LoadCheckpointableMap(uart_ports_, reader);
+  LoadCheckpointableMap(i2c_ports_, reader);
+  LoadCheckpointableMap(gpio_ports_, reader);
+}
+
 void OnBoardComputer::Initialize() {}
 
 void OnBoardComputer::MainRoutine(const int time_count) { UNUSED(time_count); }
@@ -186,6 +186,19 @@ class OnBoardComputer : public Component {
    */
   virtual bool GpioComponentRead(int port_id);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the states of the UART, I2C, and GPIO ports into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the states of the UART, I2C, and GPIO ports from the checkpoint
+   * @note The reader is marked as failed when the connected ports are different from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
  protected:
   /**
    * @fn Initialize
@@ -117,6 +117,16 @@ std::string GroundStationCalculator::GetLogValue() const {
   return str_tmp;
 }
 
+void GroundStationCalculator::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(max_bitrate_Mbps_);
+  writer.Write(receive_margin_dB_);
+}
+
+void GroundStationCalculator::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(max_bitrate_Mbps_);
+  reader.Read(receive_margin_dB_);
+}
+
 GroundStationCalculator InitGsCalculator(const std::string file_name) {
   IniAccess gs_conf(file_name);
 
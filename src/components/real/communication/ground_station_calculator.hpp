@@ -12,12 +12,13 @@
 #include <environment/global/global_environment.hpp>
 #include <logger/loggable.hpp>
 #include <simulation/ground_station/ground_station.hpp>
+#include <utilities/checkpoint.hpp>
 
 /*
  * @class GroundStationCalculator
  * @brief Emulation of analysis and calculation for Ground Stations
  */
-class GroundStationCalculator : public ILoggable {
+class GroundStationCalculator : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn GroundStationCalculator
@@ -64,6 +65,18 @@ class GroundStationCalculator : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   // Getter
   /**
    * @fn GetMaxBitrate_Mbps
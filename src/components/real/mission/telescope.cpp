@@ -66,6 +66,34 @@ Telescope::Telescope(ClockGenerator* clock_generator, const libra::Quaternion& q
 
 Telescope::~Telescope() {}
 
+void Telescope::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(is_sun_in_forbidden_angle);
+  writer.Write(is_earth_in_forbidden_angle);
+  writer.Write(is_moon_in_forbidden_angle);
+  writer.Write(sun_position_image_sensor);
+  writer.Write(earth_position_image_sensor);
+  writer.Write(moon_position_image_sensor);
+  writer.Write(ground_position_x_image_sensor_);
+  writer.Write(ground_position_y_image_sensor_);
+  writer.Write(initial_ground_position_ecef_m_);
+  writer.Write(star_list_in_sight);
+}
+
+void Telescope::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(is_sun_in_forbidden_angle);
+  reader.Read(is_earth_in_forbidden_angle);
+  reader.Read(is_moon_in_forbidden_angle);
+  reader.Read(sun_position_image_sensor);
+  reader.Read(earth_position_image_sensor);
+  reader.Read(moon_position_image_sensor);
+  reader.Read(ground_position_x_image_sensor_);
+  reader.Read(ground_position_y_image_sensor_);
+  reader.Read(initial_ground_position_ecef_m_);
+  reader.Read(star_list_in_sight);
+}
+
 void Telescope::MainRoutine(const int time_count) {
   UNUSED(time_count);
   // Check forbidden angle
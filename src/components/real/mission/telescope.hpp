@@ -65,6 +65,18 @@ class Telescope : public Component, public ILoggable {
   inline bool GetIsEarthInForbiddenAngle() const { return is_earth_in_forbidden_angle; }
   inline bool GetIsMoonInForbiddenAngle() const { return is_moon_in_forbidden_angle; }
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the observation results and the initial ground position into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the observation results and the initial ground position from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
  protected:
  private:
   libra::Quaternion quaternion_b2c_;    //!< Quaternion from the body frame to component frame
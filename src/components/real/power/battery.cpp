@@ -68,6 +68,20 @@ std::string Battery::GetLogValue() const {
   return str_tmp;
 }
 
+void Battery::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(battery_voltage_V_);
+  writer.Write(depth_of_discharge_percent_);
+  writer.Write(charge_current_A_);
+}
+
+void Battery::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(battery_voltage_V_);
+  reader.Read(depth_of_discharge_percent_);
+  reader.Read(charge_current_A_);
+}
+
 void Battery::MainRoutine(const int time_count) {
   UNUSED(time_count);
 
@@ -107,6 +107,18 @@ class Battery : public Component, public ILoggable {
    */
   std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
  private:
   const int number_of_series_;                                   //!< Number of series connected cells
   const int number_of_parallel_;                                 //!< Number of parallel connected cells
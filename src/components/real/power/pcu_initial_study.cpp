@@ -35,6 +35,18 @@ PcuInitialStudy::PcuInitialStudy(ClockGenerator* clock_generator, const std::vec
 
 PcuInitialStudy::~PcuInitialStudy() {}
 
+void PcuInitialStudy::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(bus_voltage_V_);
+  writer.Write(power_consumption_W_);
+}
+
+void PcuInitialStudy::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(bus_voltage_V_);
+  reader.Read(power_consumption_W_);
+}
+
 std::string PcuInitialStudy::GetLogHeader() const {
   std::string str_tmp = "";
   std::string component_name = "pcu_initial_study_";
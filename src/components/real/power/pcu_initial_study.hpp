@@ -52,6 +52,18 @@ class PcuInitialStudy : public Component, public ILoggable {
    */
   std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the bus voltage and the power consumption into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the bus voltage and the power consumption from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
  private:
   const std::vector<SolarArrayPanel*> saps_;  //!< Solar Array Panels
   Battery* const battery_;                    //!< Battery
@@ -10,6 +10,16 @@ PowerControlUnit::PowerControlUnit(int prescaler, ClockGenerator* clock_generato
 
 PowerControlUnit::~PowerControlUnit() {}
 
+void PowerControlUnit::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  SaveCheckpointableMap(power_ports_, writer);
+}
+
+void PowerControlUnit::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  LoadCheckpointableMap(power_ports_, reader);
+}
+
 void PowerControlUnit::MainRoutine(const int time_count) {
   UNUSED(time_count);
 
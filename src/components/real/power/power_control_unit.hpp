@@ -56,6 +56,19 @@ class PowerControlUnit : public Component, public ILoggable {
    */
   std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the states of the connected power ports into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the states of the connected power ports from the checkpoint
+   * @note The reader is marked as failed when the connected ports are different from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
   /**
    * @fn GetPowerPort
    * @brief Return power port information
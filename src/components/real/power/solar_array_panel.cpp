@@ -82,6 +82,18 @@ SolarArrayPanel::SolarArrayPanel(const SolarArrayPanel& obj)
 
 SolarArrayPanel::~SolarArrayPanel() {}
 
+void SolarArrayPanel::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(voltage_V_);
+  writer.Write(power_generation_W_);
+}
+
+void SolarArrayPanel::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(voltage_V_);
+  reader.Read(power_generation_W_);
+}
+
 std::string SolarArrayPanel::GetLogHeader() const {
   std::string str_tmp = "";
   std::string component_name = "sap" + std::to_string(component_id_) + "_";
@@ -106,6 +106,18 @@ class SolarArrayPanel : public Component, public ILoggable {
    */
   std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the voltage and the generated power into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the voltage and the generated power from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
  private:
   const int component_id_;                //!< SolarArrayPanel ID TODO: Use string?
   const int number_of_series_;            //!< Number of series connected solar cells
@@ -45,6 +45,7 @@ SimpleThruster::~SimpleThruster() {}
 void SimpleThruster::Initialize(const double magnitude_standard_deviation_N, const double direction_standard_deviation_rad) {
   magnitude_random_noise_.SetParameters(0.0, magnitude_standard_deviation_N);
   direction_random_noise_.SetParameters(0.0, direction_standard_deviation_rad);
+  axis_rotation_random_.Initialize(global_randomization.MakeSeed());
   thrust_direction_b_ = thrust_direction_b_.CalcNormalizedVector();
 }
 
@@ -93,6 +94,26 @@ std::string SimpleThruster::GetLogValue() const {
   return str_tmp;
 }
 
+void SimpleThruster::SaveCheckpoint(CheckpointWriter& writer) const {
+  Component::SaveCheckpoint(writer);
+  writer.Write(duty_);
+  writer.Write(magnitude_random_noise_);
+  writer.Write(direction_random_noise_);
+  writer.Write(axis_rotation_random_);
+  writer.Write(output_thrust_b_N_);
+  writer.Write(output_torque_b_Nm_);
+}
+
+void SimpleThruster::LoadCheckpoint(CheckpointReader& reader) {
+  Component::LoadCheckpoint(reader);
+  reader.Read(duty_);
+  reader.Read(magnitude_random_noise_);
+  reader.Read(direction_random_noise_);
+  reader.Read(axis_rotation_random_);
+  reader.Read(output_thrust_b_N_);
+  reader.Read(output_torque_b_Nm_);
+}
+
 double SimpleThruster::CalcThrustMagnitude() { return duty_ * thrust_magnitude_max_N_; }
 
 libra::Vector<3> SimpleThruster::CalcThrustDirection() {
@@ -102,13 +123,8 @@ libra::Vector<3> SimpleThruster::CalcThrustDirection() {
     ex[0] = 1.0;
     ex[1] = 0.0;
     ex[2] = 0.0;
-    int flag = rand() % 2;
-    double make_axis_rot_rad;
-    if (flag == 0) {
-      make_axis_rot_rad = libra::pi * (double)rand() / RAND_MAX;
-    } else {
-      make_axis_rot_rad = -libra::pi * (double)rand() / RAND_MAX;
-    }
+    // The generator is held by each thruster to keep the result independent of the update order of the spacecraft
+    double make_axis_rot_rad = libra::pi * (2.0 * (double)axis_rotation_random_ - 1.0);
 
     libra::Quaternion make_axis_rot(thrust_dir_b_true, make_axis_rot_rad);
     libra::Vector<3> axis_rot = make_axis_rot.FrameConversion(ex);
@@ -10,6 +10,7 @@
 #include <logger/logger.hpp>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <math_physics/randomization/minimal_standard_linear_congruential_generator.hpp>
 #include <math_physics/randomization/normal_randomization.hpp>
 #include <simulation/spacecraft/structure/structure.hpp>
 
@@ -87,6 +88,18 @@ class SimpleThruster : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) override;
+
   // Getter
   /**
    * @fn GetOutputThrust_b_N
@@ -116,6 +129,7 @@ class SimpleThruster : public Component, public ILoggable {
   double direction_noise_standard_deviation_rad_ = 0.0;  //!< Standard deviation of thrust direction error [rad]
   libra::NormalRand magnitude_random_noise_;             //!< Normal random for thrust magnitude error
   libra::NormalRand direction_random_noise_;             //!< Normal random for thrust direction error
+  libra::MinimalStandardLcg axis_rotation_random_;       //!< Uniform random for the rotation axis of the thrust direction error
   // outputs
   Vector<3> output_thrust_b_N_{0.0};   //!< Generated thrust on the body fixed frame [N]
   Vector<3> output_torque_b_Nm_{0.0};  //!< Generated torque on the body fixed frame [Nm]
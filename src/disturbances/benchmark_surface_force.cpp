@@ -0,0 +1,84 @@
+/**
+ * @file benchmark_surface_force.cpp
+ * @brief Benchmark codes for SurfaceForce class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "air_drag.hpp"
+#include "solar_radiation_pressure_disturbance.hpp"
+
+namespace {
+/**
+ * @class SurfaceForceBenchmark
+ * @brief Surface force which exposes the force and torque calculation without the environment and the dynamics
+ */
+template <class Force>
+class SurfaceForceBenchmark : public Force {
+ public:
+  using Force::Force;
+  using SurfaceForce::CalcTorqueForce;
+};
+
+/**
+ * @brief Make the surfaces of a box spacecraft with two solar panels
+ */
+std::vector<Surface> MakeSurfaces() {
+  std::vector<Surface> surfaces;
+  for (size_t axis = 0; axis < 3; axis++) {
+    for (const double sign : {1.0, -1.0}) {
+      libra::Vector<3> normal_b(0.0);
+      normal_b[axis] = sign;
+      surfaces.push_back(Surface(0.5 * normal_b, normal_b, 1.0, 0.3, 0.2, 0.1));
+    }
+  }
+  for (const double sign : {1.0, -1.0}) {
+    libra::Vector<3> position_b_m(0.0);
+    position_b_m[1] = 1.5 * sign;
+    libra::Vector<3> normal_b(0.0);
+    normal_b[2] = sign;
+    surfaces.push_back(Surface(position_b_m, normal_b, 2.0, 0.2, 0.4, 0.1));
+  }
+  return surfaces;
+}
+
+/**
+ * @brief Make a direction of the disturbance source which is seen by several surfaces
+ */
+libra::Vector<3> MakeDirection() {
+  libra::Vector<3> direction_b;
+  direction_b[0] = 0.6;
+  direction_b[1] = -0.3;
+  direction_b[2] = 0.74;
+  return direction_b;
+}
+}  // namespace
+
+/**
+ * @brief Benchmark of the air drag force and torque calculation
+ */
+static void BM_SurfaceForceAirDrag(benchmark::State& state) {
+  const std::vector<Surface> surfaces = MakeSurfaces();
+  const libra::Vector<3> center_of_gravity_b_m(0.01);
+  SurfaceForceBenchmark<AirDrag> air_drag(surfaces, center_of_gravity_b_m, 30.0, 3.0, 18.0);
+  libra::Vector<3> velocity_b_m_s = 7500.0 * MakeDirection();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(air_drag.CalcTorqueForce(velocity_b_m_s, 1.0e-12));
+  }
+}
+BENCHMARK(BM_SurfaceForceAirDrag);
+
+/**
+ * @brief Benchmark of the solar radiation pressure force and torque calculation
+ */
+static void BM_SurfaceForceSolarRadiationPressure(benchmark::State& state) {
+  const std::vector<Surface> surfaces = MakeSurfaces();
+  const libra::Vector<3> center_of_gravity_b_m(0.01);
+  SurfaceForceBenchmark<SolarRadiationPressureDisturbance> solar_radiation_pressure(surfaces, center_of_gravity_b_m);
+  libra::Vector<3> sun_direction_b = MakeDirection();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(solar_radiation_pressure.CalcTorqueForce(sun_direction_b, 4.5e-6));
+  }
+}
+BENCHMARK(BM_SurfaceForceSolarRadiationPressure);
@@ -7,13 +7,16 @@
 #define S2E_DISTURBANCES_DISTURBANCE_HPP_
 
 #include "../environment/local/local_environment.hpp"
+#include "../math_physics/math/matrix.hpp"
 #include "../math_physics/math/vector.hpp"
+#include "../utilities/checkpoint.hpp"
+#include "../utilities/execution_cost.hpp"
 
 /**
  * @class Disturbance
  * @brief Base class for a disturbance
  */
-class Disturbance : public ILoggable {
+class Disturbance : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn Disturbance
@@ -27,6 +30,7 @@ class Disturbance : public ILoggable {
     torque_b_Nm_ = libra::Vector<3>(0.0);
     acceleration_i_m_s2_ = libra::Vector<3>(0.0);
     acceleration_b_m_s2_ = libra::Vector<3>(0.0);
+    acceleration_partial_derivative_i_s2_ = libra::Matrix<3, 3>(0.0);
   }
 
   /**
@@ -41,12 +45,14 @@ class Disturbance : public ILoggable {
    */
   virtual inline void UpdateIfEnabled(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
     if (is_calculation_enabled_) {
+      ScopedExecutionCost scoped_cost(update_cost_);
       Update(local_environment, dynamics);
     } else {
       force_b_N_ *= 0.0;
       torque_b_Nm_ *= 0.0;
       acceleration_b_m_s2_ *= 0.0;
       acceleration_i_m_s2_ *= 0.0;
+      acceleration_partial_derivative_i_s2_ *= 0.0;
     }
   }
 
@@ -76,19 +82,58 @@ class Disturbance : public ILoggable {
    * @brief Return the disturbance acceleration in the inertial frame [m/s2]
    */
   virtual inline libra::Vector<3> GetAcceleration_i_m_s2() { return acceleration_i_m_s2_; }
+  /**
+   * @fn GetAccelerationPartialDerivative_i_s2
+   * @brief Return the partial derivative of the disturbance acceleration with respect to the position in the inertial frame [1/s2]
+   * @note Calculated only when the state transition matrix calculation of the orbit is enabled
+   */
+  virtual inline libra::Matrix<3, 3> GetAccelerationPartialDerivative_i_s2() { return acceleration_partial_derivative_i_s2_; }
   /**
    * @fn IsAttitudeDependent
    * @brief Return the attitude dependent flag
    */
   virtual inline bool IsAttitudeDependent() { return is_attitude_dependent_; }
+  /**
+   * @fn GetUpdateCost
+   * @brief Return measured execution cost of the disturbance calculation
+   */
+  inline const ExecutionCost& GetUpdateCost() const { return update_cost_; }
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the calculated disturbance values into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const {
+    writer.Write(force_b_N_);
+    writer.Write(torque_b_Nm_);
+    writer.Write(acceleration_b_m_s2_);
+    writer.Write(acceleration_i_m_s2_);
+    writer.Write(acceleration_partial_derivative_i_s2_);
+  }
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the calculated disturbance values from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) {
+    reader.Read(force_b_N_);
+    reader.Read(torque_b_Nm_);
+    reader.Read(acceleration_b_m_s2_);
+    reader.Read(acceleration_i_m_s2_);
+    reader.Read(acceleration_partial_derivative_i_s2_);
+  }
 
  protected:
-  bool is_calculation_enabled_;           //!< Flag to calculate the disturbance
-  bool is_attitude_dependent_;            //!< Flag to show the disturbance depends on attitude information
-  libra::Vector<3> force_b_N_;            //!< Disturbance force in the body frame [N]
-  libra::Vector<3> torque_b_Nm_;          //!< Disturbance torque in the body frame [Nm]
-  libra::Vector<3> acceleration_b_m_s2_;  //!< Disturbance acceleration in the body frame [m/s2]
-  libra::Vector<3> acceleration_i_m_s2_;  //!< Disturbance acceleration in the inertial frame [m/s2]
+  bool is_calculation_enabled_;                               //!< Flag to calculate the disturbance
+  bool is_attitude_dependent_;                                //!< Flag to show the disturbance depends on attitude information
+  libra::Vector<3> force_b_N_;                                //!< Disturbance force in the body frame [N]
+  libra::Vector<3> torque_b_Nm_;                              //!< Disturbance torque in the body frame [Nm]
+  libra::Vector<3> acceleration_b_m_s2_;                      //!< Disturbance acceleration in the body frame [m/s2]
+  libra::Vector<3> acceleration_i_m_s2_;                      //!< Disturbance acceleration in the inertial frame [m/s2]
+  libra::Matrix<3, 3> acceleration_partial_derivative_i_s2_;  //!< Partial derivative of the acceleration in the inertial frame [1/s2]
+
+ private:
+  ExecutionCost update_cost_;  //!< Execution cost of the disturbance calculation
 };
 
 #endif  // S2E_DISTURBANCES_DISTURBANCE_HPP_
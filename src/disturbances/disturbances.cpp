@@ -6,6 +6,9 @@
 #include "disturbances.hpp"
 
 #include <setting_file_reader/initialize_file_access.hpp>
+#include <typeinfo>
+#include <utilities/allocation_tracker.hpp>
+#include <utilities/profiler.hpp>
 
 #include "air_drag.hpp"
 #include "geopotential.hpp"
@@ -33,6 +36,8 @@ void Disturbances::Update(const LocalEnvironment& local_environment, const Dynam
   InitializeAcceleration();
 
   for (auto disturbance : disturbances_list_) {
+    PROFILE_SCOPE(typeid(*disturbance).name());
+    ALLOCATION_SCOPE(typeid(*disturbance).name());
     if (simulation_time->GetOrbitPropagateFlag()) {
       // Update disturbances that depend only on the position
       disturbance->UpdateIfEnabled(local_environment, dynamics);
@@ -45,6 +50,7 @@ void Disturbances::Update(const LocalEnvironment& local_environment, const Dynam
     total_torque_b_Nm_ += disturbance->GetTorque_b_Nm();
     total_force_b_N_ += disturbance->GetForce_b_N();
     total_acceleration_i_m_s2_ += disturbance->GetAcceleration_i_m_s2();
+    total_acceleration_partial_derivative_i_s2_ += disturbance->GetAccelerationPartialDerivative_i_s2();
   }
 }
 
@@ -55,6 +61,18 @@ void Disturbances::LogSetup(Logger& logger) {
   logger.CopyFileToLogDirectory(initialize_file_name_);
 }
 
+void Disturbances::SaveCheckpoint(CheckpointWriter& writer) const {
+  for (auto disturbance : disturbances_list_) {
+    disturbance->SaveCheckpoint(writer);
+  }
+}
+
+void Disturbances::LoadCheckpoint(CheckpointReader& reader) {
+  for (auto disturbance : disturbances_list_) {
+    disturbance->LoadCheckpoint(reader);
+  }
+}
+
 void Disturbances::InitializeInstances(const SimulationConfiguration* simulation_configuration, const int spacecraft_id, const Structure* structure,
                                        const GlobalEnvironment* global_environment) {
   IniAccess ini_access = IniAccess(simulation_configuration->spacecraft_file_list_[spacecraft_id]);
@@ -95,4 +113,7 @@ void Disturbances::InitializeForceAndTorque() {
   total_force_b_N_ = Vector<3>(0.0);
 }
 
-void Disturbances::InitializeAcceleration() { total_acceleration_i_m_s2_ = Vector<3>(0.0); }
+void Disturbances::InitializeAcceleration() {
+  total_acceleration_i_m_s2_ = Vector<3>(0.0);
+  total_acceleration_partial_derivative_i_s2_ = libra::Matrix<3, 3>(0.0);
+}
@@ -10,6 +10,7 @@
 
 #include "../environment/global/simulation_time.hpp"
 #include "../simulation/spacecraft/structure/structure.hpp"
+#include "../utilities/checkpoint.hpp"
 #include "disturbance.hpp"
 
 class Logger;
@@ -18,7 +19,7 @@ class Logger;
  * @class Disturbances
  * @brief Class to manage all disturbances
  */
-class Disturbances {
+class Disturbances : public ICheckpointable {
  public:
   /**
    * @fn Disturbances
@@ -51,6 +52,18 @@ class Disturbances {
    */
   void LogSetup(Logger& logger);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the states of all disturbances into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the states of all disturbances from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   /**
    * @fn GetTorque
    * @brief Return total disturbance torque in the body frame [Nm]
@@ -69,13 +82,26 @@ class Disturbances {
    */
   inline libra::Vector<3> GetAcceleration_i_m_s2() { return total_acceleration_i_m_s2_; }
 
+  /**
+   * @fn GetAccelerationPartialDerivative_i_s2
+   * @brief Return total partial derivative of the disturbance acceleration with respect to the position in the inertial frame [1/s2]
+   */
+  inline libra::Matrix<3, 3> GetAccelerationPartialDerivative_i_s2() { return total_acceleration_partial_derivative_i_s2_; }
+
+  /**
+   * @fn GetDisturbanceList
+   * @brief Return list of the disturbances
+   */
+  inline const std::vector<Disturbance*>& GetDisturbanceList() const { return disturbances_list_; }
+
  private:
   std::string initialize_file_name_;  //!< Initialization file name
 
-  std::vector<Disturbance*> disturbances_list_;  //!< List of disturbances
-  Vector<3> total_torque_b_Nm_;                  //!< Total disturbance torque in the body frame [Nm]
-  Vector<3> total_force_b_N_;                    //!< Total disturbance force in the body frame [N]
-  Vector<3> total_acceleration_i_m_s2_;          //!< Total disturbance acceleration in the inertial frame [m/s2]
+  std::vector<Disturbance*> disturbances_list_;                     //!< List of disturbances
+  Vector<3> total_torque_b_Nm_;                                     //!< Total disturbance torque in the body frame [Nm]
+  Vector<3> total_force_b_N_;                                       //!< Total disturbance force in the body frame [N]
+  Vector<3> total_acceleration_i_m_s2_;                             //!< Total disturbance acceleration in the inertial frame [m/s2]
+  libra::Matrix<3, 3> total_acceleration_partial_derivative_i_s2_;  //!< Total partial derivative of the acceleration [1/s2]
 
   /**
    * @fn InitializeInstances
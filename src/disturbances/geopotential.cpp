@@ -86,6 +86,12 @@ void Geopotential::Update(const LocalEnvironment &local_environment, const Dynam
   libra::Matrix<3, 3> trans_eci2ecef_ = local_environment.GetCelestialInformation().GetGlobalInformation().GetEarthRotation().GetDcmJ2000ToEcef();
   libra::Matrix<3, 3> trans_ecef2eci = trans_eci2ecef_.Transpose();
   acceleration_i_m_s2_ = trans_ecef2eci * acceleration_ecef_m_s2_;
+
+  // Partial derivative for the variational equation of the orbit
+  if (dynamics.GetOrbit().GetIsStmCalcEnabled()) {
+    libra::Matrix<3, 3> partial_derivative_ecef_s2 = geopotential_.CalcPartialDerivative_xcxf_s2(dynamics.GetOrbit().GetPosition_ecef_m());
+    acceleration_partial_derivative_i_s2_ = trans_ecef2eci * partial_derivative_ecef_s2 * trans_eci2ecef_;
+  }
 }
 
 std::string Geopotential::GetLogHeader() const {
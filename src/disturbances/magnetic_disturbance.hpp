@@ -10,6 +10,8 @@
 
 #include "../logger/loggable.hpp"
 #include "../math_physics/math/vector.hpp"
+#include "../math_physics/randomization/normal_randomization.hpp"
+#include "../math_physics/randomization/random_walk.hpp"
 #include "../simulation/spacecraft/structure/residual_magnetic_moment.hpp"
 #include "disturbance.hpp"
 
@@ -47,11 +49,25 @@ class MagneticDisturbance : public Disturbance {
    */
   virtual std::string GetLogValue() const;
 
+  // Override Disturbance
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the calculated torque, the RMM, and the noise state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the calculated torque, the RMM, and the noise state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   const double kMagUnit_ = 1.0e-9;  //!< Constant value to change the unit [nT] -> [T]
 
   libra::Vector<3> rmm_b_Am2_;                              //!< True RMM of the spacecraft in the body frame [Am2]
   const ResidualMagneticMoment& residual_magnetic_moment_;  //!< RMM parameters
+  RandomWalk<3> random_walk_;                               //!< Random walk of the RMM [FIXME] step width is constant
+  libra::NormalRand normal_random_;                         //!< White noise of the RMM
 
   /**
    * @fn CalcRMM
@@ -16,6 +16,8 @@ ThirdBodyGravity::~ThirdBodyGravity() {}
 
 void ThirdBodyGravity::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
   acceleration_i_m_s2_ = libra::Vector<3>(0.0);  // initialize
+  acceleration_partial_derivative_i_s2_ = libra::Matrix<3, 3>(0.0);
+  const bool is_partial_derivative_calc_enabled = dynamics.GetOrbit().GetIsStmCalcEnabled();
 
   libra::Vector<3> sc_position_i_m = dynamics.GetOrbit().GetPosition_i_m();
   for (auto third_body : third_body_list_) {
@@ -25,6 +27,9 @@ void ThirdBodyGravity::Update(const LocalEnvironment& local_environment, const D
 
     third_body_acceleration_i_m_s2_ = CalcAcceleration_i_m_s2(third_body_pos_i_m, third_body_position_from_sc_i_m, gravity_constant);
     acceleration_i_m_s2_ += third_body_acceleration_i_m_s2_;
+    if (is_partial_derivative_calc_enabled) {
+      acceleration_partial_derivative_i_s2_ += CalcPartialDerivative_i_s2(third_body_position_from_sc_i_m, gravity_constant);
+    }
   }
 }
 
@@ -42,6 +47,25 @@ libra::Vector<3> ThirdBodyGravity::CalcAcceleration_i_m_s2(const libra::Vector<3
   return acceleration_i_m_s2;
 }
 
+libra::Matrix<3, 3> ThirdBodyGravity::CalcPartialDerivative_i_s2(const libra::Vector<3> sr, const double gravity_constant_m_s2) {
+  libra::Matrix<3, 3> partial_derivative_i_s2;
+
+  double sr_norm = sr.CalcNorm();
+  double sr_norm2 = sr_norm * sr_norm;
+  double sr_norm3 = sr_norm2 * sr_norm;
+
+  // d/dr [GM * sr / |sr|^3] with sr = s - r
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      partial_derivative_i_s2[i][j] = 3.0 * sr[i] * sr[j] / sr_norm2;
+    }
+    partial_derivative_i_s2[i][i] -= 1.0;
+  }
+  partial_derivative_i_s2 *= gravity_constant_m_s2 / sr_norm3;
+
+  return partial_derivative_i_s2;
+}
+
 std::string ThirdBodyGravity::GetLogHeader() const {
   std::string str_tmp = "";
   str_tmp += WriteVector("third_body_acceleration", "i", "m/s2", 3);
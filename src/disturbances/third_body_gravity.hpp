@@ -11,6 +11,7 @@
 #include <string>
 
 #include "../logger/loggable.hpp"
+#include "../math_physics/math/matrix.hpp"
 #include "../math_physics/math/vector.hpp"
 #include "disturbance.hpp"
 
@@ -41,6 +42,24 @@ class ThirdBodyGravity : public Disturbance {
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
 
+  /**
+   * @fn CalcAcceleration_i_m_s2
+   * @brief Calculate and return the third body disturbance acceleration
+   * @param [in] s: Position vector of the third celestial body from the origin in the inertial frame in unit [m]
+   * @param [in] sr: Position vector of the third celestial body from the spacecraft in the inertial frame in unit [m]
+   * @param [in] GM: The gravitational constants of the third celestial body [m3/s2]
+   * @return Third body disturbance acceleration in the inertial frame in unit [m/s2]
+   */
+  libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3> s, const libra::Vector<3> sr, const double gravity_constant_m_s2);
+  /**
+   * @fn CalcPartialDerivative_i_s2
+   * @brief Calculate and return the partial derivative of the third body disturbance acceleration with respect to the spacecraft position
+   * @param [in] sr: Position vector of the third celestial body from the spacecraft in the inertial frame in unit [m]
+   * @param [in] GM: The gravitational constants of the third celestial body [m3/s2]
+   * @return Partial derivative of the third body disturbance acceleration in the inertial frame in unit [1/s2]
+   */
+  libra::Matrix<3, 3> CalcPartialDerivative_i_s2(const libra::Vector<3> sr, const double gravity_constant_m_s2);
+
  private:
   std::set<std::string> third_body_list_;                 //!< List of celestial bodies to calculate the third body disturbances
   libra::Vector<3> third_body_acceleration_i_m_s2_{0.0};  //!< Calculated third body disturbance acceleration in the inertial frame [m/s2]
@@ -56,16 +75,6 @@ class ThirdBodyGravity : public Disturbance {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
-
-  /**
-   * @fn CalcAcceleration_i_m_s2
-   * @brief Calculate and return the third body disturbance acceleration
-   * @param [in] s: Position vector of the third celestial body from the origin in the inertial frame in unit [m]
-   * @param [in] sr: Position vector of the third celestial body from the spacecraft in the inertial frame in unit [m]
-   * @param [in] GM: The gravitational constants of the third celestial body [m3/s2]
-   * @return Third body disturbance acceleration in the inertial frame in unit [m/s2]
-   */
-  libra::Vector<3> CalcAcceleration_i_m_s2(const libra::Vector<3> s, const libra::Vector<3> sr, const double gravity_constant_m_s2);
 };
 
 /**
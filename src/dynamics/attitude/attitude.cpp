@@ -43,6 +43,32 @@ std::string Attitude::GetLogValue() const {
   return str_tmp;
 }
 
+void Attitude::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(is_calc_enabled_);
+  writer.Write(angular_velocity_b_rad_s_);
+  writer.Write(quaternion_i2b_);
+  writer.Write(torque_b_Nm_);
+  writer.Write(angular_momentum_spacecraft_b_Nms_);
+  writer.Write(angular_momentum_reaction_wheel_b_Nms_);
+  writer.Write(angular_momentum_total_b_Nms_);
+  writer.Write(angular_momentum_total_i_Nms_);
+  writer.Write(angular_momentum_total_Nms_);
+  writer.Write(kinetic_energy_J_);
+}
+
+void Attitude::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(is_calc_enabled_);
+  reader.Read(angular_velocity_b_rad_s_);
+  reader.Read(quaternion_i2b_);
+  reader.Read(torque_b_Nm_);
+  reader.Read(angular_momentum_spacecraft_b_Nms_);
+  reader.Read(angular_momentum_reaction_wheel_b_Nms_);
+  reader.Read(angular_momentum_total_b_Nms_);
+  reader.Read(angular_momentum_total_i_Nms_);
+  reader.Read(angular_momentum_total_Nms_);
+  reader.Read(kinetic_energy_J_);
+}
+
 void Attitude::SetParameters(const MonteCarloSimulationExecutor& mc_simulator) {
   GetInitializedMonteCarloParameterQuaternion(mc_simulator, "quaternion_i2b", quaternion_i2b_);
 }
@@ -11,12 +11,13 @@
 #include <math_physics/math/quaternion.hpp>
 #include <simulation/monte_carlo_simulation/simulation_object.hpp>
 #include <string>
+#include <utilities/checkpoint.hpp>
 
 /**
  * @class Attitude
  * @brief Base class for attitude of spacecraft
  */
-class Attitude : public ILoggable, public SimulationObject {
+class Attitude : public ILoggable, public SimulationObject, public ICheckpointable {
  public:
   /**
    * @fn Attitude
@@ -110,6 +111,18 @@ class Attitude : public ILoggable, public SimulationObject {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the attitude state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the attitude state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   // SimulationObject for McSim
   virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
 
@@ -56,6 +56,18 @@ void AttitudeRk4::Propagate(const double end_time_s) {
   CalcAngularMomentum();
 }
 
+void AttitudeRk4::SaveCheckpoint(CheckpointWriter& writer) const {
+  Attitude::SaveCheckpoint(writer);
+  writer.Write(current_propagation_time_s_);
+  writer.Write(previous_inertia_tensor_kgm2_);
+}
+
+void AttitudeRk4::LoadCheckpoint(CheckpointReader& reader) {
+  Attitude::LoadCheckpoint(reader);
+  reader.Read(current_propagation_time_s_);
+  reader.Read(previous_inertia_tensor_kgm2_);
+}
+
 libra::Vector<7> AttitudeRk4::AttitudeDynamicsAndKinematics(libra::Vector<7> x, double t) {
   UNUSED(t);
 
@@ -40,6 +40,17 @@ class AttitudeRk4 : public Attitude {
    */
   virtual void Propagate(const double end_time_s);
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the attitude state and the propagation time into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the attitude state and the propagation time from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   /**
    * @fn SetParameters
    * @brief Set parameters for Monte-Carlo simulation
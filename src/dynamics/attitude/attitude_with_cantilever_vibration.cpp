@@ -99,3 +99,21 @@ void AttitudeWithCantileverVibration::Propagate(const double end_time_s) {
   attitude_ode_.SetPreviousInertiaTensor_kgm2(inertia_tensor_kgm2_);
   CalcAngularMomentum();
 }
+
+void AttitudeWithCantileverVibration::SaveCheckpoint(CheckpointWriter& writer) const {
+  Attitude::SaveCheckpoint(writer);
+  writer.Write(current_propagation_time_s_);
+  writer.Write(angular_velocity_cantilever_rad_s_);
+  writer.Write(euler_angular_cantilever_rad_);
+  writer.Write(attitude_ode_.GetPreviousInertiaTensor_kgm2());
+}
+
+void AttitudeWithCantileverVibration::LoadCheckpoint(CheckpointReader& reader) {
+  Attitude::LoadCheckpoint(reader);
+  reader.Read(current_propagation_time_s_);
+  reader.Read(angular_velocity_cantilever_rad_s_);
+  reader.Read(euler_angular_cantilever_rad_);
+  libra::Matrix<3, 3> previous_inertia_tensor_kgm2;
+  reader.Read(previous_inertia_tensor_kgm2);
+  attitude_ode_.SetPreviousInertiaTensor_kgm2(previous_inertia_tensor_kgm2);
+}
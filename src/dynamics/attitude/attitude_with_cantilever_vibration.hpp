@@ -61,6 +61,17 @@ class AttitudeWithCantileverVibration : public Attitude {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the attitude state, the cantilever state, and the propagation time into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the attitude state, the cantilever state, and the propagation time from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   /**
    * @fn SetParameters
    * @brief Set parameters for Monte-Carlo simulation
@@ -73,6 +73,28 @@ void ControlledAttitude::Propagate(const double end_time_s) {
   return;
 }
 
+void ControlledAttitude::SaveCheckpoint(CheckpointWriter& writer) const {
+  Attitude::SaveCheckpoint(writer);
+  writer.Write(main_mode_);
+  writer.Write(sub_mode_);
+  writer.Write(main_target_direction_b_);
+  writer.Write(sub_target_direction_b_);
+  writer.Write(previous_calc_time_s_);
+  writer.Write(previous_quaternion_i2b_);
+  writer.Write(previous_omega_b_rad_s_);
+}
+
+void ControlledAttitude::LoadCheckpoint(CheckpointReader& reader) {
+  Attitude::LoadCheckpoint(reader);
+  reader.Read(main_mode_);
+  reader.Read(sub_mode_);
+  reader.Read(main_target_direction_b_);
+  reader.Read(sub_target_direction_b_);
+  reader.Read(previous_calc_time_s_);
+  reader.Read(previous_quaternion_i2b_);
+  reader.Read(previous_omega_b_rad_s_);
+}
+
 libra::Vector<3> ControlledAttitude::CalcTargetDirection_i(AttitudeControlMode mode) {
   libra::Vector<3> direction;
   if (mode == AttitudeControlMode::kSunPointing) {
@@ -98,6 +98,17 @@ class ControlledAttitude : public Attitude {
    */
   virtual void Propagate(const double end_time_s);
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the attitude state, the control mode, and the previous attitude into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the attitude state, the control mode, and the previous attitude from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   AttitudeControlMode main_mode_;              //!< Main control mode
   AttitudeControlMode sub_mode_;               //!< Sub control mode
@@ -0,0 +1,84 @@
+/**
+ * @file ephemeris_attitude.cpp
+ * @brief Class to replay spacecraft attitude from a precomputed ephemeris file
+ */
+
+#include "ephemeris_attitude.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+/**
+ * @fn ConcatenateColumnNames
+ * @brief Return the quaternion column names followed by the angular velocity column names
+ */
+static std::vector<std::string> ConcatenateColumnNames(const std::vector<std::string>& quaternion_column_names,
+                                                       const std::vector<std::string>& angular_velocity_column_names) {
+  std::vector<std::string> column_names = quaternion_column_names;
+  column_names.insert(column_names.end(), angular_velocity_column_names.begin(), angular_velocity_column_names.end());
+  return column_names;
+}
+
+EphemerisAttitude::EphemerisAttitude(const libra::Matrix<3, 3>& inertia_tensor_kgm2, const std::string file_name, const std::string time_column_name,
+                                     const std::vector<std::string> quaternion_column_names,
+                                     const std::vector<std::string> angular_velocity_column_names, const size_t number_of_interpolation_points,
+                                     const double time_offset_s, const double propagation_step_s, const std::string& simulation_object_name)
+    : Attitude(inertia_tensor_kgm2, simulation_object_name),
+      ephemeris_(file_name, time_column_name, ConcatenateColumnNames(quaternion_column_names, angular_velocity_column_names)),
+      number_of_interpolation_points_(number_of_interpolation_points),
+      time_offset_s_(time_offset_s) {
+  propagation_step_s_ = propagation_step_s;
+
+  if (!ephemeris_.IsOpened() || quaternion_column_names.size() != 4 || angular_velocity_column_names.size() != 3) {
+    std::cerr << "[WARNING] Ephemeris attitude: the ephemeris file is not available and the attitude calculation is disabled." << std::endl;
+    is_calc_enabled_ = false;
+    return;
+  }
+  UpdateState(0.0);
+}
+
+void EphemerisAttitude::Propagate(const double end_time_s) {
+  if (!is_calc_enabled_) return;
+
+  UpdateState(end_time_s);
+}
+
+void EphemerisAttitude::UpdateState(const double elapsed_time_s) {
+  double time_s = elapsed_time_s + time_offset_s_;
+  if (time_s < ephemeris_.GetStartTime_s() || time_s > ephemeris_.GetEndTime_s()) {
+    if (!is_out_of_range_warned_) {
+      std::cerr << "[WARNING] Ephemeris attitude: " << time_s << " sec is out of the ephemeris file. The state is held." << std::endl;
+      is_out_of_range_warned_ = true;
+    }
+    time_s = std::min(std::max(time_s, ephemeris_.GetStartTime_s()), ephemeris_.GetEndTime_s());
+  }
+
+  // Spherical linear interpolation of the quaternion
+  const size_t record_id = ephemeris_.FindRecord(time_s);
+  libra::Vector<4> quaternion_0, quaternion_1;
+  for (size_t i = 0; i < 4; i++) {
+    quaternion_0[i] = ephemeris_.GetData(record_id, i);
+    quaternion_1[i] = ephemeris_.GetData(record_id + 1, i);
+  }
+  const double time_0_s = ephemeris_.GetTime_s(record_id);
+  const double sigma = (time_s - time_0_s) / (ephemeris_.GetTime_s(record_id + 1) - time_0_s);
+  double cos_angle = libra::InnerProduct(quaternion_0, quaternion_1);
+  if (cos_angle < 0.0) {
+    quaternion_1 = -1.0 * quaternion_1;
+    cos_angle = -cos_angle;
+  }
+  libra::Vector<4> quaternion_i2b;
+  if (cos_angle > 0.9995) {
+    quaternion_i2b = (1.0 - sigma) * quaternion_0 + sigma * quaternion_1;
+  } else {
+    const double angle_rad = acos(cos_angle);
+    quaternion_i2b = (sin((1.0 - sigma) * angle_rad) / sin(angle_rad)) * quaternion_0 + (sin(sigma * angle_rad) / sin(angle_rad)) * quaternion_1;
+  }
+  quaternion_i2b_ = libra::Quaternion(quaternion_i2b).Normalize();
+
+  for (size_t axis = 0; axis < 3; axis++) {
+    angular_velocity_b_rad_s_[axis] = ephemeris_.CalcLagrange(axis + 4, time_s, number_of_interpolation_points_);
+  }
+  CalcAngularMomentum();
+}
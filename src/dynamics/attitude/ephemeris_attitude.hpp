@@ -0,0 +1,63 @@
+/**
+ * @file ephemeris_attitude.hpp
+ * @brief Class to replay spacecraft attitude from a precomputed ephemeris file
+ */
+
+#ifndef S2E_DYNAMICS_ATTITUDE_EPHEMERIS_ATTITUDE_HPP_
+#define S2E_DYNAMICS_ATTITUDE_EPHEMERIS_ATTITUDE_HPP_
+
+#include <math_physics/orbit/ephemeris_file_reader.hpp>
+#include <string>
+#include <vector>
+
+#include "attitude.hpp"
+
+/**
+ * @class EphemerisAttitude
+ * @brief Class to replay spacecraft attitude from a precomputed ephemeris file such as a log file of a previous S2E run
+ * @details The quaternion is interpolated with the spherical linear interpolation between the two records around the time, and the angular
+ *          velocity is interpolated with the Lagrange polynomial. The torques are not applied, and the state is held at the first or last record
+ *          out of the time span of the file.
+ */
+class EphemerisAttitude : public Attitude {
+ public:
+  /**
+   * @fn EphemerisAttitude
+   * @brief Constructor
+   * @param [in] inertia_tensor_kgm2: Inertia tensor of the spacecraft [kg m^2]
+   * @param [in] file_name: Path of the ephemeris file
+   * @param [in] time_column_name: Column name of the time [s]
+   * @param [in] quaternion_column_names: Column names of the quaternion from the inertial frame to the body fixed frame (x, y, z, w)
+   * @param [in] angular_velocity_column_names: Column names of the angular velocity in the body fixed frame [rad/s] (x, y, z)
+   * @param [in] number_of_interpolation_points: Number of records for the Lagrange interpolation of the angular velocity
+   * @param [in] time_offset_s: Time in the file at the simulation start [s]
+   * @param [in] propagation_step_s: Propagation step width [sec]
+   * @param [in] simulation_object_name: Simulation object name for Monte-Carlo simulation
+   */
+  EphemerisAttitude(const libra::Matrix<3, 3>& inertia_tensor_kgm2, const std::string file_name, const std::string time_column_name,
+                    const std::vector<std::string> quaternion_column_names, const std::vector<std::string> angular_velocity_column_names,
+                    const size_t number_of_interpolation_points, const double time_offset_s, const double propagation_step_s,
+                    const std::string& simulation_object_name = "attitude");
+
+  /**
+   * @fn Propagate
+   * @brief Attitude propagation
+   * @param [in] end_time_s: Propagation endtime [sec]
+   */
+  virtual void Propagate(const double end_time_s);
+
+ private:
+  EphemerisFileReader ephemeris_;          //!< Ephemeris file
+  size_t number_of_interpolation_points_;  //!< Number of records for the Lagrange interpolation
+  double time_offset_s_;                   //!< Time in the file at the simulation start [s]
+  bool is_out_of_range_warned_ = false;    //!< Flag to warn the time out of the file only once
+
+  /**
+   * @fn UpdateState
+   * @brief Interpolate the quaternion and angular velocity
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   */
+  void UpdateState(const double elapsed_time_s);
+};
+
+#endif  // S2E_DYNAMICS_ATTITUDE_EPHEMERIS_ATTITUDE_HPP_
@@ -85,6 +85,17 @@ Attitude* InitAttitude(std::string file_name, const Orbit* orbit, const LocalCel
 
     attitude = new ControlledAttitude(main_mode, sub_mode, quaternion_i2b, main_target_direction_b, sub_target_direction_b, inertia_tensor_kgm2,
                                       local_celestial_information, orbit, mc_name);
+  } else if (propagate_mode == "EPHEMERIS") {
+    // Attitude replay from the ephemeris file
+    const std::string ephemeris_file = ini_file.ReadString(section_, "ephemeris_file");
+    const std::string time_column_name = ini_file.ReadString(section_, "ephemeris_time_column");
+    const std::vector<std::string> quaternion_column_names = ini_file.ReadVectorString(section_, "ephemeris_quaternion_i2b_column", 4);
+    const std::vector<std::string> angular_velocity_column_names = ini_file.ReadVectorString(section_, "ephemeris_angular_velocity_b_rad_s_column", 3);
+    const size_t number_of_interpolation_points = (size_t)ini_file.ReadInt(section_, "ephemeris_interpolation_points");
+    const double time_offset_s = ini_file.ReadDouble(section_, "ephemeris_time_offset_s");
+
+    attitude = new EphemerisAttitude(inertia_tensor_kgm2, ephemeris_file, time_column_name, quaternion_column_names, angular_velocity_column_names,
+                                     number_of_interpolation_points, time_offset_s, step_width_s, mc_name);
   } else {
     std::cerr << "ERROR: attitude propagation mode: " << propagate_mode << " is not defined!" << std::endl;
     std::cerr << "The attitude mode is automatically set as RK4" << std::endl;
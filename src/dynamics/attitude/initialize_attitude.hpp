@@ -10,6 +10,7 @@
 #include "attitude_rk4.hpp"
 #include "attitude_with_cantilever_vibration.hpp"
 #include "controlled_attitude.hpp"
+#include "ephemeris_attitude.hpp"
 
 /**
  * @fn InitAttitude
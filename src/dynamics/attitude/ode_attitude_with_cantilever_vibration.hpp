@@ -140,7 +140,7 @@ class AttitudeWithCantileverVibrationOde : public InterfaceOde<13> {
    * @fn GetPreviousInertiaTensor_kgm2
    * @brief Get previous inertia tensor [kgm2]
    */
-  inline libra::Matrix<3, 3> GetPreviousInertiaTensor_kgm2() { return previous_inertia_tensor_kgm2_; }
+  inline libra::Matrix<3, 3> GetPreviousInertiaTensor_kgm2() const { return previous_inertia_tensor_kgm2_; }
   /**
    * @fn GetInertiaTensorCantilever_kgm2
    * @brief Get inertia tensor of the cantilever [kgm2]
@@ -6,6 +6,8 @@
 #include "dynamics.hpp"
 
 #include "../simulation/multiple_spacecraft/relative_information.hpp"
+#include "../utilities/allocation_tracker.hpp"
+#include "../utilities/profiler.hpp"
 
 Dynamics::Dynamics(const SimulationConfiguration* simulation_configuration, const SimulationTime* simulation_time,
                    const LocalEnvironment* local_environment, const int spacecraft_id, Structure* structure,
@@ -37,12 +39,16 @@ void Dynamics::Initialize(const SimulationConfiguration* simulation_configuratio
 }
 
 void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestialInformation* local_celestial_information) {
+  PROFILE_SCOPE("Dynamics::Update");
+  ALLOCATION_SCOPE("Dynamics::Update");
   // Attitude propagation
   if (simulation_time->GetAttitudePropagateFlag()) {
+    ScopedExecutionCost scoped_cost(attitude_cost_);
     attitude_->Propagate(simulation_time->GetElapsedTime_s());
   }
   // Orbit Propagation
   if (simulation_time->GetOrbitPropagateFlag()) {
+    ScopedExecutionCost scoped_cost(orbit_cost_);
     orbit_->Propagate(simulation_time->GetElapsedTime_s(), simulation_time->GetCurrentTime_jd());
   }
   // Attitude dependent update
@@ -50,6 +56,7 @@ void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestia
 
   // Thermal
   if (simulation_time->GetThermalPropagateFlag()) {
+    ScopedExecutionCost scoped_cost(thermal_cost_);
     std::string sun_str = "SUN";
     char* c_sun = new char[sun_str.size() + 1];
     std::char_traits<char>::copy(c_sun, sun_str.c_str(), sun_str.size() + 1);  // string -> char*
@@ -62,6 +69,7 @@ void Dynamics::ClearForceTorque(void) {
   libra::Vector<3> zero(0.0);
   attitude_->SetTorque_b_Nm(zero);
   orbit_->SetAcceleration_i_m_s2(zero);
+  orbit_->SetAccelerationPartialDerivative_i_s2(libra::Matrix<3, 3>(0.0));
 }
 
 void Dynamics::LogSetup(Logger& logger) {
@@ -69,3 +77,15 @@ void Dynamics::LogSetup(Logger& logger) {
   logger.AddLogList(orbit_);
   logger.AddLogList(temperature_);
 }
+
+void Dynamics::SaveCheckpoint(CheckpointWriter& writer) const {
+  attitude_->SaveCheckpoint(writer);
+  orbit_->SaveCheckpoint(writer);
+  temperature_->SaveCheckpoint(writer);
+}
+
+void Dynamics::LoadCheckpoint(CheckpointReader& reader) {
+  attitude_->LoadCheckpoint(reader);
+  orbit_->LoadCheckpoint(reader);
+  temperature_->LoadCheckpoint(reader);
+}
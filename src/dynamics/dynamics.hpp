@@ -12,6 +12,8 @@
 #include "../math_physics/math/vector.hpp"
 #include "../simulation/simulation_configuration.hpp"
 #include "../simulation/spacecraft/structure/structure.hpp"
+#include "../utilities/checkpoint.hpp"
+#include "../utilities/execution_cost.hpp"
 #include "dynamics/attitude/initialize_attitude.hpp"
 #include "dynamics/orbit/initialize_orbit.hpp"
 #include "dynamics/thermal/node.hpp"
@@ -24,7 +26,7 @@ class LocalEnvironment;
  * @class Dynamics
  * @brief Class to manage dynamics of spacecraft
  */
-class Dynamics {
+class Dynamics : public ICheckpointable {
  public:
   /**
    * @fn Dynamics
@@ -58,6 +60,18 @@ class Dynamics {
    */
   void LogSetup(Logger& logger);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the states of the attitude, orbit, and thermal dynamics into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the states of the attitude, orbit, and thermal dynamics from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   /**
    * @fn AddTorque_b_Nm
    * @brief Add input torque for the attitude dynamics propagation
@@ -78,6 +92,14 @@ class Dynamics {
    * @param [in] acceleration_i_m_s2: Acceleration in the inertial fixed frame [N]
    */
   inline void AddAcceleration_i_m_s2(libra::Vector<3> acceleration_i_m_s2) { orbit_->AddAcceleration_i_m_s2(acceleration_i_m_s2); }
+  /**
+   * @fn AddAccelerationPartialDerivative_i_s2
+   * @brief Add partial derivative of the acceleration for the variational equation of the orbit
+   * @param [in] acceleration_partial_derivative_i_s2: Partial derivative of the acceleration with respect to the position in the inertial frame [1/s2]
+   */
+  inline void AddAccelerationPartialDerivative_i_s2(libra::Matrix<3, 3> acceleration_partial_derivative_i_s2) {
+    orbit_->AddAccelerationPartialDerivative_i_s2(acceleration_partial_derivative_i_s2);
+  }
 
   /**
    * @fn ClearForceTorque
@@ -105,6 +127,21 @@ class Dynamics {
    * @brief Return Attitude class to change the Attitude
    */
   inline Attitude& SetAttitude() const { return *attitude_; }
+  /**
+   * @fn GetAttitudeCost
+   * @brief Return measured execution cost of the attitude propagation
+   */
+  inline const ExecutionCost& GetAttitudeCost() const { return attitude_cost_; }
+  /**
+   * @fn GetOrbitCost
+   * @brief Return measured execution cost of the orbit propagation
+   */
+  inline const ExecutionCost& GetOrbitCost() const { return orbit_cost_; }
+  /**
+   * @fn GetThermalCost
+   * @brief Return measured execution cost of the thermal propagation
+   */
+  inline const ExecutionCost& GetThermalCost() const { return thermal_cost_; }
 
  private:
   Attitude* attitude_;                         //!< Attitude dynamics
@@ -112,6 +149,9 @@ class Dynamics {
   Temperature* temperature_;                   //!< Thermal dynamics
   const Structure* structure_;                 //!< Structure information
   const LocalEnvironment* local_environment_;  //!< Local environment
+  ExecutionCost attitude_cost_;                //!< Execution cost of the attitude propagation
+  ExecutionCost orbit_cost_;                   //!< Execution cost of the orbit propagation
+  ExecutionCost thermal_cost_;                 //!< Execution cost of the thermal propagation
 
   /**
    * @fn Initialize
@@ -59,6 +59,28 @@ void EnckeOrbitPropagation::Propagate(const double end_time_s, const double curr
   UpdateSatOrbit();
 }
 
+void EnckeOrbitPropagation::SaveCheckpoint(CheckpointWriter& writer) const {
+  Orbit::SaveCheckpoint(writer);
+  libra::OrdinaryDifferentialEquation<6>::SaveCheckpoint(writer);
+  writer.Write(propagation_time_s_);
+  writer.Write(reference_position_i_m_);
+  writer.Write(reference_velocity_i_m_s_);
+  writer.Write(reference_kepler_orbit);
+  writer.Write(difference_position_i_m_);
+  writer.Write(difference_velocity_i_m_s_);
+}
+
+void EnckeOrbitPropagation::LoadCheckpoint(CheckpointReader& reader) {
+  Orbit::LoadCheckpoint(reader);
+  libra::OrdinaryDifferentialEquation<6>::LoadCheckpoint(reader);
+  reader.Read(propagation_time_s_);
+  reader.Read(reference_position_i_m_);
+  reader.Read(reference_velocity_i_m_s_);
+  reader.Read(reference_kepler_orbit);
+  reader.Read(difference_position_i_m_);
+  reader.Read(difference_velocity_i_m_s_);
+}
+
 // Functions for OrdinaryDifferentialEquation
 void EnckeOrbitPropagation::DerivativeFunction(double t, const libra::Vector<6>& state, libra::Vector<6>& rhs) {
   UNUSED(t);
@@ -107,8 +129,7 @@ void EnckeOrbitPropagation::UpdateSatOrbit() {
   spacecraft_position_i_m_ = reference_position_i_m_ + difference_position_i_m_;
   spacecraft_velocity_i_m_s_ = reference_velocity_i_m_s_ + difference_velocity_i_m_s_;
 
-  TransformEciToEcef();
-  TransformEcefToGeodetic();
+  ResetDerivedStates();
 }
 
 double EnckeOrbitPropagation::CalcQFunction(libra::Vector<3> difference_position_i_m) {
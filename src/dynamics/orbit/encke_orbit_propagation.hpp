@@ -45,6 +45,17 @@ class EnckeOrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEq
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the orbit state, the reference orbit, and the integration state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the orbit state, the reference orbit, and the integration state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   // Override OrdinaryDifferentialEquation
   /**
    * @fn DerivativeFunction
@@ -0,0 +1,71 @@
+/**
+ * @file ephemeris_orbit.cpp
+ * @brief Class to replay spacecraft orbit from a precomputed ephemeris file
+ */
+
+#include "ephemeris_orbit.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utilities/macros.hpp>
+
+/**
+ * @fn ConcatenateColumnNames
+ * @brief Return the position column names followed by the velocity column names
+ */
+static std::vector<std::string> ConcatenateColumnNames(const std::vector<std::string>& position_column_names,
+                                                       const std::vector<std::string>& velocity_column_names) {
+  std::vector<std::string> column_names = position_column_names;
+  column_names.insert(column_names.end(), velocity_column_names.begin(), velocity_column_names.end());
+  return column_names;
+}
+
+EphemerisOrbit::EphemerisOrbit(const CelestialInformation* celestial_information, const std::string file_name, const std::string time_column_name,
+                               const std::vector<std::string> position_column_names, const std::vector<std::string> velocity_column_names,
+                               const EphemerisInterpolationMethod interpolation_method, const size_t number_of_interpolation_points,
+                               const double time_offset_s)
+    : Orbit(celestial_information),
+      ephemeris_(file_name, time_column_name, ConcatenateColumnNames(position_column_names, velocity_column_names)),
+      interpolation_method_(interpolation_method),
+      number_of_interpolation_points_(number_of_interpolation_points),
+      time_offset_s_(time_offset_s) {
+  propagate_mode_ = OrbitPropagateMode::kEphemeris;
+
+  if (!ephemeris_.IsOpened() || position_column_names.size() != 3 || velocity_column_names.size() != 3) {
+    std::cerr << "[WARNING] Ephemeris orbit: the ephemeris file is not available and the orbit calculation is disabled." << std::endl;
+    is_calc_enabled_ = false;
+    return;
+  }
+  UpdateState(0.0);
+}
+
+void EphemerisOrbit::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+
+  UpdateState(end_time_s);
+}
+
+void EphemerisOrbit::UpdateState(const double elapsed_time_s) {
+  double time_s = elapsed_time_s + time_offset_s_;
+  if (time_s < ephemeris_.GetStartTime_s() || time_s > ephemeris_.GetEndTime_s()) {
+    if (!is_out_of_range_warned_) {
+      std::cerr << "[WARNING] Ephemeris orbit: " << time_s << " sec is out of the ephemeris file. The state is held." << std::endl;
+      is_out_of_range_warned_ = true;
+    }
+    time_s = std::min(std::max(time_s, ephemeris_.GetStartTime_s()), ephemeris_.GetEndTime_s());
+  }
+
+  for (size_t axis = 0; axis < 3; axis++) {
+    if (interpolation_method_ == EphemerisInterpolationMethod::kHermite) {
+      spacecraft_position_i_m_[axis] = ephemeris_.CalcHermite(axis, axis + 3, time_s, spacecraft_velocity_i_m_s_[axis]);
+    } else {
+      spacecraft_position_i_m_[axis] = ephemeris_.CalcLagrange(axis, time_s, number_of_interpolation_points_);
+      spacecraft_velocity_i_m_s_[axis] = ephemeris_.CalcLagrange(axis + 3, time_s, number_of_interpolation_points_);
+    }
+  }
+  spacecraft_acceleration_i_m_s2_ *= 0.0;
+
+  ResetDerivedStates();
+}
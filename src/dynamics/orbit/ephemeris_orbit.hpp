@@ -0,0 +1,63 @@
+/**
+ * @file ephemeris_orbit.hpp
+ * @brief Class to replay spacecraft orbit from a precomputed ephemeris file
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_EPHEMERIS_ORBIT_HPP_
+#define S2E_DYNAMICS_ORBIT_EPHEMERIS_ORBIT_HPP_
+
+#include <math_physics/orbit/ephemeris_file_reader.hpp>
+#include <string>
+#include <vector>
+
+#include "orbit.hpp"
+
+/**
+ * @class EphemerisOrbit
+ * @brief Class to replay spacecraft orbit from a precomputed ephemeris file such as a log file of a previous S2E run
+ * @details The position and velocity in the inertial frame are interpolated from the records. The disturbances and the thruster maneuver are
+ *          not applied, and the state is held at the first or last record out of the time span of the file.
+ */
+class EphemerisOrbit : public Orbit {
+ public:
+  /**
+   * @fn EphemerisOrbit
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] file_name: Path of the ephemeris file
+   * @param [in] time_column_name: Column name of the time [s]
+   * @param [in] position_column_names: Column names of the position in the inertial frame [m] (x, y, z)
+   * @param [in] velocity_column_names: Column names of the velocity in the inertial frame [m/s] (x, y, z)
+   * @param [in] interpolation_method: Interpolation method
+   * @param [in] number_of_interpolation_points: Number of records for the Lagrange interpolation
+   * @param [in] time_offset_s: Time in the file at the simulation start [s]
+   */
+  EphemerisOrbit(const CelestialInformation* celestial_information, const std::string file_name, const std::string time_column_name,
+                 const std::vector<std::string> position_column_names, const std::vector<std::string> velocity_column_names,
+                 const EphemerisInterpolationMethod interpolation_method, const size_t number_of_interpolation_points, const double time_offset_s);
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+
+ private:
+  EphemerisFileReader ephemeris_;                      //!< Ephemeris file
+  EphemerisInterpolationMethod interpolation_method_;  //!< Interpolation method
+  size_t number_of_interpolation_points_;              //!< Number of records for the Lagrange interpolation
+  double time_offset_s_;                               //!< Time in the file at the simulation start [s]
+  bool is_out_of_range_warned_ = false;                //!< Flag to warn the time out of the file only once
+
+  /**
+   * @fn UpdateState
+   * @brief Interpolate the position and velocity
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   */
+  void UpdateState(const double elapsed_time_s);
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_EPHEMERIS_ORBIT_HPP_
@@ -7,7 +7,9 @@
 #include <setting_file_reader/initialize_file_access.hpp>
 
 #include "encke_orbit_propagation.hpp"
+#include "ephemeris_orbit.hpp"
 #include "kepler_orbit_propagation.hpp"
+#include "mean_element_orbit_propagation.hpp"
 #include "relative_orbit.hpp"
 #include "rk4_orbit_propagation.hpp"
 #include "sgp4_orbit_propagation.hpp"
@@ -96,6 +98,51 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
     double error_tolerance = conf.ReadDouble(section_, "error_tolerance");
     orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd, position_i_m, velocity_i_m_s,
                                       error_tolerance);
+  } else if (propagate_mode == "MEAN_ELEMENT") {
+    // initialize orbit for the mean element propagation
+    libra::Vector<3> position_i_m;
+    libra::Vector<3> velocity_i_m_s;
+    libra::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+
+    libra::Vector<4> zonal_coefficients;
+    conf.ReadVector<4>(section_, "zonal_coefficients_j2_to_j5", zonal_coefficients);
+    std::vector<double> zonal_coefficient_list;
+    for (size_t i = 0; i < 4; i++) {
+      zonal_coefficient_list.push_back(zonal_coefficients[i]);
+    }
+    MeanElementOrbit mean_element_model(gravity_constant_m3_s2, environment::earth_equatorial_radius_m, zonal_coefficient_list);
+
+    std::vector<std::string> third_body_list;
+    const int number_of_third_body = conf.ReadInt(section_, "number_of_third_body");
+    for (int i = 0; i < number_of_third_body; i++) {
+      const std::string third_body_id = "third_body_name(" + std::to_string(i) + ")";
+      third_body_list.push_back(conf.ReadString(section_, third_body_id.c_str()));
+    }
+
+    const double mean_element_step_s = conf.ReadDouble(section_, "mean_element_step_s");
+    const std::string air_density_model = conf.ReadString(section_, "air_density_model");
+    const double ballistic_coefficient_m2_kg = conf.ReadDouble(section_, "ballistic_coefficient_m2_kg");
+    const bool is_short_period_correction_enabled = conf.ReadEnable(section_, "short_period_correction");
+    const double decay_altitude_m = conf.ReadDouble(section_, "decay_altitude_m");
+    orbit = new MeanElementOrbitPropagation(celestial_information, mean_element_model, mean_element_step_s, position_i_m, velocity_i_m_s,
+                                            air_density_model, ballistic_coefficient_m2_kg, third_body_list, is_short_period_correction_enabled,
+                                            decay_altitude_m);
+  } else if (propagate_mode == "EPHEMERIS") {
+    // initialize orbit replay from the ephemeris file
+    const std::string ephemeris_file = conf.ReadString(section_, "ephemeris_file");
+    const std::string time_column_name = conf.ReadString(section_, "ephemeris_time_column");
+    const std::vector<std::string> position_column_names = conf.ReadVectorString(section_, "ephemeris_position_i_m_column", 3);
+    const std::vector<std::string> velocity_column_names = conf.ReadVectorString(section_, "ephemeris_velocity_i_m_s_column", 3);
+    const EphemerisInterpolationMethod interpolation_method =
+        ConvertEphemerisInterpolationMethod(conf.ReadString(section_, "ephemeris_interpolation_method"));
+    const size_t number_of_interpolation_points = (size_t)conf.ReadInt(section_, "ephemeris_interpolation_points");
+    const double time_offset_s = conf.ReadDouble(section_, "ephemeris_time_offset_s");
+    orbit = new EphemerisOrbit(celestial_information, ephemeris_file, time_column_name, position_column_names, velocity_column_names,
+                               interpolation_method, number_of_interpolation_points, time_offset_s);
   } else {
     std::cerr << "ERROR: orbit propagation mode: " << propagate_mode << " is not defined!" << std::endl;
     std::cerr << "The orbit mode is automatically set as RK4" << std::endl;
@@ -111,6 +158,7 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
   }
 
   orbit->SetIsCalcEnabled(conf.ReadEnable(section_, "calculation"));
+  orbit->SetIsStmCalcEnabled(conf.ReadEnable(section_, "state_transition_matrix_calculation"));
   orbit->is_log_enabled_ = conf.ReadEnable(section_, "logging");
   return orbit;
 }
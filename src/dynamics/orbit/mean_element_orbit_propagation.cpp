@@ -0,0 +1,184 @@
+/**
+ * @file mean_element_orbit_propagation.cpp
+ * @brief Class to propagate spacecraft orbit with averaged equations of the mean elements
+ */
+
+#include "mean_element_orbit_propagation.hpp"
+
+#include <environment/global/physical_constants.hpp>
+#include <iostream>
+#include <logger/log_utility.hpp>
+#include <math_physics/atmosphere/harris_priester_model.hpp>
+#include <math_physics/atmosphere/simple_air_density_model.hpp>
+#include <math_physics/math/matrix_vector.hpp>
+#include <utilities/macros.hpp>
+
+MeanElementOrbitPropagation::MeanElementOrbitPropagation(const CelestialInformation* celestial_information, const MeanElementOrbit mean_element_model,
+                                                         const double step_width_s, const libra::Vector<3> position_i_m,
+                                                         const libra::Vector<3> velocity_i_m_s, const std::string air_density_model,
+                                                         const double ballistic_coefficient_m2_kg, const std::vector<std::string> third_body_list,
+                                                         const bool is_short_period_correction_enabled, const double decay_altitude_m)
+    : Orbit(celestial_information),
+      mean_element_model_(mean_element_model),
+      integrator_(step_width_s, mean_element_model_),
+      step_width_s_(step_width_s),
+      air_density_model_(air_density_model),
+      third_body_list_(third_body_list),
+      is_short_period_correction_enabled_(is_short_period_correction_enabled),
+      decay_altitude_m_(decay_altitude_m) {
+  propagate_mode_ = OrbitPropagateMode::kMeanElement;
+
+  if (air_density_model_ == "STANDARD" || air_density_model_ == "HARRIS_PRIESTER") {
+    libra::Vector<3> earth_angular_velocity_i_rad_s(0.0);
+    earth_angular_velocity_i_rad_s[2] = environment::earth_mean_angular_velocity_rad_s;
+    mean_element_model_.SetDragParameters(ballistic_coefficient_m2_kg, earth_angular_velocity_i_rad_s,
+                                          [this](const libra::Vector<3>& position_i_m) { return CalcAirDensity_kg_m3(position_i_m); });
+  }
+  UpdateEnvironment();
+
+  // Initial mean elements from the osculating state
+  const double gravity_constant_m3_s2 = mean_element_model_.GetGravityConstant_m3_s2();
+  const libra::Vector<6> osculating_elements = ConvertPositionVelocityToEquinoctialElements(gravity_constant_m3_s2, position_i_m, velocity_i_m_s);
+  if (is_short_period_correction_enabled_) {
+    next_node_elements_ = mean_element_model_.ConvertOsculatingToMean(osculating_elements);
+  } else {
+    next_node_elements_ = osculating_elements;
+  }
+  next_node_rate_ = mean_element_model_.CalcAveragedRate(next_node_elements_, &next_node_short_period_terms_);
+  integrator_.SetState(0.0, next_node_elements_);
+  IntegrateNode();
+
+  spacecraft_acceleration_i_m_s2_ *= 0.0;
+  UpdateState(0.0);
+}
+
+void MeanElementOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+
+  UpdateEnvironment();
+  while (end_time_s > next_node_time_s_ && !is_decayed_) {
+    IntegrateNode();
+  }
+  UpdateState(end_time_s);
+}
+
+void MeanElementOrbitPropagation::UpdateEnvironment() {
+  dcm_i_to_ecef_ = celestial_information_->GetEarthRotation().GetDcmJ2000ToEcef();
+  if (air_density_model_ == "HARRIS_PRIESTER") {
+    sun_direction_i_ = celestial_information_->GetPositionFromCenter_i_m("SUN").CalcNormalizedVector();
+  }
+
+  mean_element_model_.ClearThirdBodies();
+  for (const auto& third_body : third_body_list_) {
+    mean_element_model_.AddThirdBody(celestial_information_->GetGravityConstant_m3_s2(third_body.c_str()),
+                                     celestial_information_->GetPositionFromCenter_i_m(third_body.c_str()));
+  }
+}
+
+void MeanElementOrbitPropagation::IntegrateNode() {
+  previous_node_time_s_ = next_node_time_s_;
+  previous_node_elements_ = next_node_elements_;
+  previous_node_rate_ = next_node_rate_;
+  previous_node_short_period_terms_ = next_node_short_period_terms_;
+
+  integrator_.Integrate();
+  next_node_time_s_ += step_width_s_;
+  next_node_elements_ = integrator_.GetState();
+  next_node_rate_ = mean_element_model_.CalcAveragedRate(next_node_elements_, &next_node_short_period_terms_);
+
+  // Decay check with the mean perigee altitude
+  const double eccentricity = sqrt(pow(next_node_elements_[1], 2.0) + pow(next_node_elements_[2], 2.0));
+  const double perigee_altitude_m = next_node_elements_[0] * (1.0 - eccentricity) - mean_element_model_.GetReferenceRadius_m();
+  if (perigee_altitude_m < decay_altitude_m_) {
+    is_decayed_ = true;
+    std::cerr << "[WARNING] Mean element orbit: the spacecraft decayed at " << next_node_time_s_ << " sec." << std::endl;
+  }
+}
+
+void MeanElementOrbitPropagation::UpdateState(const double time_s) {
+  // Cubic Hermite interpolation between the nodes
+  double sigma = (time_s - previous_node_time_s_) / step_width_s_;
+  if (sigma < 0.0) sigma = 0.0;
+  if (sigma > 1.0) sigma = 1.0;
+  const double sigma2 = sigma * sigma;
+  const double sigma3 = sigma2 * sigma;
+  const double h00 = 2.0 * sigma3 - 3.0 * sigma2 + 1.0;
+  const double h10 = sigma3 - 2.0 * sigma2 + sigma;
+  const double h01 = -2.0 * sigma3 + 3.0 * sigma2;
+  const double h11 = sigma3 - sigma2;
+  mean_elements_ = h00 * previous_node_elements_ + (h10 * step_width_s_) * previous_node_rate_ + h01 * next_node_elements_ +
+                   (h11 * step_width_s_) * next_node_rate_;
+
+  libra::Vector<6> osculating_elements = mean_elements_;
+  if (is_short_period_correction_enabled_) {
+    const double mean_longitude_rad = mean_elements_[5];
+    osculating_elements += (1.0 - sigma) * previous_node_short_period_terms_.CalcVariation(mean_longitude_rad) +
+                           sigma * next_node_short_period_terms_.CalcVariation(mean_longitude_rad);
+  }
+
+  ConvertEquinoctialElementsToPositionVelocity(mean_element_model_.GetGravityConstant_m3_s2(), osculating_elements, spacecraft_position_i_m_,
+                                               spacecraft_velocity_i_m_s_);
+  ResetDerivedStates();
+}
+
+double MeanElementOrbitPropagation::CalcAirDensity_kg_m3(const libra::Vector<3>& position_i_m) const {
+  GeodeticPosition geodetic_position;
+  geodetic_position.UpdateFromEcef(dcm_i_to_ecef_ * position_i_m);
+
+  if (air_density_model_ == "STANDARD") {
+    return libra::atmosphere::CalcAirDensityWithSimpleModel(geodetic_position.GetAltitude_m());
+  } else if (air_density_model_ == "HARRIS_PRIESTER") {
+    return libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(geodetic_position, sun_direction_i_);
+  }
+  return 0.0;
+}
+
+std::string MeanElementOrbitPropagation::GetLogHeader() const {
+  std::string str_tmp = Orbit::GetLogHeader();
+
+  str_tmp += WriteScalar("mean_semi_major_axis", "m");
+  str_tmp += WriteScalar("mean_eccentricity", "-");
+
+  return str_tmp;
+}
+
+std::string MeanElementOrbitPropagation::GetLogValue() const {
+  std::string str_tmp = Orbit::GetLogValue();
+
+  str_tmp += WriteScalar(mean_elements_[0], 16);
+  str_tmp += WriteScalar(sqrt(pow(mean_elements_[1], 2.0) + pow(mean_elements_[2], 2.0)));
+
+  return str_tmp;
+}
+
+void MeanElementOrbitPropagation::SaveCheckpoint(CheckpointWriter& writer) const {
+  Orbit::SaveCheckpoint(writer);
+  integrator_.SaveCheckpoint(writer);
+  writer.Write(is_decayed_);
+  writer.Write(previous_node_time_s_);
+  writer.Write(next_node_time_s_);
+  writer.Write(previous_node_elements_);
+  writer.Write(next_node_elements_);
+  writer.Write(previous_node_rate_);
+  writer.Write(next_node_rate_);
+  writer.Write(mean_elements_);
+}
+
+void MeanElementOrbitPropagation::LoadCheckpoint(CheckpointReader& reader) {
+  Orbit::LoadCheckpoint(reader);
+  integrator_.LoadCheckpoint(reader);
+  reader.Read(is_decayed_);
+  reader.Read(previous_node_time_s_);
+  reader.Read(next_node_time_s_);
+  reader.Read(previous_node_elements_);
+  reader.Read(next_node_elements_);
+  reader.Read(previous_node_rate_);
+  reader.Read(next_node_rate_);
+  reader.Read(mean_elements_);
+
+  // The short-period terms are recalculated from the node elements
+  mean_element_model_.CalcAveragedRate(previous_node_elements_, &previous_node_short_period_terms_);
+  mean_element_model_.CalcAveragedRate(next_node_elements_, &next_node_short_period_terms_);
+}
@@ -0,0 +1,137 @@
+/**
+ * @file mean_element_orbit_propagation.hpp
+ * @brief Class to propagate spacecraft orbit with averaged equations of the mean elements
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_MEAN_ELEMENT_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_MEAN_ELEMENT_ORBIT_PROPAGATION_HPP_
+
+#include <math_physics/numerical_integration/runge_kutta_4.hpp>
+#include <math_physics/orbit/mean_element_orbit.hpp>
+#include <string>
+#include <vector>
+
+#include "orbit.hpp"
+
+/**
+ * @class MeanElementOrbitPropagation
+ * @brief Class to propagate spacecraft orbit with averaged equations of the mean elements for long-duration analysis such as orbit lifetime
+ * @details The mean elements are integrated with the RK4 method with a large step width such as hours, and the state between the integration
+ *          nodes is interpolated with the cubic Hermite interpolation. The osculating state is reconstructed with the short-period terms.
+ *          The disturbances and the thruster maneuver are not applied, and the propagation stops when the mean perigee altitude becomes lower
+ *          than the decay altitude.
+ */
+class MeanElementOrbitPropagation : public Orbit {
+ public:
+  /**
+   * @fn MeanElementOrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] mean_element_model: Model of the averaged equations
+   * @param [in] step_width_s: Step width of the mean element integration [s]
+   * @param [in] position_i_m: Initial osculating position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial osculating velocity in the inertial frame [m/s]
+   * @param [in] air_density_model: Air density model for the averaged drag (STANDARD or HARRIS_PRIESTER, others disable the drag)
+   * @param [in] ballistic_coefficient_m2_kg: Drag coefficient x area / mass [m2/kg]
+   * @param [in] third_body_list: Names of the third bodies
+   * @param [in] is_short_period_correction_enabled: Enable flag of the short-period correction for the osculating state
+   * @param [in] decay_altitude_m: Mean perigee altitude to stop the propagation [m]
+   */
+  MeanElementOrbitPropagation(const CelestialInformation* celestial_information, const MeanElementOrbit mean_element_model, const double step_width_s,
+                              const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const std::string air_density_model,
+                              const double ballistic_coefficient_m2_kg, const std::vector<std::string> third_body_list,
+                              const bool is_short_period_correction_enabled, const double decay_altitude_m = 100.0e3);
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+
+  // Getter
+  /**
+   * @fn GetMeanElements
+   * @brief Return the current mean equinoctial elements
+   */
+  inline const libra::Vector<6>& GetMeanElements() const { return mean_elements_; }
+  /**
+   * @fn GetIsDecayed
+   * @brief Return true when the mean perigee altitude is lower than the decay altitude
+   */
+  inline bool GetIsDecayed() const { return is_decayed_; }
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the orbit state and the integration nodes into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the orbit state and the integration nodes from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
+ private:
+  MeanElementOrbit mean_element_model_;                                 //!< Model of the averaged equations
+  libra::numerical_integration::RungeKutta4<6> integrator_;             //!< Integrator of the mean elements
+  double step_width_s_;                                                 //!< Step width of the mean element integration [s]
+  std::string air_density_model_;                                       //!< Air density model for the averaged drag
+  std::vector<std::string> third_body_list_;                            //!< Names of the third bodies
+  bool is_short_period_correction_enabled_;                             //!< Enable flag of the short-period correction
+  double decay_altitude_m_;                                             //!< Mean perigee altitude to stop the propagation [m]
+  bool is_decayed_ = false;                                             //!< Decay flag
+  libra::Matrix<3, 3> dcm_i_to_ecef_ = libra::MakeIdentityMatrix<3>();  //!< DCM from the inertial frame to the ECEF frame for the air density
+  libra::Vector<3> sun_direction_i_{0.0};                               //!< Sun direction in the inertial frame for the air density
+
+  // Integration nodes bracketing the current time
+  double previous_node_time_s_ = 0.0;                             //!< Time of the previous node [s]
+  double next_node_time_s_ = 0.0;                                 //!< Time of the next node [s]
+  libra::Vector<6> previous_node_elements_;                       //!< Mean elements at the previous node
+  libra::Vector<6> next_node_elements_;                           //!< Mean elements at the next node
+  libra::Vector<6> previous_node_rate_;                           //!< Averaged rate at the previous node
+  libra::Vector<6> next_node_rate_;                               //!< Averaged rate at the next node
+  MeanElementShortPeriodTerms previous_node_short_period_terms_;  //!< Short-period terms at the previous node
+  MeanElementShortPeriodTerms next_node_short_period_terms_;      //!< Short-period terms at the next node
+  libra::Vector<6> mean_elements_;                                //!< Current mean elements
+
+  /**
+   * @fn UpdateEnvironment
+   * @brief Update positions of the third bodies and the frame information for the air density
+   */
+  void UpdateEnvironment();
+  /**
+   * @fn IntegrateNode
+   * @brief Integrate the mean elements from the next node by one step
+   */
+  void IntegrateNode();
+  /**
+   * @fn UpdateState
+   * @brief Interpolate the mean elements and update the osculating position and velocity
+   * @param [in] time_s: Elapsed time [s]
+   */
+  void UpdateState(const double time_s);
+  /**
+   * @fn CalcAirDensity_kg_m3
+   * @brief Calculate the air density at the position with the selected model
+   * @param [in] position_i_m: Position in the inertial frame [m]
+   */
+  double CalcAirDensity_kg_m3(const libra::Vector<3>& position_i_m) const;
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_MEAN_ELEMENT_ORBIT_PROPAGATION_HPP_
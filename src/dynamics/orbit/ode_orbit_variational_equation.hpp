@@ -0,0 +1,136 @@
+/**
+ * @file ode_orbit_variational_equation.hpp
+ * @brief Class to implement Ordinary Differential Equations for orbit propagation with the variational equation
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_ODE_ORBIT_VARIATIONAL_EQUATION_HPP_
+#define S2E_DYNAMICS_ORBIT_ODE_ORBIT_VARIATIONAL_EQUATION_HPP_
+
+#include <cmath>
+#include <math_physics/math/matrix.hpp>
+#include <math_physics/math/vector.hpp>
+#include <math_physics/numerical_integration/interface_ode.hpp>
+#include <utilities/macros.hpp>
+
+namespace libra::numerical_integration {
+/**
+ * @class OrbitVariationalEquationOde
+ * @brief Class to implement Ordinary Differential Equations for orbit propagation with the variational equation
+ * @note  State variables in this ODE compose the following elements (in order): position_i_m (3-dimension), velocity_i_m_s (3-dimension), and
+ *        the row-major state transition matrix of the position and velocity (36-dimension)
+ */
+class OrbitVariationalEquationOde : public InterfaceOde<42> {
+ public:
+  /**
+   * @fn SetStateFromPhysicalQuantities
+   * @brief Set state for calculating the ordinary differential equation from physical quantities
+   * @param [in] position_i_m: Spacecraft position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Spacecraft velocity in the inertial frame [m/s]
+   * @param [in] state_transition_matrix: State transition matrix of the position and velocity
+   */
+  libra::Vector<42> SetStateFromPhysicalQuantities(const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s,
+                                                   const libra::Matrix<6, 6> state_transition_matrix) const {
+    libra::Vector<42> state;
+    for (size_t i = 0; i < 3; i++) {
+      state[i] = position_i_m[i];
+      state[i + 3] = velocity_i_m_s[i];
+    }
+    for (size_t i = 0; i < 6; i++) {
+      for (size_t j = 0; j < 6; j++) {
+        state[6 + 6 * i + j] = state_transition_matrix[i][j];
+      }
+    }
+    return state;
+  }
+
+  /**
+   * @fn SetPhysicalQuantitiesFromState
+   * @brief Set physical quantities from state acquired by calculation of the ordinary differential equation
+   * @param [in] state: state variables used to calculate the ordinary differential equation
+   */
+  void SetPhysicalQuantitiesFromState(const libra::Vector<42> state, libra::Vector<3>& position_i_m, libra::Vector<3>& velocity_i_m_s,
+                                      libra::Matrix<6, 6>& state_transition_matrix) const {
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = state[i];
+      velocity_i_m_s[i] = state[i + 3];
+    }
+    for (size_t i = 0; i < 6; i++) {
+      for (size_t j = 0; j < 6; j++) {
+        state_transition_matrix[i][j] = state[6 + 6 * i + j];
+      }
+    }
+  }
+
+  Vector<42> DerivativeFunction(const double time_s, const Vector<42>& state) const override {
+    UNUSED(time_s);
+
+    libra::Vector<42> output(0.0);
+
+    const double x = state[0], y = state[1], z = state[2];
+    const double r2 = x * x + y * y + z * z;
+    const double r = sqrt(r2);
+    const double mu_r3 = gravity_constant_m3_s2_ / (r2 * r);
+
+    // Position and velocity
+    output[0] = state[3];
+    output[1] = state[4];
+    output[2] = state[5];
+    output[3] = acceleration_i_m_s2_[0] - mu_r3 * x;
+    output[4] = acceleration_i_m_s2_[1] - mu_r3 * y;
+    output[5] = acceleration_i_m_s2_[2] - mu_r3 * z;
+
+    // Partial derivative of the acceleration with respect to the position
+    // Two-body term: -mu / r^3 * (I - 3 r r^T / r^2) evaluated at the stage position, other terms are held over the step
+    const double position[3] = {x, y, z};
+    libra::Matrix<3, 3> partial_derivative_i_s2 = acceleration_partial_derivative_i_s2_;
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        partial_derivative_i_s2[i][j] += 3.0 * mu_r3 * position[i] * position[j] / r2;
+      }
+      partial_derivative_i_s2[i][i] -= mu_r3;
+    }
+
+    // Variational equation: dPhi/dt = [[0, I], [dA/dr, 0]] * Phi
+    // The velocity partial derivative of the acceleration is neglected
+    for (size_t j = 0; j < 6; j++) {
+      for (size_t i = 0; i < 3; i++) {
+        output[6 + 6 * i + j] = state[6 + 6 * (i + 3) + j];
+        double d_phi = 0.0;
+        for (size_t k = 0; k < 3; k++) {
+          d_phi += partial_derivative_i_s2[i][k] * state[6 + 6 * k + j];
+        }
+        output[6 + 6 * (i + 3) + j] = d_phi;
+      }
+    }
+
+    return output;
+  }
+
+  // Setter
+  /**
+   * @fn SetGravityConstant_m3_s2
+   * @brief Set gravity constant of the center body [m3/s2]
+   */
+  inline void SetGravityConstant_m3_s2(const double gravity_constant_m3_s2) { gravity_constant_m3_s2_ = gravity_constant_m3_s2; }
+  /**
+   * @fn SetAcceleration_i_m_s2
+   * @brief Set perturbation acceleration in the inertial frame [m/s2]
+   */
+  inline void SetAcceleration_i_m_s2(const libra::Vector<3> acceleration_i_m_s2) { acceleration_i_m_s2_ = acceleration_i_m_s2; }
+  /**
+   * @fn SetAccelerationPartialDerivative_i_s2
+   * @brief Set partial derivative of the perturbation acceleration with respect to the position in the inertial frame [1/s2]
+   */
+  inline void SetAccelerationPartialDerivative_i_s2(const libra::Matrix<3, 3> acceleration_partial_derivative_i_s2) {
+    acceleration_partial_derivative_i_s2_ = acceleration_partial_derivative_i_s2;
+  }
+
+ protected:
+  double gravity_constant_m3_s2_ = 0.0;                            //!< Gravity constant of the center body [m3/s2]
+  libra::Vector<3> acceleration_i_m_s2_{0.0};                      //!< Perturbation acceleration in the inertial frame [m/s2]
+  libra::Matrix<3, 3> acceleration_partial_derivative_i_s2_{0.0};  //!< Partial derivative of the perturbation acceleration [1/s2]
+};
+
+}  // namespace libra::numerical_integration
+
+#endif  // S2E_DYNAMICS_ORBIT_ODE_ORBIT_VARIATIONAL_EQUATION_HPP_
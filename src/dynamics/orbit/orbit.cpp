@@ -4,11 +4,15 @@
  */
 #include "orbit.hpp"
 
-libra::Quaternion Orbit::CalcQuaternion_i2lvlh() const {
-  libra::Vector<3> lvlh_x = spacecraft_position_i_m_;  // x-axis in LVLH frame is position vector direction from geocenter to satellite
+#include <cstdlib>
+#include <iostream>
+
+libra::Quaternion Orbit::CalcQuaternion_i2lvlh() const { return CalcQuaternion_i2lvlh(spacecraft_position_i_m_, spacecraft_velocity_i_m_s_); }
+
+libra::Quaternion Orbit::CalcQuaternion_i2lvlh(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) {
+  libra::Vector<3> lvlh_x = position_i_m;  // x-axis in LVLH frame is position vector direction from geocenter to satellite
   libra::Vector<3> lvlh_ex = lvlh_x.CalcNormalizedVector();
-  libra::Vector<3> lvlh_z =
-      OuterProduct(spacecraft_position_i_m_, spacecraft_velocity_i_m_s_);  // z-axis in LVLH frame is angular momentum vector direction of orbit
+  libra::Vector<3> lvlh_z = OuterProduct(position_i_m, velocity_i_m_s);  // z-axis in LVLH frame is angular momentum vector direction of orbit
   libra::Vector<3> lvlh_ez = lvlh_z.CalcNormalizedVector();
   libra::Vector<3> lvlh_y = OuterProduct(lvlh_z, lvlh_x);
   libra::Vector<3> lvlh_ey = lvlh_y.CalcNormalizedVector();
@@ -28,26 +32,68 @@ libra::Quaternion Orbit::CalcQuaternion_i2lvlh() const {
   return q_i2lvlh.Normalize();
 }
 
-void Orbit::TransformEciToEcef(void) {
-  libra::Matrix<3, 3> dcm_i_to_xcxf = celestial_information_->GetEarthRotation().GetDcmJ2000ToEcef();
-  spacecraft_position_ecef_m_ = dcm_i_to_xcxf * spacecraft_position_i_m_;
+libra::Vector<3> Orbit::GetPosition_ecef_m() const {
+  std::lock_guard<std::mutex> lock(derived_state_mutex_);
+  EvaluateEcef();
+  return spacecraft_position_ecef_m_;
+}
+
+libra::Vector<3> Orbit::GetVelocity_ecef_m_s() const {
+  std::lock_guard<std::mutex> lock(derived_state_mutex_);
+  EvaluateEcef();
+  return spacecraft_velocity_ecef_m_s_;
+}
+
+GeodeticPosition Orbit::GetGeodeticPosition() const {
+  std::lock_guard<std::mutex> lock(derived_state_mutex_);
+  EvaluateGeodetic();
+  return spacecraft_geodetic_position_;
+}
+
+void Orbit::ResetDerivedStates(void) {
+  // Check altitude with the minimum radius of the Earth since the geodetic position is calculated only when it is accessed
+  if (InnerProduct(spacecraft_position_i_m_, spacecraft_position_i_m_) < environment::earth_polar_radius_m * environment::earth_polar_radius_m) {
+    StopByNegativeAltitude();
+  }
+
+  std::lock_guard<std::mutex> lock(derived_state_mutex_);
+  dcm_i_to_ecef_ = celestial_information_->GetEarthRotation().GetDcmJ2000ToEcef();
+  is_ecef_evaluated_ = false;
+  is_geodetic_evaluated_ = false;
+}
+
+void Orbit::EvaluateEcef(void) const {
+  if (is_ecef_evaluated_) return;
+
+  spacecraft_position_ecef_m_ = dcm_i_to_ecef_ * spacecraft_position_i_m_;
 
   // convert velocity vector in ECI to the vector in ECEF
   libra::Vector<3> earth_angular_velocity_i_rad_s{0.0};
   earth_angular_velocity_i_rad_s[2] = environment::earth_mean_angular_velocity_rad_s;
   libra::Vector<3> we_cross_r = OuterProduct(earth_angular_velocity_i_rad_s, spacecraft_position_i_m_);
   libra::Vector<3> velocity_we_cross_r = spacecraft_velocity_i_m_s_ - we_cross_r;
-  spacecraft_velocity_ecef_m_s_ = dcm_i_to_xcxf * velocity_we_cross_r;
+  spacecraft_velocity_ecef_m_s_ = dcm_i_to_ecef_ * velocity_we_cross_r;
+
+  is_ecef_evaluated_ = true;
 }
 
-void Orbit::TransformEcefToGeodetic(void) {
+void Orbit::EvaluateGeodetic(void) const {
+  if (is_geodetic_evaluated_) return;
+
+  EvaluateEcef();
   spacecraft_geodetic_position_.UpdateFromEcef(spacecraft_position_ecef_m_);
   // Check altitude
   if (spacecraft_geodetic_position_.GetAltitude_m() < 0.0) {
-    std::cout << "[Error Orbit]: The spacecraft altitude is smaller than zero." << std::endl;
-    std::cout << "               The orbit or disturbance setting may have something wrong." << std::endl;
-    std::exit(1);
+    StopByNegativeAltitude();
   }
+
+  is_geodetic_evaluated_ = true;
+}
+
+void Orbit::StopByNegativeAltitude(void) const {
+  std::cout << "[Error Orbit]: The spacecraft altitude is smaller than zero." << std::endl;
+  std::cout << "               The orbit or disturbance setting may have something wrong." << std::endl;
+  std::exit(1);
 }
 
 OrbitInitializeMode SetOrbitInitializeMode(const std::string initialize_mode) {
@@ -75,6 +121,9 @@ std::string Orbit::GetLogHeader() const {
   str_tmp += WriteScalar("spacecraft_latitude", "rad");
   str_tmp += WriteScalar("spacecraft_longitude", "rad");
   str_tmp += WriteScalar("spacecraft_altitude", "m");
+  if (is_stm_calc_enabled_) {
+    str_tmp += WriteMatrix("state_transition_matrix", "i", "-", 6, 6);
+  }
 
   return str_tmp;
 }
@@ -82,14 +131,50 @@ std::string Orbit::GetLogHeader() const {
 std::string Orbit::GetLogValue() const {
   std::string str_tmp = "";
 
+  const GeodeticPosition geodetic_position = GetGeodeticPosition();
   str_tmp += WriteVector(spacecraft_position_i_m_, 16);
-  str_tmp += WriteVector(spacecraft_position_ecef_m_, 16);
+  str_tmp += WriteVector(GetPosition_ecef_m(), 16);
   str_tmp += WriteVector(spacecraft_velocity_i_m_s_, 10);
   str_tmp += WriteVector(spacecraft_velocity_b_m_s_, 10);
   str_tmp += WriteVector(spacecraft_acceleration_i_m_s2_, 10);
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetLatitude_rad());
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetLongitude_rad());
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetAltitude_m());
+  str_tmp += WriteScalar(geodetic_position.GetLatitude_rad());
+  str_tmp += WriteScalar(geodetic_position.GetLongitude_rad());
+  str_tmp += WriteScalar(geodetic_position.GetAltitude_m());
+  if (is_stm_calc_enabled_) {
+    str_tmp += WriteMatrix(state_transition_matrix_, 10);
+  }
 
   return str_tmp;
 }
+
+void Orbit::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(is_calc_enabled_);
+  writer.Write(is_stm_calc_enabled_);
+  writer.Write(spacecraft_position_i_m_);
+  writer.Write(GetPosition_ecef_m());
+  writer.Write(GetGeodeticPosition());
+  writer.Write(spacecraft_velocity_i_m_s_);
+  writer.Write(spacecraft_velocity_b_m_s_);
+  writer.Write(GetVelocity_ecef_m_s());
+  writer.Write(spacecraft_acceleration_i_m_s2_);
+  writer.Write(spacecraft_acceleration_partial_derivative_i_s2_);
+  writer.Write(state_transition_matrix_);
+}
+
+void Orbit::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(is_calc_enabled_);
+  reader.Read(is_stm_calc_enabled_);
+  reader.Read(spacecraft_position_i_m_);
+  reader.Read(spacecraft_position_ecef_m_);
+  reader.Read(spacecraft_geodetic_position_);
+  reader.Read(spacecraft_velocity_i_m_s_);
+  reader.Read(spacecraft_velocity_b_m_s_);
+  reader.Read(spacecraft_velocity_ecef_m_s_);
+  reader.Read(spacecraft_acceleration_i_m_s2_);
+  reader.Read(spacecraft_acceleration_partial_derivative_i_s2_);
+  reader.Read(state_transition_matrix_);
+
+  // The derived states are restored as the states of this step
+  is_ecef_evaluated_ = true;
+  is_geodetic_evaluated_ = true;
+}
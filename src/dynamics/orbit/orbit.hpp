@@ -15,6 +15,8 @@
 #include <math_physics/math/matrix_vector.hpp>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <mutex>
+#include <utilities/checkpoint.hpp>
 
 /**
  * @enum OrbitPropagateMode
@@ -25,7 +27,9 @@ enum class OrbitPropagateMode {
   kSgp4,           //!< SGP4 propagation using TLE without thruster maneuver
   kRelativeOrbit,  //!< Relative dynamics (for formation flying simulation)
   kKepler,         //!< Kepler orbit propagation without disturbances and thruster maneuver
-  kEncke           //!< Encke orbit propagation with disturbances and thruster maneuver
+  kEncke,          //!< Encke orbit propagation with disturbances and thruster maneuver
+  kMeanElement,    //!< Mean element propagation with averaged perturbations without disturbances and thruster maneuver
+  kEphemeris       //!< Replay of a precomputed ephemeris file without disturbances and thruster maneuver
 };
 
 /**
@@ -42,7 +46,7 @@ enum class OrbitInitializeMode {
  * @class Orbit
  * @brief Base class of orbit propagation
  */
-class Orbit : public ILoggable {
+class Orbit : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn Orbit
@@ -93,7 +97,7 @@ class Orbit : public ILoggable {
    * @fn GetPosition_ecef_m
    * @brief Return spacecraft position in the ECEF frame [m]
    */
-  inline libra::Vector<3> GetPosition_ecef_m() const { return spacecraft_position_ecef_m_; }
+  libra::Vector<3> GetPosition_ecef_m() const;
   /**
    * @fn GetVelocity_i_m_s
    * @brief Return spacecraft velocity in the inertial frame [m/s]
@@ -108,22 +112,33 @@ class Orbit : public ILoggable {
    * @fn GetVelocity_ecef_m_s
    * @brief Return spacecraft velocity in the ECEF frame [m/s]
    */
-  inline libra::Vector<3> GetVelocity_ecef_m_s() const { return spacecraft_velocity_ecef_m_s_; }
+  libra::Vector<3> GetVelocity_ecef_m_s() const;
   /**
    * @fn GetGeodeticPosition
    * @brief Return spacecraft position in the geodetic frame [m]
    */
-  inline GeodeticPosition GetGeodeticPosition() const { return spacecraft_geodetic_position_; }
+  GeodeticPosition GetGeodeticPosition() const;
+  /**
+   * @fn GetIsStmCalcEnabled
+   * @brief Return calculate flag of the state transition matrix
+   */
+  inline bool GetIsStmCalcEnabled() const { return is_stm_calc_enabled_; }
+  /**
+   * @fn GetStateTransitionMatrix
+   * @brief Return state transition matrix of the position and velocity in the inertial frame from the initial epoch
+   */
+  inline libra::Matrix<6, 6> GetStateTransitionMatrix() const { return state_transition_matrix_; }
 
   // TODO delete the following functions
-  inline double GetLatitude_rad() const { return spacecraft_geodetic_position_.GetLatitude_rad(); }
-  inline double GetLongitude_rad() const { return spacecraft_geodetic_position_.GetLongitude_rad(); }
-  inline double GetAltitude_m() const { return spacecraft_geodetic_position_.GetAltitude_m(); }
+  inline double GetLatitude_rad() const { return GetGeodeticPosition().GetLatitude_rad(); }
+  inline double GetLongitude_rad() const { return GetGeodeticPosition().GetLongitude_rad(); }
+  inline double GetAltitude_m() const { return GetGeodeticPosition().GetAltitude_m(); }
   inline libra::Vector<3> GetLatLonAlt() const {
+    const GeodeticPosition geodetic_position = GetGeodeticPosition();
     libra::Vector<3> vec;
-    vec(0) = spacecraft_geodetic_position_.GetLatitude_rad();
-    vec(1) = spacecraft_geodetic_position_.GetLongitude_rad();
-    vec(2) = spacecraft_geodetic_position_.GetAltitude_m();
+    vec(0) = geodetic_position.GetLatitude_rad();
+    vec(1) = geodetic_position.GetLongitude_rad();
+    vec(2) = geodetic_position.GetAltitude_m();
     return vec;
   }
 
@@ -133,6 +148,17 @@ class Orbit : public ILoggable {
    * @brief Set calculate flag
    */
   inline void SetIsCalcEnabled(const bool is_calc_enabled) { is_calc_enabled_ = is_calc_enabled; }
+  /**
+   * @fn SetIsStmCalcEnabled
+   * @brief Set calculate flag of the state transition matrix
+   * @note The state transition matrix is propagated only by the propagators supporting the variational equation
+   */
+  inline void SetIsStmCalcEnabled(const bool is_stm_calc_enabled) { is_stm_calc_enabled_ = is_stm_calc_enabled; }
+  /**
+   * @fn ResetStateTransitionMatrix
+   * @brief Reset the state transition matrix to the identity matrix
+   */
+  inline void ResetStateTransitionMatrix() { state_transition_matrix_ = libra::MakeIdentityMatrix<6>(); }
   /**
    * @fn SetAcceleration_i_m_s2
    * @brief Set acceleration in the inertial frame [m/s2]
@@ -154,6 +180,20 @@ class Orbit : public ILoggable {
    * @brief Add acceleration in the inertial frame [m/s2]
    */
   inline void AddAcceleration_i_m_s2(const libra::Vector<3> acceleration_i_m_s2) { spacecraft_acceleration_i_m_s2_ += acceleration_i_m_s2; }
+  /**
+   * @fn SetAccelerationPartialDerivative_i_s2
+   * @brief Set partial derivative of the acceleration with respect to the position in the inertial frame [1/s2]
+   */
+  inline void SetAccelerationPartialDerivative_i_s2(const libra::Matrix<3, 3> acceleration_partial_derivative_i_s2) {
+    spacecraft_acceleration_partial_derivative_i_s2_ = acceleration_partial_derivative_i_s2;
+  }
+  /**
+   * @fn AddAccelerationPartialDerivative_i_s2
+   * @brief Add partial derivative of the acceleration with respect to the position in the inertial frame [1/s2]
+   */
+  inline void AddAccelerationPartialDerivative_i_s2(const libra::Matrix<3, 3> acceleration_partial_derivative_i_s2) {
+    spacecraft_acceleration_partial_derivative_i_s2_ += acceleration_partial_derivative_i_s2;
+  }
   /**
    * @fn AddForce_i_N
    * @brief Add force
@@ -171,6 +211,13 @@ class Orbit : public ILoggable {
    * @brief Calculate and return quaternion from the inertial frame to the LVLH frame
    */
   libra::Quaternion CalcQuaternion_i2lvlh() const;
+  /**
+   * @fn CalcQuaternion_i2lvlh
+   * @brief Calculate and return quaternion from the inertial frame to the LVLH frame of the given orbital state
+   * @param [in] position_i_m: Position of the spacecraft in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity of the spacecraft in the inertial frame [m/s]
+   */
+  static libra::Quaternion CalcQuaternion_i2lvlh(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s);
 
   // Override ILoggable
   /**
@@ -184,35 +231,72 @@ class Orbit : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the orbit state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the orbit state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  protected:
   const CelestialInformation* celestial_information_;  //!< Celestial information
 
   // Settings
   bool is_calc_enabled_ = false;       //!< Calculate flag
+  bool is_stm_calc_enabled_ = false;   //!< Calculate flag of the state transition matrix
   OrbitPropagateMode propagate_mode_;  //!< Propagation mode
 
-  libra::Vector<3> spacecraft_position_i_m_;       //!< Spacecraft position in the inertial frame [m]
-  libra::Vector<3> spacecraft_position_ecef_m_;    //!< Spacecraft position in the ECEF frame [m]
-  GeodeticPosition spacecraft_geodetic_position_;  //!< Spacecraft position in the Geodetic frame
-
-  libra::Vector<3> spacecraft_velocity_i_m_s_;     //!< Spacecraft velocity in the inertial frame [m/s]
-  libra::Vector<3> spacecraft_velocity_b_m_s_;     //!< Spacecraft velocity in the body frame [m/s]
-  libra::Vector<3> spacecraft_velocity_ecef_m_s_;  //!< Spacecraft velocity in the ECEF frame [m/s]
+  libra::Vector<3> spacecraft_position_i_m_;    //!< Spacecraft position in the inertial frame [m]
+  libra::Vector<3> spacecraft_velocity_i_m_s_;  //!< Spacecraft velocity in the inertial frame [m/s]
+  libra::Vector<3> spacecraft_velocity_b_m_s_;  //!< Spacecraft velocity in the body frame [m/s]
 
   libra::Vector<3> spacecraft_acceleration_i_m_s2_;  //!< Spacecraft acceleration in the inertial frame [m/s2]
                                                      //!< NOTE: Clear to zero at the end of the Propagate function
 
+  libra::Matrix<3, 3> spacecraft_acceleration_partial_derivative_i_s2_{0.0};      //!< Partial derivative of the acceleration [1/s2]
+                                                                                  //!< NOTE: The two-body term is not included
+  libra::Matrix<6, 6> state_transition_matrix_ = libra::MakeIdentityMatrix<6>();  //!< State transition matrix of the position and velocity
+
   // Frame Conversion TODO: consider other planet
   /**
-   * @fn TransformEciToEcef
-   * @brief Transform states from the ECI frame to ECEF frame
+   * @fn ResetDerivedStates
+   * @brief Keep the DCM from the ECI frame to the ECEF frame of this step and mark the ECEF and geodetic states as outdated
+   * @note Call after the inertial states are updated. The ECEF and geodetic states are calculated at the first access in the step.
+   */
+  void ResetDerivedStates(void);
+
+ private:
+  // States derived from the inertial states at the first access
+  libra::Matrix<3, 3> dcm_i_to_ecef_ = libra::MakeIdentityMatrix<3>();  //!< DCM from the ECI frame to the ECEF frame of this step
+  mutable libra::Vector<3> spacecraft_position_ecef_m_{0.0};             //!< Spacecraft position in the ECEF frame [m]
+  mutable libra::Vector<3> spacecraft_velocity_ecef_m_s_{0.0};           //!< Spacecraft velocity in the ECEF frame [m/s]
+  mutable GeodeticPosition spacecraft_geodetic_position_;                //!< Spacecraft position in the Geodetic frame
+  mutable bool is_ecef_evaluated_ = false;                               //!< Flag of the ECEF states are calculated in this step
+  mutable bool is_geodetic_evaluated_ = false;                           //!< Flag of the geodetic position is calculated in this step
+  mutable std::mutex derived_state_mutex_;                               //!< Mutex of the derived states read by other spacecraft in parallel
+
+  /**
+   * @fn EvaluateEcef
+   * @brief Transform states from the ECI frame to ECEF frame if they are not calculated in this step
+   * @note The derived state mutex must be locked
+   */
+  void EvaluateEcef(void) const;
+  /**
+   * @fn EvaluateGeodetic
+   * @brief Transform states from the ECEF frame to the geodetic frame if they are not calculated in this step
+   * @note The derived state mutex must be locked
    */
-  void TransformEciToEcef(void);
+  void EvaluateGeodetic(void) const;
   /**
-   * @fn TransformEcefToGeodetic
-   * @brief Transform states from the ECEF frame to the geodetic frame
+   * @fn StopByNegativeAltitude
+   * @brief Show the error message and stop the simulation when the spacecraft altitude is smaller than zero
    */
-  void TransformEcefToGeodetic(void);
+  void StopByNegativeAltitude(void) const;
 };
 
 OrbitInitializeMode SetOrbitInitializeMode(const std::string initialize_mode);
@@ -63,8 +63,7 @@ void RelativeOrbit::InitializeState(libra::Vector<3> relative_position_lvlh_m, l
                  0.0);
   }
 
-  TransformEciToEcef();
-  TransformEcefToGeodetic();
+  ResetDerivedStates();
 }
 
 void RelativeOrbit::CalculateSystemMatrix(RelativeOrbitModel relative_dynamics_model_type, const Orbit* reference_sat_orbit,
@@ -116,8 +115,25 @@ void RelativeOrbit::Propagate(const double end_time_s, const double current_time
 
   spacecraft_position_i_m_ = q_lvlh2i.FrameConversion(relative_position_lvlh_m_) + reference_sat_position_i;
   spacecraft_velocity_i_m_s_ = q_lvlh2i.FrameConversion(relative_velocity_lvlh_m_s_) + reference_sat_velocity_i;
-  TransformEciToEcef();
-  TransformEcefToGeodetic();
+  ResetDerivedStates();
+}
+
+void RelativeOrbit::SaveCheckpoint(CheckpointWriter& writer) const {
+  Orbit::SaveCheckpoint(writer);
+  libra::OrdinaryDifferentialEquation<6>::SaveCheckpoint(writer);
+  writer.Write(propagation_time_s_);
+  writer.Write(stm_);
+  writer.Write(relative_position_lvlh_m_);
+  writer.Write(relative_velocity_lvlh_m_s_);
+}
+
+void RelativeOrbit::LoadCheckpoint(CheckpointReader& reader) {
+  Orbit::LoadCheckpoint(reader);
+  libra::OrdinaryDifferentialEquation<6>::LoadCheckpoint(reader);
+  reader.Read(propagation_time_s_);
+  reader.Read(stm_);
+  reader.Read(relative_position_lvlh_m_);
+  reader.Read(relative_velocity_lvlh_m_s_);
 }
 
 void RelativeOrbit::PropagateRk4(double elapsed_sec) {
@@ -57,6 +57,17 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the orbit state, the relative state, and the integration state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the orbit state, the relative state, and the integration state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   // Override OrdinaryDifferentialEquation
   /**
    * @fn DerivativeFunction
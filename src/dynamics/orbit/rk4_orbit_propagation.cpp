@@ -10,8 +10,12 @@
 
 Rk4OrbitPropagation::Rk4OrbitPropagation(const CelestialInformation* celestial_information, double gravity_constant_m3_s2, double time_step_s,
                                          libra::Vector<3> position_i_m, libra::Vector<3> velocity_i_m_s, double initial_time_s)
-    : Orbit(celestial_information), OrdinaryDifferentialEquation<6>(time_step_s), gravity_constant_m3_s2_(gravity_constant_m3_s2) {
+    : Orbit(celestial_information),
+      OrdinaryDifferentialEquation<6>(time_step_s),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      variational_equation_integrator_(time_step_s, variational_equation_ode_) {
   propagate_mode_ = OrbitPropagateMode::kRk4;
+  variational_equation_ode_.SetGravityConstant_m3_s2(gravity_constant_m3_s2_);
 
   propagation_time_s_ = 0.0;
   propagation_step_s_ = time_step_s;
@@ -58,14 +62,17 @@ void Rk4OrbitPropagation::Initialize(libra::Vector<3> position_i_m, libra::Vecto
   spacecraft_velocity_i_m_s_[1] = init_state[4];
   spacecraft_velocity_i_m_s_[2] = init_state[5];
 
-  TransformEciToEcef();
-  TransformEcefToGeodetic();
+  ResetDerivedStates();
 }
 
 void Rk4OrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
   UNUSED(current_time_jd);
 
   if (!is_calc_enabled_) return;
+  if (is_stm_calc_enabled_) {
+    PropagateWithStateTransitionMatrix(end_time_s);
+    return;
+  }
 
   SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
   while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
@@ -83,6 +90,48 @@ void Rk4OrbitPropagation::Propagate(const double end_time_s, const double curren
   spacecraft_velocity_i_m_s_[1] = GetState()[4];
   spacecraft_velocity_i_m_s_[2] = GetState()[5];
 
-  TransformEciToEcef();
-  TransformEcefToGeodetic();
+  ResetDerivedStates();
+}
+
+void Rk4OrbitPropagation::SaveCheckpoint(CheckpointWriter& writer) const {
+  Orbit::SaveCheckpoint(writer);
+  libra::OrdinaryDifferentialEquation<6>::SaveCheckpoint(writer);
+  writer.Write(propagation_time_s_);
+}
+
+void Rk4OrbitPropagation::LoadCheckpoint(CheckpointReader& reader) {
+  Orbit::LoadCheckpoint(reader);
+  libra::OrdinaryDifferentialEquation<6>::LoadCheckpoint(reader);
+  reader.Read(propagation_time_s_);
+}
+
+void Rk4OrbitPropagation::PropagateWithStateTransitionMatrix(const double end_time_s) {
+  variational_equation_ode_.SetAcceleration_i_m_s2(spacecraft_acceleration_i_m_s2_);
+  variational_equation_ode_.SetAccelerationPartialDerivative_i_s2(spacecraft_acceleration_partial_derivative_i_s2_);
+
+  libra::Vector<42> initial_state =
+      variational_equation_ode_.SetStateFromPhysicalQuantities(spacecraft_position_i_m_, spacecraft_velocity_i_m_s_, state_transition_matrix_);
+  auto integrator = variational_equation_integrator_.GetIntegrator();
+  integrator->SetState(propagation_time_s_, initial_state);
+  integrator->SetStepWidth(propagation_step_s_);
+  while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+    integrator->Integrate();
+    propagation_time_s_ += propagation_step_s_;
+  }
+  integrator->SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation Δt
+  integrator->Integrate();
+  propagation_time_s_ = end_time_s;
+
+  variational_equation_ode_.SetPhysicalQuantitiesFromState(integrator->GetState(), spacecraft_position_i_m_, spacecraft_velocity_i_m_s_,
+                                                           state_transition_matrix_);
+
+  // Keep the state of OrdinaryDifferentialEquation consistent to switch the STM calculation off
+  libra::Vector<6> state;
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = spacecraft_position_i_m_[i];
+    state[i + 3] = spacecraft_velocity_i_m_s_[i];
+  }
+  Setup(end_time_s, state);
+
+  ResetDerivedStates();
 }
@@ -8,7 +8,9 @@
 
 #include <environment/global/celestial_information.hpp>
 #include <math_physics/math/ordinary_differential_equation.hpp>
+#include <math_physics/numerical_integration/numerical_integrator_manager.hpp>
 
+#include "ode_orbit_variational_equation.hpp"
 #include "orbit.hpp"
 
 /**
@@ -54,11 +56,32 @@ class Rk4OrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEqua
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the orbit state and the integration state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the orbit state and the integration state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   double gravity_constant_m3_s2_;  //!< Gravity constant [m3/s2]
   double propagation_time_s_;      //!< Simulation current time for numerical integration by RK4 [sec]
   double propagation_step_s_;      //!< Step width for RK4 [sec]
 
+  libra::numerical_integration::OrbitVariationalEquationOde variational_equation_ode_;            //!< ODE of the orbit with the variational equation
+  libra::numerical_integration::NumericalIntegratorManager<42> variational_equation_integrator_;  //!< Integrator for the variational equation
+
+  /**
+   * @fn PropagateWithStateTransitionMatrix
+   * @brief Propagate orbit and state transition matrix simultaneously
+   * @param [in] end_time_s: End time of simulation [sec]
+   */
+  void PropagateWithStateTransitionMatrix(const double end_time_s);
+
   /**
    * @fn Initialize
    * @brief Initialize function
@@ -63,6 +63,15 @@ void Sgp4OrbitPropagation::Propagate(const double end_time_s, const double curre
     spacecraft_velocity_i_m_s_[i] = velocity_i_km_s[i] * 1000.0;
   }
 
-  TransformEciToEcef();
-  TransformEcefToGeodetic();
+  ResetDerivedStates();
+}
+
+void Sgp4OrbitPropagation::SaveCheckpoint(CheckpointWriter& writer) const {
+  Orbit::SaveCheckpoint(writer);
+  writer.Write(sgp4_data_);
+}
+
+void Sgp4OrbitPropagation::LoadCheckpoint(CheckpointReader& reader) {
+  Orbit::LoadCheckpoint(reader);
+  reader.Read(sgp4_data_);
 }
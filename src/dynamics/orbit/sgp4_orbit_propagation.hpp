@@ -40,6 +40,17 @@ class Sgp4OrbitPropagation : public Orbit {
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the orbit state and the SGP4 data into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the orbit state and the SGP4 data from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   gravconsttype gravity_constant_setting_;  //!< Gravity constant value type
   elsetrec sgp4_data_;                      //!< Structure data for SGP4 library
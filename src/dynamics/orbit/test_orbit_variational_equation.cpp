@@ -0,0 +1,188 @@
+/**
+ * @file test_orbit_variational_equation.cpp
+ * @brief Test codes for the state transition matrix of the orbit and the partial derivatives of the accelerations with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <disturbances/third_body_gravity.hpp>
+#include <math_physics/gravity/gravity_potential.hpp>
+#include <math_physics/numerical_integration/runge_kutta_4.hpp>
+
+#include "ode_orbit_variational_equation.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = 3.986004418e14;  //!< Gravity constant of the Earth [m3/s2]
+
+/**
+ * @fn Propagate
+ * @brief Propagate the orbit and the state transition matrix with RK4
+ * @param [in] initial_state: Initial position and velocity in the inertial frame [m, m/s]
+ * @param [in] duration_s: Propagation duration [s]
+ * @param [out] state_transition_matrix: State transition matrix from the initial state
+ * @return Position and velocity at the end of the propagation [m, m/s]
+ */
+libra::Vector<6> Propagate(const libra::Vector<6>& initial_state, const double duration_s, libra::Matrix<6, 6>& state_transition_matrix) {
+  const double step_width_s = 1.0;
+  libra::numerical_integration::OrbitVariationalEquationOde ode;
+  ode.SetGravityConstant_m3_s2(kGravityConstant_m3_s2);
+  libra::numerical_integration::RungeKutta4<42> integrator(step_width_s, ode);
+
+  libra::Vector<3> position_i_m, velocity_i_m_s;
+  for (size_t i = 0; i < 3; i++) {
+    position_i_m[i] = initial_state[i];
+    velocity_i_m_s[i] = initial_state[i + 3];
+  }
+  integrator.SetState(0.0, ode.SetStateFromPhysicalQuantities(position_i_m, velocity_i_m_s, libra::MakeIdentityMatrix<6>()));
+  const size_t number_of_steps = (size_t)(duration_s / step_width_s);
+  for (size_t step = 0; step < number_of_steps; step++) {
+    integrator.Integrate();
+  }
+
+  ode.SetPhysicalQuantitiesFromState(integrator.GetState(), position_i_m, velocity_i_m_s, state_transition_matrix);
+  libra::Vector<6> state;
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = position_i_m[i];
+    state[i + 3] = velocity_i_m_s[i];
+  }
+  return state;
+}
+
+/**
+ * @fn CalcRotationMatrix
+ * @brief Return the rotation matrix around the Z axis
+ * @param [in] angle_rad: Rotation angle [rad]
+ */
+libra::Matrix<3, 3> CalcRotationMatrix(const double angle_rad) {
+  libra::Matrix<3, 3> rotation_matrix = libra::MakeIdentityMatrix<3>();
+  rotation_matrix[0][0] = cos(angle_rad);
+  rotation_matrix[0][1] = sin(angle_rad);
+  rotation_matrix[1][0] = -sin(angle_rad);
+  rotation_matrix[1][1] = cos(angle_rad);
+  return rotation_matrix;
+}
+}  // namespace
+
+/**
+ * @brief Test for the state transition matrix compared with the central finite differences of the perturbed initial states
+ */
+TEST(OrbitVariationalEquation, StateTransitionMatrix) {
+  // Two-body LEO at the altitude of 500 km with the inclination of 51.6 deg
+  const double radius_m = 6878.137e3;
+  const double speed_m_s = sqrt(kGravityConstant_m3_s2 / radius_m);
+  const double inclination_rad = 51.6 * M_PI / 180.0;
+  libra::Vector<6> initial_state(0.0);
+  initial_state[0] = radius_m;
+  initial_state[4] = speed_m_s * cos(inclination_rad);
+  initial_state[5] = speed_m_s * sin(inclination_rad);
+  const double duration_s = 1500.0;
+
+  libra::Matrix<6, 6> state_transition_matrix;
+  const libra::Vector<6> final_state = Propagate(initial_state, duration_s, state_transition_matrix);
+  // The circular orbit keeps the radius
+  double final_radius_m = 0.0;
+  for (size_t i = 0; i < 3; i++) final_radius_m += final_state[i] * final_state[i];
+  EXPECT_NEAR(radius_m, sqrt(final_radius_m), 1.0e-3);
+
+  // Central finite differences of the re-propagated perturbed initial states, column by column
+  const double perturbations[6] = {1.0, 1.0, 1.0, 1.0e-3, 1.0e-3, 1.0e-3};
+  for (size_t j = 0; j < 6; j++) {
+    libra::Vector<6> plus_state = initial_state;
+    libra::Vector<6> minus_state = initial_state;
+    plus_state[j] += perturbations[j];
+    minus_state[j] -= perturbations[j];
+    libra::Matrix<6, 6> unused_matrix;
+    const libra::Vector<6> plus_final_state = Propagate(plus_state, duration_s, unused_matrix);
+    const libra::Vector<6> minus_final_state = Propagate(minus_state, duration_s, unused_matrix);
+
+    double column_norm = 0.0;
+    for (size_t i = 0; i < 6; i++) column_norm += state_transition_matrix[i][j] * state_transition_matrix[i][j];
+    column_norm = sqrt(column_norm);
+    for (size_t i = 0; i < 6; i++) {
+      const double numerical_element = (plus_final_state[i] - minus_final_state[i]) / (2.0 * perturbations[j]);
+      EXPECT_NEAR(numerical_element, state_transition_matrix[i][j], 1.0e-6 * column_norm) << "element (" << i << ", " << j << ")";
+    }
+  }
+}
+
+/**
+ * @brief Test for the partial derivative of the third body gravity compared with the numerical differentiation
+ */
+TEST(OrbitVariationalEquation, ThirdBodyPartialDerivative) {
+  ThirdBodyGravity third_body_gravity(std::set<std::string>{"MOON"});
+  const double gravity_constant_m3_s2 = 4.9028e12;
+  libra::Vector<3> moon_position_i_m;
+  moon_position_i_m[0] = 3.0e8;
+  moon_position_i_m[1] = -2.0e8;
+  moon_position_i_m[2] = 1.0e8;
+  libra::Vector<3> spacecraft_position_i_m;
+  spacecraft_position_i_m[0] = 6000.0e3;
+  spacecraft_position_i_m[1] = 2000.0e3;
+  spacecraft_position_i_m[2] = -2500.0e3;
+
+  const libra::Matrix<3, 3> partial_derivative_i_s2 =
+      third_body_gravity.CalcPartialDerivative_i_s2(moon_position_i_m - spacecraft_position_i_m, gravity_constant_m3_s2);
+
+  const double d_r_m = 10.0;
+  for (size_t j = 0; j < 3; j++) {
+    libra::Vector<3> plus_position_i_m = spacecraft_position_i_m;
+    libra::Vector<3> minus_position_i_m = spacecraft_position_i_m;
+    plus_position_i_m[j] += d_r_m;
+    minus_position_i_m[j] -= d_r_m;
+    const libra::Vector<3> plus_acceleration_i_m_s2 =
+        third_body_gravity.CalcAcceleration_i_m_s2(moon_position_i_m, moon_position_i_m - plus_position_i_m, gravity_constant_m3_s2);
+    const libra::Vector<3> minus_acceleration_i_m_s2 =
+        third_body_gravity.CalcAcceleration_i_m_s2(moon_position_i_m, moon_position_i_m - minus_position_i_m, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      const double numerical_element = (plus_acceleration_i_m_s2[i] - minus_acceleration_i_m_s2[i]) / (2.0 * d_r_m);
+      // The partial derivative is about 1e-13 /s2
+      EXPECT_NEAR(numerical_element, partial_derivative_i_s2[i][j], 1.0e-19) << "element (" << i << ", " << j << ")";
+    }
+  }
+}
+
+/**
+ * @brief Test for the partial derivative of the geopotential transformed into the inertial frame compared with the numerical differentiation
+ */
+TEST(OrbitVariationalEquation, GeopotentialPartialDerivative) {
+  // Normalized coefficients up to degree 4 in the order of magnitude of the Earth
+  const size_t degree = 4;
+  std::vector<std::vector<double>> cosine_coefficients(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> sine_coefficients(degree + 1, std::vector<double>(degree + 1, 0.0));
+  cosine_coefficients[0][0] = 1.0;
+  cosine_coefficients[2][0] = -4.84165e-4;
+  cosine_coefficients[2][2] = 2.43938e-6;
+  sine_coefficients[2][2] = -1.40027e-6;
+  cosine_coefficients[3][0] = 9.57161e-7;
+  cosine_coefficients[3][1] = 2.03046e-6;
+  sine_coefficients[3][1] = 2.48200e-7;
+  cosine_coefficients[4][0] = 5.39966e-7;
+  cosine_coefficients[4][4] = -9.55436e-8;
+  GravityPotential gravity_potential(degree, cosine_coefficients, sine_coefficients);
+
+  // Same transformation as Geopotential::Update
+  const libra::Matrix<3, 3> dcm_i_to_ecef = CalcRotationMatrix(0.7);
+  const libra::Matrix<3, 3> dcm_ecef_to_i = dcm_i_to_ecef.Transpose();
+  libra::Vector<3> position_i_m;
+  position_i_m[0] = 4000.0e3;
+  position_i_m[1] = -3000.0e3;
+  position_i_m[2] = 4500.0e3;
+  const libra::Matrix<3, 3> partial_derivative_i_s2 =
+      dcm_ecef_to_i * gravity_potential.CalcPartialDerivative_xcxf_s2(dcm_i_to_ecef * position_i_m) * dcm_i_to_ecef;
+
+  const double d_r_m = 1.0;
+  for (size_t j = 0; j < 3; j++) {
+    libra::Vector<3> plus_position_i_m = position_i_m;
+    libra::Vector<3> minus_position_i_m = position_i_m;
+    plus_position_i_m[j] += d_r_m;
+    minus_position_i_m[j] -= d_r_m;
+    const libra::Vector<3> plus_acceleration_i_m_s2 = dcm_ecef_to_i * gravity_potential.CalcAcceleration_xcxf_m_s2(dcm_i_to_ecef * plus_position_i_m);
+    const libra::Vector<3> minus_acceleration_i_m_s2 =
+        dcm_ecef_to_i * gravity_potential.CalcAcceleration_xcxf_m_s2(dcm_i_to_ecef * minus_position_i_m);
+    for (size_t i = 0; i < 3; i++) {
+      const double numerical_element = (plus_acceleration_i_m_s2[i] - minus_acceleration_i_m_s2[i]) / (2.0 * d_r_m);
+      // The partial derivative is about 1e-6 /s2
+      EXPECT_NEAR(numerical_element, partial_derivative_i_s2[i][j], 1.0e-11) << "element (" << i << ", " << j << ")";
+    }
+  }
+}
@@ -211,6 +211,40 @@ string Temperature::GetLogValue() const {
   return str_tmp;
 }
 
+void Temperature::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(propagation_time_s_);
+  for (size_t i = 0; i < node_num_; i++) {
+    writer.Write(nodes_[i].GetTemperature_K());
+    writer.Write(heatloads_[i].GetSolarHeatload_W());
+    writer.Write(heatloads_[i].GetInternalHeatload_W());
+    writer.Write(heatloads_[i].GetHeaterHeatload_W());
+  }
+  for (auto itr = heaters_.begin(); itr != heaters_.end(); ++itr) {
+    writer.Write(itr->GetHeaterStatus());
+  }
+}
+
+void Temperature::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(propagation_time_s_);
+  for (size_t i = 0; i < node_num_; i++) {
+    double temperature_K, solar_heatload_W, internal_heatload_W, heater_heatload_W;
+    reader.Read(temperature_K);
+    reader.Read(solar_heatload_W);
+    reader.Read(internal_heatload_W);
+    reader.Read(heater_heatload_W);
+    nodes_[i].SetTemperature_K(temperature_K);
+    heatloads_[i].SetSolarHeatload_W(solar_heatload_W);
+    heatloads_[i].SetInternalHeatload_W(internal_heatload_W);
+    heatloads_[i].SetHeaterHeatload_W(heater_heatload_W);
+    heatloads_[i].UpdateTotalHeatload();
+  }
+  for (auto itr = heaters_.begin(); itr != heaters_.end(); ++itr) {
+    HeaterStatus heater_status;
+    reader.Read(heater_status);
+    itr->SetHeaterStatus(heater_status);
+  }
+}
+
 void Temperature::PrintParams(void) {
   cout << "< Print Thermal Parameters >" << endl;
   cout << "IsCalcEnabled: " << is_calc_enabled_ << endl;
@@ -15,6 +15,7 @@
 #include "heater_controller.hpp"
 #include "heatload.hpp"
 #include "node.hpp"
+#include <utilities/checkpoint.hpp>
 
 /**
  * @enum SolarCalcSetting
@@ -29,7 +30,7 @@ enum class SolarCalcSetting {
  * @class Temperature
  * @brief class to calculate temperature of all nodes
  */
-class Temperature : public ILoggable {
+class Temperature : public ILoggable, public ICheckpointable {
  protected:
   std::vector<std::vector<double>> conductance_matrix_W_K_;  // Coupling of node i and node j by heat conduction [W/K]
   std::vector<std::vector<double>> radiation_matrix_m2_;     // Coupling of node i and node j by thermal radiation [m2]
@@ -137,6 +138,18 @@ class Temperature : public ILoggable {
    */
   std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the node temperatures, the heater status, and the heatloads into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the node temperatures, the heater status, and the heatloads from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   /**
    * @fn UpdateHeaterStatus
    * @brief Update all heater status based on heater controller and temperature
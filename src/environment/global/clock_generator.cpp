@@ -5,31 +5,101 @@
 
 #include "clock_generator.hpp"
 
+#include <algorithm>
+
 ClockGenerator::~ClockGenerator() {}
 
-void ClockGenerator::RegisterComponent(ITickable* tickable) { components_.push_back(tickable); }
+void ClockGenerator::RegisterComponent(ITickable* tickable) {
+  if (registrations_.count(tickable) > 0) return;
+
+  const unsigned int prescaler = std::max(tickable->GetPrescaler(), 1u);
+  // The slot of the current count is already visited when the component is registered in a tick
+  TickGroup* group = GetGroup(prescaler, false, is_ticking_ ? timer_count_ + 1 : timer_count_);
+  Registration registration;
+  registration.group = group;
+  registration.member = group->members.insert(group->members.end(), Member{next_sequence_++, tickable});
+  registration.pending_entry = pending_components_.insert(pending_components_.end(), tickable);
+  registrations_[tickable] = registration;
+}
 
 void ClockGenerator::RemoveComponent(ITickable* tickable) {
-  for (auto itr = components_.begin(); itr != components_.end();) {
-    if (*itr == tickable) {
-      components_.erase(itr++);
-      break;
+  auto registration = registrations_.find(tickable);
+  if (registration == registrations_.end()) return;
+
+  registration->second.group->members.erase(registration->second.member);
+  if (registration->second.fast_group != nullptr) {
+    registration->second.fast_group->members.erase(registration->second.fast_member);
+  }
+  if (registration->second.is_pending) {
+    pending_components_.erase(registration->second.pending_entry);
+  }
+  registrations_.erase(registration);
+  // The component removed in a tick is not executed in the rest of the tick
+  for (DueMember& due_member : due_members_) {
+    if (due_member.tickable == tickable) due_member.tickable = nullptr;
+  }
+}
+
+void ClockGenerator::TickToComponents() {
+  // Check the fast update flag of the newly registered components
+  for (ITickable* tickable : pending_components_) {
+    Registration& registration = registrations_[tickable];
+    registration.is_pending = false;
+    if (tickable->GetNeedsFastUpdate()) {
+      AddToFastGroup(tickable, registration, timer_count_);
+    }
+  }
+  pending_components_.clear();
+
+  // Collect the due groups in the slot and reschedule them
+  std::vector<TickGroup*>& slot = wheel_[timer_count_ % kWheelSize];
+  std::vector<TickGroup*> due_groups;
+  for (auto itr = slot.begin(); itr != slot.end();) {
+    if ((*itr)->next_due_count == timer_count_) {
+      due_groups.push_back(*itr);
+      itr = slot.erase(itr);
     } else {
       ++itr;
     }
   }
-}
+  for (TickGroup* group : due_groups) {
+    for (const Member& member : group->members) {
+      due_members_.push_back(DueMember{member.sequence, group->is_fast, member.tickable});
+    }
+    group->next_due_count += group->prescaler;
+    wheel_[group->next_due_count % kWheelSize].push_back(group);
+  }
 
-void ClockGenerator::TickToComponents() {
-  // Update for each component
-  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
-    // Run MainRoutine
-    (*itr)->Tick(timer_count_);
-    // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
-    if ((*itr)->GetNeedsFastUpdate()) {
-      (*itr)->FastTick(timer_count_);
+  // Update for each component in order of registration
+  if (due_groups.size() > 1) {
+    std::sort(due_members_.begin(), due_members_.end(), [](const DueMember& lhs, const DueMember& rhs) {
+      return lhs.sequence != rhs.sequence ? lhs.sequence < rhs.sequence : lhs.is_fast < rhs.is_fast;
+    });
+  }
+  is_ticking_ = true;
+  for (size_t i = 0; i < due_members_.size(); i++) {
+    const DueMember due_member = due_members_[i];
+    ITickable* tickable = due_member.tickable;
+    if (tickable == nullptr) continue;
+    if (!due_member.is_fast) {
+      // Run MainRoutine
+      tickable->Tick(timer_count_);
+      if (due_members_[i].tickable == nullptr) continue;  // Removed by itself
+      if (tickable->GetNeedsFastUpdate()) {
+        Registration& registration = registrations_[tickable];
+        if (registration.fast_group == nullptr) {
+          // FastTick of this count is executed here since the due groups are already rescheduled
+          AddToFastGroup(tickable, registration, timer_count_ + 1);
+          if (timer_count_ % registration.fast_group->prescaler == 0) tickable->FastTick(timer_count_);
+        }
+      }
+    } else if (tickable->GetNeedsFastUpdate()) {
+      // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
+      tickable->FastTick(timer_count_);
     }
   }
+  is_ticking_ = false;
+  due_members_.clear();
   timer_count_++;  // TODO: Consider if "timer_count" is necessary
 }
 
@@ -38,3 +108,62 @@ void ClockGenerator::UpdateComponents(const SimulationTime* simulation_time) {
     TickToComponents();
   }
 }
+
+void ClockGenerator::ClearTimerCount(void) {
+  timer_count_ = 0;
+  Reschedule();
+}
+
+std::vector<ITickable*> ClockGenerator::GetComponents() const {
+  std::vector<std::pair<uint64_t, ITickable*>> sorted_components;
+  for (const auto& registration : registrations_) {
+    sorted_components.push_back(std::make_pair(registration.second.member->sequence, registration.first));
+  }
+  std::sort(sorted_components.begin(), sorted_components.end());
+
+  std::vector<ITickable*> components;
+  for (const auto& component : sorted_components) {
+    components.push_back(component.second);
+  }
+  return components;
+}
+
+void ClockGenerator::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(timer_count_);
+  Reschedule();
+}
+
+ClockGenerator::TickGroup* ClockGenerator::GetGroup(const unsigned int prescaler, const bool is_fast, const unsigned int first_count) {
+  const auto key = std::make_pair(prescaler, is_fast);
+  auto group = groups_.find(key);
+  if (group != groups_.end()) return &(group->second);
+
+  TickGroup& new_group = groups_[key];
+  new_group.prescaler = prescaler;
+  new_group.is_fast = is_fast;
+  new_group.next_due_count = CalcNextDueCount(prescaler, first_count);
+  wheel_[new_group.next_due_count % kWheelSize].push_back(&new_group);
+  return &new_group;
+}
+
+void ClockGenerator::AddToFastGroup(ITickable* tickable, Registration& registration, const unsigned int first_count) {
+  if (registration.fast_group != nullptr) return;
+  const unsigned int fast_prescaler = std::max(tickable->GetFastPrescaler(), 1u);
+  registration.fast_group = GetGroup(fast_prescaler, true, first_count);
+  registration.fast_member =
+      registration.fast_group->members.insert(registration.fast_group->members.end(), Member{registration.member->sequence, tickable});
+}
+
+unsigned int ClockGenerator::CalcNextDueCount(const unsigned int prescaler, const unsigned int first_count) const {
+  return (first_count + prescaler - 1) / prescaler * prescaler;
+}
+
+void ClockGenerator::Reschedule() {
+  for (auto& slot : wheel_) {
+    slot.clear();
+  }
+  for (auto& group : groups_) {
+    group.second.next_due_count = CalcNextDueCount(group.second.prescaler, timer_count_);
+    wheel_[group.second.next_due_count % kWheelSize].push_back(&(group.second));
+  }
+}
@@ -6,7 +6,14 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
 
+#include <array>
 #include <components/base/interface_tickable.hpp>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <utilities/checkpoint.hpp>
+#include <utility>
 #include <vector>
 
 #include "simulation_time.hpp"
@@ -14,9 +21,26 @@
 /**
  * @class ClockGenerator
  * @brief Class to generate clock for classes which have ITickable
+ * @details The components are grouped by their prescaler, and the groups are scheduled on a hashed timing wheel with their next due count. Each
+ *          tick visits only the groups which are due, and the due components are executed in order of registration.
  */
-class ClockGenerator {
+class ClockGenerator : public ICheckpointable {
  public:
+  /**
+   * @fn ClockGenerator
+   * @brief Constructor
+   */
+  ClockGenerator() = default;
+  /**
+   * @fn ClockGenerator
+   * @brief Copy constructor is deleted since the wheel refers the groups of this instance
+   */
+  ClockGenerator(const ClockGenerator&) = delete;
+  /**
+   * @fn operator=
+   * @brief Copy assignment is deleted since the wheel refers the groups of this instance
+   */
+  ClockGenerator& operator=(const ClockGenerator&) = delete;
   /**
    * @fn ~ClockGenerator
    * @brief Destructor
@@ -26,6 +50,7 @@ class ClockGenerator {
   /**
    * @fn RegisterComponent
    * @brief Register component which has ITickable
+   * @note The prescalers are read at the registration. The fast update flag is read at the next tick and at every tick of the component.
    * @param [in] tickable: Component class
    */
   void RegisterComponent(ITickable* tickable);
@@ -37,7 +62,7 @@ class ClockGenerator {
   void RemoveComponent(ITickable* tickable);
   /**
    * @fn TickToComponents
-   * @brief Execute tick function of all registered components
+   * @brief Execute tick function of all registered components which are due at the current timer count
    */
   void TickToComponents();
   /**
@@ -50,11 +75,103 @@ class ClockGenerator {
    * @fn ClearTimerCount
    * @brief Clear time count
    */
-  inline void ClearTimerCount(void) { timer_count_ = 0; }
+  void ClearTimerCount(void);
+  /**
+   * @fn GetComponents
+   * @brief Return registered components in the registration order
+   */
+  std::vector<ITickable*> GetComponents() const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the timer count into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const { writer.Write(timer_count_); }
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the timer count from the checkpoint and reschedule the components
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
 
  private:
-  std::vector<ITickable*> components_;  //!< Component list fot tick
-  unsigned int timer_count_;            //!< Timer count TODO: change to long?
+  /**
+   * @struct Member
+   * @brief Component in a tick group
+   */
+  struct Member {
+    uint64_t sequence;    //!< Registration order
+    ITickable* tickable;  //!< Component
+  };
+  /**
+   * @struct TickGroup
+   * @brief Components which have the same prescaler
+   */
+  struct TickGroup {
+    unsigned int prescaler;       //!< Frequency scale factor
+    bool is_fast;                 //!< Group for FastTick
+    unsigned int next_due_count;  //!< Timer count when the group is due next
+    std::list<Member> members;    //!< Components in the group
+  };
+  /**
+   * @struct Registration
+   * @brief Location of a registered component in the groups
+   */
+  struct Registration {
+    TickGroup* group;                               //!< Group for Tick
+    std::list<Member>::iterator member;             //!< Location in the group for Tick
+    TickGroup* fast_group = nullptr;                //!< Group for FastTick (nullptr when the fast update has not been required)
+    std::list<Member>::iterator fast_member;        //!< Location in the group for FastTick
+    bool is_pending = true;                         //!< Whether the fast update flag has not been checked yet
+    std::list<ITickable*>::iterator pending_entry;  //!< Location in the pending list
+  };
+  /**
+   * @struct DueMember
+   * @brief Component due at the current tick
+   */
+  struct DueMember {
+    uint64_t sequence;    //!< Registration order
+    bool is_fast;         //!< Due for FastTick
+    ITickable* tickable;  //!< Component
+  };
+
+  static const unsigned int kWheelSize = 256;  //!< Number of slots of the timing wheel
+
+  std::array<std::vector<TickGroup*>, kWheelSize> wheel_;       //!< Timing wheel of the groups hashed by the next due count
+  std::map<std::pair<unsigned int, bool>, TickGroup> groups_;   //!< Groups with the prescaler and the fast flag
+  std::unordered_map<ITickable*, Registration> registrations_;  //!< Registered components
+  std::list<ITickable*> pending_components_;                    //!< Components whose fast update flag is not checked yet
+  std::vector<DueMember> due_members_;                          //!< Due components of the current tick
+  uint64_t next_sequence_ = 0;                                  //!< Registration order of the next component
+  unsigned int timer_count_ = 0;                                //!< Timer count TODO: change to long?
+  bool is_ticking_ = false;                                     //!< Whether the due components are being executed
+
+  /**
+   * @fn GetGroup
+   * @brief Return the group of the prescaler. The group is created and scheduled when it does not exist.
+   * @param [in] prescaler: Frequency scale factor
+   * @param [in] is_fast: Group for FastTick
+   * @param [in] first_count: Earliest timer count when the created group can be due
+   */
+  TickGroup* GetGroup(const unsigned int prescaler, const bool is_fast, const unsigned int first_count);
+  /**
+   * @fn AddToFastGroup
+   * @brief Add the component to the group for FastTick
+   * @param [in] tickable: Component
+   * @param [in] registration: Registration of the component
+   * @param [in] first_count: Earliest timer count when the created group can be due
+   */
+  void AddToFastGroup(ITickable* tickable, Registration& registration, const unsigned int first_count);
+  /**
+   * @fn CalcNextDueCount
+   * @brief Return the smallest multiple of the prescaler which is not smaller than the first count
+   */
+  unsigned int CalcNextDueCount(const unsigned int prescaler, const unsigned int first_count) const;
+  /**
+   * @fn Reschedule
+   * @brief Rebuild the timing wheel from the current timer count
+   */
+  void Reschedule();
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
@@ -0,0 +1,68 @@
+/**
+ * @file event_scheduler.cpp
+ * @brief Priority queue scheduler of periodic and one-shot events on the simulation step count
+ */
+
+#include "event_scheduler.hpp"
+
+#include <iostream>
+#include <limits>
+
+size_t EventScheduler::AddPeriodicEvent(const int64_t first_step, const int64_t period_steps, const std::function<void()> callback) {
+  if (period_steps < 1) {
+    std::cerr << "[WARNING] event scheduler: the period must be larger than 0 steps. The event is registered as one-shot event." << std::endl;
+    return AddEvent(first_step, 0, callback);
+  }
+  return AddEvent(first_step, period_steps, callback);
+}
+
+size_t EventScheduler::AddOneShotEvent(const int64_t step, const std::function<void()> callback) { return AddEvent(step, 0, callback); }
+
+size_t EventScheduler::AddWakeUpEvent(const int64_t step) { return AddEvent(step, 0, nullptr); }
+
+void EventScheduler::RemoveEvent(const size_t event_id) { events_.erase(event_id); }
+
+int64_t EventScheduler::GetNextDueStep() {
+  DropRemovedEvents();
+  if (queue_.empty()) return std::numeric_limits<int64_t>::max();
+  return queue_.top().first;
+}
+
+void EventScheduler::Execute(const int64_t step_count) {
+  DropRemovedEvents();
+  while (!queue_.empty() && queue_.top().first <= step_count) {
+    const int64_t due_step = queue_.top().first;
+    const size_t event_id = queue_.top().second;
+    queue_.pop();
+
+    auto event = events_.find(event_id);
+    if (event == events_.end()) continue;  // Removed event
+    const std::function<void()> callback = event->second.callback;
+    const int64_t period_steps = event->second.period_steps;
+    if (period_steps > 0) {
+      int64_t next_step = due_step + period_steps;
+      if (next_step <= step_count) {
+        next_step += ((step_count - next_step) / period_steps + 1) * period_steps;
+      }
+      queue_.push(std::make_pair(next_step, event_id));
+    } else {
+      events_.erase(event);
+    }
+
+    if (callback) callback();
+    DropRemovedEvents();
+  }
+}
+
+size_t EventScheduler::AddEvent(const int64_t first_step, const int64_t period_steps, const std::function<void()> callback) {
+  const size_t event_id = next_event_id_++;
+  events_[event_id] = Event{period_steps, callback};
+  queue_.push(std::make_pair(first_step, event_id));
+  return event_id;
+}
+
+void EventScheduler::DropRemovedEvents() {
+  while (!queue_.empty() && events_.count(queue_.top().second) == 0) {
+    queue_.pop();
+  }
+}
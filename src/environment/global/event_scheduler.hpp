@@ -0,0 +1,103 @@
+/**
+ * @file event_scheduler.hpp
+ * @brief Priority queue scheduler of periodic and one-shot events on the simulation step count
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_EVENT_SCHEDULER_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_EVENT_SCHEDULER_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <queue>
+#include <utility>
+#include <vector>
+
+/**
+ * @class EventScheduler
+ * @brief Priority queue scheduler of periodic and one-shot events on the simulation step count
+ * @details The events are sorted by the due step count and executed in order of registration when they are due at the same step. The main loop
+ *          can jump directly to the next due step instead of checking all events at every simulation step.
+ */
+class EventScheduler {
+ public:
+  /**
+   * @fn AddPeriodicEvent
+   * @brief Register a periodic event
+   * @param [in] first_step: Step count of the first execution
+   * @param [in] period_steps: Period of the execution [steps]
+   * @param [in] callback: Function executed when the event is due
+   * @return ID of the event
+   */
+  size_t AddPeriodicEvent(const int64_t first_step, const int64_t period_steps, const std::function<void()> callback);
+  /**
+   * @fn AddOneShotEvent
+   * @brief Register an event executed only once
+   * @param [in] step: Step count of the execution
+   * @param [in] callback: Function executed when the event is due
+   * @return ID of the event
+   */
+  size_t AddOneShotEvent(const int64_t step, const std::function<void()> callback);
+  /**
+   * @fn AddWakeUpEvent
+   * @brief Register a step where the main loop must stop without any callback
+   * @note It is used when the main loop itself does something at the step (e.g. saving the checkpoint), so the step is not jumped over.
+   * @param [in] step: Step count where the main loop stops
+   * @return ID of the event
+   */
+  size_t AddWakeUpEvent(const int64_t step);
+  /**
+   * @fn RemoveEvent
+   * @brief Remove the registered event
+   * @param [in] event_id: ID of the event
+   */
+  void RemoveEvent(const size_t event_id);
+
+  /**
+   * @fn GetNextDueStep
+   * @brief Return the step count when the next event is due (INT64_MAX when no event is registered)
+   */
+  int64_t GetNextDueStep();
+  /**
+   * @fn GetNumberOfEvents
+   * @brief Return number of the registered events
+   */
+  inline size_t GetNumberOfEvents() const { return events_.size(); }
+
+  /**
+   * @fn Execute
+   * @brief Execute all events due until the step count
+   * @note A periodic event which missed some due steps is executed only once and rescheduled after the step count
+   * @param [in] step_count: Current step count
+   */
+  void Execute(const int64_t step_count);
+
+ private:
+  /**
+   * @struct Event
+   * @brief Registered event
+   */
+  struct Event {
+    int64_t period_steps;            //!< Period of the execution [steps] (0 means one-shot event)
+    std::function<void()> callback;  //!< Function executed when the event is due
+  };
+
+  using QueueEntry = std::pair<int64_t, size_t>;  //!< Pair of the due step count and the event ID
+
+  std::map<size_t, Event> events_;                                                            //!< Registered events with their ID
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue_;  //!< Queue of the due events
+  size_t next_event_id_ = 0;                                                                  //!< ID of the next registered event
+
+  /**
+   * @fn AddEvent
+   * @brief Register an event
+   */
+  size_t AddEvent(const int64_t first_step, const int64_t period_steps, const std::function<void()> callback);
+  /**
+   * @fn DropRemovedEvents
+   * @brief Pop the queue entries of the removed events at the top of the queue
+   */
+  void DropRemovedEvents();
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_EVENT_SCHEDULER_HPP_
@@ -6,6 +6,8 @@
 #include "global_environment.hpp"
 
 #include "setting_file_reader/initialize_file_access.hpp"
+#include "utilities/allocation_tracker.hpp"
+#include "utilities/profiler.hpp"
 
 GlobalEnvironment::GlobalEnvironment(const SimulationConfiguration* simulation_configuration) { Initialize(simulation_configuration); }
 
@@ -32,6 +34,8 @@ void GlobalEnvironment::Initialize(const SimulationConfiguration* simulation_con
 }
 
 void GlobalEnvironment::Update() {
+  PROFILE_SCOPE("GlobalEnvironment::Update");
+  ALLOCATION_SCOPE("GlobalEnvironment::Update");
   simulation_time_->UpdateTime();
   celestial_information_->UpdateAllObjectsInformation(*simulation_time_);
   gnss_satellites_->Update(*simulation_time_);
@@ -44,3 +48,11 @@ void GlobalEnvironment::LogSetup(Logger& logger) {
 }
 
 void GlobalEnvironment::Reset(void) { simulation_time_->ResetClock(); }
+
+void GlobalEnvironment::SaveCheckpoint(CheckpointWriter& writer) const { simulation_time_->SaveCheckpoint(writer); }
+
+void GlobalEnvironment::LoadCheckpoint(CheckpointReader& reader) {
+  simulation_time_->LoadCheckpoint(reader);
+  celestial_information_->UpdateAllObjectsInformation(*simulation_time_);
+  gnss_satellites_->Update(*simulation_time_);
+}
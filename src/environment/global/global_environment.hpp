@@ -12,12 +12,13 @@
 #include "logger/logger.hpp"
 #include "simulation/simulation_configuration.hpp"
 #include "simulation_time.hpp"
+#include "utilities/checkpoint.hpp"
 
 /**
  * @class GlobalEnvironment
  * @brief Class to manage the global environment
  */
-class GlobalEnvironment {
+class GlobalEnvironment : public ICheckpointable {
  public:
   /**
    * @fn ~GlobalEnvironment
@@ -53,12 +54,29 @@ class GlobalEnvironment {
    */
   void Reset(void);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the simulation time into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the simulation time from the checkpoint and recalculate the celestial and GNSS information
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   // Getter
   /**
    * @fn GetSimulationTime
    * @brief Return SimulationTime
    */
   inline const SimulationTime& GetSimulationTime() const { return *simulation_time_; }
+  /**
+   * @fn GetSimulationTime
+   * @brief Return SimulationTime to register the events
+   */
+  inline SimulationTime& GetSimulationTime() { return *simulation_time_; }
   /**
    * @fn GetCelestialInformation
    * @brief Return CelestialInformation
@@ -57,10 +57,7 @@ void GnssSatellites::Update(const SimulationTime& simulation_time) {
   if (!IsCalcEnabled()) return;
 
   // Get time
-  UTC current_utc = simulation_time.GetCurrentUtc();
-  DateTime current_date_time((size_t)current_utc.year, (size_t)current_utc.month, (size_t)current_utc.day, (size_t)current_utc.hour,
-                             (size_t)current_utc.minute, current_utc.second);
-  current_epoch_time_ = EpochTime(current_date_time);
+  current_epoch_time_ = simulation_time.GetCurrentEpochTime();
 
   // Check interpolation update
   double diff_s = current_epoch_time_.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
@@ -8,19 +8,34 @@
 
 #include <SpiceUsr.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 
 #include "setting_file_reader/initialize_file_access.hpp"
-#ifdef WIN32
-#include <Windows.h>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include <cerrno>
 #else
-#include <errno.h>
+#include <thread>
 #endif
 
 using namespace std;
 
+void RealTimePacingStatistics::AddLateness(const double lateness_us) {
+  max_lateness_us = std::max(max_lateness_us, lateness_us);
+  size_t bin = 0;
+  while (bin < kNumberOfBins - 1 && lateness_us >= kBinUpperLimits_us[bin]) {
+    bin++;
+  }
+  histogram[bin]++;
+}
+
 SimulationTime::SimulationTime(const double end_sec, const double step_sec, const double attitude_update_interval_sec,
                                const double attitude_rk_step_sec, const double orbit_update_interval_sec, const double orbit_rk_step_sec,
                                const double thermal_update_interval_sec, const double thermal_rk_step_sec, const double compo_propagate_step_sec,
@@ -37,17 +52,35 @@ SimulationTime::SimulationTime(const double end_sec, const double step_sec, cons
   component_update_interval_sec_ = compo_propagate_step_sec;
   component_propagate_frequency_Hz_ = int(1.0 / component_update_interval_sec_);
   simulation_speed_ = sim_speed;
-  display_period_ = (1.0 * end_sec / step_sec / 100);  // Update every 1%
   time_exceeds_continuously_limit_sec_ = 1.0;
 
   //  sscanf_s(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_month_, &start_day_, &start_hour_, &start_minute_, &start_sec_);
   sscanf(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_month_, &start_day_, &start_hour_, &start_minute_, &start_sec_);
   jday(start_year_, start_month_, start_day_, start_hour_, start_minute_, start_sec_, start_jd_);
   current_jd_ = start_jd_;
-  current_sidereal_ = gstime(current_jd_);
-  JdToDecyear(current_jd_, &current_decyear_);
-  ConvJDtoCalendarDay(current_jd_);
+  ResetDerivedTime();
   AssertTimeStepParams();
+
+  // Integer timebase
+  end_ns_ = llround(end_sec_ * 1.0e9);
+  step_ns_ = llround(step_sec_ * 1.0e9);
+  if (step_ns_ < 1) {
+    cerr << "[WARNING] simulation time: the simulation step is smaller than 1 ns. It is set as 1 ns." << endl;
+    step_ns_ = 1;
+  }
+  step_sec_ = step_ns_ / 1.0e9;
+  attitude_update_interval_steps_ = ConvertToIntervalSteps(attitude_update_interval_sec_, "attitude_update_period_s");
+  orbit_update_interval_steps_ = ConvertToIntervalSteps(orbit_update_interval_sec_, "orbit_update_period_s");
+  thermal_update_interval_steps_ = ConvertToIntervalSteps(thermal_update_interval_sec_, "thermal_update_period_s");
+  component_update_interval_steps_ = ConvertToIntervalSteps(component_update_interval_sec_, "component_update_period_s");
+  log_output_interval_steps_ = ConvertToIntervalSteps(log_output_interval_sec_, "log_output_period_s");
+  display_interval_steps_ = std::max(end_ns_ / step_ns_ / 100, (int64_t)1);  // Update every 1%
+  attitude_update_interval_sec_ = attitude_update_interval_steps_ * step_sec_;
+  orbit_update_interval_sec_ = orbit_update_interval_steps_ * step_sec_;
+  thermal_update_interval_sec_ = thermal_update_interval_steps_ * step_sec_;
+  component_update_interval_sec_ = component_update_interval_steps_ * step_sec_;
+  log_output_interval_sec_ = log_output_interval_steps_ * step_sec_;
+
   InitializeState();
   SetParameters();
 
@@ -74,108 +107,244 @@ void SimulationTime::AssertTimeStepParams() {
 }
 
 void SimulationTime::SetParameters(void) {
+  elapsed_time_ns_ = 0;
+  step_count_ = 0;
   elapsed_time_sec_ = 0.0;
-  attitude_update_counter_ = 1;
   attitude_update_flag_ = false;
-  orbit_update_counter_ = 1;
   orbit_update_flag_ = false;
-  thermal_update_counter_ = 1;
   thermal_update_flag_ = false;
-  component_update_counter_ = 1;
   component_update_flag_ = false;
-  log_counter_ = 0;
-  display_counter_ = 0;
   state_.log_output = true;
 }
 
+int64_t SimulationTime::ConvertToIntervalSteps(const double interval_sec, const std::string name) const {
+  const int64_t interval_ns = llround(interval_sec * 1.0e9);
+  const int64_t interval_steps = std::max((interval_ns + step_ns_ / 2) / step_ns_, (int64_t)1);
+  if (interval_steps * step_ns_ != interval_ns) {
+    cerr << "[WARNING] simulation time: " << name << " is not an integer multiple of the simulation step. It is rounded to "
+         << interval_steps * step_sec_ << " s." << endl;
+  }
+  return interval_steps;
+}
+
 void SimulationTime::UpdateTime(void) {
   InitializeState();
-  elapsed_time_sec_ += step_sec_;
+  // Jump to the next step when anything is due
+  const int64_t previous_step_count = step_count_;
+  const int64_t end_step_count = end_ns_ / step_ns_ + 1;
+  step_count_ = std::min({step_count_ + CalcStepsToNextEvent(), event_scheduler_.GetNextDueStep(), end_step_count});
+  step_count_ = std::max(step_count_, previous_step_count + 1);
   if (simulation_speed_ > 0) {
-    chrono::system_clock clk;
-    int toWaitTime = (int)(elapsed_time_sec_ * 1000 -
-                           chrono::duration_cast<chrono::milliseconds>(clk.now() - clock_start_time_millisec_).count() * simulation_speed_);
-    if (toWaitTime <= 0) {
-      // When the execution time is larger than specified step_sec
-
-      int exceeded_duration_ms = (int)chrono::duration_cast<chrono::milliseconds>(clk.now() - clock_last_time_completed_step_in_time_).count();
-      if (exceeded_duration_ms > time_exceeds_continuously_limit_sec_ * 1000) {
-        // Skip time and warn only when execution time exceeds continuously for long time
-
-        cout << "Error: the specified step_sec is too small for this computer.\r\n";
+    WaitForStepDeadline();
+  }
 
-        // Forcibly set elapsed_tim_sec_ as actual elapsed time Reason: to catch up with real time when resume from a breakpoint
-        elapsed_time_sec_ =
-            (chrono::duration_cast<chrono::duration<double, ratio<1, 1>>>(clk.now() - clock_start_time_millisec_).count() * simulation_speed_);
+  UpdateDerivedTime(previous_step_count);
 
-        clock_last_time_completed_step_in_time_ = clk.now();
-      }
-    } else {
-      clock_last_time_completed_step_in_time_ = clk.now();
+  state_.running = true;
+}
 
-#ifdef WIN32
-      Sleep(toWaitTime);
-#else
-      const struct timespec req = {toWaitTime / 1000, (toWaitTime % 1000) * 1000000};
-      nanosleep(&req, NULL);
-#endif
-    }
+int64_t SimulationTime::CalcStepsToNextEvent(void) const {
+  // The dynamics and the components are updated at the end of each interval, and the log is written at the beginning of it
+  int64_t steps = log_output_interval_steps_ - step_count_ % log_output_interval_steps_;
+  const int64_t update_interval_steps[] = {attitude_update_interval_steps_, orbit_update_interval_steps_, thermal_update_interval_steps_,
+                                           component_update_interval_steps_};
+  for (const int64_t interval_steps : update_interval_steps) {
+    steps = std::min(steps, interval_steps - (step_count_ + 1) % interval_steps);
   }
+  return steps;
+}
 
-  attitude_update_counter_++;
-  orbit_update_counter_++;
-  thermal_update_counter_++;
-  component_update_counter_++;
-  log_counter_++;
-  display_counter_++;
+void SimulationTime::UpdateDerivedTime(const int64_t previous_step_count) {
+  elapsed_time_ns_ = step_count_ * step_ns_;
+  elapsed_time_sec_ = elapsed_time_ns_ / 1.0e9;
 
-  if (elapsed_time_sec_ > end_sec_) {
+  if (elapsed_time_ns_ > end_ns_) {
     state_.finish = true;
   }
 
   current_jd_ = start_jd_ + elapsed_time_sec_ / (60.0 * 60.0 * 24.0);
-  current_sidereal_ = gstime(current_jd_);
-  JdToDecyear(current_jd_, &current_decyear_);
-  ConvJDtoCalendarDay(current_jd_);
+  ResetDerivedTime();
+
+  // True when a timing (step_count + offset) % interval == 0 is in (previous_step_count, step_count_]
+  auto is_due = [&](const int64_t interval_steps, const int64_t offset) {
+    return (step_count_ + offset) / interval_steps > (previous_step_count + offset) / interval_steps;
+  };
+  attitude_update_flag_ = is_due(attitude_update_interval_steps_, 1);
+  orbit_update_flag_ = is_due(orbit_update_interval_steps_, 1);
+  thermal_update_flag_ = is_due(thermal_update_interval_steps_, 1);
+  component_update_flag_ = is_due(component_update_interval_steps_, 1);
+  if (is_due(log_output_interval_steps_, 0)) {
+    state_.log_output = true;
+  }
+  if (is_due(display_interval_steps_, 0)) {
+    state_.disp_output = true;
+  }
+}
 
-  attitude_update_flag_ = false;
-  if (double(attitude_update_counter_) * step_sec_ >= attitude_update_interval_sec_) {
-    attitude_update_counter_ = 0;
-    attitude_update_flag_ = true;
+void SimulationTime::WaitForStepDeadline() {
+  const chrono::duration<double, nano> real_elapsed_time(step_count_ * step_ns_ / simulation_speed_);
+  const chrono::steady_clock::time_point deadline = clock_start_time_ + chrono::duration_cast<chrono::steady_clock::duration>(real_elapsed_time);
+  chrono::steady_clock::time_point now = chrono::steady_clock::now();
+  real_time_pacing_statistics_.number_of_steps++;
+
+  if (now >= deadline) {
+    // When the execution time is larger than specified step_sec
+    real_time_pacing_statistics_.number_of_overruns++;
+    real_time_pacing_statistics_.AddLateness(chrono::duration<double, micro>(now - deadline).count());
+
+    if (now - clock_last_time_completed_step_in_time_ > chrono::duration<double>(time_exceeds_continuously_limit_sec_)) {
+      // Skip time and warn only when execution time exceeds continuously for long time
+
+      cout << "Error: the specified step_sec is too small for this computer.\r\n";
+
+      // Forcibly set the step count as actual elapsed time Reason: to catch up with real time when resume from a breakpoint
+      // The skipped update timings are merged into this step
+      const double actual_elapsed_time_ns = chrono::duration<double, nano>(now - clock_start_time_).count() * simulation_speed_;
+      step_count_ = std::max((int64_t)(actual_elapsed_time_ns / step_ns_), step_count_);
+
+      clock_last_time_completed_step_in_time_ = now;
+    }
+    return;
+  }
+  clock_last_time_completed_step_in_time_ = now;
+
+  // Sleep until the absolute time before the deadline, and wait the rest with the busy loop
+  const chrono::steady_clock::time_point wake_up_time = deadline - spin_wait_duration_;
+  if (now < wake_up_time) {
+#ifdef __linux__
+    // steady_clock is CLOCK_MONOTONIC on Linux
+    const int64_t wake_up_time_ns = chrono::duration_cast<chrono::nanoseconds>(wake_up_time.time_since_epoch()).count();
+    const struct timespec request = {(time_t)(wake_up_time_ns / 1000000000), (long)(wake_up_time_ns % 1000000000)};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &request, NULL) == EINTR) {
+    }
+#else
+    this_thread::sleep_until(wake_up_time);
+#endif
   }
+  do {
+    now = chrono::steady_clock::now();
+  } while (now < deadline);
+  real_time_pacing_statistics_.AddLateness(chrono::duration<double, micro>(now - deadline).count());
+}
 
-  orbit_update_flag_ = false;
-  if (double(orbit_update_counter_) * step_sec_ >= orbit_update_interval_sec_) {
-    orbit_update_counter_ = 0;
-    orbit_update_flag_ = true;
+void SimulationTime::SetRealTimePacingParameters(const double spin_wait_us, const int cpu_core, const int fifo_priority) {
+  spin_wait_duration_ = chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double, micro>(std::max(spin_wait_us, 0.0)));
+  if (simulation_speed_ <= 0) return;
+
+#ifdef __linux__
+  if (cpu_core >= 0) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu_core, &cpu_set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+      cerr << "[WARNING] simulation time: failed to pin the simulation thread to the CPU core " << cpu_core << "." << endl;
+    }
+  }
+  if (fifo_priority > 0) {
+    struct sched_param parameter;
+    parameter.sched_priority = fifo_priority;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameter) != 0) {
+      cerr << "[WARNING] simulation time: failed to set SCHED_FIFO. The privilege may be required." << endl;
+    }
   }
+#else
+  if (cpu_core >= 0 || fifo_priority > 0) {
+    cerr << "[WARNING] simulation time: the CPU affinity and the SCHED_FIFO are supported only on Linux." << endl;
+  }
+#endif
+}
 
-  thermal_update_flag_ = false;
-  if (double(thermal_update_counter_) * step_sec_ >= thermal_update_interval_sec_) {
-    thermal_update_counter_ = 0;
-    thermal_update_flag_ = true;
+void SimulationTime::ResetClock(void) {
+  clock_start_time_ = chrono::steady_clock::now();
+  if (simulation_speed_ > 0) {
+    clock_start_time_ -= chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(elapsed_time_sec_ / simulation_speed_));
   }
+  clock_last_time_completed_step_in_time_ = chrono::steady_clock::now();
+}
 
-  component_update_flag_ = false;
-  if (double(component_update_counter_) * step_sec_ >= component_update_interval_sec_) {
-    component_update_counter_ = 0;
-    component_update_flag_ = true;
+void SimulationTime::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(step_count_);
+  writer.Write(current_jd_);
+  writer.Write(GetCurrentSiderealTime());
+  writer.Write(GetCurrentDecimalYear());
+  writer.Write(GetCurrentUtc());
+
+  writer.Write(attitude_update_flag_);
+  writer.Write(orbit_update_flag_);
+  writer.Write(thermal_update_flag_);
+  writer.Write(component_update_flag_);
+  writer.Write(state_);
+}
+
+void SimulationTime::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(step_count_);
+  elapsed_time_ns_ = step_count_ * step_ns_;
+  elapsed_time_sec_ = elapsed_time_ns_ / 1.0e9;
+  reader.Read(current_jd_);
+  ResetDerivedTime();
+  reader.Read(current_sidereal_);
+  reader.Read(current_decyear_);
+  reader.Read(current_utc_);
+  is_sidereal_evaluated_ = true;
+  is_decyear_evaluated_ = true;
+  is_utc_evaluated_ = true;
+
+  reader.Read(attitude_update_flag_);
+  reader.Read(orbit_update_flag_);
+  reader.Read(thermal_update_flag_);
+  reader.Read(component_update_flag_);
+  reader.Read(state_);
+}
+
+double SimulationTime::GetCurrentSiderealTime(void) const {
+  std::lock_guard<std::mutex> lock(derived_time_mutex_);
+  if (!is_sidereal_evaluated_) {
+    current_sidereal_ = gstime(current_jd_);
+    is_sidereal_evaluated_ = true;
   }
+  return current_sidereal_;
+}
 
-  if (double(log_counter_) * step_sec_ >= log_output_interval_sec_) {
-    log_counter_ = 0;
-    state_.log_output = true;
+double SimulationTime::GetCurrentDecimalYear(void) const {
+  std::lock_guard<std::mutex> lock(derived_time_mutex_);
+  if (!is_decyear_evaluated_) {
+    JdToDecyear(current_jd_, &current_decyear_);
+    is_decyear_evaluated_ = true;
   }
+  return current_decyear_;
+}
 
-  if (display_counter_ >= display_period_) {
-    display_counter_ -= (int)display_period_;
-    state_.disp_output = true;
+const UTC SimulationTime::GetCurrentUtc(void) const {
+  std::lock_guard<std::mutex> lock(derived_time_mutex_);
+  EvaluateUtc();
+  return current_utc_;
+}
+
+EpochTime SimulationTime::GetCurrentEpochTime(void) const {
+  std::lock_guard<std::mutex> lock(derived_time_mutex_);
+  if (!is_epoch_time_evaluated_) {
+    EvaluateUtc();
+    DateTime current_date_time((size_t)current_utc_.year, (size_t)current_utc_.month, (size_t)current_utc_.day, (size_t)current_utc_.hour,
+                               (size_t)current_utc_.minute, current_utc_.second);
+    current_epoch_time_ = EpochTime(current_date_time);
+    is_epoch_time_evaluated_ = true;
   }
+  return current_epoch_time_;
+}
 
-  state_.running = true;
+void SimulationTime::EvaluateUtc() const {
+  if (is_utc_evaluated_) return;
+  ConvJDtoCalendarDay(current_jd_);
+  is_utc_evaluated_ = true;
 }
 
-void SimulationTime::ResetClock(void) { clock_start_time_millisec_ = chrono::system_clock::now(); }
+void SimulationTime::ResetDerivedTime() {
+  std::lock_guard<std::mutex> lock(derived_time_mutex_);
+  is_sidereal_evaluated_ = false;
+  is_decyear_evaluated_ = false;
+  is_utc_evaluated_ = false;
+  is_epoch_time_evaluated_ = false;
+}
 
 void SimulationTime::PrintStartDateTime(void) const {
   int sec_int = int(start_sec_ + 0.5);
@@ -204,6 +373,14 @@ string SimulationTime::GetLogHeader() const {
 
   str_tmp += WriteScalar("elapsed_time", "s");
   str_tmp += WriteScalar("time", "UTC");
+  if (simulation_speed_ > 0) {
+    str_tmp += WriteScalar("pacing_overrun_count", "-");
+    str_tmp += WriteScalar("pacing_max_lateness", "us");
+    const std::string bin_names[] = {"under_1us", "under_10us", "under_100us", "under_1ms", "under_10ms", "over_10ms"};
+    for (const std::string& bin_name : bin_names) {
+      str_tmp += WriteScalar("pacing_lateness_" + bin_name, "-");
+    }
+  }
 
   return str_tmp;
 }
@@ -213,14 +390,23 @@ string SimulationTime::GetLogValue() const {
 
   str_tmp += WriteScalar(elapsed_time_sec_);
 
+  const UTC current_utc = GetCurrentUtc();
   const char kSize = 100;
   char ymdhms[kSize];
-  double sec_floor = floor(current_utc_.second * 1e3) / 1e3;
+  double sec_floor = floor(current_utc.second * 1e3) / 1e3;
 
-  snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3f,", current_utc_.year, current_utc_.month, current_utc_.day, current_utc_.hour,
-           current_utc_.minute, sec_floor);
+  snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3f,", current_utc.year, current_utc.month, current_utc.day, current_utc.hour,
+           current_utc.minute, sec_floor);
   str_tmp += ymdhms;
 
+  if (simulation_speed_ > 0) {
+    str_tmp += WriteScalar(real_time_pacing_statistics_.number_of_overruns);
+    str_tmp += WriteScalar(real_time_pacing_statistics_.max_lateness_us);
+    for (const int64_t count : real_time_pacing_statistics_.histogram) {
+      str_tmp += WriteScalar(count);
+    }
+  }
+
   return str_tmp;
 }
 
@@ -232,7 +418,7 @@ void SimulationTime::InitializeState() {
 }
 
 // wrapper function of invjday @ sgp4ext for interface adjustment
-void SimulationTime::ConvJDtoCalendarDay(const double JD) {
+void SimulationTime::ConvJDtoCalendarDay(const double JD) const {
   int year, mon, day, hr, minute;
   double sec;
   invjday(JD, year, mon, day, hr, minute, sec);
@@ -269,9 +455,18 @@ SimulationTime* InitSimulationTime(std::string file_name) {
 
   double sim_speed = ini_file.ReadDouble(section, "simulation_speed_setting");
 
+  // Real time pacing
+  double spin_wait_us = ini_file.ReadDouble(section, "real_time_spin_wait_us");
+  int cpu_core = -1;
+  if (ini_file.ReadEnable(section, "real_time_cpu_affinity_enable")) {
+    cpu_core = ini_file.ReadInt(section, "real_time_cpu_core");
+  }
+  int fifo_priority = ini_file.ReadInt(section, "real_time_fifo_priority");
+
   SimulationTime* simTime = new SimulationTime(end_sec, step_sec, attitude_update_interval_sec, attitude_rk_step_sec, orbit_update_interval_sec,
                                                orbit_rk_step_sec, thermal_update_interval_sec, thermal_rk_step_sec, compo_propagate_step_sec,
                                                log_output_interval_sec, start_ymdhms.c_str(), sim_speed);
+  simTime->SetRealTimePacingParameters(spin_wait_us, cpu_core, fifo_priority);
 
   return simTime;
 }
@@ -10,11 +10,17 @@
 #define _WINSOCKAPI_  // stops windows.h including winsock.h
 #endif
 
+#include <array>
+#include <cstdint>
 #include <string>
 // #include <time.h>
 #include <chrono>
+#include <mutex>
 
+#include "event_scheduler.hpp"
 #include "logger/loggable.hpp"
+#include "math_physics/time_system/epoch_time.hpp"
+#include "utilities/checkpoint.hpp"
 #include "math_physics/orbit/sgp4/sgp4ext.h"
 #include "math_physics/orbit/sgp4/sgp4io.h"
 #include "math_physics/orbit/sgp4/sgp4unit.h"
@@ -30,6 +36,27 @@ struct TimeState {
   bool disp_output = true;
 };
 
+/**
+ *@struct RealTimePacingStatistics
+ *@brief Statistics of the wake-up lateness from the step deadlines in the real time simulation
+ */
+struct RealTimePacingStatistics {
+  static const size_t kNumberOfBins = 6;                                                                //!< Number of the histogram bins
+  static constexpr double kBinUpperLimits_us[kNumberOfBins - 1] = {1.0, 10.0, 100.0, 1000.0, 10000.0};  //!< Upper limits of the bins [us]
+
+  int64_t number_of_steps = 0;                        //!< Number of the paced steps
+  int64_t number_of_overruns = 0;                     //!< Number of the steps which reached after their deadline
+  double max_lateness_us = 0.0;                       //!< Maximum lateness [us]
+  std::array<int64_t, kNumberOfBins> histogram = {};  //!< Histogram of the lateness
+
+  /**
+   *@fn AddLateness
+   *@brief Add a lateness to the statistics
+   *@param [in] lateness_us: Lateness from the deadline [us]
+   */
+  void AddLateness(const double lateness_us);
+};
+
 /**
  *@struct UTC
  *@brief UTC (Coordinated Universal Time) calendar expression
@@ -46,8 +73,10 @@ struct UTC {
 /**
  *@class SimulationTime
  *@brief Class to manage simulation time related information
+ *@details The elapsed time is counted with an integer nanosecond timebase. Every update interval is rounded to an integer multiple of the
+ *         simulation step, and the double expressions are derived from the integer counts. Thus, no drift accumulates in long simulations.
  */
-class SimulationTime : public ILoggable {
+class SimulationTime : public ILoggable, public ICheckpointable {
  public:
   /**
    *@fn SimulationTime
@@ -84,14 +113,37 @@ class SimulationTime : public ILoggable {
   /**
    *@fn UpdateTime
    *@brief Update simulation time
+   *@note The simulation time jumps directly to the next step when any update, the log output, the registered event, or the end of the simulation
+   *      is due
    */
   void UpdateTime(void);
+  /**
+   *@fn CalcStepsToNextEvent
+   *@brief Calculate number of simulation steps until the next step where any update flag or the log output flag becomes true
+   */
+  int64_t CalcStepsToNextEvent(void) const;
+  /**
+   *@fn SetRealTimePacingParameters
+   *@brief Set parameters of the real time pacing. They are used only when the simulation speed is positive.
+   *@param [in] spin_wait_us: Duration of the busy wait before each deadline to reduce the wake-up jitter [us]
+   *@param [in] cpu_core: CPU core to pin the simulation thread (negative value means not pinned)
+   *@param [in] fifo_priority: SCHED_FIFO priority of the simulation thread (0 means the normal scheduling)
+   *@note The CPU affinity and the SCHED_FIFO are supported only on Linux, and the SCHED_FIFO requires the privilege.
+   */
+  void SetRealTimePacingParameters(const double spin_wait_us, const int cpu_core, const int fifo_priority);
   /**
    *@fn ResetClock
    *@brief Reset simulation start time as PC’s time
+   *@note The already elapsed simulation time is taken into account to keep the real time pacing after the restore of the checkpoint
    */
   void ResetClock(void);
 
+  /**
+   *@fn GetEventScheduler
+   *@brief Return scheduler of the user events executed in the main loop
+   */
+  inline EventScheduler& GetEventScheduler(void) { return event_scheduler_; };
+
   /**
    *@fn GetState
    *@brief Return time state
@@ -102,11 +154,26 @@ class SimulationTime : public ILoggable {
    *@brief Return simulation elapsed time [sec]
    */
   inline double GetElapsedTime_s(void) const { return elapsed_time_sec_; };
+  /**
+   *@fn GetElapsedTime_ns
+   *@brief Return simulation elapsed time in the integer timebase [ns]
+   */
+  inline int64_t GetElapsedTime_ns(void) const { return elapsed_time_ns_; };
+  /**
+   *@fn GetStepCount
+   *@brief Return number of simulation steps from the start of simulation
+   */
+  inline int64_t GetStepCount(void) const { return step_count_; };
   /**
    *@fn GetSimulationStep_s
    *@brief Return simulation step [sec]
    */
   inline double GetSimulationStep_s(void) const { return step_sec_; };
+  /**
+   *@fn GetSimulationStep_ns
+   *@brief Return simulation step in the integer timebase [ns]
+   */
+  inline int64_t GetSimulationStep_ns(void) const { return step_ns_; };
   /**
    *@fn GetAttitudeUpdateInterval_s
    *@brief Return attitude update interval [sec]
@@ -171,6 +238,12 @@ class SimulationTime : public ILoggable {
    */
   inline int GetComponentPropagateFrequency_Hz(void) const { return component_propagate_frequency_Hz_; };
 
+  /**
+   *@fn GetRealTimePacingStatistics
+   *@brief Return statistics of the real time pacing
+   */
+  inline const RealTimePacingStatistics& GetRealTimePacingStatistics(void) const { return real_time_pacing_statistics_; };
+
   /**
    *@fn GetEndTime_s
    *@brief Return simulation end elapsed time [sec]
@@ -190,18 +263,24 @@ class SimulationTime : public ILoggable {
   /**
    *@fn GetCurrentSiderealTime
    *@brief Return current sidereal day [day]
+   *@note The derived time quantities are calculated at the first call in each step
    */
-  inline double GetCurrentSiderealTime(void) const { return current_sidereal_; };
+  double GetCurrentSiderealTime(void) const;
   /**
    *@fn GetCurrentDecimalYear
    *@brief Return current decimal year [year]
    */
-  inline double GetCurrentDecimalYear(void) const { return current_decyear_; };
+  double GetCurrentDecimalYear(void) const;
   /**
    *@fn GetCurrentUtc
    *@brief Return current UTC calendar expression
    */
-  inline const UTC GetCurrentUtc(void) const { return current_utc_; };
+  const UTC GetCurrentUtc(void) const;
+  /**
+   *@fn GetCurrentEpochTime
+   *@brief Return current time as EpochTime
+   */
+  EpochTime GetCurrentEpochTime(void) const;
   /**
    *@fn GetCurrentEphemerisTime
    *@brief Return current Ephemeris time
@@ -251,6 +330,18 @@ class SimulationTime : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the current step count and the timing flags into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the current step count and the timing flags from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   /**
    * @fn PrintStartDateTime
    * @brief Debug output of start date and time
@@ -259,29 +350,35 @@ class SimulationTime : public ILoggable {
 
  private:
   // Variables
-  double elapsed_time_sec_;  //!< Elapsed time from start of simulation [sec]
+  int64_t elapsed_time_ns_;  //!< Elapsed time from start of simulation in the integer timebase [ns]
+  int64_t step_count_;       //!< Number of simulation steps from start of simulation
+  double elapsed_time_sec_;  //!< Elapsed time from start of simulation derived from elapsed_time_ns_ [sec]
   double current_jd_;        //!< Current Julian date [day]
-  double current_sidereal_;  //!< Current Greenwich sidereal time (GST) [day]
-  double current_decyear_;   //!< Current decimal year [year]
-  UTC current_utc_;          //!< UTC calendar day
+
+  // Derived time quantities calculated lazily
+  mutable double current_sidereal_;               //!< Current Greenwich sidereal time (GST) [day]
+  mutable double current_decyear_;                //!< Current decimal year [year]
+  mutable UTC current_utc_;                       //!< UTC calendar day
+  mutable EpochTime current_epoch_time_;          //!< Current time as EpochTime
+  mutable bool is_sidereal_evaluated_ = false;    //!< Flag of the sidereal time is calculated in this step
+  mutable bool is_decyear_evaluated_ = false;     //!< Flag of the decimal year is calculated in this step
+  mutable bool is_utc_evaluated_ = false;         //!< Flag of the UTC calendar day is calculated in this step
+  mutable bool is_epoch_time_evaluated_ = false;  //!< Flag of the EpochTime is calculated in this step
+  mutable std::mutex derived_time_mutex_;         //!< Mutex of the derived time quantities read by spacecraft in parallel
 
   // Timing controller
-  int attitude_update_counter_;   //!< Update counter for attitude calculation
-  bool attitude_update_flag_;     //!< Update flag for attitude calculation
-  int orbit_update_counter_;      //!< Update counter for orbit calculation
-  bool orbit_update_flag_;        //!< Update flag for orbit calculation
-  int thermal_update_counter_;    //!< Update counter for thermal calculation
-  bool thermal_update_flag_;      //!< Update flag for thermal calculation
-  int component_update_counter_;  //!< Update counter for component calculation
-  bool component_update_flag_;    //!< Update flag for component calculation
-  int log_counter_;               //!< Update counter for log output
-  int display_counter_;           //!< Update counter for display output
-  TimeState state_;               //!< State of timing controller
+  bool attitude_update_flag_;       //!< Update flag for attitude calculation
+  bool orbit_update_flag_;          //!< Update flag for orbit calculation
+  bool thermal_update_flag_;        //!< Update flag for thermal calculation
+  bool component_update_flag_;      //!< Update flag for component calculation
+  TimeState state_;                 //!< State of timing controller
+  EventScheduler event_scheduler_;  //!< Scheduler of the user events
 
   // Calculation time measure
-  std::chrono::system_clock::time_point clock_start_time_millisec_;  //!< Simulation start time [ms]
-  // chrono::system_clock::time_point clock_elapsed_time_millisec_;  //!< Simulation elapsed time in real time simulation [ms]
-  std::chrono::system_clock::time_point clock_last_time_completed_step_in_time_;  //!< Simulation finished time [ms]
+  std::chrono::steady_clock::time_point clock_start_time_;                        //!< Simulation start time
+  std::chrono::steady_clock::time_point clock_last_time_completed_step_in_time_;  //!< Last time when a step is completed in time
+  std::chrono::steady_clock::duration spin_wait_duration_{0};                     //!< Duration of the busy wait before each deadline
+  RealTimePacingStatistics real_time_pacing_statistics_;                          //!< Statistics of the real time pacing
 
   // Constants
   double end_sec_;                        //!< Time from start of simulation to end [sec]
@@ -295,7 +392,16 @@ class SimulationTime : public ILoggable {
   double component_update_interval_sec_;  //!< Update intercal for component calculation [sec]
   int component_propagate_frequency_Hz_;  //!< Component propagation frequency [Hz]
   double log_output_interval_sec_;        //!< Log output interval [sec]
-  double display_period_;                 //!< Display output period [sec]
+
+  // Constants in the integer timebase
+  int64_t end_ns_;                           //!< Time from start of simulation to end [ns]
+  int64_t step_ns_;                          //!< Simulation step width [ns]
+  int64_t attitude_update_interval_steps_;   //!< Update interval for attitude calculation [steps]
+  int64_t orbit_update_interval_steps_;      //!< Update interval for orbit calculation [steps]
+  int64_t thermal_update_interval_steps_;    //!< Update interval for thermal calculation [steps]
+  int64_t component_update_interval_steps_;  //!< Update interval for component calculation [steps]
+  int64_t log_output_interval_steps_;        //!< Log output interval [steps]
+  int64_t display_interval_steps_;           //!< Display output interval [steps]
 
   double start_ephemeris_time_;  //!< Simulation start Ephemeris Time
   double start_jd_;              //!< Simulation start Julian date [day]
@@ -314,17 +420,49 @@ class SimulationTime : public ILoggable {
    * @brief Initialize timer state
    */
   void InitializeState();
+  /**
+   * @fn WaitForStepDeadline
+   * @brief Wait until the deadline of the current step in the real time simulation
+   * @note The step count jumps to the actual time when the execution is late continuously
+   */
+  void WaitForStepDeadline();
   /**
    * @fn AssertTimeStepParams
    * @brief Check the timing setting parameters are correct
    */
   void AssertTimeStepParams();
+  /**
+   * @fn ConvertToIntervalSteps
+   * @brief Convert the update interval to the number of simulation steps
+   * @note The interval is rounded to an integer multiple of the simulation step with a warning when it is not
+   * @param [in] interval_sec: Update interval [sec]
+   * @param [in] name: Name of the interval for the warning
+   * @return Update interval [steps]
+   */
+  int64_t ConvertToIntervalSteps(const double interval_sec, const std::string name) const;
+  /**
+   * @fn UpdateDerivedTime
+   * @brief Update the double expressions, the Julian date, and the flags from the integer timebase. The other quantities are calculated lazily.
+   * @param [in] previous_step_count: Step count at the previous update. The flags become true when the update timing is in the period.
+   */
+  void UpdateDerivedTime(const int64_t previous_step_count);
   /**
    * @fn ConvJDtoCalendarDay
    * @brief Convert Julian date to UTC Calendar date
    * @note wrapper function of invjday @ sgp4ext for interface adjustment
    */
-  void ConvJDtoCalendarDay(const double JD);
+  void ConvJDtoCalendarDay(const double JD) const;
+  /**
+   * @fn EvaluateUtc
+   * @brief Calculate the UTC calendar day when it is not calculated in this step
+   * @note The derived time mutex must be locked
+   */
+  void EvaluateUtc() const;
+  /**
+   * @fn ResetDerivedTime
+   * @brief Mark the derived time quantities as not calculated
+   */
+  void ResetDerivedTime();
 };
 
 /**
@@ -0,0 +1,313 @@
+/**
+ * @file test_clock_generator.cpp
+ * @brief Test codes for ClockGenerator class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "clock_generator.hpp"
+
+namespace {
+/**
+ * @class RecordingTickable
+ * @brief Tickable which records the executed ticks. The prescalers are checked in the tick functions as Component does.
+ */
+class RecordingTickable : public ITickable {
+ public:
+  /**
+   * @fn RecordingTickable
+   * @brief Constructor
+   * @param [in] name: Name in the record
+   * @param [in] prescaler: Frequency scale factor of Tick
+   * @param [in] fast_prescaler: Frequency scale factor of FastTick
+   * @param [in] needs_fast_update: Fast update flag
+   * @param [out] record: Record of the executed ticks
+   */
+  RecordingTickable(const std::string name, const unsigned int prescaler, const unsigned int fast_prescaler, const bool needs_fast_update,
+                    std::vector<std::string>& record)
+      : name_(name), prescaler_(prescaler), fast_prescaler_(fast_prescaler), record_(record) {
+    needs_fast_update_ = needs_fast_update;
+  }
+
+  void Tick(const unsigned int count) override {
+    if (count % prescaler_ > 0) return;
+    record_.push_back(std::to_string(count) + ":" + name_ + ":Tick");
+    if (tick_callback_) tick_callback_(count);
+  }
+  void FastTick(const unsigned int fast_count) override {
+    if (fast_count % fast_prescaler_ > 0) return;
+    record_.push_back(std::to_string(fast_count) + ":" + name_ + ":FastTick");
+  }
+  unsigned int GetPrescaler() const override { return prescaler_; }
+  unsigned int GetFastPrescaler() const override { return fast_prescaler_; }
+
+  /**
+   * @fn SetTickCallback
+   * @brief Set the function called after the record of Tick
+   */
+  void SetTickCallback(const std::function<void(unsigned int)> tick_callback) { tick_callback_ = tick_callback; }
+
+ private:
+  std::string name_;                                 //!< Name in the record
+  unsigned int prescaler_;                           //!< Frequency scale factor of Tick
+  unsigned int fast_prescaler_;                      //!< Frequency scale factor of FastTick
+  std::vector<std::string>& record_;                 //!< Record of the executed ticks
+  std::function<void(unsigned int)> tick_callback_;  //!< Function called after the record of Tick
+};
+
+/**
+ * @class LinearScanClockGenerator
+ * @brief Reference of the clock generator which calls all components at every tick
+ */
+class LinearScanClockGenerator {
+ public:
+  void RegisterComponent(ITickable* tickable) { components_.push_back(tickable); }
+  void RemoveComponent(ITickable* tickable) {
+    for (auto itr = components_.begin(); itr != components_.end();) {
+      if (*itr == tickable) {
+        components_.erase(itr++);
+        break;
+      } else {
+        ++itr;
+      }
+    }
+  }
+  void TickToComponents() {
+    for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
+      (*itr)->Tick(timer_count_);
+      if ((*itr)->GetNeedsFastUpdate()) {
+        (*itr)->FastTick(timer_count_);
+      }
+    }
+    timer_count_++;
+  }
+
+ private:
+  std::vector<ITickable*> components_;  //!< Component list for tick
+  unsigned int timer_count_ = 0;        //!< Timer count
+};
+
+/**
+ * @struct TickableSetting
+ * @brief Setting of RecordingTickable
+ */
+struct TickableSetting {
+  std::string name;             //!< Name in the record
+  unsigned int prescaler;       //!< Frequency scale factor of Tick
+  unsigned int fast_prescaler;  //!< Frequency scale factor of FastTick
+  bool needs_fast_update;       //!< Fast update flag
+};
+
+/**
+ * @fn MakeTickables
+ * @brief Make the tickables of the settings
+ * @param [in] settings: Settings of the tickables
+ * @param [out] record: Record of the executed ticks
+ */
+std::vector<std::unique_ptr<RecordingTickable>> MakeTickables(const std::vector<TickableSetting>& settings, std::vector<std::string>& record) {
+  std::vector<std::unique_ptr<RecordingTickable>> tickables;
+  for (const TickableSetting& setting : settings) {
+    tickables.emplace_back(new RecordingTickable(setting.name, setting.prescaler, setting.fast_prescaler, setting.needs_fast_update, record));
+  }
+  return tickables;
+}
+}  // namespace
+
+/**
+ * @brief Test for the mixed prescalers including the prescalers larger than the wheel size
+ */
+TEST(ClockGenerator, MixedPrescalers) {
+  const std::vector<TickableSetting> settings = {{"a", 1, 1, false},  {"b", 3, 1, true},  {"c", 300, 7, false}, {"d", 256, 1, false},
+                                                 {"e", 512, 2, true}, {"f", 3, 1, false}, {"g", 257, 1, true},  {"h", 1000, 256, true}};
+  std::vector<std::string> record, expected_record;
+  auto tickables = MakeTickables(settings, record);
+  auto reference_tickables = MakeTickables(settings, expected_record);
+  // The fast update flag enabled in Tick
+  tickables[2]->SetTickCallback([&](const unsigned int count) {
+    if (count == 600) tickables[2]->SetNeedsFastUpdate(true);
+  });
+  reference_tickables[2]->SetTickCallback([&](const unsigned int count) {
+    if (count == 600) reference_tickables[2]->SetNeedsFastUpdate(true);
+  });
+
+  ClockGenerator clock_generator;
+  LinearScanClockGenerator reference_clock_generator;
+  for (size_t i = 0; i < settings.size(); i++) {
+    clock_generator.RegisterComponent(tickables[i].get());
+    reference_clock_generator.RegisterComponent(reference_tickables[i].get());
+  }
+  for (size_t count = 0; count < 3000; count++) {
+    clock_generator.TickToComponents();
+    reference_clock_generator.TickToComponents();
+  }
+
+  EXPECT_EQ(expected_record, record);
+  // Prescalers larger than the wheel size are not executed at the collided slots
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "1000:h:Tick"));
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "256:h:FastTick"));
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "1024:h:FastTick"));
+  EXPECT_EQ(0, std::count(record.begin(), record.end(), "256:g:Tick"));
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "2313:g:Tick"));
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "602:c:FastTick"));
+}
+
+/**
+ * @brief Test for the FastTick executed before the Tick of the following components in the same step
+ */
+TEST(ClockGenerator, FastTickOrder) {
+  const std::vector<TickableSetting> settings = {{"a", 2, 1, true}, {"b", 1, 1, false}, {"c", 2, 2, true}};
+  std::vector<std::string> record, expected_record;
+  auto tickables = MakeTickables(settings, record);
+  auto reference_tickables = MakeTickables(settings, expected_record);
+
+  ClockGenerator clock_generator;
+  LinearScanClockGenerator reference_clock_generator;
+  for (size_t i = 0; i < settings.size(); i++) {
+    clock_generator.RegisterComponent(tickables[i].get());
+    reference_clock_generator.RegisterComponent(reference_tickables[i].get());
+  }
+  for (size_t count = 0; count < 4; count++) {
+    clock_generator.TickToComponents();
+    reference_clock_generator.TickToComponents();
+  }
+
+  const std::vector<std::string> explicit_record = {"0:a:Tick", "0:a:FastTick", "0:b:Tick", "0:c:Tick",     "0:c:FastTick",
+                                                    "1:a:FastTick", "1:b:Tick", "2:a:Tick", "2:a:FastTick", "2:b:Tick",
+                                                    "2:c:Tick", "2:c:FastTick", "3:a:FastTick", "3:b:Tick"};
+  EXPECT_EQ(explicit_record, expected_record);
+  EXPECT_EQ(expected_record, record);
+}
+
+/**
+ * @brief Test for the removal of the components which are scheduled in the timing wheel
+ */
+TEST(ClockGenerator, RemoveScheduledComponent) {
+  const std::vector<TickableSetting> settings = {{"a", 1, 1, false}, {"b", 5, 1, true}, {"c", 300, 1, false}, {"d", 2, 3, true}};
+  std::vector<std::string> record, expected_record;
+  auto tickables = MakeTickables(settings, record);
+  auto reference_tickables = MakeTickables(settings, expected_record);
+
+  ClockGenerator clock_generator;
+  LinearScanClockGenerator reference_clock_generator;
+  for (size_t i = 0; i < settings.size(); i++) {
+    clock_generator.RegisterComponent(tickables[i].get());
+    reference_clock_generator.RegisterComponent(reference_tickables[i].get());
+  }
+  // The component due later in the same tick is removed in the tick
+  tickables[0]->SetTickCallback([&](const unsigned int count) {
+    if (count == 150) clock_generator.RemoveComponent(tickables[3].get());
+  });
+  reference_tickables[0]->SetTickCallback([&](const unsigned int count) {
+    if (count == 150) reference_clock_generator.RemoveComponent(reference_tickables[3].get());
+  });
+
+  for (size_t count = 0; count < 1000; count++) {
+    if (count == 101) {
+      // The component in the groups of Tick and FastTick, and the component due after a wheel round
+      clock_generator.RemoveComponent(tickables[1].get());
+      clock_generator.RemoveComponent(tickables[2].get());
+      reference_clock_generator.RemoveComponent(reference_tickables[1].get());
+      reference_clock_generator.RemoveComponent(reference_tickables[2].get());
+    }
+    if (count == 700) {
+      clock_generator.RegisterComponent(tickables[2].get());
+      reference_clock_generator.RegisterComponent(reference_tickables[2].get());
+    }
+    clock_generator.TickToComponents();
+    reference_clock_generator.TickToComponents();
+  }
+
+  EXPECT_EQ(expected_record, record);
+  EXPECT_EQ(0, std::count(record.begin(), record.end(), "150:d:Tick"));
+  EXPECT_EQ(0, std::count(record.begin(), record.end(), "600:c:Tick"));
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "900:c:Tick"));
+  EXPECT_EQ((std::vector<ITickable*>{tickables[0].get(), tickables[2].get()}), clock_generator.GetComponents());
+}
+
+/**
+ * @brief Test for the component registered in a tick
+ */
+TEST(ClockGenerator, RegisterInTick) {
+  std::vector<std::string> record;
+  RecordingTickable parent("parent", 1, 1, false, record);
+  RecordingTickable child("child", 3, 1, false, record);
+  ClockGenerator clock_generator;
+  clock_generator.RegisterComponent(&parent);
+  parent.SetTickCallback([&](const unsigned int count) {
+    if (count == 3) clock_generator.RegisterComponent(&child);
+  });
+  for (size_t count = 0; count < 10; count++) {
+    clock_generator.TickToComponents();
+  }
+
+  // Executed from the next due count and kept scheduled
+  EXPECT_EQ(0, std::count(record.begin(), record.end(), "3:child:Tick"));
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "6:child:Tick"));
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "9:child:Tick"));
+}
+
+/**
+ * @brief Test for the rescheduling after the checkpoint load
+ */
+TEST(ClockGenerator, CheckpointReschedule) {
+  const std::vector<TickableSetting> settings = {{"a", 1, 1, false}, {"b", 4, 3, true}, {"c", 300, 1, false}, {"d", 512, 5, true}};
+  std::vector<std::string> record, expected_record;
+  auto reference_tickables = MakeTickables(settings, expected_record);
+  LinearScanClockGenerator reference_clock_generator;
+  for (size_t i = 0; i < settings.size(); i++) {
+    reference_clock_generator.RegisterComponent(reference_tickables[i].get());
+  }
+  for (size_t count = 0; count < 2000; count++) {
+    reference_clock_generator.TickToComponents();
+  }
+
+  // Save the checkpoint at the count which is not a multiple of the prescalers
+  const size_t checkpoint_count = 777;
+  std::stringstream stream;
+  {
+    auto tickables = MakeTickables(settings, record);
+    ClockGenerator clock_generator;
+    for (size_t i = 0; i < settings.size(); i++) {
+      clock_generator.RegisterComponent(tickables[i].get());
+    }
+    for (size_t count = 0; count < checkpoint_count; count++) {
+      clock_generator.TickToComponents();
+    }
+    CheckpointWriter writer(stream);
+    clock_generator.SaveCheckpoint(writer);
+    ASSERT_TRUE(writer.IsGood());
+  }
+
+  // The restored generator has run some ticks before the load
+  auto tickables = MakeTickables(settings, record);
+  ClockGenerator clock_generator;
+  for (size_t i = 0; i < settings.size(); i++) {
+    clock_generator.RegisterComponent(tickables[i].get());
+  }
+  std::vector<std::string> discarded_record;
+  RecordingTickable discarded("discarded", 1, 1, false, discarded_record);
+  clock_generator.RegisterComponent(&discarded);
+  const size_t record_size = record.size();
+  for (size_t count = 0; count < 10; count++) {
+    clock_generator.TickToComponents();
+  }
+  record.resize(record_size);
+  clock_generator.RemoveComponent(&discarded);
+
+  CheckpointReader reader(stream);
+  clock_generator.LoadCheckpoint(reader);
+  ASSERT_TRUE(reader.IsGood());
+  for (size_t count = checkpoint_count; count < 2000; count++) {
+    clock_generator.TickToComponents();
+  }
+
+  EXPECT_EQ(expected_record, record);
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "900:c:Tick"));
+  EXPECT_EQ(1, std::count(record.begin(), record.end(), "1024:d:Tick"));
+}
@@ -0,0 +1,114 @@
+/**
+ * @file test_event_scheduler.cpp
+ * @brief Test codes for EventScheduler class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "event_scheduler.hpp"
+
+/**
+ * @brief Test for the firing order of the one-shot events and the periodic events
+ */
+TEST(EventScheduler, FiringOrder) {
+  EventScheduler scheduler;
+  std::vector<std::pair<int64_t, std::string>> executions;
+  int64_t current_step = 0;
+  auto record = [&](const std::string name) { return [&, name]() { executions.push_back(std::make_pair(current_step, name)); }; };
+
+  scheduler.AddOneShotEvent(6, record("one_shot_a"));
+  scheduler.AddPeriodicEvent(2, 2, record("periodic"));
+  scheduler.AddOneShotEvent(6, record("one_shot_b"));
+  scheduler.AddOneShotEvent(3, record("one_shot_c"));
+  EXPECT_EQ(4u, scheduler.GetNumberOfEvents());
+  EXPECT_EQ(2, scheduler.GetNextDueStep());
+
+  for (current_step = 0; current_step <= 7; current_step++) {
+    scheduler.Execute(current_step);
+  }
+
+  // Sorted by the step, and in order of the registration at the same step
+  const std::vector<std::pair<int64_t, std::string>> expected_executions = {
+      {2, "periodic"}, {3, "one_shot_c"}, {4, "periodic"}, {6, "one_shot_a"}, {6, "periodic"}, {6, "one_shot_b"}};
+  EXPECT_EQ(expected_executions, executions);
+  // Only the periodic event remains
+  EXPECT_EQ(1u, scheduler.GetNumberOfEvents());
+  EXPECT_EQ(8, scheduler.GetNextDueStep());
+}
+
+/**
+ * @brief Test for the periodic event which missed some due steps by the step jump
+ */
+TEST(EventScheduler, MissedPeriodicEvent) {
+  EventScheduler scheduler;
+  size_t number_of_executions = 0;
+  scheduler.AddPeriodicEvent(1, 3, [&]() { number_of_executions++; });
+
+  // Due at 1, 4, 7 and 10, but executed only once
+  scheduler.Execute(10);
+  EXPECT_EQ(1u, number_of_executions);
+  EXPECT_EQ(13, scheduler.GetNextDueStep());
+
+  // Not due between the periods
+  scheduler.Execute(12);
+  EXPECT_EQ(1u, number_of_executions);
+  scheduler.Execute(13);
+  EXPECT_EQ(2u, number_of_executions);
+
+  // Period smaller than 1 step is registered as one-shot event
+  EventScheduler one_shot_scheduler;
+  one_shot_scheduler.AddPeriodicEvent(5, 0, [&]() { number_of_executions++; });
+  one_shot_scheduler.Execute(5);
+  EXPECT_EQ(3u, number_of_executions);
+  EXPECT_EQ(0u, one_shot_scheduler.GetNumberOfEvents());
+}
+
+/**
+ * @brief Test for the events registered and removed by the callbacks
+ */
+TEST(EventScheduler, RegisterInCallback) {
+  EventScheduler scheduler;
+  std::vector<std::string> executions;
+
+  // The event registered for the current step is executed in the same Execute, and the event for the next step is not
+  scheduler.AddOneShotEvent(5, [&]() {
+    executions.push_back("parent");
+    scheduler.AddOneShotEvent(5, [&]() { executions.push_back("current_step"); });
+    scheduler.AddOneShotEvent(3, [&]() { executions.push_back("past_step"); });
+    scheduler.AddOneShotEvent(6, [&]() { executions.push_back("next_step"); });
+  });
+  scheduler.Execute(5);
+  EXPECT_EQ((std::vector<std::string>{"parent", "past_step", "current_step"}), executions);
+  EXPECT_EQ(6, scheduler.GetNextDueStep());
+
+  // The event removed by the callback of the same step is not executed
+  executions.clear();
+  size_t removed_event_id = 0;
+  scheduler.AddOneShotEvent(6, [&]() { scheduler.RemoveEvent(removed_event_id); });
+  removed_event_id = scheduler.AddOneShotEvent(6, [&]() { executions.push_back("removed"); });
+  scheduler.Execute(6);
+  EXPECT_EQ((std::vector<std::string>{"next_step"}), executions);
+  EXPECT_EQ(0u, scheduler.GetNumberOfEvents());
+  EXPECT_EQ(std::numeric_limits<int64_t>::max(), scheduler.GetNextDueStep());
+}
+
+/**
+ * @brief Test for the wake-up event without callback
+ */
+TEST(EventScheduler, WakeUpEvent) {
+  EventScheduler scheduler;
+  const size_t periodic_event_id = scheduler.AddPeriodicEvent(100, 100, []() {});
+  scheduler.AddWakeUpEvent(42);
+  EXPECT_EQ(42, scheduler.GetNextDueStep());
+
+  scheduler.Execute(42);
+  EXPECT_EQ(1u, scheduler.GetNumberOfEvents());
+  EXPECT_EQ(100, scheduler.GetNextDueStep());
+
+  scheduler.RemoveEvent(periodic_event_id);
+  EXPECT_EQ(std::numeric_limits<int64_t>::max(), scheduler.GetNextDueStep());
+}
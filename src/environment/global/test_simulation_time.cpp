@@ -0,0 +1,245 @@
+/**
+ * @file test_simulation_time.cpp
+ * @brief Test codes for SimulationTime class with GoogleTest
+ */
+#include <SpiceUsr.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "simulation_time.hpp"
+
+namespace {
+/**
+ * @fn LoadLeapSecondsKernel
+ * @brief Load the leap seconds kernel used to calculate the ephemeris time at the constructor of SimulationTime
+ */
+void LoadLeapSecondsKernel() {
+  static bool is_loaded = false;
+  if (is_loaded) return;
+  const std::string file_name = std::string(EXT_LIB_DIR_FROM_EXE) + "/cspice/generic_kernels/lsk/naif0010.tls";
+  furnsh_c(file_name.c_str());
+  is_loaded = true;
+}
+
+/**
+ * @fn ExpectDerivedTime
+ * @brief Expect the lazily calculated time quantities match the eager calculation from the elapsed time
+ * @param [in] simulation_time: Simulation time
+ * @param [in] start_jd: Simulation start Julian date [day]
+ */
+void ExpectDerivedTime(const SimulationTime& simulation_time, const double start_jd) {
+  const double jd = start_jd + simulation_time.GetElapsedTime_s() / (60.0 * 60.0 * 24.0);
+  EXPECT_DOUBLE_EQ(jd, simulation_time.GetCurrentTime_jd());
+  EXPECT_DOUBLE_EQ(gstime(jd), simulation_time.GetCurrentSiderealTime());
+  double decimal_year;
+  JdToDecyear(jd, &decimal_year);
+  EXPECT_DOUBLE_EQ(decimal_year, simulation_time.GetCurrentDecimalYear());
+
+  int year, month, day, hour, minute;
+  double second;
+  invjday(jd, year, month, day, hour, minute, second);
+  const UTC utc = simulation_time.GetCurrentUtc();
+  EXPECT_EQ((unsigned int)year, utc.year);
+  EXPECT_EQ((unsigned int)month, utc.month);
+  EXPECT_EQ((unsigned int)day, utc.day);
+  EXPECT_EQ((unsigned int)hour, utc.hour);
+  EXPECT_EQ((unsigned int)minute, utc.minute);
+  EXPECT_DOUBLE_EQ(second, utc.second);
+  const EpochTime epoch_time(DateTime((size_t)year, (size_t)month, (size_t)day, (size_t)hour, (size_t)minute, second));
+  EXPECT_EQ(epoch_time, simulation_time.GetCurrentEpochTime());
+}
+}  // namespace
+
+/**
+ * @brief Test for the integer step accumulation and the update flags in a long simulation
+ * @note The simulation step of 0.01 s is not exactly expressed in binary, so the accumulation of the double step drifts in a day.
+ */
+TEST(SimulationTime, LongRunUpdateFlags) {
+  LoadLeapSecondsKernel();
+  const double end_s = 86400.0;
+  const int64_t step_ns = 10000000;
+  const int64_t attitude_interval_steps = 3;
+  const int64_t orbit_interval_steps = 10;
+  const int64_t thermal_interval_steps = 100;
+  const int64_t component_interval_steps = 10;
+  const int64_t log_interval_steps = 1000;
+  SimulationTime simulation_time(end_s, 0.01, 0.03, 0.01, 0.1, 0.1, 1.0, 1.0, 0.1, 10.0, "2020/01/01 11:00:00.0", 0.0);
+  EXPECT_EQ(step_ns, simulation_time.GetSimulationStep_ns());
+  EXPECT_TRUE(simulation_time.GetState().log_output);
+
+  int64_t number_of_updates[5] = {0, 0, 0, 0, 0};
+  int64_t number_of_violations = 0;
+  int64_t previous_step_count = 0;
+  while (!simulation_time.GetState().finish) {
+    simulation_time.UpdateTime();
+    const int64_t step_count = simulation_time.GetStepCount();
+    if (step_count <= previous_step_count) number_of_violations++;
+    previous_step_count = step_count;
+    if (simulation_time.GetElapsedTime_ns() != step_count * step_ns) number_of_violations++;
+
+    // The updates are due at the end of each interval, and the log is due at the beginning of it
+    const bool flags[5] = {simulation_time.GetAttitudePropagateFlag(), simulation_time.GetOrbitPropagateFlag(),
+                           simulation_time.GetThermalPropagateFlag(), simulation_time.GetCompoUpdateFlag(),
+                           simulation_time.GetState().log_output};
+    const bool expected_flags[5] = {(step_count + 1) % attitude_interval_steps == 0, (step_count + 1) % orbit_interval_steps == 0,
+                                    (step_count + 1) % thermal_interval_steps == 0, (step_count + 1) % component_interval_steps == 0,
+                                    step_count % log_interval_steps == 0};
+    for (size_t i = 0; i < 5; i++) {
+      if (flags[i] != expected_flags[i]) number_of_violations++;
+      if (flags[i]) number_of_updates[i]++;
+    }
+  }
+  EXPECT_EQ(0, number_of_violations);
+
+  // The simulation finishes at the first step after the end time
+  const int64_t last_step_count = 8640001;
+  EXPECT_EQ(last_step_count, simulation_time.GetStepCount());
+  EXPECT_NEAR(86400.01, simulation_time.GetElapsedTime_s(), 1.0e-9);
+
+  // No due step is jumped over
+  EXPECT_EQ((last_step_count + 1) / attitude_interval_steps, number_of_updates[0]);
+  EXPECT_EQ((last_step_count + 1) / orbit_interval_steps, number_of_updates[1]);
+  EXPECT_EQ((last_step_count + 1) / thermal_interval_steps, number_of_updates[2]);
+  EXPECT_EQ((last_step_count + 1) / component_interval_steps, number_of_updates[3]);
+  EXPECT_EQ(last_step_count / log_interval_steps, number_of_updates[4]);
+}
+
+/**
+ * @brief Test for the update interval which is not an integer multiple of the simulation step
+ */
+TEST(SimulationTime, IntervalRounding) {
+  LoadLeapSecondsKernel();
+  SimulationTime simulation_time(10.0, 0.01, 0.025, 0.01, 0.1, 0.1, 1.0, 1.0, 0.1, 1.0, "2020/01/01 11:00:00.0", 0.0);
+  // 2.5 steps is rounded to 3 steps
+  EXPECT_DOUBLE_EQ(0.03, simulation_time.GetAttitudeUpdateInterval_s());
+  EXPECT_DOUBLE_EQ(0.1, simulation_time.GetOrbitUpdateInterval_s());
+}
+
+/**
+ * @brief Test for the step jump stopped by the events of the event scheduler
+ */
+TEST(SimulationTime, EventSchedulerStep) {
+  LoadLeapSecondsKernel();
+  SimulationTime simulation_time(100.0, 0.01, 10.0, 0.01, 10.0, 0.1, 10.0, 1.0, 10.0, 10.0, "2020/01/01 11:00:00.0", 0.0);
+  EventScheduler& event_scheduler = simulation_time.GetEventScheduler();
+  std::set<int64_t> executed_steps;
+  event_scheduler.AddWakeUpEvent(1001);
+  event_scheduler.AddPeriodicEvent(2500, 2500, [&]() {
+    executed_steps.insert(simulation_time.GetStepCount());
+    // The event registered for the current step is executed in the same step
+    event_scheduler.AddOneShotEvent(simulation_time.GetStepCount(), [&]() { executed_steps.insert(-simulation_time.GetStepCount()); });
+  });
+
+  std::set<int64_t> visited_steps;
+  while (!simulation_time.GetState().finish) {
+    event_scheduler.Execute(simulation_time.GetStepCount());
+    simulation_time.UpdateTime();
+    visited_steps.insert(simulation_time.GetStepCount());
+  }
+
+  // The update, the log output and the events
+  const std::set<int64_t> expected_first_steps = {999, 1000, 1001, 1999, 2000, 2500, 2999};
+  std::set<int64_t> first_steps;
+  for (const int64_t step : visited_steps) {
+    if (step <= 2999) first_steps.insert(step);
+  }
+  EXPECT_EQ(expected_first_steps, first_steps);
+  EXPECT_EQ((std::set<int64_t>{-10000, -7500, -5000, -2500, 2500, 5000, 7500, 10000}), executed_steps);
+}
+
+/**
+ * @brief Test for the histogram bins of the lateness in the real time pacing
+ */
+TEST(SimulationTime, PacingLatenessHistogram) {
+  RealTimePacingStatistics statistics;
+  // The lower edge is included in the bin
+  const double latenesses_us[] = {-5.0, 0.0, 0.999, 1.0, 9.999, 10.0, 99.9, 100.0, 1000.0, 9999.9, 10000.0, 1.0e9};
+  for (const double lateness_us : latenesses_us) {
+    statistics.AddLateness(lateness_us);
+  }
+
+  const std::array<int64_t, RealTimePacingStatistics::kNumberOfBins> expected_histogram = {3, 2, 2, 1, 2, 2};
+  EXPECT_EQ(expected_histogram, statistics.histogram);
+  EXPECT_DOUBLE_EQ(1.0e9, statistics.max_lateness_us);
+
+  // Negative lateness is counted in the first bin and does not change the maximum
+  RealTimePacingStatistics negative_statistics;
+  negative_statistics.AddLateness(-100.0);
+  EXPECT_EQ(1, negative_statistics.histogram[0]);
+  EXPECT_DOUBLE_EQ(0.0, negative_statistics.max_lateness_us);
+}
+
+/**
+ * @brief Test for the step deadlines which advance by the step without drift after an overrun
+ */
+TEST(SimulationTime, PacingDeadlineWithoutDrift) {
+  LoadLeapSecondsKernel();
+  const double step_s = 0.01;
+  const int64_t number_of_steps = 20;
+  SimulationTime simulation_time(10.0, step_s, step_s, step_s, step_s, step_s, step_s, step_s, step_s, step_s, "2020/01/01 11:00:00.0", 1.0);
+  simulation_time.ResetClock();
+  const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+  for (int64_t step = 1; step <= number_of_steps; step++) {
+    simulation_time.UpdateTime();
+    const double elapsed_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    // The deadline of each step is the start time plus the step count times the step
+    EXPECT_EQ(step, simulation_time.GetStepCount());
+    EXPECT_GE(elapsed_time_s, step * step_s - 1.0e-3);
+    // Overrun of 6 steps, which is shorter than the limit of the time skip
+    if (step == 5) std::this_thread::sleep_for(std::chrono::milliseconds(60));
+  }
+  const double elapsed_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+  // The late steps are not waited, and the following deadlines are not shifted by the overrun
+  const RealTimePacingStatistics& statistics = simulation_time.GetRealTimePacingStatistics();
+  EXPECT_EQ(number_of_steps, statistics.number_of_steps);
+  EXPECT_GE(statistics.number_of_overruns, 5);
+  EXPECT_GE(statistics.max_lateness_us, 40.0e3);
+  EXPECT_LT(elapsed_time_s, number_of_steps * step_s + 0.04);
+}
+
+/**
+ * @brief Test for the lazily calculated time quantities compared with the eager calculation
+ */
+TEST(SimulationTime, LazyDerivedTime) {
+  LoadLeapSecondsKernel();
+  // The date changes at 13 h after the start
+  SimulationTime simulation_time(86400.0, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 1000.0, "2020/12/31 11:00:00.0", 0.0);
+  double start_jd;
+  jday(2020, 12, 31, 11, 0, 0.0, start_jd);
+  ExpectDerivedTime(simulation_time, start_jd);
+
+  // The values are refreshed after each update, including the same getter called twice in a step
+  simulation_time.UpdateTime();
+  ExpectDerivedTime(simulation_time, start_jd);
+  ExpectDerivedTime(simulation_time, start_jd);
+  const double sidereal_time_rad = simulation_time.GetCurrentSiderealTime();
+  simulation_time.UpdateTime();
+  EXPECT_NE(sidereal_time_rad, simulation_time.GetCurrentSiderealTime());
+  ExpectDerivedTime(simulation_time, start_jd);
+
+  // The values read between the updates do not remain after the steps without reading
+  const UTC utc_before_new_year = simulation_time.GetCurrentUtc();
+  EXPECT_EQ(2020u, utc_before_new_year.year);
+  while (simulation_time.GetElapsedTime_s() < 13.0 * 3600.0 + 0.05) {
+    simulation_time.UpdateTime();
+  }
+  const UTC utc_after_new_year = simulation_time.GetCurrentUtc();
+  EXPECT_EQ(2021u, utc_after_new_year.year);
+  EXPECT_EQ(1u, utc_after_new_year.month);
+  EXPECT_EQ(1u, utc_after_new_year.day);
+  ExpectDerivedTime(simulation_time, start_jd);
+
+  // Only a part of the values is read in a step
+  for (size_t i = 0; i < 10; i++) {
+    simulation_time.UpdateTime();
+    if (i % 2 == 0) simulation_time.GetCurrentSiderealTime();
+    if (i % 3 == 0) simulation_time.GetCurrentEpochTime();
+  }
+  ExpectDerivedTime(simulation_time, start_jd);
+}
@@ -99,6 +99,10 @@ std::string Atmosphere::GetLogHeader() const {
   return str_tmp;
 }
 
+void Atmosphere::SaveCheckpoint(CheckpointWriter& writer) const { writer.Write(air_density_kg_m3_); }
+
+void Atmosphere::LoadCheckpoint(CheckpointReader& reader) { reader.Read(air_density_kg_m3_); }
+
 Atmosphere InitAtmosphere(const std::string initialize_file_path, const LocalCelestialInformation* local_celestial_information,
                           const SimulationTime* simulation_time) {
   auto conf = IniAccess(initialize_file_path);
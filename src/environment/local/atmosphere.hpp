@@ -14,12 +14,13 @@
 #include "logger/loggable.hpp"
 #include "math_physics/atmosphere/wrapper_nrlmsise00.hpp"
 #include "math_physics/math/vector.hpp"
+#include "utilities/checkpoint.hpp"
 
 /**
  * @class Atmosphere
  * @brief Class to calculate earth's atmospheric density
  */
-class Atmosphere : public ILoggable {
+class Atmosphere : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn Atmosphere
@@ -73,6 +74,18 @@ class Atmosphere : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the air density into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the air density from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   // General information
   bool is_calc_enabled_ = true;  //!< Calculation enable flag
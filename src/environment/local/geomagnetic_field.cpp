@@ -7,8 +7,6 @@
 
 #include "math_physics/geomagnetic/igrf.h"
 #include "math_physics/randomization/global_randomization.hpp"
-#include "math_physics/randomization/normal_randomization.hpp"
-#include "math_physics/randomization/random_walk.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
 
 GeomagneticField::GeomagneticField(const std::string igrf_file_name, const double random_walk_srandard_deviation_nT,
@@ -18,7 +16,9 @@ GeomagneticField::GeomagneticField(const std::string igrf_file_name, const doubl
       random_walk_standard_deviation_nT_(random_walk_srandard_deviation_nT),
       random_walk_limit_nT_(random_walk_limit_nT),
       white_noise_standard_deviation_nT_(white_noise_standard_deviation_nT),
-      igrf_file_name_(igrf_file_name) {
+      igrf_file_name_(igrf_file_name),
+      random_walk_(0.1, libra::Vector<3>(random_walk_srandard_deviation_nT), libra::Vector<3>(random_walk_limit_nT)),
+      white_noise_(0.0, white_noise_standard_deviation_nT, global_randomization.MakeSeed()) {
   set_file_path(igrf_file_name_.c_str());
 }
 
@@ -40,16 +40,10 @@ void GeomagneticField::CalcMagneticField(const double decimal_year, const double
 }
 
 void GeomagneticField::AddNoise(double* magnetic_field_array_i_nT) {
-  static libra::Vector<3> standard_deviation(random_walk_standard_deviation_nT_);
-  static libra::Vector<3> limit(random_walk_limit_nT_);
-  static RandomWalk<3> random_walk(0.1, standard_deviation, limit);
-
-  static libra::NormalRand white_noise(0.0, white_noise_standard_deviation_nT_, global_randomization.MakeSeed());
-
   for (int i = 0; i < 3; ++i) {
-    magnetic_field_array_i_nT[i] += random_walk[i] + white_noise;
+    magnetic_field_array_i_nT[i] += random_walk_[i] + white_noise_;
   }
-  ++random_walk;  // Update random walk
+  ++random_walk_;  // Update random walk
 }
 
 std::string GeomagneticField::GetLogHeader() const {
@@ -85,3 +79,17 @@ GeomagneticField InitGeomagneticField(std::string initialize_file_path) {
 
   return geomagnetic_field;
 }
+
+void GeomagneticField::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(magnetic_field_i_nT_);
+  writer.Write(magnetic_field_b_nT_);
+  random_walk_.SaveCheckpoint(writer);
+  writer.Write(white_noise_);
+}
+
+void GeomagneticField::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(magnetic_field_i_nT_);
+  reader.Read(magnetic_field_b_nT_);
+  random_walk_.LoadCheckpoint(reader);
+  reader.Read(white_noise_);
+}
@@ -10,12 +10,15 @@
 #include "math_physics/geodesy/geodetic_position.hpp"
 #include "math_physics/math/quaternion.hpp"
 #include "math_physics/math/vector.hpp"
+#include "math_physics/randomization/normal_randomization.hpp"
+#include "math_physics/randomization/random_walk.hpp"
+#include "utilities/checkpoint.hpp"
 
 /**
  * @class GeomagneticField
  * @brief Class to calculate magnetic field of the earth
  */
-class GeomagneticField : public ILoggable {
+class GeomagneticField : public ILoggable, public ICheckpointable {
  public:
   bool IsCalcEnabled = true;  //!< Calculation flag
 
@@ -69,6 +72,18 @@ class GeomagneticField : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the magnetic field and the noise state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the magnetic field and the noise state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   libra::Vector<3> magnetic_field_i_nT_;      //!< Magnetic field vector at the inertial frame [nT]
   libra::Vector<3> magnetic_field_b_nT_;      //!< Magnetic field vector at the spacecraft body fixed frame [nT]
@@ -76,6 +91,8 @@ class GeomagneticField : public ILoggable {
   double random_walk_limit_nT_;               //!< Limit of Random Walk [nT]
   double white_noise_standard_deviation_nT_;  //!< Standard deviation of white noise [nT]
   std::string igrf_file_name_;                //!< Path to the initialize file
+  RandomWalk<3> random_walk_;                 //!< Random walk noise
+  libra::NormalRand white_noise_;             //!< White noise
 
   /**
    * @fn AddNoise
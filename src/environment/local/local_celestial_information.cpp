@@ -197,3 +197,27 @@ std::string LocalCelestialInformation::GetLogValue() const {
   }
   return str_tmp;
 }
+
+void LocalCelestialInformation::SaveCheckpoint(CheckpointWriter& writer) const {
+  const int num_of_state = global_celestial_information_->GetNumberOfSelectedBodies() * 3;
+  for (int i = 0; i < num_of_state; i++) {
+    writer.Write(celestial_body_position_from_center_b_m_[i]);
+    writer.Write(celestial_body_velocity_from_center_b_m_s_[i]);
+    writer.Write(celestial_body_position_from_spacecraft_i_m_[i]);
+    writer.Write(celestial_body_velocity_from_spacecraft_i_m_s_[i]);
+    writer.Write(celestial_body_position_from_spacecraft_b_m_[i]);
+    writer.Write(celestial_body_velocity_from_spacecraft_b_m_s_[i]);
+  }
+}
+
+void LocalCelestialInformation::LoadCheckpoint(CheckpointReader& reader) {
+  const int num_of_state = global_celestial_information_->GetNumberOfSelectedBodies() * 3;
+  for (int i = 0; i < num_of_state; i++) {
+    reader.Read(celestial_body_position_from_center_b_m_[i]);
+    reader.Read(celestial_body_velocity_from_center_b_m_s_[i]);
+    reader.Read(celestial_body_position_from_spacecraft_i_m_[i]);
+    reader.Read(celestial_body_velocity_from_spacecraft_i_m_s_[i]);
+    reader.Read(celestial_body_position_from_spacecraft_b_m_[i]);
+    reader.Read(celestial_body_velocity_from_spacecraft_b_m_s_[i]);
+  }
+}
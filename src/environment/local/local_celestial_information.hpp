@@ -7,12 +7,13 @@
 #define S2E_ENVIRONMENT_LOCAL_LOCAL_CELESTIAL_INFORMATION_HPP_
 
 #include "../global/celestial_information.hpp"
+#include "utilities/checkpoint.hpp"
 
 /**
  * @class LocalCelestialInformation
  * @brief Class to manage celestial body information in the spacecraft body frame
  */
-class LocalCelestialInformation : public ILoggable {
+class LocalCelestialInformation : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn LocalCelestialInformation
@@ -80,6 +81,18 @@ class LocalCelestialInformation : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the celestial body positions and velocities into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the celestial body positions and velocities from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   const CelestialInformation* global_celestial_information_;  //!< Global celestial information
   // Local Information
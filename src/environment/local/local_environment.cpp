@@ -7,6 +7,8 @@
 #include "dynamics/attitude/attitude.hpp"
 #include "dynamics/orbit/orbit.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
+#include "utilities/allocation_tracker.hpp"
+#include "utilities/profiler.hpp"
 
 LocalEnvironment::LocalEnvironment(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
                                    const int spacecraft_id) {
@@ -48,6 +50,8 @@ void LocalEnvironment::Initialize(const SimulationConfiguration* simulation_conf
 }
 
 void LocalEnvironment::Update(const Dynamics* dynamics, const SimulationTime* simulation_time) {
+  PROFILE_SCOPE("LocalEnvironment::Update");
+  ALLOCATION_SCOPE("LocalEnvironment::Update");
   auto& orbit = dynamics->GetOrbit();
   auto& attitude = dynamics->GetAttitude();
 
@@ -72,3 +76,17 @@ void LocalEnvironment::LogSetup(Logger& logger) {
   logger.AddLogList(atmosphere_);
   logger.AddLogList(celestial_information_);
 }
+
+void LocalEnvironment::SaveCheckpoint(CheckpointWriter& writer) const {
+  geomagnetic_field_->SaveCheckpoint(writer);
+  solar_radiation_pressure_environment_->SaveCheckpoint(writer);
+  atmosphere_->SaveCheckpoint(writer);
+  celestial_information_->SaveCheckpoint(writer);
+}
+
+void LocalEnvironment::LoadCheckpoint(CheckpointReader& reader) {
+  geomagnetic_field_->LoadCheckpoint(reader);
+  solar_radiation_pressure_environment_->LoadCheckpoint(reader);
+  atmosphere_->LoadCheckpoint(reader);
+  celestial_information_->LoadCheckpoint(reader);
+}
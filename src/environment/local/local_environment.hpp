@@ -13,6 +13,7 @@
 #include "local_celestial_information.hpp"
 #include "simulation/simulation_configuration.hpp"
 #include "solar_radiation_pressure_environment.hpp"
+#include "utilities/checkpoint.hpp"
 
 class Dynamics;
 
@@ -20,7 +21,7 @@ class Dynamics;
  * @class LocalEnvironment
  * @brief Class to manage local environments
  */
-class LocalEnvironment {
+class LocalEnvironment : public ICheckpointable {
  public:
   /**
    * @fn LocalEnvironment
@@ -50,6 +51,18 @@ class LocalEnvironment {
    */
   void LogSetup(Logger& logger);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the states of the local environments into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the states of the local environments from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   /**
    * @fn GetAtmosphere
    * @brief Return Atmosphere class
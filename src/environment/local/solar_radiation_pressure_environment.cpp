@@ -55,6 +55,16 @@ std::string SolarRadiationPressureEnvironment::GetLogValue() const {
   return str_tmp;
 }
 
+void SolarRadiationPressureEnvironment::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(solar_radiation_pressure_N_m2_);
+  writer.Write(shadow_coefficient_);
+}
+
+void SolarRadiationPressureEnvironment::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(solar_radiation_pressure_N_m2_);
+  reader.Read(shadow_coefficient_);
+}
+
 void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow_source_name) {
   if (shadow_source_name == "SUN") {
     shadow_coefficient_ *= 1.0;
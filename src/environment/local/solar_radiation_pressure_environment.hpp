@@ -8,12 +8,13 @@
 
 #include "environment/global/physical_constants.hpp"
 #include "environment/local/local_celestial_information.hpp"
+#include "utilities/checkpoint.hpp"
 
 /**
  * @class SolarRadiationPressureEnvironment
  * @brief Class to calculate Solar Radiation Pressure
  */
-class SolarRadiationPressureEnvironment : public ILoggable {
+class SolarRadiationPressureEnvironment : public ILoggable, public ICheckpointable {
  public:
   bool IsCalcEnabled = true;  //!< Calculation flag
 
@@ -90,6 +91,18 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the solar radiation pressure and the shadow coefficient into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the solar radiation pressure and the shadow coefficient from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   double solar_radiation_pressure_N_m2_;              //!< Solar radiation pressure [N/m^2]
   double solar_constant_W_m2_ = 1366.0;               //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
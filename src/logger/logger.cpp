@@ -7,6 +7,8 @@
 
 #include <ctime>
 #include <sstream>
+#include <utilities/allocation_tracker.hpp>
+#include <utilities/profiler.hpp>
 #ifdef _WIN32
 #include <direct.h>
 #else
@@ -63,6 +65,8 @@ void Logger::WriteHeaders(const bool add_newline) {
 }
 
 void Logger::WriteValues(const bool add_newline) {
+  PROFILE_SCOPE("Logger::WriteValues");
+  ALLOCATION_SCOPE("Logger::WriteValues");
   for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
     if (!((*itr)->is_log_enabled_)) continue;
     Write((*itr)->GetLogValue());
@@ -0,0 +1,23 @@
+/**
+ * @file benchmark_nrlmsise00.cpp
+ * @brief Benchmark codes for NRLMSISE-00 air density model with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "wrapper_nrlmsise00.hpp"
+
+/**
+ * @brief Benchmark of the air density calculation with the manual space weather parameters
+ * @note The manual parameters are used so that the benchmark does not depend on the space weather table file
+ */
+static void BM_CalcNRLMSISE00(benchmark::State& state) {
+  const std::vector<nrlmsise_table> table;
+  double longitude_rad = 0.0;
+  for (auto _ : state) {
+    longitude_rad += 1.0e-6;
+    benchmark::DoNotOptimize(CalcNRLMSISE00(2020.25, 0.6, longitude_rad, 500.0e3, table, true, 150.0, 150.0, 3.0));
+  }
+}
+BENCHMARK(BM_CalcNRLMSISE00);
@@ -17,6 +17,7 @@ extern "C" {
 #include <cmath> /* maths functions */
 #include <environment/global/physical_constants.hpp>
 #include <math_physics/math/constants.hpp>
+#include <mutex>
 #include <numeric>
 
 #include "wrapper_nrlmsise00.hpp" /* header for nrlmsise-00.h */
@@ -167,6 +168,10 @@ int ConvertMonthStrToMonthNum(string month_str) {
 /* ------------------------------------------------------------------- */
 double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const vector<nrlmsise_table>& table, bool is_manual_param,
                       double manual_f107, double manual_f107a, double manual_ap) {
+  // The NRLMSISE-00 library and decyear_monthly are not reentrant, so spacecraft updated in parallel share this function exclusively
+  static std::mutex nrlmsise_mutex;
+  std::lock_guard<std::mutex> lock(nrlmsise_mutex);
+
   struct nrlmsise_output output;
   struct nrlmsise_input input;
   struct nrlmsise_flags flags;
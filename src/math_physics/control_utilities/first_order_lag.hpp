@@ -37,6 +37,11 @@ class FirstOrderLag {
    * @brief Return output
    */
   inline double GetOutput() const { return output_; }
+  /**
+   * @fn SetOutput
+   * @brief Set output to restore the internal state
+   */
+  inline void SetOutput(const double output) { output_ = output; }
 
  private:
   double output_ = 0.0;           //!< Output of the system
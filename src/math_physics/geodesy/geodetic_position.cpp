@@ -6,6 +6,8 @@
 
 #include <math_physics/orbit/sgp4/sgp4ext.h>  // TODO: do not to use the functions in SGP4 library
 
+#include <algorithm>
+#include <cmath>
 #include <environment/global/physical_constants.hpp>
 #include <math_physics/math/constants.hpp>
 #include <math_physics/math/matrix.hpp>
@@ -24,29 +26,54 @@ GeodeticPosition::GeodeticPosition(const double latitude_rad, const double longi
 }
 
 void GeodeticPosition::UpdateFromEcef(const libra::Vector<3> position_ecef_m) {
+  // Closed-form conversion without iteration
+  // Ref: H. Vermeille, An analytical method to transform geocentric into geodetic coordinates, Journal of Geodesy, 2011
   const double earth_radius_m = environment::earth_equatorial_radius_m;
   const double flattening = environment::earth_flattening;
-
-  double r_m, e2, phi, c;
-  double theta_rad;
-
-  theta_rad = AcTan(position_ecef_m[1], position_ecef_m[0]);
-  longitude_rad_ = FMod2p(theta_rad);
-  r_m = sqrt(position_ecef_m[0] * position_ecef_m[0] + position_ecef_m[1] * position_ecef_m[1]);
-  e2 = flattening * (2.0 - flattening);
-  double lat_tmp_rad = AcTan(position_ecef_m[2], r_m);
-
-  do {
-    phi = lat_tmp_rad;
-    c = 1.0 / sqrt(1.0 - e2 * sin(phi) * sin(phi));
-    lat_tmp_rad = AcTan(position_ecef_m[2] + earth_radius_m * c * e2 * sin(phi), r_m);
-  } while (fabs(lat_tmp_rad - phi) >= 1E-10);
-
-  altitude_m_ = r_m / cos(lat_tmp_rad) - c * earth_radius_m;
-
-  if (lat_tmp_rad > libra::pi_2) lat_tmp_rad -= libra::tau;
-
-  latitude_rad_ = lat_tmp_rad;
+  const double e2 = flattening * (2.0 - flattening);
+  const double e4 = e2 * e2;
+
+  longitude_rad_ = FMod2p(AcTan(position_ecef_m[1], position_ecef_m[0]));
+
+  const double horizontal_distance_m = sqrt(position_ecef_m[0] * position_ecef_m[0] + position_ecef_m[1] * position_ecef_m[1]);
+  const double p = pow(horizontal_distance_m / earth_radius_m, 2.0);
+  const double q = (1.0 - e2) * pow(position_ecef_m[2] / earth_radius_m, 2.0);
+  const double r = (p + q - e4) / 6.0;
+  const double evolute_border_test = 8.0 * r * r * r + e4 * p * q;
+
+  if (evolute_border_test > 0.0 || q != 0.0) {
+    double u;
+    if (evolute_border_test > 0.0) {
+      // Outside the evolute of the ellipsoid
+      const double rad1 = sqrt(evolute_border_test);
+      const double rad2 = sqrt(e4 * p * q);
+      if (evolute_border_test > 10.0 * e2) {
+        const double rad3 = cbrt(pow(rad1 + rad2, 2.0));
+        u = r + 0.5 * rad3 + 2.0 * r * r / rad3;
+      } else {
+        u = r + 0.5 * cbrt(pow(rad1 + rad2, 2.0)) + 0.5 * cbrt(pow(rad1 - rad2, 2.0));
+      }
+    } else {
+      // Inside the evolute of the ellipsoid and not on the equatorial plane
+      const double rad1 = sqrt(-evolute_border_test);
+      const double rad2 = sqrt(-8.0 * r * r * r);
+      const double rad3 = sqrt(e4 * p * q);
+      const double angle_rad = 2.0 * atan2(rad3, rad1 + rad2) / 3.0;
+      u = -4.0 * r * sin(angle_rad) * cos(libra::pi / 6.0 + angle_rad);
+    }
+    const double v = sqrt(u * u + e4 * q);
+    const double w = e2 * (u + v - q) / (2.0 * v);
+    const double k = (u + v) / (sqrt(w * w + u + v) + w);
+    const double d = k * horizontal_distance_m / (k + e2);
+    const double distance_m = sqrt(d * d + position_ecef_m[2] * position_ecef_m[2]);
+    latitude_rad_ = 2.0 * atan2(position_ecef_m[2], distance_m + d);
+    altitude_m_ = (k + e2 - 1.0) * distance_m / k;
+  } else {
+    // On the equatorial plane inside the evolute. The northern one of the two nearest points is selected.
+    const double cos2_latitude = std::min(p * (1.0 - e2) / (e2 * (e2 - p)), 1.0);
+    latitude_rad_ = acos(sqrt(cos2_latitude));
+    altitude_m_ = -earth_radius_m * (1.0 - e2) / sqrt(1.0 - e2 * (1.0 - cos2_latitude));
+  }
 
   CalcQuaternionXcxfToLtc();
   return;
@@ -0,0 +1,52 @@
+/**
+ * @file test_geodetic_position.cpp
+ * @brief Test codes for GeodeticPosition class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <math_physics/math/constants.hpp>
+
+#include "geodetic_position.hpp"
+
+/**
+ * @brief Test for the conversion from the ECEF position and the inverse conversion
+ */
+TEST(GeodeticPosition, UpdateFromEcef) {
+  const double latitudes_rad[] = {-libra::pi_2, -1.2, -0.4, 0.0, 1.0e-6, 0.7, 1.5, libra::pi_2};
+  const double longitudes_rad[] = {0.0, 1.0, 3.0, 4.5, 6.2};
+  const double altitudes_m[] = {-10.0e3, 0.0, 400.0e3, 2000.0e3, 36000.0e3, 380000.0e3};
+
+  for (const double latitude_rad : latitudes_rad) {
+    for (const double longitude_rad : longitudes_rad) {
+      for (const double altitude_m : altitudes_m) {
+        const GeodeticPosition reference(latitude_rad, longitude_rad, altitude_m);
+        GeodeticPosition geodetic_position;
+        geodetic_position.UpdateFromEcef(reference.CalcEcefPosition());
+
+        EXPECT_NEAR(latitude_rad, geodetic_position.GetLatitude_rad(), 1.0e-11);
+        if (fabs(latitude_rad) < libra::pi_2) {
+          EXPECT_NEAR(longitude_rad, geodetic_position.GetLongitude_rad(), 1.0e-11);
+        }
+        EXPECT_NEAR(altitude_m, geodetic_position.GetAltitude_m(), 1.0e-6);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the positions near the center of the earth
+ */
+TEST(GeodeticPosition, NearCenter) {
+  // Inside the evolute and out of the equatorial plane
+  const GeodeticPosition reference(0.3, 1.0, -6300.0e3);
+  GeodeticPosition geodetic_position;
+  geodetic_position.UpdateFromEcef(reference.CalcEcefPosition());
+  const libra::Vector<3> difference_m = geodetic_position.CalcEcefPosition() - reference.CalcEcefPosition();
+  EXPECT_NEAR(0.0, difference_m.CalcNorm(), 1.0e-6);
+
+  // Center of the earth
+  geodetic_position.UpdateFromEcef(libra::Vector<3>(0.0));
+  EXPECT_NEAR(libra::pi_2, geodetic_position.GetLatitude_rad(), 1.0e-9);
+  EXPECT_NEAR(-6356752.0, geodetic_position.GetAltitude_m(), 1.0);
+}
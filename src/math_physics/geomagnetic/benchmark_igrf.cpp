@@ -0,0 +1,26 @@
+/**
+ * @file benchmark_igrf.cpp
+ * @brief Benchmark codes for IGRF calculation with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "igrf.h"
+
+/**
+ * @brief Benchmark of the magnetic field calculation with the bundled IGRF-13 coefficients
+ */
+static void BM_IgrfCalc(benchmark::State& state) {
+  const std::string coefficient_file_name = std::string(CORE_DIR_FROM_EXE) + "/src/math_physics/geomagnetic/igrf13.coef";
+  set_file_path(coefficient_file_name.c_str());
+  double magnetic_field_i_nT[3];
+  double latitude_rad = 0.0;
+  for (auto _ : state) {
+    // Change the latitude so that the terms cached for the previous position are not reused
+    latitude_rad += 1.0e-6;
+    IgrfCalc(2020.25, latitude_rad, 2.4, 500.0e3, 0.3, magnetic_field_i_nT);
+    benchmark::DoNotOptimize(magnetic_field_i_nT);
+  }
+}
+BENCHMARK(BM_IgrfCalc);
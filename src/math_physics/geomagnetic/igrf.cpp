@@ -46,6 +46,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <mutex>
 using namespace std;
 
 #include "../../math_physics/orbit/sgp4/sgp4ext.h"
@@ -441,6 +442,9 @@ int TransMagaxisToECI(const double *mag, double *pos, double lonrad, double thet
 // IGRFの計算を実行するメインルーチン
 // Output	:	mag[3]	ECI座標での磁界の値[nT]
 void IgrfCalc(double decyear, double latrad, double lonrad, double alt, double side, double *mag) {
+  // The coefficients and work arrays are global, so spacecraft updated in parallel share this function exclusively
+  static std::mutex igrf_mutex;
+  std::lock_guard<std::mutex> lock(igrf_mutex);
   static bool first_flg = true;
 
   if (first_flg == true) {
@@ -0,0 +1,87 @@
+/**
+ * @file benchmark_gravity_potential.cpp
+ * @brief Benchmark codes for GravityPotential class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "gravity_potential.hpp"
+
+namespace {
+/**
+ * @brief Make the geopotential model with deterministic coefficients following the Kaula's rule (10^-5 / n^2)
+ */
+GravityPotential MakeGravityPotential(const size_t degree) {
+  std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 2; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      c[n][m] = 1.0e-5 / (double)(n * n) * cos(0.7 * n + 1.3 * m);
+      if (m > 0) s[n][m] = 1.0e-5 / (double)(n * n) * sin(0.9 * n + 1.1 * m);
+    }
+  }
+  return GravityPotential(degree, c, s);
+}
+
+/**
+ * @brief Make the position of a LEO spacecraft in the ECEF frame
+ */
+libra::Vector<3> MakePosition(const size_t index) {
+  const double radius_m = 6878.0e3;
+  const double latitude_rad = 1.2 * sin(0.37 * index);
+  const double longitude_rad = 0.11 * index;
+  libra::Vector<3> position_xcxf_m;
+  position_xcxf_m[0] = radius_m * cos(latitude_rad) * cos(longitude_rad);
+  position_xcxf_m[1] = radius_m * cos(latitude_rad) * sin(longitude_rad);
+  position_xcxf_m[2] = radius_m * sin(latitude_rad);
+  return position_xcxf_m;
+}
+}  // namespace
+
+/**
+ * @brief Benchmark of the acceleration calculation for a position
+ */
+static void BM_GravityPotentialAcceleration(benchmark::State& state) {
+  GravityPotential gravity_potential = MakeGravityPotential(state.range(0));
+  const libra::Vector<3> position_xcxf_m = MakePosition(0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(gravity_potential.CalcAcceleration_xcxf_m_s2(position_xcxf_m));
+  }
+}
+BENCHMARK(BM_GravityPotentialAcceleration)->Arg(2)->Arg(10)->Arg(20)->Arg(50)->Arg(100);
+
+/**
+ * @brief Benchmark of the partial derivative calculation for a position
+ */
+static void BM_GravityPotentialPartialDerivative(benchmark::State& state) {
+  GravityPotential gravity_potential = MakeGravityPotential(state.range(0));
+  const libra::Vector<3> position_xcxf_m = MakePosition(0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(gravity_potential.CalcPartialDerivative_xcxf_s2(position_xcxf_m));
+  }
+}
+BENCHMARK(BM_GravityPotentialPartialDerivative)->Arg(2)->Arg(10)->Arg(20)->Arg(50);
+
+/**
+ * @brief Benchmark of the acceleration calculation for many positions in the structure-of-arrays layout
+ */
+static void BM_GravityPotentialAccelerationArrays(benchmark::State& state) {
+  const GravityPotential gravity_potential = MakeGravityPotential(state.range(0));
+  const size_t number_of_positions = 64;
+  std::vector<double> x(number_of_positions), y(number_of_positions), z(number_of_positions);
+  for (size_t i = 0; i < number_of_positions; i++) {
+    const libra::Vector<3> position_xcxf_m = MakePosition(i);
+    x[i] = position_xcxf_m[0];
+    y[i] = position_xcxf_m[1];
+    z[i] = position_xcxf_m[2];
+  }
+  std::vector<double> ax(number_of_positions), ay(number_of_positions), az(number_of_positions);
+  for (auto _ : state) {
+    gravity_potential.CalcAcceleration_xcxf_m_s2(number_of_positions, x.data(), y.data(), z.data(), ax.data(), ay.data(), az.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_positions);
+}
+BENCHMARK(BM_GravityPotentialAccelerationArrays)->Arg(10)->Arg(50);
@@ -5,6 +5,7 @@
 
 #include "gravity_potential.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <fstream>
@@ -93,6 +94,139 @@ libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vecto
   return acceleration_xcxf_m_s2;
 }
 
+void GravityPotential::CalcAcceleration_xcxf_m_s2(const size_t number_of_positions, const double *position_x_m, const double *position_y_m,
+                                                  const double *position_z_m, double *acceleration_x_m_s2, double *acceleration_y_m_s2,
+                                                  double *acceleration_z_m_s2) const {
+  if (degree_ <= 0) {
+    std::fill(acceleration_x_m_s2, acceleration_x_m_s2 + number_of_positions, 0.0);
+    std::fill(acceleration_y_m_s2, acceleration_y_m_s2 + number_of_positions, 0.0);
+    std::fill(acceleration_z_m_s2, acceleration_z_m_s2 + number_of_positions, 0.0);
+    return;
+  }
+
+  // V and W of a block of positions are stored as v[(n * size_vw + m) * kBlockSize + k]
+  const size_t kBlockSize = 64;
+  const size_t degree_vw = degree_ + 1;
+  const size_t size_vw = degree_vw + 1;
+  std::vector<double> v(size_vw * size_vw * kBlockSize, 0.0);
+  std::vector<double> w(size_vw * size_vw * kBlockSize, 0.0);
+  auto index = [size_vw](const size_t n, const size_t m) { return (n * size_vw + m) * kBlockSize; };
+  double x_tmp[kBlockSize], y_tmp[kBlockSize], z_tmp[kBlockSize], re_tmp[kBlockSize];
+  double acceleration_x[kBlockSize], acceleration_y[kBlockSize], acceleration_z[kBlockSize];
+
+  for (size_t begin = 0; begin < number_of_positions; begin += kBlockSize) {
+    const size_t count = std::min(kBlockSize, number_of_positions - begin);
+
+    // n = m = 0
+    for (size_t k = 0; k < count; k++) {
+      const double radius2_m2 = position_x_m[begin + k] * position_x_m[begin + k] + position_y_m[begin + k] * position_y_m[begin + k] +
+                                position_z_m[begin + k] * position_z_m[begin + k];
+      const double tmp = center_body_radius_m_ / radius2_m2;
+      x_tmp[k] = position_x_m[begin + k] * tmp;
+      y_tmp[k] = position_y_m[begin + k] * tmp;
+      z_tmp[k] = position_z_m[begin + k] * tmp;
+      re_tmp[k] = center_body_radius_m_ * tmp;
+      v[k] = center_body_radius_m_ / sqrt(radius2_m2);
+      w[k] = 0.0;
+    }
+
+    // Calc V and W
+    for (size_t m = 0; m < degree_vw;) {
+      const double m_d = (double)m;
+      for (size_t n = m + 1; n <= degree_vw; n++) {
+        const double n_d = (double)n;
+        const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+        const double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+        double *v_nm = &v[index(n, m)];
+        double *w_nm = &w[index(n, m)];
+        const double *v_prev = &v[index(n - 1, m)];
+        const double *w_prev = &w[index(n - 1, m)];
+        if (n <= m + 1) {
+          for (size_t k = 0; k < count; k++) {
+            v_nm[k] = c_normalize * c1 * z_tmp[k] * v_prev[k];
+            w_nm[k] = c_normalize * c1 * z_tmp[k] * w_prev[k];
+          }
+        } else {
+          const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+          const double c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+          const double *v_prev2 = &v[index(n - 2, m)];
+          const double *w_prev2 = &w[index(n - 2, m)];
+          for (size_t k = 0; k < count; k++) {
+            v_nm[k] = c_normalize * (c1 * z_tmp[k] * v_prev[k] - c2 * c2_normalize * re_tmp[k] * v_prev2[k]);
+            w_nm[k] = c_normalize * (c1 * z_tmp[k] * w_prev[k] - c2 * c2_normalize * re_tmp[k] * w_prev2[k]);
+          }
+        }
+      }
+      // next step
+      m++;
+      const double n_d = (double)m;
+      const double c_normalize = (m == 1) ? (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0) : sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+      double *v_nn = &v[index(m, m)];
+      double *w_nn = &w[index(m, m)];
+      const double *v_prev = &v[index(m - 1, m - 1)];
+      const double *w_prev = &w[index(m - 1, m - 1)];
+      for (size_t k = 0; k < count; k++) {
+        v_nn[k] = c_normalize * (x_tmp[k] * v_prev[k] - y_tmp[k] * w_prev[k]);
+        w_nn[k] = c_normalize * (x_tmp[k] * w_prev[k] + y_tmp[k] * v_prev[k]);
+      }
+    }
+
+    // Calc Acceleration
+    for (size_t k = 0; k < count; k++) {
+      acceleration_x[k] = 0.0;
+      acceleration_y[k] = 0.0;
+      acceleration_z[k] = 0.0;
+    }
+    for (size_t n = 0; n <= degree_; n++) {
+      const double n_d = (double)n;
+      const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+      const double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+      // m = 0
+      {
+        const double c_n0 = c_[n][0];
+        const double s_n0 = s_[n][0];
+        const double *v_p0 = &v[index(n + 1, 0)];
+        const double *w_p0 = &w[index(n + 1, 0)];
+        const double *v_p1 = &v[index(n + 1, 1)];
+        const double *w_p1 = &w[index(n + 1, 1)];
+        for (size_t k = 0; k < count; k++) {
+          acceleration_x[k] += -c_n0 * v_p1[k] * normalize_xy;
+          acceleration_y[k] += -c_n0 * w_p1[k] * normalize_xy;
+          acceleration_z[k] += (n_d + 1.0) * (-c_n0 * v_p0[k] - s_n0 * w_p0[k]) * normalize;
+        }
+      }
+      for (size_t m = 1; m <= n; m++) {
+        const double m_d = (double)m;
+        const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+        const double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+        const double normalize_xy2 = (m == 1) ? normalize * sqrt(factorial) * sqrt(2.0) : normalize * sqrt(factorial);
+        const double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+        const double c_nm = c_[n][m];
+        const double s_nm = s_[n][m];
+        const double *v_pp = &v[index(n + 1, m + 1)];
+        const double *w_pp = &w[index(n + 1, m + 1)];
+        const double *v_p0 = &v[index(n + 1, m)];
+        const double *w_p0 = &w[index(n + 1, m)];
+        const double *v_pm = &v[index(n + 1, m - 1)];
+        const double *w_pm = &w[index(n + 1, m - 1)];
+        for (size_t k = 0; k < count; k++) {
+          acceleration_x[k] +=
+              0.5 * (normalize_xy1 * (-c_nm * v_pp[k] - s_nm * w_pp[k]) + normalize_xy2 * (c_nm * v_pm[k] + s_nm * w_pm[k]));
+          acceleration_y[k] +=
+              0.5 * (normalize_xy1 * (-c_nm * w_pp[k] + s_nm * v_pp[k]) + normalize_xy2 * (-c_nm * w_pm[k] + s_nm * v_pm[k]));
+          acceleration_z[k] += (n_d - m_d + 1.0) * (-c_nm * v_p0[k] - s_nm * w_p0[k]) * normalize_z;
+        }
+      }
+    }
+    const double coefficient = gravity_constants_m3_s2_ / pow(center_body_radius_m_, 2.0);
+    for (size_t k = 0; k < count; k++) {
+      acceleration_x_m_s2[begin + k] = acceleration_x[k] * coefficient;
+      acceleration_y_m_s2[begin + k] = acceleration_y[k] * coefficient;
+      acceleration_z_m_s2[begin + k] = acceleration_z[k] * coefficient;
+    }
+  }
+}
+
 libra::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m) {
   libra::Matrix<3, 3> partial_derivative(0.0);
   if (degree_ <= 0) return partial_derivative;
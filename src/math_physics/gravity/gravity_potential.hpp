@@ -56,6 +56,29 @@ class GravityPotential {
    */
   libra::Matrix<3, 3> CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m);
 
+  /**
+   * @fn CalcAcceleration_xcxf_m_s2
+   * @brief Calculate the high-order gravity of many positions given in the structure-of-arrays layout
+   * @note The V and W functions are evaluated for each degree and order over a block of positions, so the inner loops over the positions can be
+   *       vectorized. The result is same with the single position version.
+   * @param [in] number_of_positions: Number of positions
+   * @param [in] position_x_m: X components of the positions in the XCXF frame [m]
+   * @param [in] position_y_m: Y components of the positions in the XCXF frame [m]
+   * @param [in] position_z_m: Z components of the positions in the XCXF frame [m]
+   * @param [out] acceleration_x_m_s2: X components of the acceleration in the XCXF frame [m/s2]
+   * @param [out] acceleration_y_m_s2: Y components of the acceleration in the XCXF frame [m/s2]
+   * @param [out] acceleration_z_m_s2: Z components of the acceleration in the XCXF frame [m/s2]
+   */
+  void CalcAcceleration_xcxf_m_s2(const size_t number_of_positions, const double *position_x_m, const double *position_y_m,
+                                  const double *position_z_m, double *acceleration_x_m_s2, double *acceleration_y_m_s2,
+                                  double *acceleration_z_m_s2) const;
+
+  /**
+   * @fn GetDegree
+   * @brief Return the maximum degree
+   */
+  inline size_t GetDegree() const { return degree_; }
+
  private:
   size_t degree_ = 0;                   //!< Maximum degree
   size_t n_ = 0, m_ = 0;                //!< Degree and order (FIXME: follow naming rule)
@@ -153,3 +153,48 @@ TEST(GravityPotential, PartialDerivative2) {
     }
   }
 }
+
+/**
+ * @brief Test for Acceleration calculation of many positions
+ */
+TEST(GravityPotential, BatchAcceleration) {
+  const size_t degree = 10;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Coefficients which are different for each degree and order
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 0; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      c_[n][m] = 1.0 / (1.0 + n + 0.5 * m);
+      if (m > 0) s_[n][m] = 0.5 / (1.0 + n + m);
+    }
+  }
+  GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+
+  // More positions than the block size
+  const size_t number_of_positions = 150;
+  std::vector<double> x(number_of_positions), y(number_of_positions), z(number_of_positions);
+  for (size_t i = 0; i < number_of_positions; i++) {
+    x[i] = 1.1 + 0.5 * sin(0.3 * i);
+    y[i] = 0.8 * cos(0.7 * i);
+    z[i] = 0.6 * sin(1.3 * i + 0.2);
+  }
+  std::vector<double> acceleration_x(number_of_positions), acceleration_y(number_of_positions), acceleration_z(number_of_positions);
+  gravity_potential_.CalcAcceleration_xcxf_m_s2(number_of_positions, x.data(), y.data(), z.data(), acceleration_x.data(), acceleration_y.data(),
+                                                acceleration_z.data());
+
+  for (size_t i = 0; i < number_of_positions; i++) {
+    libra::Vector<3> position_xcxf_m;
+    position_xcxf_m[0] = x[i];
+    position_xcxf_m[1] = y[i];
+    position_xcxf_m[2] = z[i];
+    const libra::Vector<3> acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_xcxf_m);
+    const double accuracy = 1.0e-12 * acceleration_xcxf_m_s2.CalcNorm();
+    EXPECT_NEAR(acceleration_xcxf_m_s2[0], acceleration_x[i], accuracy);
+    EXPECT_NEAR(acceleration_xcxf_m_s2[1], acceleration_y[i], accuracy);
+    EXPECT_NEAR(acceleration_xcxf_m_s2[2], acceleration_z[i], accuracy);
+  }
+}
@@ -0,0 +1,54 @@
+/**
+ * @file benchmark_interpolation.cpp
+ * @brief Benchmark codes for Interpolation class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "interpolation.hpp"
+
+namespace {
+const double kPeriod_s = 86400.0;  // Characteristic period like the earth rotation
+const double kStep_s = 900.0;      // Interval of the data points like the precise ephemeris
+
+/**
+ * @brief Make the interpolation with the data points of a periodic function
+ */
+libra::Interpolation MakeInterpolation(const size_t number_of_points) {
+  std::vector<double> time_s;
+  std::vector<double> value;
+  for (size_t i = 0; i < number_of_points; i++) {
+    time_s.push_back(kStep_s * i);
+    value.push_back(7000.0e3 * cos(2.0 * M_PI * kStep_s * i / 5800.0));
+  }
+  return libra::Interpolation(time_s, value);
+}
+}  // namespace
+
+/**
+ * @brief Benchmark of the trigonometric interpolation
+ */
+static void BM_InterpolationCalcTrigonometric(benchmark::State& state) {
+  const size_t number_of_points = state.range(0);
+  const libra::Interpolation interpolation = MakeInterpolation(number_of_points);
+  const double time_s = 0.5 * kStep_s * (number_of_points - 1) + 0.3 * kStep_s;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(interpolation.CalcTrigonometric(time_s, kPeriod_s));
+  }
+}
+BENCHMARK(BM_InterpolationCalcTrigonometric)->Arg(5)->Arg(9)->Arg(13);
+
+/**
+ * @brief Benchmark of the polynomial interpolation
+ */
+static void BM_InterpolationCalcPolynomial(benchmark::State& state) {
+  const size_t number_of_points = state.range(0);
+  const libra::Interpolation interpolation = MakeInterpolation(number_of_points);
+  const double time_s = 0.5 * kStep_s * (number_of_points - 1) + 0.3 * kStep_s;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(interpolation.CalcPolynomial(time_s));
+  }
+}
+BENCHMARK(BM_InterpolationCalcPolynomial)->Arg(5)->Arg(9)->Arg(13);
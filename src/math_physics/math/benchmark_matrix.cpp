@@ -0,0 +1,71 @@
+/**
+ * @file benchmark_matrix.cpp
+ * @brief Benchmark codes for Matrix class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "matrix.hpp"
+#include "matrix_vector.hpp"
+
+namespace {
+/**
+ * @brief Make a well-conditioned matrix with deterministic elements
+ */
+template <size_t N>
+libra::Matrix<N, N> MakeMatrix() {
+  libra::Matrix<N, N> matrix;
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < N; j++) {
+      matrix[i][j] = sin(1.0 + 0.7 * i + 1.3 * j);
+    }
+    matrix[i][i] += (double)N;
+  }
+  return matrix;
+}
+}  // namespace
+
+/**
+ * @brief Benchmark of the matrix multiplication
+ */
+template <size_t N>
+static void BM_MatrixMultiply(benchmark::State& state) {
+  const libra::Matrix<N, N> lhs = MakeMatrix<N>();
+  const libra::Matrix<N, N> rhs = lhs.Transpose();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs * rhs);
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, 3);
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, 6);
+BENCHMARK_TEMPLATE(BM_MatrixMultiply, 12);
+
+/**
+ * @brief Benchmark of the matrix and vector multiplication
+ */
+template <size_t N>
+static void BM_MatrixVectorMultiply(benchmark::State& state) {
+  const libra::Matrix<N, N> matrix = MakeMatrix<N>();
+  libra::Vector<N> vector;
+  for (size_t i = 0; i < N; i++) vector[i] = cos(0.3 * i);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(matrix * vector);
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixVectorMultiply, 3);
+BENCHMARK_TEMPLATE(BM_MatrixVectorMultiply, 6);
+
+/**
+ * @brief Benchmark of the inverse matrix calculation with the LU decomposition
+ */
+template <size_t N>
+static void BM_MatrixInverse(benchmark::State& state) {
+  const libra::Matrix<N, N> matrix = MakeMatrix<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(libra::CalcInverseMatrix(matrix));
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixInverse, 3);
+BENCHMARK_TEMPLATE(BM_MatrixInverse, 6);
+BENCHMARK_TEMPLATE(BM_MatrixInverse, 12);
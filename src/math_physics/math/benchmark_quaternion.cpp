@@ -0,0 +1,70 @@
+/**
+ * @file benchmark_quaternion.cpp
+ * @brief Benchmark codes for Quaternion class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include "quaternion.hpp"
+
+namespace {
+/**
+ * @brief Make a normalized quaternion
+ */
+libra::Quaternion MakeQuaternion() {
+  libra::Quaternion quaternion(0.1, -0.3, 0.5, 0.8);
+  return quaternion.Normalize();
+}
+}  // namespace
+
+/**
+ * @brief Benchmark of the frame conversion of a vector
+ */
+static void BM_QuaternionFrameConversion(benchmark::State& state) {
+  const libra::Quaternion quaternion = MakeQuaternion();
+  libra::Vector<3> vector;
+  vector[0] = 1.0;
+  vector[1] = 2.0;
+  vector[2] = 3.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(quaternion.FrameConversion(vector));
+  }
+}
+BENCHMARK(BM_QuaternionFrameConversion);
+
+/**
+ * @brief Benchmark of the inverse frame conversion of a vector
+ */
+static void BM_QuaternionInverseFrameConversion(benchmark::State& state) {
+  const libra::Quaternion quaternion = MakeQuaternion();
+  libra::Vector<3> vector;
+  vector[0] = 1.0;
+  vector[1] = 2.0;
+  vector[2] = 3.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(quaternion.InverseFrameConversion(vector));
+  }
+}
+BENCHMARK(BM_QuaternionInverseFrameConversion);
+
+/**
+ * @brief Benchmark of the conversion to the direction cosine matrix
+ */
+static void BM_QuaternionConvertToDcm(benchmark::State& state) {
+  const libra::Quaternion quaternion = MakeQuaternion();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(quaternion.ConvertToDcm());
+  }
+}
+BENCHMARK(BM_QuaternionConvertToDcm);
+
+/**
+ * @brief Benchmark of the quaternion multiplication
+ */
+static void BM_QuaternionMultiply(benchmark::State& state) {
+  const libra::Quaternion lhs = MakeQuaternion();
+  const libra::Quaternion rhs(0.6, 0.0, -0.8, 0.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs * rhs);
+  }
+}
+BENCHMARK(BM_QuaternionMultiply);
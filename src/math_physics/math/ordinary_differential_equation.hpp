@@ -6,6 +6,8 @@
 #ifndef S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_HPP_
 #define S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_HPP_
 
+#include <utilities/checkpoint.hpp>
+
 #include "./vector.hpp"
 
 namespace libra {
@@ -97,6 +99,20 @@ class OrdinaryDifferentialEquation {
    */
   inline double operator[](size_t n) const { return state_[n]; }
 
+  // Checkpoint
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the internal state into the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the internal state from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  protected:
   /**
    * @fn GetState
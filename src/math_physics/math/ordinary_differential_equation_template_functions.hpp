@@ -44,6 +44,22 @@ void OrdinaryDifferentialEquation<N>::Update() {
   independent_variable_ += step_width_s_;               // Update independent variable
 }
 
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(independent_variable_);
+  writer.Write(state_);
+  writer.Write(derivative_);
+  writer.Write(step_width_s_);
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(independent_variable_);
+  reader.Read(state_);
+  reader.Read(derivative_);
+  reader.Read(step_width_s_);
+}
+
 }  // namespace libra
 
 #endif  // S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_TEMPLATE_FUNCTIONS_HPP_
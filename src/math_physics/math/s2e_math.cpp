@@ -23,4 +23,39 @@ double WrapTo2Pi(const double angle_rad) {
   }
   return angle_out;
 }
+
+double CalcInverseStandardNormalCdf(const double probability) {
+  if (probability <= 0.0) return -HUGE_VAL;
+  if (probability >= 1.0) return HUGE_VAL;
+
+  // Coefficients of the rational approximation
+  const double a[6] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                       1.383577518672690e+02,  -3.066479806614716e+01, 2.506628277459239e+00};
+  const double b[5] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02, 6.680131188771972e+01, -1.328068155288572e+01};
+  const double c[6] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                       -2.549732539343734e+00, 4.374664141464968e+00,  2.938163982698783e+00};
+  const double d[4] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00};
+  const double probability_low = 0.02425;
+
+  double x;
+  if (probability < probability_low) {
+    const double q = sqrt(-2.0 * log(probability));
+    x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+  } else if (probability <= 1.0 - probability_low) {
+    const double q = probability - 0.5;
+    const double r = q * q;
+    x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+        (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+  } else {
+    const double q = sqrt(-2.0 * log(1.0 - probability));
+    x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+  }
+
+  // Halley's refinement
+  const double e = 0.5 * erfc(-x / sqrt(2.0)) - probability;
+  const double u = e * sqrt(libra::tau) * exp(x * x / 2.0);
+  x = x - u / (1.0 + x * u / 2.0);
+
+  return x;
+}
 }  // namespace libra
@@ -17,6 +17,15 @@ namespace libra {
  */
 double WrapTo2Pi(const double angle_rad);
 
+/**
+ * @fn CalcInverseStandardNormalCdf
+ * @brief Calculate inverse of the cumulative distribution function of the standard normal distribution
+ * @note Acklam's rational approximation with one step of Halley's refinement
+ * @param probability: Probability in (0, 1)
+ * @return Quantile of the standard normal distribution
+ */
+double CalcInverseStandardNormalCdf(const double probability);
+
 }  // namespace libra
 
 #endif  // S2E_LIBRARY_MATH_S2E_MATH_HPP_
@@ -29,3 +29,21 @@ TEST(S2eMath, WrapTo2Pi) {
   wrapped_angle_rad = libra::WrapTo2Pi(input_angle_rad);
   EXPECT_NEAR(1.0e-5, wrapped_angle_rad, accuracy);
 }
+
+/**
+ * @brief Test for inverse of the cumulative distribution function of the standard normal distribution
+ */
+TEST(S2eMath, CalcInverseStandardNormalCdf) {
+  const double accuracy = 1.0e-12;
+
+  EXPECT_NEAR(0.0, libra::CalcInverseStandardNormalCdf(0.5), accuracy);
+  EXPECT_NEAR(1.959963984540054, libra::CalcInverseStandardNormalCdf(0.975), accuracy);
+  EXPECT_NEAR(-1.959963984540054, libra::CalcInverseStandardNormalCdf(0.025), accuracy);
+  EXPECT_NEAR(-3.090232306167814, libra::CalcInverseStandardNormalCdf(0.001), accuracy);
+
+  // Consistency with the cumulative distribution function
+  for (double probability = 1.0e-8; probability < 1.0; probability += 0.01) {
+    const double x = libra::CalcInverseStandardNormalCdf(probability);
+    EXPECT_NEAR(probability, 0.5 * erfc(-x / sqrt(2.0)), 1.0e-14);
+  }
+}
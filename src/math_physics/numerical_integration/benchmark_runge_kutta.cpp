@@ -0,0 +1,36 @@
+/**
+ * @file benchmark_runge_kutta.cpp
+ * @brief Benchmark codes for RungeKutta class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "dormand_prince_5.hpp"
+#include "ode_examples.hpp"
+#include "runge_kutta_4.hpp"
+#include "runge_kutta_fehlberg.hpp"
+
+/**
+ * @brief Benchmark of an integration step of the two-body orbit
+ */
+template <class Integrator>
+static void BM_RungeKuttaTwoBodyOrbit(benchmark::State& state) {
+  const double step_width_s = 0.01;
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  Integrator integrator(step_width_s, ode);
+
+  libra::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  integrator.SetState(0.0, initial_state);
+
+  for (auto _ : state) {
+    integrator.Integrate();
+    benchmark::DoNotOptimize(integrator.GetState());
+  }
+}
+BENCHMARK_TEMPLATE(BM_RungeKuttaTwoBodyOrbit, libra::numerical_integration::RungeKutta4<4>);
+BENCHMARK_TEMPLATE(BM_RungeKuttaTwoBodyOrbit, libra::numerical_integration::RungeKuttaFehlberg<4>);
+BENCHMARK_TEMPLATE(BM_RungeKuttaTwoBodyOrbit, libra::numerical_integration::DormandPrince5<4>);
@@ -43,6 +43,23 @@ class EmbeddedRungeKutta : public RungeKutta<N> {
    */
   inline double GetLocalTruncationError() const { return local_truncation_error_; }
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the integration state and the local truncation error into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const {
+    RungeKutta<N>::SaveCheckpoint(writer);
+    writer.Write(local_truncation_error_);
+  }
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the integration state and the local truncation error from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) {
+    RungeKutta<N>::LoadCheckpoint(reader);
+    reader.Read(local_truncation_error_);
+  }
+
  protected:
   // Parameters should be defined by child class
   std::vector<double> higher_order_weights_;  //!< Weights vector for higher order approximation
@@ -6,6 +6,7 @@
 #ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_NUMERICAL_INTEGRATOR_HPP_
 #define S2E_LIBRARY_NUMERICAL_INTEGRATION_NUMERICAL_INTEGRATOR_HPP_
 
+#include <utilities/checkpoint.hpp>
 #include <vector>
 
 #include "../math/vector.hpp"
@@ -50,6 +51,12 @@ class NumericalIntegrator {
     previous_state_ = state;
   }
 
+  /**
+   * @fn SetStepWidth
+   * @brief Set step width
+   */
+  inline void SetStepWidth(const double step_width) { step_width_ = step_width; }
+
   /**
    * @fn GetState
    * @brief Return current state vector
@@ -64,6 +71,29 @@ class NumericalIntegrator {
    */
   virtual Vector<N> CalcInterpolationState(const double sigma) const = 0;
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the integration state into the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const {
+    writer.Write(step_width_);
+    writer.Write(current_independent_variable_);
+    writer.Write(current_state_);
+    writer.Write(previous_state_);
+  }
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the integration state from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) {
+    reader.Read(step_width_);
+    reader.Read(current_independent_variable_);
+    reader.Read(current_state_);
+    reader.Read(previous_state_);
+  }
+
  protected:
   // Settings
   double step_width_;  //!< Step width. The unit is depending on the independent variable
@@ -6,6 +6,8 @@
 #ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_EXAMPLE_ODE_HPP_
 #define S2E_LIBRARY_NUMERICAL_INTEGRATION_EXAMPLE_ODE_HPP_
 
+#include <cfloat>
+
 #include "../../utilities/macros.hpp"
 #include "interface_ode.hpp"
 
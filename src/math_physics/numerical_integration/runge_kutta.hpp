@@ -37,6 +37,23 @@ class RungeKutta : public NumericalIntegrator<N> {
    */
   virtual void Integrate();
 
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the integration state and the latest slope vectors used for the interpolation into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const {
+    NumericalIntegrator<N>::SaveCheckpoint(writer);
+    writer.Write(slope_);
+  }
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the integration state and the latest slope vectors from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) {
+    NumericalIntegrator<N>::LoadCheckpoint(reader);
+    reader.Read(slope_);
+  }
+
  protected:
   // Settings
   size_t number_of_stages_;     //!< Number of stage for integration (s in the equation)
@@ -0,0 +1,227 @@
+/**
+ * @file constellation_propagator.cpp
+ * @brief Class to propagate orbits of many homogeneous spacecraft together in the structure-of-arrays layout
+ */
+
+#include "constellation_propagator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <math_physics/atmosphere/harris_priester_model.hpp>
+#include <math_physics/atmosphere/simple_air_density_model.hpp>
+#include <math_physics/geodesy/geodetic_position.hpp>
+
+ConstellationPropagator::ConstellationPropagator(const GravityPotential& geopotential, const double step_width_s, const std::string air_density_model,
+                                                 const double gravity_constant_m3_s2, const double angular_velocity_rad_s)
+    : geopotential_(geopotential),
+      step_width_s_(step_width_s),
+      air_density_model_(air_density_model),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      angular_velocity_rad_s_(angular_velocity_rad_s) {
+  is_drag_enabled_ = (air_density_model_ == "STANDARD" || air_density_model_ == "HARRIS_PRIESTER");
+}
+
+size_t ConstellationPropagator::AddSpacecraft(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s,
+                                              const double ballistic_coefficient_m2_kg) {
+  position_i_m_.x.push_back(position_i_m[0]);
+  position_i_m_.y.push_back(position_i_m[1]);
+  position_i_m_.z.push_back(position_i_m[2]);
+  velocity_i_m_s_.x.push_back(velocity_i_m_s[0]);
+  velocity_i_m_s_.y.push_back(velocity_i_m_s[1]);
+  velocity_i_m_s_.z.push_back(velocity_i_m_s[2]);
+  ballistic_coefficients_m2_kg_.push_back(ballistic_coefficient_m2_kg);
+  air_densities_kg_m3_.push_back(0.0);
+
+  const size_t number_of_spacecraft = GetNumberOfSpacecraft();
+  stage_position_i_m_.Resize(number_of_spacecraft);
+  stage_velocity_i_m_s_.Resize(number_of_spacecraft);
+  stage_acceleration_i_m_s2_.Resize(number_of_spacecraft);
+  position_increment_i_m_.Resize(number_of_spacecraft);
+  velocity_increment_i_m_s_.Resize(number_of_spacecraft);
+  position_xcxf_m_.Resize(number_of_spacecraft);
+  acceleration_xcxf_m_s2_.Resize(number_of_spacecraft);
+
+  return number_of_spacecraft - 1;
+}
+
+void ConstellationPropagator::Propagate(const double end_time_s, const libra::Matrix<3, 3>& dcm_i_to_xcxf, const libra::Vector<3>& sun_direction_i) {
+  const double start_time_s = current_time_s_;
+  while (end_time_s - current_time_s_ > 1.0e-9) {
+    const double step_width_s = std::min(step_width_s_, end_time_s - current_time_s_);
+
+    // Rotation of the central body from the beginning of the propagation
+    const double rotation_angle_rad = angular_velocity_rad_s_ * (current_time_s_ - start_time_s);
+    libra::Matrix<3, 3> rotation = libra::MakeIdentityMatrix<3>();
+    rotation[0][0] = cos(rotation_angle_rad);
+    rotation[0][1] = sin(rotation_angle_rad);
+    rotation[1][0] = -sin(rotation_angle_rad);
+    rotation[1][1] = cos(rotation_angle_rad);
+    const libra::Matrix<3, 3> dcm_i_to_xcxf_step = rotation * dcm_i_to_xcxf;
+
+    if (is_drag_enabled_) UpdateAirDensity(dcm_i_to_xcxf_step, sun_direction_i);
+    Step(step_width_s, dcm_i_to_xcxf_step);
+    current_time_s_ += step_width_s;
+  }
+}
+
+libra::Vector<3> ConstellationPropagator::GetPosition_i_m(const size_t spacecraft_id) const {
+  libra::Vector<3> position_i_m;
+  position_i_m[0] = position_i_m_.x[spacecraft_id];
+  position_i_m[1] = position_i_m_.y[spacecraft_id];
+  position_i_m[2] = position_i_m_.z[spacecraft_id];
+  return position_i_m;
+}
+
+libra::Vector<3> ConstellationPropagator::GetVelocity_i_m_s(const size_t spacecraft_id) const {
+  libra::Vector<3> velocity_i_m_s;
+  velocity_i_m_s[0] = velocity_i_m_s_.x[spacecraft_id];
+  velocity_i_m_s[1] = velocity_i_m_s_.y[spacecraft_id];
+  velocity_i_m_s[2] = velocity_i_m_s_.z[spacecraft_id];
+  return velocity_i_m_s;
+}
+
+void ConstellationPropagator::Step(const double step_width_s, const libra::Matrix<3, 3>& dcm_i_to_xcxf) {
+  const size_t number_of_spacecraft = GetNumberOfSpacecraft();
+  const double rk_stage_ratio[4] = {0.0, 0.5, 0.5, 1.0};
+  const double rk_weight[4] = {1.0 / 6.0, 2.0 / 6.0, 2.0 / 6.0, 1.0 / 6.0};
+
+  for (size_t stage = 0; stage < 4; stage++) {
+    // Stage state from the derivatives of the previous stage
+    const double stage_step_s = rk_stage_ratio[stage] * step_width_s;
+    if (stage == 0) {
+      stage_position_i_m_ = position_i_m_;
+      stage_velocity_i_m_s_ = velocity_i_m_s_;
+    } else {
+      for (size_t i = 0; i < number_of_spacecraft; i++) {
+        // The stage velocity still holds the velocity of the previous stage here
+        stage_position_i_m_.x[i] = position_i_m_.x[i] + stage_step_s * stage_velocity_i_m_s_.x[i];
+        stage_position_i_m_.y[i] = position_i_m_.y[i] + stage_step_s * stage_velocity_i_m_s_.y[i];
+        stage_position_i_m_.z[i] = position_i_m_.z[i] + stage_step_s * stage_velocity_i_m_s_.z[i];
+        stage_velocity_i_m_s_.x[i] = velocity_i_m_s_.x[i] + stage_step_s * stage_acceleration_i_m_s2_.x[i];
+        stage_velocity_i_m_s_.y[i] = velocity_i_m_s_.y[i] + stage_step_s * stage_acceleration_i_m_s2_.y[i];
+        stage_velocity_i_m_s_.z[i] = velocity_i_m_s_.z[i] + stage_step_s * stage_acceleration_i_m_s2_.z[i];
+      }
+    }
+
+    // Rotation of the central body in the stage
+    const double rotation_angle_rad = angular_velocity_rad_s_ * stage_step_s;
+    libra::Matrix<3, 3> rotation = libra::MakeIdentityMatrix<3>();
+    rotation[0][0] = cos(rotation_angle_rad);
+    rotation[0][1] = sin(rotation_angle_rad);
+    rotation[1][0] = -sin(rotation_angle_rad);
+    rotation[1][1] = cos(rotation_angle_rad);
+    CalcAcceleration(rotation * dcm_i_to_xcxf);
+
+    // Weighted sum of the derivatives
+    const double weight = rk_weight[stage];
+    if (stage == 0) {
+      for (size_t i = 0; i < number_of_spacecraft; i++) {
+        position_increment_i_m_.x[i] = weight * stage_velocity_i_m_s_.x[i];
+        position_increment_i_m_.y[i] = weight * stage_velocity_i_m_s_.y[i];
+        position_increment_i_m_.z[i] = weight * stage_velocity_i_m_s_.z[i];
+        velocity_increment_i_m_s_.x[i] = weight * stage_acceleration_i_m_s2_.x[i];
+        velocity_increment_i_m_s_.y[i] = weight * stage_acceleration_i_m_s2_.y[i];
+        velocity_increment_i_m_s_.z[i] = weight * stage_acceleration_i_m_s2_.z[i];
+      }
+    } else {
+      for (size_t i = 0; i < number_of_spacecraft; i++) {
+        position_increment_i_m_.x[i] += weight * stage_velocity_i_m_s_.x[i];
+        position_increment_i_m_.y[i] += weight * stage_velocity_i_m_s_.y[i];
+        position_increment_i_m_.z[i] += weight * stage_velocity_i_m_s_.z[i];
+        velocity_increment_i_m_s_.x[i] += weight * stage_acceleration_i_m_s2_.x[i];
+        velocity_increment_i_m_s_.y[i] += weight * stage_acceleration_i_m_s2_.y[i];
+        velocity_increment_i_m_s_.z[i] += weight * stage_acceleration_i_m_s2_.z[i];
+      }
+    }
+  }
+
+  for (size_t i = 0; i < number_of_spacecraft; i++) {
+    position_i_m_.x[i] += step_width_s * position_increment_i_m_.x[i];
+    position_i_m_.y[i] += step_width_s * position_increment_i_m_.y[i];
+    position_i_m_.z[i] += step_width_s * position_increment_i_m_.z[i];
+    velocity_i_m_s_.x[i] += step_width_s * velocity_increment_i_m_s_.x[i];
+    velocity_i_m_s_.y[i] += step_width_s * velocity_increment_i_m_s_.y[i];
+    velocity_i_m_s_.z[i] += step_width_s * velocity_increment_i_m_s_.z[i];
+  }
+}
+
+void ConstellationPropagator::UpdateAirDensity(const libra::Matrix<3, 3>& dcm_i_to_xcxf, const libra::Vector<3>& sun_direction_i) {
+  const size_t number_of_spacecraft = GetNumberOfSpacecraft();
+  GeodeticPosition geodetic_position;
+  for (size_t i = 0; i < number_of_spacecraft; i++) {
+    libra::Vector<3> position_xcxf_m;
+    for (size_t row = 0; row < 3; row++) {
+      position_xcxf_m[row] = dcm_i_to_xcxf[row][0] * position_i_m_.x[i] + dcm_i_to_xcxf[row][1] * position_i_m_.y[i] +
+                             dcm_i_to_xcxf[row][2] * position_i_m_.z[i];
+    }
+    geodetic_position.UpdateFromEcef(position_xcxf_m);
+
+    if (air_density_model_ == "STANDARD") {
+      air_densities_kg_m3_[i] = libra::atmosphere::CalcAirDensityWithSimpleModel(geodetic_position.GetAltitude_m());
+    } else {
+      air_densities_kg_m3_[i] = libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(geodetic_position, sun_direction_i);
+    }
+  }
+}
+
+void ConstellationPropagator::CalcAcceleration(const libra::Matrix<3, 3>& dcm_i_to_xcxf) {
+  const size_t number_of_spacecraft = GetNumberOfSpacecraft();
+  const double* position_x_m = stage_position_i_m_.x.data();
+  const double* position_y_m = stage_position_i_m_.y.data();
+  const double* position_z_m = stage_position_i_m_.z.data();
+  double* acceleration_x_m_s2 = stage_acceleration_i_m_s2_.x.data();
+  double* acceleration_y_m_s2 = stage_acceleration_i_m_s2_.y.data();
+  double* acceleration_z_m_s2 = stage_acceleration_i_m_s2_.z.data();
+
+  // Two-body
+  for (size_t i = 0; i < number_of_spacecraft; i++) {
+    const double radius2_m2 = position_x_m[i] * position_x_m[i] + position_y_m[i] * position_y_m[i] + position_z_m[i] * position_z_m[i];
+    const double coefficient = -gravity_constant_m3_s2_ / (radius2_m2 * sqrt(radius2_m2));
+    acceleration_x_m_s2[i] = coefficient * position_x_m[i];
+    acceleration_y_m_s2[i] = coefficient * position_y_m[i];
+    acceleration_z_m_s2[i] = coefficient * position_z_m[i];
+  }
+
+  // Geopotential
+  if (geopotential_.GetDegree() >= 2) {
+    double dcm[3][3];
+    for (size_t row = 0; row < 3; row++) {
+      for (size_t column = 0; column < 3; column++) {
+        dcm[row][column] = dcm_i_to_xcxf[row][column];
+      }
+    }
+    for (size_t i = 0; i < number_of_spacecraft; i++) {
+      position_xcxf_m_.x[i] = dcm[0][0] * position_x_m[i] + dcm[0][1] * position_y_m[i] + dcm[0][2] * position_z_m[i];
+      position_xcxf_m_.y[i] = dcm[1][0] * position_x_m[i] + dcm[1][1] * position_y_m[i] + dcm[1][2] * position_z_m[i];
+      position_xcxf_m_.z[i] = dcm[2][0] * position_x_m[i] + dcm[2][1] * position_y_m[i] + dcm[2][2] * position_z_m[i];
+    }
+    geopotential_.CalcAcceleration_xcxf_m_s2(number_of_spacecraft, position_xcxf_m_.x.data(), position_xcxf_m_.y.data(), position_xcxf_m_.z.data(),
+                                             acceleration_xcxf_m_s2_.x.data(), acceleration_xcxf_m_s2_.y.data(), acceleration_xcxf_m_s2_.z.data());
+    for (size_t i = 0; i < number_of_spacecraft; i++) {
+      const double acceleration_xcxf_x = acceleration_xcxf_m_s2_.x[i];
+      const double acceleration_xcxf_y = acceleration_xcxf_m_s2_.y[i];
+      const double acceleration_xcxf_z = acceleration_xcxf_m_s2_.z[i];
+      acceleration_x_m_s2[i] += dcm[0][0] * acceleration_xcxf_x + dcm[1][0] * acceleration_xcxf_y + dcm[2][0] * acceleration_xcxf_z;
+      acceleration_y_m_s2[i] += dcm[0][1] * acceleration_xcxf_x + dcm[1][1] * acceleration_xcxf_y + dcm[2][1] * acceleration_xcxf_z;
+      acceleration_z_m_s2[i] += dcm[0][2] * acceleration_xcxf_x + dcm[1][2] * acceleration_xcxf_y + dcm[2][2] * acceleration_xcxf_z;
+    }
+  }
+
+  // Air drag with the velocity relative to the co-rotating atmosphere
+  if (is_drag_enabled_) {
+    const double* velocity_x_m_s = stage_velocity_i_m_s_.x.data();
+    const double* velocity_y_m_s = stage_velocity_i_m_s_.y.data();
+    const double* velocity_z_m_s = stage_velocity_i_m_s_.z.data();
+    for (size_t i = 0; i < number_of_spacecraft; i++) {
+      const double relative_velocity_x_m_s = velocity_x_m_s[i] + angular_velocity_rad_s_ * position_y_m[i];
+      const double relative_velocity_y_m_s = velocity_y_m_s[i] - angular_velocity_rad_s_ * position_x_m[i];
+      const double relative_velocity_z_m_s = velocity_z_m_s[i];
+      const double relative_speed_m_s = sqrt(relative_velocity_x_m_s * relative_velocity_x_m_s + relative_velocity_y_m_s * relative_velocity_y_m_s +
+                                             relative_velocity_z_m_s * relative_velocity_z_m_s);
+      const double coefficient = -0.5 * ballistic_coefficients_m2_kg_[i] * air_densities_kg_m3_[i] * relative_speed_m_s;
+      acceleration_x_m_s2[i] += coefficient * relative_velocity_x_m_s;
+      acceleration_y_m_s2[i] += coefficient * relative_velocity_y_m_s;
+      acceleration_z_m_s2[i] += coefficient * relative_velocity_z_m_s;
+    }
+  }
+}
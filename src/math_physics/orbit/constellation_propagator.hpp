@@ -0,0 +1,146 @@
+/**
+ * @file constellation_propagator.hpp
+ * @brief Class to propagate orbits of many homogeneous spacecraft together in the structure-of-arrays layout
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_CONSTELLATION_PROPAGATOR_HPP_
+#define S2E_LIBRARY_ORBIT_CONSTELLATION_PROPAGATOR_HPP_
+
+#include <environment/global/physical_constants.hpp>
+#include <math_physics/gravity/gravity_potential.hpp>
+#include <math_physics/math/matrix.hpp>
+#include <math_physics/math/vector.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class ConstellationPropagator
+ * @brief Class to propagate orbits of many homogeneous spacecraft together in the structure-of-arrays layout
+ * @details All spacecraft share the force model of the two-body gravity, the geopotential, and the air drag. The states are stored as arrays of
+ *          each component, and the accelerations are evaluated with loops over the spacecraft. The states are integrated together with the RK4
+ *          method. The geopotential is evaluated at every stage with the rotation of the earth during the step, and the air density is evaluated
+ *          at the beginning of each step. The attitude, the other disturbances, and the maneuvers are not considered.
+ */
+class ConstellationPropagator {
+ public:
+  /**
+   * @fn ConstellationPropagator
+   * @brief Constructor
+   * @param [in] geopotential: Geopotential model without the two-body term (c[0][0] = 0) like Geopotential disturbance
+   * @param [in] step_width_s: Step width of the integration [s]
+   * @param [in] air_density_model: Air density model for the drag (STANDARD or HARRIS_PRIESTER, others disable the drag)
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the central body [m3/s2]
+   * @param [in] angular_velocity_rad_s: Rotation angular velocity of the central body around the Z axis [rad/s]
+   */
+  ConstellationPropagator(const GravityPotential& geopotential, const double step_width_s, const std::string air_density_model = "NONE",
+                          const double gravity_constant_m3_s2 = environment::earth_gravitational_constant_m3_s2,
+                          const double angular_velocity_rad_s = environment::earth_mean_angular_velocity_rad_s);
+
+  /**
+   * @fn AddSpacecraft
+   * @brief Add a spacecraft
+   * @param [in] position_i_m: Initial position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial velocity in the inertial frame [m/s]
+   * @param [in] ballistic_coefficient_m2_kg: Drag coefficient x area / mass [m2/kg]
+   * @return Index of the spacecraft
+   */
+  size_t AddSpacecraft(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s, const double ballistic_coefficient_m2_kg = 0.0);
+  /**
+   * @fn Propagate
+   * @brief Propagate all spacecraft to the end time
+   * @param [in] end_time_s: End time [s]
+   * @param [in] dcm_i_to_xcxf: DCM from the inertial frame to the central body fixed frame at the current time
+   * @param [in] sun_direction_i: Sun direction unit vector in the inertial frame for HARRIS_PRIESTER model
+   */
+  void Propagate(const double end_time_s, const libra::Matrix<3, 3>& dcm_i_to_xcxf, const libra::Vector<3>& sun_direction_i);
+
+  // Getter
+  /**
+   * @fn GetNumberOfSpacecraft
+   * @brief Return number of spacecraft
+   */
+  inline size_t GetNumberOfSpacecraft() const { return position_i_m_.x.size(); }
+  /**
+   * @fn GetCurrentTime_s
+   * @brief Return current time of the states [s]
+   */
+  inline double GetCurrentTime_s() const { return current_time_s_; }
+  /**
+   * @fn GetPosition_i_m
+   * @brief Return position of the spacecraft in the inertial frame [m]
+   * @param [in] spacecraft_id: Index of the spacecraft
+   */
+  libra::Vector<3> GetPosition_i_m(const size_t spacecraft_id) const;
+  /**
+   * @fn GetVelocity_i_m_s
+   * @brief Return velocity of the spacecraft in the inertial frame [m/s]
+   * @param [in] spacecraft_id: Index of the spacecraft
+   */
+  libra::Vector<3> GetVelocity_i_m_s(const size_t spacecraft_id) const;
+
+ private:
+  /**
+   * @struct CartesianArrays
+   * @brief Three dimensional vectors of all spacecraft in the structure-of-arrays layout
+   */
+  struct CartesianArrays {
+    std::vector<double> x;  //!< X components
+    std::vector<double> y;  //!< Y components
+    std::vector<double> z;  //!< Z components
+    /**
+     * @fn Resize
+     * @brief Resize all components
+     */
+    inline void Resize(const size_t size) {
+      x.resize(size, 0.0);
+      y.resize(size, 0.0);
+      z.resize(size, 0.0);
+    }
+  };
+
+  GravityPotential geopotential_;  //!< Geopotential model without the two-body term
+  double step_width_s_;            //!< Step width of the integration [s]
+  std::string air_density_model_;  //!< Air density model for the drag
+  bool is_drag_enabled_;           //!< Flag of the air drag
+  double gravity_constant_m3_s2_;  //!< Gravity constant of the central body [m3/s2]
+  double angular_velocity_rad_s_;  //!< Rotation angular velocity of the central body [rad/s]
+  double current_time_s_ = 0.0;    //!< Current time of the states [s]
+
+  // States and parameters
+  CartesianArrays position_i_m_;                      //!< Positions in the inertial frame [m]
+  CartesianArrays velocity_i_m_s_;                    //!< Velocities in the inertial frame [m/s]
+  std::vector<double> ballistic_coefficients_m2_kg_;  //!< Ballistic coefficients [m2/kg]
+  std::vector<double> air_densities_kg_m3_;           //!< Air densities at the beginning of the step [kg/m3]
+
+  // Work arrays of the integration
+  CartesianArrays stage_position_i_m_;         //!< Positions at the stage [m]
+  CartesianArrays stage_velocity_i_m_s_;       //!< Velocities at the stage [m/s]
+  CartesianArrays stage_acceleration_i_m_s2_;  //!< Accelerations at the stage [m/s2]
+  CartesianArrays position_increment_i_m_;     //!< Weighted sum of the velocities for the position increment [m/s]
+  CartesianArrays velocity_increment_i_m_s_;   //!< Weighted sum of the accelerations for the velocity increment [m/s2]
+  CartesianArrays position_xcxf_m_;            //!< Positions in the central body fixed frame [m]
+  CartesianArrays acceleration_xcxf_m_s2_;     //!< Geopotential accelerations in the central body fixed frame [m/s2]
+
+  /**
+   * @fn Step
+   * @brief Integrate all spacecraft by one step with the RK4 method
+   * @param [in] step_width_s: Step width [s]
+   * @param [in] dcm_i_to_xcxf: DCM from the inertial frame to the central body fixed frame at the beginning of the step
+   */
+  void Step(const double step_width_s, const libra::Matrix<3, 3>& dcm_i_to_xcxf);
+  /**
+   * @fn UpdateAirDensity
+   * @brief Update the air densities at the current positions
+   * @param [in] dcm_i_to_xcxf: DCM from the inertial frame to the central body fixed frame
+   * @param [in] sun_direction_i: Sun direction unit vector in the inertial frame
+   */
+  void UpdateAirDensity(const libra::Matrix<3, 3>& dcm_i_to_xcxf, const libra::Vector<3>& sun_direction_i);
+  /**
+   * @fn CalcAcceleration
+   * @brief Calculate the accelerations at the stage positions and velocities into the stage accelerations
+   * @param [in] dcm_i_to_xcxf: DCM from the inertial frame to the central body fixed frame at the stage
+   */
+  void CalcAcceleration(const libra::Matrix<3, 3>& dcm_i_to_xcxf);
+};
+
+#endif  // S2E_LIBRARY_ORBIT_CONSTELLATION_PROPAGATOR_HPP_
@@ -0,0 +1,365 @@
+/**
+ * @file ephemeris_file_reader.cpp
+ * @brief Class to read time series of states from an ephemeris file with indexed seeking and interpolation
+ */
+
+#include "ephemeris_file_reader.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+static const char kBinaryMagic[8] = {'S', '2', 'E', 'E', 'P', 'H', 'E', 'M'};  //!< Magic of the binary ephemeris file
+
+/**
+ * @fn SplitCsvNames
+ * @brief Split the header line of the CSV file into the column names
+ */
+static std::vector<std::string> SplitCsvNames(const std::string& line) {
+  std::vector<std::string> names;
+  size_t begin = 0;
+  while (true) {
+    const size_t end = line.find(',', begin);
+    std::string name = line.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+    const size_t first = name.find_first_not_of(" \t\r");
+    const size_t last = name.find_last_not_of(" \t\r");
+    names.push_back(first == std::string::npos ? "" : name.substr(first, last - first + 1));
+    if (end == std::string::npos) break;
+    begin = end + 1;
+  }
+  return names;
+}
+
+/**
+ * @fn FindCsvFields
+ * @brief Find the start positions of the fields in the CSV line
+ */
+static void FindCsvFields(const std::string& line, std::vector<size_t>& field_positions) {
+  field_positions.clear();
+  field_positions.push_back(0);
+  for (size_t i = 0; i < line.size(); i++) {
+    if (line[i] == ',') field_positions.push_back(i + 1);
+  }
+}
+
+/**
+ * @fn ParseCsvField
+ * @brief Parse the field of the CSV line as a number
+ * @return The value, or NaN when the field is not a number
+ */
+static double ParseCsvField(const std::string& line, const std::vector<size_t>& field_positions, const size_t column_index) {
+  if (column_index >= field_positions.size()) return std::numeric_limits<double>::quiet_NaN();
+  const char* begin = line.c_str() + field_positions[column_index];
+  char* end;
+  const double value = std::strtod(begin, &end);
+  if (end == begin) return std::numeric_limits<double>::quiet_NaN();
+  return value;
+}
+
+EphemerisInterpolationMethod ConvertEphemerisInterpolationMethod(const std::string method) {
+  if (method == "HERMITE") return EphemerisInterpolationMethod::kHermite;
+  if (method != "LAGRANGE") {
+    std::cerr << "[WARNING] Ephemeris interpolation method: " << method << " is not defined. LAGRANGE is used." << std::endl;
+  }
+  return EphemerisInterpolationMethod::kLagrange;
+}
+
+size_t ConvertEphemerisTextToBinary(const std::string text_file_name, const std::string binary_file_name) {
+  std::ifstream text_file(text_file_name);
+  if (!text_file.is_open()) {
+    std::cerr << "[WARNING] Ephemeris file not found: " << text_file_name << std::endl;
+    return 0;
+  }
+  std::ofstream binary_file(binary_file_name, std::ios::binary);
+  if (!binary_file.is_open()) {
+    std::cerr << "[WARNING] Ephemeris file cannot be created: " << binary_file_name << std::endl;
+    return 0;
+  }
+
+  // Header
+  std::string line;
+  if (!std::getline(text_file, line)) return 0;
+  const std::vector<std::string> column_names = SplitCsvNames(line);
+  const uint32_t number_of_columns = (uint32_t)column_names.size();
+  binary_file.write(kBinaryMagic, sizeof(kBinaryMagic));
+  binary_file.write(reinterpret_cast<const char*>(&number_of_columns), sizeof(number_of_columns));
+  for (const auto& name : column_names) {
+    const uint32_t length = (uint32_t)name.size();
+    binary_file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    binary_file.write(name.data(), length);
+  }
+
+  // Records
+  size_t number_of_records = 0;
+  std::vector<size_t> field_positions;
+  std::vector<double> record(number_of_columns);
+  while (std::getline(text_file, line)) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+    FindCsvFields(line, field_positions);
+    for (size_t column = 0; column < number_of_columns; column++) {
+      record[column] = ParseCsvField(line, field_positions, column);
+    }
+    binary_file.write(reinterpret_cast<const char*>(record.data()), sizeof(double) * number_of_columns);
+    number_of_records++;
+  }
+  return number_of_records;
+}
+
+EphemerisFileReader::EphemerisFileReader(const std::string file_name, const std::string time_column_name,
+                                         const std::vector<std::string> column_names, const size_t cache_size)
+    : file_format_(EphemerisFileFormat::kText), cache_size_(std::max(cache_size, (size_t)8)) {
+  file_.open(file_name, std::ios::binary);
+  if (!file_.is_open()) {
+    std::cerr << "[WARNING] Ephemeris file not found: " << file_name << std::endl;
+    return;
+  }
+
+  // Detect the format with the magic
+  char magic[sizeof(kBinaryMagic)] = {};
+  file_.read(magic, sizeof(magic));
+  if (file_.gcount() == sizeof(magic) && std::equal(magic, magic + sizeof(magic), kBinaryMagic)) {
+    file_format_ = EphemerisFileFormat::kBinary;
+    is_opened_ = OpenBinary(time_column_name, column_names);
+  } else {
+    file_.clear();
+    file_.seekg(0);
+    file_format_ = EphemerisFileFormat::kText;
+    is_opened_ = OpenText(time_column_name, column_names);
+  }
+
+  if (is_opened_ && number_of_records_ < 2) {
+    std::cerr << "[WARNING] Ephemeris file needs at least two records: " << file_name << std::endl;
+    is_opened_ = false;
+  }
+  if (!is_opened_) {
+    number_of_records_ = 0;
+    return;
+  }
+  start_time_s_ = GetTime_s(0);
+  end_time_s_ = GetTime_s(number_of_records_ - 1);
+}
+
+size_t EphemerisFileReader::FindRecord(const double time_s) {
+  if (!is_opened_) return 0;
+  const size_t last_interval = number_of_records_ - 2;
+
+  // Sequential access
+  if (GetTime_s(cursor_) <= time_s && time_s < GetTime_s(cursor_ + 1)) return cursor_;
+  if (cursor_ < last_interval && GetTime_s(cursor_ + 1) <= time_s && time_s < GetTime_s(cursor_ + 2)) {
+    cursor_++;
+    return cursor_;
+  }
+
+  // Binary search
+  if (time_s <= GetTime_s(0)) {
+    cursor_ = 0;
+  } else if (time_s >= GetTime_s(number_of_records_ - 1)) {
+    cursor_ = last_interval;
+  } else {
+    size_t low = 0;
+    size_t high = number_of_records_ - 1;
+    while (high - low > 1) {
+      const size_t middle = (low + high) / 2;
+      if (GetTime_s(middle) <= time_s) {
+        low = middle;
+      } else {
+        high = middle;
+      }
+    }
+    cursor_ = low;
+  }
+  return cursor_;
+}
+
+double EphemerisFileReader::CalcLagrange(const size_t column_id, const double time_s, const size_t number_of_points) {
+  if (!is_opened_) return 0.0;
+
+  // The stencil must be in the cache at once
+  const size_t max_points = std::min(number_of_records_, cache_size_ - cache_size_ / 8);
+  const size_t points = std::min(std::max(number_of_points, (size_t)2), max_points);
+
+  const size_t record_id = FindRecord(time_s);
+  size_t first = (record_id + 1 >= points / 2) ? record_id + 1 - points / 2 : 0;
+  if (first + points > number_of_records_) first = number_of_records_ - points;
+
+  double value = 0.0;
+  for (size_t j = 0; j < points; j++) {
+    const double data = GetData(first + j, column_id);
+    const double time_j_s = GetTime_s(first + j);
+    double weight = 1.0;
+    for (size_t k = 0; k < points; k++) {
+      if (k == j) continue;
+      const double time_k_s = GetTime_s(first + k);
+      weight *= (time_s - time_k_s) / (time_j_s - time_k_s);
+    }
+    value += weight * data;
+  }
+  return value;
+}
+
+double EphemerisFileReader::CalcHermite(const size_t column_id, const size_t derivative_column_id, const double time_s, double& derivative) {
+  derivative = 0.0;
+  if (!is_opened_) return 0.0;
+
+  const size_t record_id = FindRecord(time_s);
+  const double value_0 = GetData(record_id, column_id);
+  const double value_1 = GetData(record_id + 1, column_id);
+  const double derivative_0 = GetData(record_id, derivative_column_id);
+  const double derivative_1 = GetData(record_id + 1, derivative_column_id);
+  const double time_0_s = GetTime_s(record_id);
+  const double interval_s = GetTime_s(record_id + 1) - time_0_s;
+
+  const double sigma = (time_s - time_0_s) / interval_s;
+  const double sigma2 = sigma * sigma;
+  const double sigma3 = sigma2 * sigma;
+  const double h00 = 2.0 * sigma3 - 3.0 * sigma2 + 1.0;
+  const double h10 = sigma3 - 2.0 * sigma2 + sigma;
+  const double h01 = -2.0 * sigma3 + 3.0 * sigma2;
+  const double h11 = sigma3 - sigma2;
+  derivative = ((6.0 * sigma2 - 6.0 * sigma) * value_0 + (-6.0 * sigma2 + 6.0 * sigma) * value_1) / interval_s +
+               (3.0 * sigma2 - 4.0 * sigma + 1.0) * derivative_0 + (3.0 * sigma2 - 2.0 * sigma) * derivative_1;
+  return h00 * value_0 + h10 * interval_s * derivative_0 + h01 * value_1 + h11 * interval_s * derivative_1;
+}
+
+double EphemerisFileReader::GetTime_s(const size_t record_id) {
+  if (record_id >= cache_begin_ && record_id < cache_begin_ + cache_count_) {
+    return cache_times_s_[record_id - cache_begin_];
+  }
+  if (file_format_ == EphemerisFileFormat::kText) {
+    return record_times_s_[record_id];
+  }
+  return ReadBinaryTime_s(record_id);
+}
+
+double EphemerisFileReader::GetData(const size_t record_id, const size_t column_id) {
+  if (record_id < cache_begin_ || record_id >= cache_begin_ + cache_count_) {
+    LoadCache(record_id);
+  }
+  return cache_data_[(record_id - cache_begin_) * data_column_indices_.size() + column_id];
+}
+
+bool EphemerisFileReader::OpenText(const std::string time_column_name, const std::vector<std::string> column_names) {
+  std::string line;
+  if (!std::getline(file_, line)) return false;
+  if (!FindColumns(SplitCsvNames(line), time_column_name, column_names)) return false;
+
+  // Index the time and the byte offset of all records
+  std::streamoff offset = (std::streamoff)line.size() + 1;
+  std::vector<size_t> field_positions;
+  while (std::getline(file_, line)) {
+    const std::streamoff line_offset = offset;
+    offset += (std::streamoff)line.size() + 1;
+
+    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+    FindCsvFields(line, field_positions);
+    const double time_s = ParseCsvField(line, field_positions, time_column_index_);
+    if (std::isnan(time_s)) continue;
+    // Duplicated epochs make the interpolation divide by zero
+    if (!record_times_s_.empty() && time_s <= record_times_s_.back()) {
+      std::cerr << "[WARNING] Ephemeris records are not strictly increasing in time at " << time_s << " sec." << std::endl;
+      return false;
+    }
+    record_times_s_.push_back(time_s);
+    record_offsets_.push_back(line_offset);
+  }
+  file_.clear();
+  number_of_records_ = record_times_s_.size();
+  return true;
+}
+
+bool EphemerisFileReader::OpenBinary(const std::string time_column_name, const std::vector<std::string> column_names) {
+  uint32_t number_of_columns = 0;
+  file_.read(reinterpret_cast<char*>(&number_of_columns), sizeof(number_of_columns));
+  std::vector<std::string> file_column_names;
+  for (uint32_t column = 0; column < number_of_columns && file_; column++) {
+    uint32_t length = 0;
+    file_.read(reinterpret_cast<char*>(&length), sizeof(length));
+    std::string name(length, ' ');
+    file_.read(&name[0], length);
+    file_column_names.push_back(name);
+  }
+  if (!file_ || number_of_columns == 0) {
+    std::cerr << "[WARNING] Ephemeris binary file header is broken." << std::endl;
+    return false;
+  }
+  if (!FindColumns(file_column_names, time_column_name, column_names)) return false;
+
+  binary_data_offset_ = file_.tellg();
+  file_.seekg(0, std::ios::end);
+  const std::streamoff file_size = file_.tellg();
+  number_of_records_ = (size_t)(file_size - binary_data_offset_) / (sizeof(double) * number_of_file_columns_);
+  return true;
+}
+
+bool EphemerisFileReader::FindColumns(const std::vector<std::string>& file_column_names, const std::string time_column_name,
+                                      const std::vector<std::string> column_names) {
+  number_of_file_columns_ = file_column_names.size();
+
+  auto find_column = [&](const std::string& name, size_t& index) {
+    const auto found = std::find(file_column_names.begin(), file_column_names.end(), name);
+    if (found == file_column_names.end()) {
+      std::cerr << "[WARNING] Ephemeris column not found: " << name << std::endl;
+      return false;
+    }
+    index = (size_t)(found - file_column_names.begin());
+    return true;
+  };
+
+  if (!find_column(time_column_name, time_column_index_)) return false;
+  data_column_indices_.assign(column_names.size(), 0);
+  for (size_t i = 0; i < column_names.size(); i++) {
+    if (!find_column(column_names[i], data_column_indices_[i])) return false;
+  }
+  return true;
+}
+
+double EphemerisFileReader::ReadBinaryTime_s(const size_t record_id) {
+  double time_s = 0.0;
+  file_.clear();
+  file_.seekg(binary_data_offset_ + (std::streamoff)((record_id * number_of_file_columns_ + time_column_index_) * sizeof(double)));
+  file_.read(reinterpret_cast<char*>(&time_s), sizeof(time_s));
+  return time_s;
+}
+
+void EphemerisFileReader::LoadCache(const size_t record_id) {
+  // Keep some records before the target for the interpolation stencil
+  const size_t margin = cache_size_ / 8;
+  cache_begin_ = record_id > margin ? record_id - margin : 0;
+  cache_count_ = std::min(cache_size_, number_of_records_ - cache_begin_);
+
+  const size_t number_of_data_columns = data_column_indices_.size();
+  cache_times_s_.resize(cache_count_);
+  cache_data_.resize(cache_count_ * number_of_data_columns);
+  file_.clear();
+
+  if (file_format_ == EphemerisFileFormat::kText) {
+    std::string line;
+    std::vector<size_t> field_positions;
+    std::streamoff next_offset = -1;
+    for (size_t i = 0; i < cache_count_; i++) {
+      // Seek only when blank or non-numeric lines are skipped in the index
+      const std::streamoff offset = record_offsets_[cache_begin_ + i];
+      if (offset != next_offset) file_.seekg(offset);
+      std::getline(file_, line);
+      next_offset = offset + (std::streamoff)line.size() + 1;
+      FindCsvFields(line, field_positions);
+      cache_times_s_[i] = record_times_s_[cache_begin_ + i];
+      for (size_t column = 0; column < number_of_data_columns; column++) {
+        cache_data_[i * number_of_data_columns + column] = ParseCsvField(line, field_positions, data_column_indices_[column]);
+      }
+    }
+  } else {
+    std::vector<double> records(cache_count_ * number_of_file_columns_);
+    file_.seekg(binary_data_offset_ + (std::streamoff)(cache_begin_ * number_of_file_columns_ * sizeof(double)));
+    file_.read(reinterpret_cast<char*>(records.data()), (std::streamsize)(records.size() * sizeof(double)));
+    for (size_t i = 0; i < cache_count_; i++) {
+      const double* record = &records[i * number_of_file_columns_];
+      cache_times_s_[i] = record[time_column_index_];
+      for (size_t column = 0; column < number_of_data_columns; column++) {
+        cache_data_[i * number_of_data_columns + column] = record[data_column_indices_[column]];
+      }
+    }
+  }
+}
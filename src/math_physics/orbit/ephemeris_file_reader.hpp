@@ -0,0 +1,192 @@
+/**
+ * @file ephemeris_file_reader.hpp
+ * @brief Class to read time series of states from an ephemeris file with indexed seeking and interpolation
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_EPHEMERIS_FILE_READER_HPP_
+#define S2E_LIBRARY_ORBIT_EPHEMERIS_FILE_READER_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @enum EphemerisFileFormat
+ * @brief Format of the ephemeris file
+ */
+enum class EphemerisFileFormat {
+  kText,    //!< CSV text with a header line such as a log file of S2E
+  kBinary,  //!< Binary file written by ConvertEphemerisTextToBinary
+};
+
+/**
+ * @enum EphemerisInterpolationMethod
+ * @brief Interpolation method of the ephemeris
+ */
+enum class EphemerisInterpolationMethod {
+  kLagrange,  //!< Lagrange polynomial interpolation with the values
+  kHermite,   //!< Cubic Hermite interpolation with the values and their derivatives
+};
+
+/**
+ * @fn ConvertEphemerisInterpolationMethod
+ * @brief Convert string to EphemerisInterpolationMethod
+ * @param [in] method: Interpolation method in string (LAGRANGE or HERMITE)
+ * @return Interpolation method (kLagrange for undefined string)
+ */
+EphemerisInterpolationMethod ConvertEphemerisInterpolationMethod(const std::string method);
+
+/**
+ * @fn ConvertEphemerisTextToBinary
+ * @brief Convert a CSV ephemeris file into the binary ephemeris file
+ * @note The binary file has the magic "S2EEPHEM", the number of columns (uint32), the column names (uint32 length + characters), and the records
+ *       of the column values (double) in the native byte order. Columns which are not numbers are written as NaN.
+ * @param [in] text_file_name: Path of the CSV file with a header line
+ * @param [in] binary_file_name: Path of the output binary file
+ * @return Number of converted records
+ */
+size_t ConvertEphemerisTextToBinary(const std::string text_file_name, const std::string binary_file_name);
+
+/**
+ * @class EphemerisFileReader
+ * @brief Class to read time series of states from an ephemeris file with indexed seeking and interpolation
+ * @details The file is not loaded at once. Only the time of the records is indexed at the opening for the text file, and the record position is
+ *          calculated directly for the binary file. The selected columns of the records around the requested time are read into a cache.
+ *          The time of the records must be strictly increasing. When the same column name appears multiple times, the first one is used.
+ */
+class EphemerisFileReader {
+ public:
+  /**
+   * @fn EphemerisFileReader
+   * @brief Constructor
+   * @param [in] file_name: Path of the ephemeris file (the format is detected with the magic of the binary file)
+   * @param [in] time_column_name: Column name of the time [s]
+   * @param [in] column_names: Column names of the data to read
+   * @param [in] cache_size: Number of records in the cache
+   */
+  EphemerisFileReader(const std::string file_name, const std::string time_column_name, const std::vector<std::string> column_names,
+                      const size_t cache_size = 1024);
+
+  /**
+   * @fn FindRecord
+   * @brief Find the record just before the time
+   * @param [in] time_s: Time [s]
+   * @return Index of the record i which satisfies time(i) <= time_s < time(i+1) (clamped into [0, number of records - 2])
+   */
+  size_t FindRecord(const double time_s);
+  /**
+   * @fn CalcLagrange
+   * @brief Interpolate the column with the Lagrange polynomial around the time
+   * @param [in] column_id: Index of the column in the column names of the constructor
+   * @param [in] time_s: Time [s]
+   * @param [in] number_of_points: Number of records used for the interpolation
+   * @return Interpolated value
+   */
+  double CalcLagrange(const size_t column_id, const double time_s, const size_t number_of_points);
+  /**
+   * @fn CalcHermite
+   * @brief Interpolate the column with the cubic Hermite polynomial between the two records around the time
+   * @param [in] column_id: Index of the column of the value
+   * @param [in] derivative_column_id: Index of the column of the time derivative of the value
+   * @param [in] time_s: Time [s]
+   * @param [out] derivative: Interpolated time derivative
+   * @return Interpolated value
+   */
+  double CalcHermite(const size_t column_id, const size_t derivative_column_id, const double time_s, double& derivative);
+
+  // Getter
+  /**
+   * @fn IsOpened
+   * @brief Return true when the file and all columns are found
+   */
+  inline bool IsOpened() const { return is_opened_; }
+  /**
+   * @fn GetFileFormat
+   * @brief Return format of the file
+   */
+  inline EphemerisFileFormat GetFileFormat() const { return file_format_; }
+  /**
+   * @fn GetNumberOfRecords
+   * @brief Return number of records in the file
+   */
+  inline size_t GetNumberOfRecords() const { return number_of_records_; }
+  /**
+   * @fn GetStartTime_s
+   * @brief Return time of the first record [s]
+   */
+  inline double GetStartTime_s() const { return start_time_s_; }
+  /**
+   * @fn GetEndTime_s
+   * @brief Return time of the last record [s]
+   */
+  inline double GetEndTime_s() const { return end_time_s_; }
+  /**
+   * @fn GetTime_s
+   * @brief Return time of the record [s]
+   * @param [in] record_id: Index of the record
+   */
+  double GetTime_s(const size_t record_id);
+  /**
+   * @fn GetData
+   * @brief Return value of the column in the record
+   * @param [in] record_id: Index of the record
+   * @param [in] column_id: Index of the column in the column names of the constructor
+   */
+  double GetData(const size_t record_id, const size_t column_id);
+
+ private:
+  std::ifstream file_;                       //!< Ephemeris file
+  EphemerisFileFormat file_format_;          //!< Format of the file
+  bool is_opened_ = false;                   //!< Flag of the file and the columns are found
+  size_t number_of_records_ = 0;             //!< Number of records
+  double start_time_s_ = 0.0;                //!< Time of the first record [s]
+  double end_time_s_ = 0.0;                  //!< Time of the last record [s]
+  size_t time_column_index_ = 0;             //!< Index of the time column in the file
+  std::vector<size_t> data_column_indices_;  //!< Indices of the data columns in the file
+  size_t cursor_ = 0;                        //!< Record index found at the last search
+
+  // Index of the text file
+  std::vector<double> record_times_s_;          //!< Time of all records [s]
+  std::vector<std::streamoff> record_offsets_;  //!< Byte offsets of all records in the file
+
+  // Layout of the binary file
+  std::streamoff binary_data_offset_ = 0;  //!< Byte offset of the first record
+  size_t number_of_file_columns_ = 0;      //!< Number of columns in the file
+
+  // Cache
+  size_t cache_size_;                  //!< Maximum number of records in the cache
+  size_t cache_begin_ = 0;             //!< Index of the first record in the cache
+  size_t cache_count_ = 0;             //!< Number of records in the cache
+  std::vector<double> cache_times_s_;  //!< Time of the cached records [s]
+  std::vector<double> cache_data_;     //!< Selected columns of the cached records (record major)
+
+  /**
+   * @fn OpenText
+   * @brief Read the header and index all records of the text file
+   */
+  bool OpenText(const std::string time_column_name, const std::vector<std::string> column_names);
+  /**
+   * @fn OpenBinary
+   * @brief Read the header of the binary file
+   */
+  bool OpenBinary(const std::string time_column_name, const std::vector<std::string> column_names);
+  /**
+   * @fn FindColumns
+   * @brief Find the indices of the time and data columns in the column names of the file
+   */
+  bool FindColumns(const std::vector<std::string>& file_column_names, const std::string time_column_name, const std::vector<std::string> column_names);
+  /**
+   * @fn ReadBinaryTime_s
+   * @brief Read the time of the record directly from the binary file
+   */
+  double ReadBinaryTime_s(const size_t record_id);
+  /**
+   * @fn LoadCache
+   * @brief Load the records including the target record into the cache
+   * @param [in] record_id: Index of the target record
+   */
+  void LoadCache(const size_t record_id);
+};
+
+#endif  // S2E_LIBRARY_ORBIT_EPHEMERIS_FILE_READER_HPP_
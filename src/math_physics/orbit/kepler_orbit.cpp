@@ -4,6 +4,10 @@
  */
 #include "kepler_orbit.hpp"
 
+#include <algorithm>
+#include <cmath>
+
+#include "../math/constants.hpp"
 #include "../math/matrix_vector.hpp"
 #include "../math/s2e_math.hpp"
 
@@ -13,8 +17,6 @@ KeplerOrbit::KeplerOrbit(const double gravity_constant_m3_s2, const OrbitalEleme
   CalcConstKeplerMotion();
 }
 
-KeplerOrbit::~KeplerOrbit() {}
-
 // Private Functions
 void KeplerOrbit::CalcConstKeplerMotion() {
   // mean motion
@@ -41,7 +43,7 @@ void KeplerOrbit::CalcOrbit(double time_jday) {
 
   // Solve Kepler Equation
   double eccentric_anomaly_rad;
-  eccentric_anomaly_rad = SolveKeplerNewtonMethod(e, l_rad, 1.0e-5, 10);
+  eccentric_anomaly_rad = SolveKeplerEquation(e, l_rad);
   double u_rad = libra::WrapTo2Pi(eccentric_anomaly_rad);
 
   // Calc position and velocity in the plane
@@ -97,3 +99,111 @@ double KeplerOrbit::SolveKeplerNewtonMethod(const double eccentricity, const dou
   }
   return u_rad;
 }
+
+double SolveKeplerEquation(const double eccentricity, const double mean_anomaly_rad) {
+  const double e = eccentricity;
+  const double pi = libra::pi;
+  // Reduce the mean anomaly into [-pi, pi]
+  const double revolution_rad = libra::tau * std::floor(mean_anomaly_rad / libra::tau + 0.5);
+  const double m = mean_anomaly_rad - revolution_rad;
+
+  // Markley's starter with the solution of the cubic equation
+  const double alpha = (3.0 * pi * pi + 1.6 * pi * (pi - std::abs(m)) / (1.0 + e)) / (pi * pi - 6.0);
+  const double d = 3.0 * (1.0 - e) + alpha * e;
+  const double q = 2.0 * alpha * d * (1.0 - e) - m * m;
+  const double r = 3.0 * alpha * d * (d - 1.0 + e) * m + m * m * m;
+  const double w = std::pow(std::abs(r) + std::sqrt(std::max(q * q * q + r * r, 0.0)), 2.0 / 3.0);
+  const double denominator = w * w + w * q + q * q;
+  double u_rad = denominator > 0.0 ? (2.0 * r * w / denominator + m) / d : m / d;
+
+  // Fifth order correction
+  const double f2 = e * std::sin(u_rad);
+  const double f3 = e * std::cos(u_rad);
+  const double f0 = u_rad - f2 - m;
+  const double f1 = 1.0 - f3;
+  const double f4 = -f2;
+  const double delta3 = -f0 / (f1 - 0.5 * f0 * f2 / f1);
+  const double delta4 = -f0 / (f1 + 0.5 * delta3 * f2 + delta3 * delta3 * f3 / 6.0);
+  const double delta5 = -f0 / (f1 + 0.5 * delta4 * f2 + delta4 * delta4 * f3 / 6.0 + delta4 * delta4 * delta4 * f4 / 24.0);
+  u_rad += delta5;
+
+  // Newton step to remove the round-off error of the correction
+  u_rad -= (u_rad - e * std::sin(u_rad) - m) / (1.0 - e * std::cos(u_rad));
+
+  return u_rad + revolution_rad;
+}
+
+void SolveKeplerEquation(const std::vector<double>& eccentricity_list, const std::vector<double>& mean_anomaly_list_rad,
+                         std::vector<double>& eccentric_anomaly_list_rad) {
+  const size_t number_of_orbits = std::min(eccentricity_list.size(), mean_anomaly_list_rad.size());
+  eccentric_anomaly_list_rad.resize(number_of_orbits);
+
+  const double* e = eccentricity_list.data();
+  const double* m = mean_anomaly_list_rad.data();
+  double* u_rad = eccentric_anomaly_list_rad.data();
+  for (size_t i = 0; i < number_of_orbits; i++) {
+    u_rad[i] = SolveKeplerEquation(e[i], m[i]);
+  }
+}
+
+void CalcKeplerOrbits(const double gravity_constant_m3_s2, const std::vector<OrbitalElements>& orbital_elements_list,
+                      const std::vector<double>& time_list_jday, std::vector<libra::Vector<3>>& position_list_i_m,
+                      std::vector<libra::Vector<3>>& velocity_list_i_m_s) {
+  const size_t number_of_orbits = std::min(orbital_elements_list.size(), time_list_jday.size());
+  position_list_i_m.resize(number_of_orbits);
+  velocity_list_i_m_s.resize(number_of_orbits);
+
+  // Gather the eccentricity and the mean anomaly to solve Kepler equation in a single loop
+  std::vector<double> eccentricity_list(number_of_orbits);
+  std::vector<double> mean_anomaly_list_rad(number_of_orbits);
+  std::vector<double> mean_motion_list_rad_s(number_of_orbits);
+  for (size_t i = 0; i < number_of_orbits; i++) {
+    const OrbitalElements& oe = orbital_elements_list[i];
+    const double a_m = oe.GetSemiMajorAxis_m();
+    const double dt_s = (time_list_jday[i] - oe.GetEpoch_jday()) * (24.0 * 60.0 * 60.0);
+    mean_motion_list_rad_s[i] = std::sqrt(gravity_constant_m3_s2 / (a_m * a_m * a_m));
+    eccentricity_list[i] = oe.GetEccentricity();
+    mean_anomaly_list_rad[i] = mean_motion_list_rad_s[i] * dt_s;
+  }
+
+  std::vector<double> eccentric_anomaly_list_rad;
+  SolveKeplerEquation(eccentricity_list, mean_anomaly_list_rad, eccentric_anomaly_list_rad);
+
+  for (size_t i = 0; i < number_of_orbits; i++) {
+    const OrbitalElements& oe = orbital_elements_list[i];
+    const double a_m = oe.GetSemiMajorAxis_m();
+    const double e = eccentricity_list[i];
+    const double n_rad_s = mean_motion_list_rad_s[i];
+
+    // Position and velocity in the plane
+    const double cos_u = std::cos(eccentric_anomaly_list_rad[i]);
+    const double sin_u = std::sin(eccentric_anomaly_list_rad[i]);
+    const double a_sqrt_e_m = a_m * std::sqrt(1.0 - e * e);
+    const double e_cos_u = 1.0 - e * cos_u;
+    const double x_m = a_m * (cos_u - e);
+    const double y_m = a_sqrt_e_m * sin_u;
+    const double vx_m_s = -1.0 * a_m * n_rad_s * sin_u / e_cos_u;
+    const double vy_m_s = n_rad_s * a_sqrt_e_m * cos_u / e_cos_u;
+
+    // First and second columns of the DCM from the in-plane frame to the inertial frame
+    const double cos_raan = std::cos(oe.GetRaan_rad());
+    const double sin_raan = std::sin(oe.GetRaan_rad());
+    const double cos_inc = std::cos(oe.GetInclination_rad());
+    const double sin_inc = std::sin(oe.GetInclination_rad());
+    const double cos_arg = std::cos(oe.GetArgPerigee_rad());
+    const double sin_arg = std::sin(oe.GetArgPerigee_rad());
+    const double p_x = cos_raan * cos_arg - sin_raan * cos_inc * sin_arg;
+    const double p_y = sin_raan * cos_arg + cos_raan * cos_inc * sin_arg;
+    const double p_z = sin_inc * sin_arg;
+    const double q_x = -cos_raan * sin_arg - sin_raan * cos_inc * cos_arg;
+    const double q_y = -sin_raan * sin_arg + cos_raan * cos_inc * cos_arg;
+    const double q_z = sin_inc * cos_arg;
+
+    position_list_i_m[i][0] = p_x * x_m + q_x * y_m;
+    position_list_i_m[i][1] = p_y * x_m + q_y * y_m;
+    position_list_i_m[i][2] = p_z * x_m + q_z * y_m;
+    velocity_list_i_m_s[i][0] = p_x * vx_m_s + q_x * vy_m_s;
+    velocity_list_i_m_s[i][1] = p_y * vx_m_s + q_y * vy_m_s;
+    velocity_list_i_m_s[i][2] = p_z * vx_m_s + q_z * vy_m_s;
+  }
+}
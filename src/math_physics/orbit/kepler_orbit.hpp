@@ -6,6 +6,8 @@
 #ifndef S2E_LIBRARY_ORBIT_KEPLER_ORBIT_HPP_
 #define S2E_LIBRARY_ORBIT_KEPLER_ORBIT_HPP_
 
+#include <vector>
+
 #include "../math/matrix.hpp"
 #include "../math/vector.hpp"
 #include "./orbital_elements.hpp"
@@ -28,11 +30,6 @@ class KeplerOrbit {
    * @param [in] oe: Orbital elements
    */
   KeplerOrbit(const double gravity_constant_m3_s2, const OrbitalElements oe);
-  /**
-   * @fn ~KeplerOrbit
-   * @brief Destructor
-   */
-  ~KeplerOrbit();
 
   /**
    * @fn CalcOrbit
@@ -87,4 +84,37 @@ class KeplerOrbit {
   double SolveKeplerNewtonMethod(const double eccentricity, const double mean_anomaly_rad, const double angle_limit_rad, const int iteration_limit);
 };
 
+/**
+ * @fn SolveKeplerEquation
+ * @brief Solve Kepler equation of the elliptic orbit to the double precision
+ * @note Markley's starter (Markley, 1995) is refined with the fifth order correction and one Newton step.
+ *       The number of operations is fixed without data-dependent iteration, so it is robust for high eccentricity.
+ * @param [in] eccentricity: Eccentricity (0 <= e < 1)
+ * @param [in] mean_anomaly_rad: Mean anomaly [rad]
+ * @return Eccentric anomaly [rad] in the same revolution as the mean anomaly
+ */
+double SolveKeplerEquation(const double eccentricity, const double mean_anomaly_rad);
+/**
+ * @fn SolveKeplerEquation
+ * @brief Solve Kepler equation for many pairs of eccentricity and mean anomaly
+ * @note The loop has no branch, so compilers can vectorize it when a vector math library is available for sin and cos.
+ * @param [in] eccentricity_list: Eccentricity list (0 <= e < 1)
+ * @param [in] mean_anomaly_list_rad: Mean anomaly list [rad]
+ * @param [out] eccentric_anomaly_list_rad: Eccentric anomaly list [rad]
+ */
+void SolveKeplerEquation(const std::vector<double>& eccentricity_list, const std::vector<double>& mean_anomaly_list_rad,
+                         std::vector<double>& eccentric_anomaly_list_rad);
+/**
+ * @fn CalcKeplerOrbits
+ * @brief Calculate position and velocity of many orbits with Kepler orbit propagation
+ * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+ * @param [in] orbital_elements_list: Orbital elements list
+ * @param [in] time_list_jday: Time list expressed as Julian day [day]. The i-th time is used for the i-th orbital elements.
+ * @param [out] position_list_i_m: Position list in the inertial frame [m]
+ * @param [out] velocity_list_i_m_s: Velocity list in the inertial frame [m/s]
+ */
+void CalcKeplerOrbits(const double gravity_constant_m3_s2, const std::vector<OrbitalElements>& orbital_elements_list,
+                      const std::vector<double>& time_list_jday, std::vector<libra::Vector<3>>& position_list_i_m,
+                      std::vector<libra::Vector<3>>& velocity_list_i_m_s);
+
 #endif  // S2E_LIBRARY_ORBIT_KEPLER_ORBIT_HPP_
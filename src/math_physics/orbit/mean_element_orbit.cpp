@@ -0,0 +1,290 @@
+/**
+ * @file mean_element_orbit.cpp
+ * @brief Semi-analytic orbit model with averaged equations of the equinoctial elements
+ */
+
+#include "mean_element_orbit.hpp"
+
+#include <cmath>
+#include <iostream>
+
+#include "../../utilities/macros.hpp"
+#include "../math/constants.hpp"
+#include "kepler_orbit.hpp"
+
+namespace {
+/**
+ * @fn CalcEquinoctialFrame
+ * @brief Calculate unit vectors of the equinoctial frame in the inertial frame
+ * @param [in] h: tan(i/2) cos(RAAN)
+ * @param [in] k: tan(i/2) sin(RAAN)
+ * @param [out] f_direction: Unit vector toward the ascending node rotated by -RAAN in the orbit plane
+ * @param [out] g_direction: Unit vector perpendicular to f_direction in the orbit plane
+ */
+void CalcEquinoctialFrame(const double h, const double k, libra::Vector<3>& f_direction, libra::Vector<3>& g_direction) {
+  const double s2 = 1.0 + h * h + k * k;
+  f_direction[0] = (1.0 - k * k + h * h) / s2;
+  f_direction[1] = 2.0 * h * k / s2;
+  f_direction[2] = -2.0 * k / s2;
+  g_direction[0] = 2.0 * h * k / s2;
+  g_direction[1] = (1.0 + k * k - h * h) / s2;
+  g_direction[2] = 2.0 * h / s2;
+}
+
+/**
+ * @fn CalcTrueLongitude
+ * @brief Calculate the true longitude from the equinoctial elements
+ */
+double CalcTrueLongitude(const libra::Vector<6>& elements) {
+  const double f = elements[1];
+  const double g = elements[2];
+  const double e = sqrt(f * f + g * g);
+  const double longitude_of_perigee_rad = atan2(g, f);
+  const double u_rad = SolveKeplerEquation(e, elements[5] - longitude_of_perigee_rad);
+  const double true_anomaly_rad = atan2(sqrt(1.0 - e * e) * sin(u_rad), cos(u_rad) - e);
+  return true_anomaly_rad + longitude_of_perigee_rad;
+}
+}  // namespace
+
+libra::Vector<6> ConvertPositionVelocityToEquinoctialElements(const double gravity_constant_m3_s2, const libra::Vector<3>& position_i_m,
+                                                              const libra::Vector<3>& velocity_i_m_s) {
+  const double r_m = position_i_m.CalcNorm();
+  const double v_m_s = velocity_i_m_s.CalcNorm();
+  const libra::Vector<3> angular_momentum = libra::OuterProduct(position_i_m, velocity_i_m_s);
+  const libra::Vector<3> normal = angular_momentum.CalcNormalizedVector();
+
+  libra::Vector<6> elements;
+  elements[0] = 1.0 / (2.0 / r_m - v_m_s * v_m_s / gravity_constant_m3_s2);
+  elements[3] = -normal[1] / (1.0 + normal[2]);
+  elements[4] = normal[0] / (1.0 + normal[2]);
+
+  libra::Vector<3> f_direction, g_direction;
+  CalcEquinoctialFrame(elements[3], elements[4], f_direction, g_direction);
+  libra::Vector<3> eccentricity_vector = libra::OuterProduct(velocity_i_m_s, angular_momentum);
+  eccentricity_vector = (1.0 / gravity_constant_m3_s2) * eccentricity_vector - (1.0 / r_m) * position_i_m;
+  const double f = libra::InnerProduct(eccentricity_vector, f_direction);
+  const double g = libra::InnerProduct(eccentricity_vector, g_direction);
+  elements[1] = f;
+  elements[2] = g;
+
+  // Mean longitude from the true longitude
+  const double true_longitude_rad = atan2(libra::InnerProduct(position_i_m, g_direction), libra::InnerProduct(position_i_m, f_direction));
+  const double e = sqrt(f * f + g * g);
+  const double longitude_of_perigee_rad = atan2(g, f);
+  const double true_anomaly_rad = true_longitude_rad - longitude_of_perigee_rad;
+  const double u_rad = atan2(sqrt(1.0 - e * e) * sin(true_anomaly_rad), e + cos(true_anomaly_rad));
+  elements[5] = u_rad - e * sin(u_rad) + longitude_of_perigee_rad;
+
+  return elements;
+}
+
+void ConvertEquinoctialElementsToPositionVelocity(const double gravity_constant_m3_s2, const libra::Vector<6>& equinoctial_elements,
+                                                  libra::Vector<3>& position_i_m, libra::Vector<3>& velocity_i_m_s) {
+  const double a_m = equinoctial_elements[0];
+  const double f = equinoctial_elements[1];
+  const double g = equinoctial_elements[2];
+  const double semi_latus_rectum_m = a_m * (1.0 - f * f - g * g);
+  const double true_longitude_rad = CalcTrueLongitude(equinoctial_elements);
+  const double cos_l = cos(true_longitude_rad);
+  const double sin_l = sin(true_longitude_rad);
+  const double r_m = semi_latus_rectum_m / (1.0 + f * cos_l + g * sin_l);
+  const double sqrt_mu_p = sqrt(gravity_constant_m3_s2 / semi_latus_rectum_m);
+
+  libra::Vector<3> f_direction, g_direction;
+  CalcEquinoctialFrame(equinoctial_elements[3], equinoctial_elements[4], f_direction, g_direction);
+  position_i_m = (r_m * cos_l) * f_direction + (r_m * sin_l) * g_direction;
+  velocity_i_m_s = (-sqrt_mu_p * (g + sin_l)) * f_direction + (sqrt_mu_p * (f + cos_l)) * g_direction;
+}
+
+libra::Vector<6> MeanElementShortPeriodTerms::CalcVariation(const double mean_longitude_rad) const {
+  libra::Vector<6> variation(0.0);
+  for (size_t k = 0; k < cosine_coefficients.size(); k++) {
+    const double angle_rad = (k + 1) * mean_longitude_rad;
+    variation += cos(angle_rad) * cosine_coefficients[k] + sin(angle_rad) * sine_coefficients[k];
+  }
+  return variation;
+}
+
+MeanElementOrbit::MeanElementOrbit(const double gravity_constant_m3_s2, const double reference_radius_m, const std::vector<double> zonal_coefficients,
+                                   const size_t number_of_samples, const size_t number_of_harmonics)
+    : gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      reference_radius_m_(reference_radius_m),
+      zonal_coefficients_(zonal_coefficients),
+      number_of_samples_(number_of_samples),
+      number_of_harmonics_(number_of_harmonics) {
+  // The harmonics over the Nyquist frequency cannot be resolved
+  if (number_of_samples_ < 4) number_of_samples_ = 4;
+  if (2 * number_of_harmonics_ >= number_of_samples_) {
+    std::cerr << "[WARNING] Mean element orbit: the number of harmonics is truncated to " << (number_of_samples_ - 1) / 2 << std::endl;
+    number_of_harmonics_ = (number_of_samples_ - 1) / 2;
+  }
+}
+
+void MeanElementOrbit::SetDragParameters(const double ballistic_coefficient_m2_kg, const libra::Vector<3> atmosphere_angular_velocity_i_rad_s,
+                                         const std::function<double(const libra::Vector<3>&)> air_density_function) {
+  ballistic_coefficient_m2_kg_ = ballistic_coefficient_m2_kg;
+  atmosphere_angular_velocity_i_rad_s_ = atmosphere_angular_velocity_i_rad_s;
+  air_density_function_ = air_density_function;
+}
+
+libra::Vector<3> MeanElementOrbit::CalcPerturbationAcceleration_i_m_s2(const libra::Vector<3>& position_i_m,
+                                                                       const libra::Vector<3>& velocity_i_m_s) const {
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  const double r_m = position_i_m.CalcNorm();
+
+  // Zonal harmonics with the recurrence of the Legendre polynomials
+  if (!zonal_coefficients_.empty()) {
+    const double s = position_i_m[2] / r_m;
+    const libra::Vector<3> radial_direction = (1.0 / r_m) * position_i_m;
+    double legendre_previous = 1.0;             // P_{n-1}
+    double legendre = s;                        // P_n
+    double legendre_derivative_previous = 0.0;  // P'_{n-1}
+    double legendre_derivative = 1.0;           // P'_n
+    double radius_ratio = reference_radius_m_ / r_m;
+    double radial_coefficient = 0.0;
+    double polar_coefficient = 0.0;
+    for (size_t n = 1; n <= zonal_coefficients_.size(); n++) {
+      // Update to degree n + 1
+      const double legendre_next = ((2.0 * n + 1.0) * s * legendre - n * legendre_previous) / (n + 1.0);
+      const double legendre_derivative_next = legendre_derivative_previous + (2.0 * n + 1.0) * legendre;
+      legendre_previous = legendre;
+      legendre = legendre_next;
+      legendre_derivative_previous = legendre_derivative;
+      legendre_derivative = legendre_derivative_next;
+      radius_ratio *= reference_radius_m_ / r_m;
+
+      const double degree = n + 1.0;
+      const double coefficient = zonal_coefficients_[n - 1] * radius_ratio;
+      radial_coefficient += coefficient * ((degree + 1.0) * legendre + s * legendre_derivative);
+      polar_coefficient += coefficient * legendre_derivative;
+    }
+    const double mu_r2 = gravity_constant_m3_s2_ / (r_m * r_m);
+    acceleration_i_m_s2 += (mu_r2 * radial_coefficient) * radial_direction;
+    acceleration_i_m_s2[2] -= mu_r2 * polar_coefficient;
+  }
+
+  // Atmospheric drag with the co-rotating atmosphere
+  if (air_density_function_ && ballistic_coefficient_m2_kg_ > 0.0) {
+    const double air_density_kg_m3 = air_density_function_(position_i_m);
+    const libra::Vector<3> relative_velocity_i_m_s = velocity_i_m_s - libra::OuterProduct(atmosphere_angular_velocity_i_rad_s_, position_i_m);
+    acceleration_i_m_s2 -= (0.5 * air_density_kg_m3 * ballistic_coefficient_m2_kg_ * relative_velocity_i_m_s.CalcNorm()) * relative_velocity_i_m_s;
+  }
+
+  // Third body gravity
+  for (size_t i = 0; i < third_body_positions_i_m_.size(); i++) {
+    const libra::Vector<3>& third_body_position_i_m = third_body_positions_i_m_[i];
+    const libra::Vector<3> relative_position_i_m = third_body_position_i_m - position_i_m;
+    const double relative_distance_m = relative_position_i_m.CalcNorm();
+    const double third_body_distance_m = third_body_position_i_m.CalcNorm();
+    acceleration_i_m_s2 += (third_body_gravity_constants_m3_s2_[i] / pow(relative_distance_m, 3.0)) * relative_position_i_m;
+    acceleration_i_m_s2 -= (third_body_gravity_constants_m3_s2_[i] / pow(third_body_distance_m, 3.0)) * third_body_position_i_m;
+  }
+
+  return acceleration_i_m_s2;
+}
+
+libra::Vector<6> MeanElementOrbit::CalcOsculatingRate(const libra::Vector<6>& elements) const {
+  const double a_m = elements[0];
+  const double f = elements[1];
+  const double g = elements[2];
+  const double h = elements[3];
+  const double k = elements[4];
+
+  libra::Vector<3> position_i_m, velocity_i_m_s;
+  ConvertEquinoctialElementsToPositionVelocity(gravity_constant_m3_s2_, elements, position_i_m, velocity_i_m_s);
+  const libra::Vector<3> acceleration_i_m_s2 = CalcPerturbationAcceleration_i_m_s2(position_i_m, velocity_i_m_s);
+
+  // Acceleration in the radial, along-track, and cross-track directions
+  const libra::Vector<3> radial_direction = position_i_m.CalcNormalizedVector();
+  const libra::Vector<3> normal_direction = libra::OuterProduct(position_i_m, velocity_i_m_s).CalcNormalizedVector();
+  const libra::Vector<3> along_track_direction = libra::OuterProduct(normal_direction, radial_direction);
+  const double acc_r = libra::InnerProduct(acceleration_i_m_s2, radial_direction);
+  const double acc_s = libra::InnerProduct(acceleration_i_m_s2, along_track_direction);
+  const double acc_w = libra::InnerProduct(acceleration_i_m_s2, normal_direction);
+
+  // Gauss variational equations of the equinoctial elements
+  const double e2 = f * f + g * g;
+  const double beta = sqrt(1.0 - e2);
+  const double semi_latus_rectum_m = a_m * (1.0 - e2);
+  const double sqrt_p_mu = sqrt(semi_latus_rectum_m / gravity_constant_m3_s2_);
+
+  libra::Vector<3> f_direction, g_direction;
+  CalcEquinoctialFrame(h, k, f_direction, g_direction);
+  const double cos_l = libra::InnerProduct(radial_direction, f_direction);
+  const double sin_l = libra::InnerProduct(radial_direction, g_direction);
+  const double w = 1.0 + f * cos_l + g * sin_l;
+  const double e_sin_nu = f * sin_l - g * cos_l;
+  const double e_cos_nu = w - 1.0;
+  const double s2 = 1.0 + h * h + k * k;
+  const double hk_term = h * sin_l - k * cos_l;
+
+  libra::Vector<6> rate;
+  rate[0] = 2.0 * a_m * a_m / sqrt(gravity_constant_m3_s2_ * semi_latus_rectum_m) * (e_sin_nu * acc_r + w * acc_s);
+  rate[1] = sqrt_p_mu * (acc_r * sin_l + ((w + 1.0) * cos_l + f) * acc_s / w - hk_term * g * acc_w / w);
+  rate[2] = sqrt_p_mu * (-acc_r * cos_l + ((w + 1.0) * sin_l + g) * acc_s / w + hk_term * f * acc_w / w);
+  rate[3] = sqrt_p_mu * s2 * acc_w * cos_l / (2.0 * w);
+  rate[4] = sqrt_p_mu * s2 * acc_w * sin_l / (2.0 * w);
+  rate[5] = sqrt_p_mu * ((-e_cos_nu / (1.0 + beta) - 2.0 * beta / w) * acc_r + e_sin_nu / (1.0 + beta) * (1.0 + 1.0 / w) * acc_s + hk_term * acc_w / w);
+  return rate;
+}
+
+libra::Vector<6> MeanElementOrbit::CalcAveragedRate(const libra::Vector<6>& mean_elements, MeanElementShortPeriodTerms* short_period_terms) const {
+  const double mean_motion_rad_s = sqrt(gravity_constant_m3_s2_ / pow(mean_elements[0], 3.0));
+
+  // Samples with the same interval in the mean longitude
+  std::vector<libra::Vector<6>> rate_samples(number_of_samples_);
+  std::vector<double> mean_longitude_samples_rad(number_of_samples_);
+  libra::Vector<6> averaged_rate(0.0);
+  for (size_t i = 0; i < number_of_samples_; i++) {
+    libra::Vector<6> elements = mean_elements;
+    elements[5] = mean_elements[5] + libra::tau * i / number_of_samples_;
+    mean_longitude_samples_rad[i] = elements[5];
+    rate_samples[i] = CalcOsculatingRate(elements);
+    averaged_rate += rate_samples[i];
+  }
+  averaged_rate /= (double)number_of_samples_;
+
+  if (short_period_terms != nullptr) {
+    short_period_terms->cosine_coefficients.assign(number_of_harmonics_, libra::Vector<6>(0.0));
+    short_period_terms->sine_coefficients.assign(number_of_harmonics_, libra::Vector<6>(0.0));
+    for (size_t k = 1; k <= number_of_harmonics_; k++) {
+      // Fourier coefficients of the rate
+      libra::Vector<6> rate_cosine(0.0), rate_sine(0.0);
+      for (size_t i = 0; i < number_of_samples_; i++) {
+        const double angle_rad = k * mean_longitude_samples_rad[i];
+        rate_cosine += cos(angle_rad) * rate_samples[i];
+        rate_sine += sin(angle_rad) * rate_samples[i];
+      }
+      rate_cosine *= 2.0 / number_of_samples_;
+      rate_sine *= 2.0 / number_of_samples_;
+
+      // Integration over the mean longitude with d(lambda)/dt = n
+      libra::Vector<6>& cosine_coefficient = short_period_terms->cosine_coefficients[k - 1];
+      libra::Vector<6>& sine_coefficient = short_period_terms->sine_coefficients[k - 1];
+      cosine_coefficient = (-1.0 / (k * mean_motion_rad_s)) * rate_sine;
+      sine_coefficient = (1.0 / (k * mean_motion_rad_s)) * rate_cosine;
+      // Variation of the mean longitude by the variation of the mean motion dn/da * delta_a
+      const double factor = 1.5 / (mean_elements[0] * mean_motion_rad_s * k * k);
+      cosine_coefficient[5] += factor * rate_cosine[0];
+      sine_coefficient[5] += factor * rate_sine[0];
+    }
+  }
+
+  averaged_rate[5] += mean_motion_rad_s;
+  return averaged_rate;
+}
+
+libra::Vector<6> MeanElementOrbit::ConvertOsculatingToMean(const libra::Vector<6>& osculating_elements) const {
+  libra::Vector<6> mean_elements = osculating_elements;
+  MeanElementShortPeriodTerms short_period_terms;
+  for (size_t i = 0; i < 5; i++) {
+    CalcAveragedRate(mean_elements, &short_period_terms);
+    mean_elements = osculating_elements - short_period_terms.CalcVariation(mean_elements[5]);
+  }
+  return mean_elements;
+}
+
+libra::Vector<6> MeanElementOrbit::DerivativeFunction(const double time_s, const libra::Vector<6>& mean_elements) const {
+  UNUSED(time_s);
+  return CalcAveragedRate(mean_elements);
+}
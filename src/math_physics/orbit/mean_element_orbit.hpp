@@ -0,0 +1,174 @@
+/**
+ * @file mean_element_orbit.hpp
+ * @brief Semi-analytic orbit model with averaged equations of the equinoctial elements
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_MEAN_ELEMENT_ORBIT_HPP_
+#define S2E_LIBRARY_ORBIT_MEAN_ELEMENT_ORBIT_HPP_
+
+#include <functional>
+#include <vector>
+
+#include "../math/vector.hpp"
+#include "../numerical_integration/interface_ode.hpp"
+
+/**
+ * @fn ConvertPositionVelocityToEquinoctialElements
+ * @brief Convert position and velocity into the equinoctial elements
+ * @note The equinoctial elements are [a, f, g, h, k, lambda] where f = e cos(w + RAAN), g = e sin(w + RAAN), h = tan(i/2) cos(RAAN),
+ *       k = tan(i/2) sin(RAAN), and lambda = M + w + RAAN. They are not singular for circular and equatorial orbits.
+ * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+ * @param [in] position_i_m: Position in the inertial frame [m]
+ * @param [in] velocity_i_m_s: Velocity in the inertial frame [m/s]
+ * @return Equinoctial elements (semi-major axis [m], f, g, h, k, mean longitude [rad])
+ */
+libra::Vector<6> ConvertPositionVelocityToEquinoctialElements(const double gravity_constant_m3_s2, const libra::Vector<3>& position_i_m,
+                                                              const libra::Vector<3>& velocity_i_m_s);
+/**
+ * @fn ConvertEquinoctialElementsToPositionVelocity
+ * @brief Convert the equinoctial elements into position and velocity
+ * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+ * @param [in] equinoctial_elements: Equinoctial elements (semi-major axis [m], f, g, h, k, mean longitude [rad])
+ * @param [out] position_i_m: Position in the inertial frame [m]
+ * @param [out] velocity_i_m_s: Velocity in the inertial frame [m/s]
+ */
+void ConvertEquinoctialElementsToPositionVelocity(const double gravity_constant_m3_s2, const libra::Vector<6>& equinoctial_elements,
+                                                  libra::Vector<3>& position_i_m, libra::Vector<3>& velocity_i_m_s);
+
+/**
+ * @struct MeanElementShortPeriodTerms
+ * @brief Fourier coefficients of the short-period variation of the equinoctial elements in the mean longitude
+ */
+struct MeanElementShortPeriodTerms {
+  std::vector<libra::Vector<6>> cosine_coefficients;  //!< Coefficients of cos(k * lambda) (k = 1, 2, ...)
+  std::vector<libra::Vector<6>> sine_coefficients;    //!< Coefficients of sin(k * lambda) (k = 1, 2, ...)
+
+  /**
+   * @fn CalcVariation
+   * @brief Calculate the short-period variation (osculating - mean) of the equinoctial elements
+   * @param [in] mean_longitude_rad: Mean longitude of the mean elements [rad]
+   */
+  libra::Vector<6> CalcVariation(const double mean_longitude_rad) const;
+};
+
+/**
+ * @class MeanElementOrbit
+ * @brief Semi-analytic orbit model with averaged equations of the equinoctial elements
+ * @details The Gauss variational equations with the zonal harmonics, the atmospheric drag, and the third body gravity are averaged over the mean
+ *          longitude with the trapezoidal rule, which is spectrally accurate for periodic functions. The same samples give the Fourier
+ *          coefficients of the short-period variation to reconstruct the osculating elements. The averaged equations are first order in the
+ *          perturbations, and the positions of the third bodies and the air density function are treated as constants during an averaging.
+ */
+class MeanElementOrbit : public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  /**
+   * @fn MeanElementOrbit
+   * @brief Constructor
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+   * @param [in] reference_radius_m: Reference radius of the zonal harmonics [m]
+   * @param [in] zonal_coefficients: Unnormalized zonal harmonics coefficients from J2 (J2, J3, J4, ...)
+   * @param [in] number_of_samples: Number of samples in the mean longitude for the averaging
+   * @param [in] number_of_harmonics: Number of harmonics of the short-period variation (less than half of the number of samples)
+   */
+  MeanElementOrbit(const double gravity_constant_m3_s2, const double reference_radius_m, const std::vector<double> zonal_coefficients,
+                   const size_t number_of_samples = 36, const size_t number_of_harmonics = 8);
+
+  /**
+   * @fn SetDragParameters
+   * @brief Set parameters of the atmospheric drag. The drag is not calculated when the air density function is not set.
+   * @param [in] ballistic_coefficient_m2_kg: Drag coefficient x area / mass [m2/kg]
+   * @param [in] atmosphere_angular_velocity_i_rad_s: Angular velocity of the co-rotating atmosphere in the inertial frame [rad/s]
+   * @param [in] air_density_function: Function to return the air density [kg/m3] from the position in the inertial frame [m]
+   */
+  void SetDragParameters(const double ballistic_coefficient_m2_kg, const libra::Vector<3> atmosphere_angular_velocity_i_rad_s,
+                         const std::function<double(const libra::Vector<3>&)> air_density_function);
+  /**
+   * @fn ClearThirdBodies
+   * @brief Clear the list of the third bodies
+   */
+  inline void ClearThirdBodies() {
+    third_body_gravity_constants_m3_s2_.clear();
+    third_body_positions_i_m_.clear();
+  }
+  /**
+   * @fn AddThirdBody
+   * @brief Add a third body
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the third body [m3/s2]
+   * @param [in] position_i_m: Position of the third body from the center body in the inertial frame [m]
+   */
+  inline void AddThirdBody(const double gravity_constant_m3_s2, const libra::Vector<3> position_i_m) {
+    third_body_gravity_constants_m3_s2_.push_back(gravity_constant_m3_s2);
+    third_body_positions_i_m_.push_back(position_i_m);
+  }
+
+  /**
+   * @fn CalcPerturbationAcceleration_i_m_s2
+   * @brief Calculate the acceleration by the perturbations in the inertial frame [m/s2]
+   * @param [in] position_i_m: Position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity in the inertial frame [m/s]
+   */
+  libra::Vector<3> CalcPerturbationAcceleration_i_m_s2(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) const;
+  /**
+   * @fn CalcAveragedRate
+   * @brief Calculate the averaged rate of the mean elements
+   * @param [in] mean_elements: Mean equinoctial elements
+   * @param [out] short_period_terms: Short-period terms at the mean elements (not calculated when nullptr)
+   * @return Averaged rate of the mean elements including the mean motion
+   */
+  libra::Vector<6> CalcAveragedRate(const libra::Vector<6>& mean_elements, MeanElementShortPeriodTerms* short_period_terms = nullptr) const;
+  /**
+   * @fn ConvertOsculatingToMean
+   * @brief Convert the osculating elements into the mean elements by the fixed-point iteration
+   * @param [in] osculating_elements: Osculating equinoctial elements
+   * @return Mean equinoctial elements
+   */
+  libra::Vector<6> ConvertOsculatingToMean(const libra::Vector<6>& osculating_elements) const;
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Return the averaged rate of the mean elements
+   * @param [in] time_s: Time [s] (not used)
+   * @param [in] mean_elements: Mean equinoctial elements
+   */
+  virtual libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& mean_elements) const;
+
+  // Getter
+  /**
+   * @fn GetGravityConstant_m3_s2
+   * @brief Return gravity constant of the center body [m3/s2]
+   */
+  inline double GetGravityConstant_m3_s2() const { return gravity_constant_m3_s2_; }
+  /**
+   * @fn GetReferenceRadius_m
+   * @brief Return reference radius of the zonal harmonics [m]
+   */
+  inline double GetReferenceRadius_m() const { return reference_radius_m_; }
+
+ private:
+  double gravity_constant_m3_s2_;           //!< Gravity constant of the center body [m3/s2]
+  double reference_radius_m_;               //!< Reference radius of the zonal harmonics [m]
+  std::vector<double> zonal_coefficients_;  //!< Zonal harmonics coefficients from J2
+  size_t number_of_samples_;                //!< Number of samples in the mean longitude
+  size_t number_of_harmonics_;              //!< Number of harmonics of the short-period variation
+
+  // Drag
+  double ballistic_coefficient_m2_kg_ = 0.0;                             //!< Drag coefficient x area / mass [m2/kg]
+  libra::Vector<3> atmosphere_angular_velocity_i_rad_s_{0.0};            //!< Angular velocity of the atmosphere [rad/s]
+  std::function<double(const libra::Vector<3>&)> air_density_function_;  //!< Air density [kg/m3] from the inertial position [m]
+
+  // Third bodies
+  std::vector<double> third_body_gravity_constants_m3_s2_;  //!< Gravity constants of the third bodies [m3/s2]
+  std::vector<libra::Vector<3>> third_body_positions_i_m_;  //!< Positions of the third bodies in the inertial frame [m]
+
+  /**
+   * @fn CalcOsculatingRate
+   * @brief Calculate the rate of the osculating elements by the perturbations with the Gauss variational equations
+   * @note The mean motion is not included
+   * @param [in] elements: Osculating equinoctial elements
+   * @return Rate of the osculating elements
+   */
+  libra::Vector<6> CalcOsculatingRate(const libra::Vector<6>& elements) const;
+};
+
+#endif  // S2E_LIBRARY_ORBIT_MEAN_ELEMENT_ORBIT_HPP_
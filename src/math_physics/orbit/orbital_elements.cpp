@@ -27,8 +27,6 @@ OrbitalElements::OrbitalElements(const double gravity_constant_m3_s2, const doub
   CalcOeFromPosVel(gravity_constant_m3_s2, time_jday, position_i_m, velocity_i_m_s);
 }
 
-OrbitalElements::~OrbitalElements() {}
-
 // Private Function
 void OrbitalElements::CalcOeFromPosVel(const double gravity_constant_m3_s2, const double time_jday, const libra::Vector<3> position_i_m,
                                        const libra::Vector<3> velocity_i_m_s) {
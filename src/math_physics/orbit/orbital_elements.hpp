@@ -41,11 +41,6 @@ class OrbitalElements {
    */
   OrbitalElements(const double gravity_constant_m3_s2, const double time_jday, const libra::Vector<3> position_i_m,
                   const libra::Vector<3> velocity_i_m_s);
-  /**
-   * @fn ~OrbitalElements
-   * @brief Destructor
-   */
-  ~OrbitalElements();
 
   // Getter
   /**
@@ -0,0 +1,324 @@
+/**
+ * @file sgp4_catalog.cpp
+ * @brief Class to propagate many objects in a TLE catalog with SGP4 method
+ */
+
+#include "sgp4_catalog.hpp"
+
+#include <math_physics/math/constants.hpp>
+#include <math_physics/orbit/sgp4/sgp4io.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <thread>
+
+Sgp4Catalog::Sgp4Catalog(const gravconsttype gravity_constant_setting) : gravity_constant_setting_(gravity_constant_setting) {}
+
+size_t Sgp4Catalog::ReadTleFile(const std::string file_name) {
+  std::ifstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] SGP4 catalog: cannot open " << file_name << std::endl;
+    return 0;
+  }
+
+  size_t number_of_read_objects = 0;
+  std::string name = "";
+  std::string line1 = "";
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty()) continue;
+
+    if (line.compare(0, 2, "1 ") == 0) {
+      line1 = line;
+    } else if (line.compare(0, 2, "2 ") == 0 && !line1.empty()) {
+      if (AddTle(name, line1, line)) number_of_read_objects++;
+      name = "";
+      line1 = "";
+    } else {
+      // Name line. The first character is "0 " in the three line element format
+      name = line.compare(0, 2, "0 ") == 0 ? line.substr(2) : line;
+      line1 = "";
+    }
+  }
+  return number_of_read_objects;
+}
+
+bool Sgp4Catalog::AddTle(const std::string name, const std::string line1, const std::string line2) {
+  // twoline2rv requires modifiable char arrays
+  char tle1[130];
+  char tle2[130];
+  strncpy(tle1, line1.c_str(), sizeof(tle1) - 1);
+  strncpy(tle2, line2.c_str(), sizeof(tle2) - 1);
+  tle1[sizeof(tle1) - 1] = '\0';
+  tle2[sizeof(tle2) - 1] = '\0';
+
+  elsetrec record;
+  char type_run = 'c', type_input = 0;
+  double start_mfe, stop_mfe, delta_min;
+  twoline2rv(tle1, tle2, type_run, type_input, gravity_constant_setting_, start_mfe, stop_mfe, delta_min, record);
+  if (record.error != 0) {
+    std::cerr << "[WARNING] SGP4 catalog: initialization of the object " << record.satnum << " failed with the error code " << record.error << std::endl;
+    return false;
+  }
+
+  const size_t object_id = names_.size();
+  names_.push_back(name);
+  satellite_numbers_.push_back(record.satnum);
+  position_list_i_m_.push_back(libra::Vector<3>(0.0));
+  velocity_list_i_m_s_.push_back(libra::Vector<3>(0.0));
+  error_list_.push_back(0);
+
+  if (record.method == 'd') {
+    deep_space_object_ids_.push_back(object_id);
+    deep_space_records_.push_back(record);
+    return true;
+  }
+
+  near_earth_.object_id.push_back(object_id);
+  near_earth_.isimp.push_back(record.isimp);
+  near_earth_.jdsatepoch.push_back(record.jdsatepoch);
+  near_earth_.no.push_back(record.no);
+  near_earth_.ecco.push_back(record.ecco);
+  near_earth_.inclo.push_back(record.inclo);
+  near_earth_.mo.push_back(record.mo);
+  near_earth_.argpo.push_back(record.argpo);
+  near_earth_.nodeo.push_back(record.nodeo);
+  near_earth_.bstar.push_back(record.bstar);
+  near_earth_.mdot.push_back(record.mdot);
+  near_earth_.argpdot.push_back(record.argpdot);
+  near_earth_.nodedot.push_back(record.nodedot);
+  near_earth_.nodecf.push_back(record.nodecf);
+  near_earth_.cc1.push_back(record.cc1);
+  near_earth_.cc4.push_back(record.cc4);
+  near_earth_.cc5.push_back(record.cc5);
+  near_earth_.t2cof.push_back(record.t2cof);
+  near_earth_.t3cof.push_back(record.t3cof);
+  near_earth_.t4cof.push_back(record.t4cof);
+  near_earth_.t5cof.push_back(record.t5cof);
+  near_earth_.omgcof.push_back(record.omgcof);
+  near_earth_.xmcof.push_back(record.xmcof);
+  near_earth_.eta.push_back(record.eta);
+  near_earth_.delmo.push_back(record.delmo);
+  near_earth_.d2.push_back(record.d2);
+  near_earth_.d3.push_back(record.d3);
+  near_earth_.d4.push_back(record.d4);
+  near_earth_.sinmao.push_back(record.sinmao);
+  near_earth_.aycof.push_back(record.aycof);
+  near_earth_.xlcof.push_back(record.xlcof);
+  near_earth_.con41.push_back(record.con41);
+  near_earth_.x1mth2.push_back(record.x1mth2);
+  near_earth_.x7thm1.push_back(record.x7thm1);
+  return true;
+}
+
+void Sgp4Catalog::Propagate(const double current_time_jd, const size_t number_of_threads) {
+  const size_t number_of_near_earth_objects = near_earth_.object_id.size();
+  const size_t number_of_deep_space_objects = deep_space_records_.size();
+  const size_t number_of_workers = std::max<size_t>(1, std::min(number_of_threads, GetNumberOfObjects()));
+
+  if (number_of_workers == 1) {
+    PropagateNearEarth(current_time_jd, 0, number_of_near_earth_objects);
+    PropagateDeepSpace(current_time_jd, 0, number_of_deep_space_objects);
+    return;
+  }
+
+  // Each worker propagates a contiguous block of the near-earth arrays and the deep-space records
+  std::vector<std::thread> workers;
+  for (size_t worker_id = 0; worker_id < number_of_workers; worker_id++) {
+    const size_t near_earth_begin = number_of_near_earth_objects * worker_id / number_of_workers;
+    const size_t near_earth_end = number_of_near_earth_objects * (worker_id + 1) / number_of_workers;
+    const size_t deep_space_begin = number_of_deep_space_objects * worker_id / number_of_workers;
+    const size_t deep_space_end = number_of_deep_space_objects * (worker_id + 1) / number_of_workers;
+    workers.emplace_back([=]() {
+      PropagateNearEarth(current_time_jd, near_earth_begin, near_earth_end);
+      PropagateDeepSpace(current_time_jd, deep_space_begin, deep_space_end);
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+void Sgp4Catalog::PropagateNearEarth(const double current_time_jd, const size_t begin, const size_t end) {
+  // Same calculation with sgp4 in sgp4unit.cpp for method = 'n'
+  double tumin, mu, radius_earth_km, xke, j2, j3, j4, j3oj2;
+  getgravconst(gravity_constant_setting_, tumin, mu, radius_earth_km, xke, j2, j3, j4, j3oj2);
+  const double vkmpersec = radius_earth_km * xke / 60.0;
+  const double twopi = libra::tau;
+  const double x2o3 = 2.0 / 3.0;
+  const NearEarthArrays& ne = near_earth_;
+
+  for (size_t i = begin; i < end; i++) {
+    const size_t object_id = ne.object_id[i];
+    const double t = (current_time_jd - ne.jdsatepoch[i]) * 1440.0;
+
+    // Update for secular gravity and atmospheric drag
+    const double xmdf = ne.mo[i] + ne.mdot[i] * t;
+    const double argpdf = ne.argpo[i] + ne.argpdot[i] * t;
+    const double nodedf = ne.nodeo[i] + ne.nodedot[i] * t;
+    double argpm = argpdf;
+    double mm = xmdf;
+    const double t2 = t * t;
+    double nodem = nodedf + ne.nodecf[i] * t2;
+    double tempa = 1.0 - ne.cc1[i] * t;
+    double tempe = ne.bstar[i] * ne.cc4[i] * t;
+    double templ = ne.t2cof[i] * t2;
+    if (ne.isimp[i] != 1) {
+      const double delomg = ne.omgcof[i] * t;
+      const double delm = ne.xmcof[i] * (pow((1.0 + ne.eta[i] * cos(xmdf)), 3) - ne.delmo[i]);
+      const double temp = delomg + delm;
+      mm = xmdf + temp;
+      argpm = argpdf - temp;
+      const double t3 = t2 * t;
+      const double t4 = t3 * t;
+      tempa = tempa - ne.d2[i] * t2 - ne.d3[i] * t3 - ne.d4[i] * t4;
+      tempe = tempe + ne.bstar[i] * ne.cc5[i] * (sin(mm) - ne.sinmao[i]);
+      templ = templ + ne.t3cof[i] * t3 + t4 * (ne.t4cof[i] + t * ne.t5cof[i]);
+    }
+
+    double nm = ne.no[i];
+    double em = ne.ecco[i];
+    const double inclm = ne.inclo[i];
+    if (nm <= 0.0) {
+      SetFailedState(object_id, 2);
+      continue;
+    }
+    const double am = pow((xke / nm), x2o3) * tempa * tempa;
+    nm = xke / pow(am, 1.5);
+    em = em - tempe;
+    if ((em >= 1.0) || (em < -0.001) || (am < 0.95)) {
+      SetFailedState(object_id, 1);
+      continue;
+    }
+    if (em < 0.0) em = 1.0e-6;
+    mm = mm + ne.no[i] * templ;
+    double xlm = mm + argpm + nodem;
+
+    nodem = fmod(nodem, twopi);
+    argpm = fmod(argpm, twopi);
+    xlm = fmod(xlm, twopi);
+    mm = fmod(xlm - argpm - nodem, twopi);
+
+    const double sinip = sin(inclm);
+    const double cosip = cos(inclm);
+
+    // Long period periodics
+    const double axnl = em * cos(argpm);
+    double temp = 1.0 / (am * (1.0 - em * em));
+    const double aynl = em * sin(argpm) + temp * ne.aycof[i];
+    const double xl = mm + argpm + nodem + temp * ne.xlcof[i] * axnl;
+
+    // Solve Kepler's equation
+    const double u = fmod(xl - nodem, twopi);
+    double eo1 = u;
+    double tem5 = 9999.9;
+    int ktr = 1;
+    double sineo1 = sin(eo1);
+    double coseo1 = cos(eo1);
+    while ((fabs(tem5) >= 1.0e-12) && (ktr <= 10)) {
+      sineo1 = sin(eo1);
+      coseo1 = cos(eo1);
+      tem5 = 1.0 - coseo1 * axnl - sineo1 * aynl;
+      tem5 = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
+      if (fabs(tem5) >= 0.95) tem5 = tem5 > 0.0 ? 0.95 : -0.95;
+      eo1 = eo1 + tem5;
+      ktr = ktr + 1;
+    }
+
+    // Short period preliminary quantities
+    const double ecose = axnl * coseo1 + aynl * sineo1;
+    const double esine = axnl * sineo1 - aynl * coseo1;
+    const double el2 = axnl * axnl + aynl * aynl;
+    const double pl = am * (1.0 - el2);
+    if (pl < 0.0) {
+      SetFailedState(object_id, 4);
+      continue;
+    }
+    const double rl = am * (1.0 - ecose);
+    const double rdotl = sqrt(am) * esine / rl;
+    const double rvdotl = sqrt(pl) / rl;
+    const double betal = sqrt(1.0 - el2);
+    temp = esine / (1.0 + betal);
+    const double sinu = am / rl * (sineo1 - aynl - axnl * temp);
+    const double cosu = am / rl * (coseo1 - axnl + aynl * temp);
+    double su = atan2(sinu, cosu);
+    const double sin2u = (cosu + cosu) * sinu;
+    const double cos2u = 1.0 - 2.0 * sinu * sinu;
+    temp = 1.0 / pl;
+    const double temp1 = 0.5 * j2 * temp;
+    const double temp2 = temp1 * temp;
+
+    // Update for short period periodics
+    const double mrt = rl * (1.0 - 1.5 * temp2 * betal * ne.con41[i]) + 0.5 * temp1 * ne.x1mth2[i] * cos2u;
+    // Decayed objects
+    if (mrt < 1.0) {
+      SetFailedState(object_id, 6);
+      continue;
+    }
+    su = su - 0.25 * temp2 * ne.x7thm1[i] * sin2u;
+    const double xnode = nodem + 1.5 * temp2 * cosip * sin2u;
+    const double xinc = inclm + 1.5 * temp2 * cosip * sinip * cos2u;
+    const double mvt = rdotl - nm * temp1 * ne.x1mth2[i] * sin2u / xke;
+    const double rvdot = rvdotl + nm * temp1 * (ne.x1mth2[i] * cos2u + 1.5 * ne.con41[i]) / xke;
+
+    // Orientation vectors
+    const double sinsu = sin(su);
+    const double cossu = cos(su);
+    const double snod = sin(xnode);
+    const double cnod = cos(xnode);
+    const double sini = sin(xinc);
+    const double cosi = cos(xinc);
+    const double xmx = -snod * cosi;
+    const double xmy = cnod * cosi;
+    const double ux = xmx * sinsu + cnod * cossu;
+    const double uy = xmy * sinsu + snod * cossu;
+    const double uz = sini * sinsu;
+    const double vx = xmx * cossu - cnod * sinsu;
+    const double vy = xmy * cossu - snod * sinsu;
+    const double vz = sini * cossu;
+
+    // Position and velocity in [km] and [km/s] are converted into [m] and [m/s]
+    libra::Vector<3>& position_i_m = position_list_i_m_[object_id];
+    libra::Vector<3>& velocity_i_m_s = velocity_list_i_m_s_[object_id];
+    position_i_m[0] = ((mrt * ux) * radius_earth_km) * 1000.0;
+    position_i_m[1] = ((mrt * uy) * radius_earth_km) * 1000.0;
+    position_i_m[2] = ((mrt * uz) * radius_earth_km) * 1000.0;
+    velocity_i_m_s[0] = ((mvt * ux + rvdot * vx) * vkmpersec) * 1000.0;
+    velocity_i_m_s[1] = ((mvt * uy + rvdot * vy) * vkmpersec) * 1000.0;
+    velocity_i_m_s[2] = ((mvt * uz + rvdot * vz) * vkmpersec) * 1000.0;
+    error_list_[object_id] = 0;
+  }
+}
+
+void Sgp4Catalog::PropagateDeepSpace(const double current_time_jd, const size_t begin, const size_t end) {
+  for (size_t i = begin; i < end; i++) {
+    elsetrec& record = deep_space_records_[i];
+    const double elapsed_time_min = (current_time_jd - record.jdsatepoch) * 1440.0;
+
+    double position_i_km[3];
+    double velocity_i_km_s[3];
+    const size_t object_id = deep_space_object_ids_[i];
+    const int error = sgp4(gravity_constant_setting_, record, elapsed_time_min, position_i_km, velocity_i_km_s);
+    if (error != 0) {
+      SetFailedState(object_id, error);
+      continue;
+    }
+    error_list_[object_id] = 0;
+
+    for (size_t axis = 0; axis < 3; axis++) {
+      position_list_i_m_[object_id][axis] = position_i_km[axis] * 1000.0;
+      velocity_list_i_m_s_[object_id][axis] = velocity_i_km_s[axis] * 1000.0;
+    }
+  }
+}
+
+void Sgp4Catalog::SetFailedState(const size_t object_id, const int error) {
+  error_list_[object_id] = error;
+  position_list_i_m_[object_id] = libra::Vector<3>(std::numeric_limits<double>::quiet_NaN());
+  velocity_list_i_m_s_[object_id] = libra::Vector<3>(std::numeric_limits<double>::quiet_NaN());
+}
@@ -0,0 +1,150 @@
+/**
+ * @file sgp4_catalog.hpp
+ * @brief Class to propagate many objects in a TLE catalog with SGP4 method
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_SGP4_CATALOG_HPP_
+#define S2E_LIBRARY_ORBIT_SGP4_CATALOG_HPP_
+
+#include <math_physics/math/vector.hpp>
+#include <math_physics/orbit/sgp4/sgp4unit.h>
+#include <string>
+#include <vector>
+
+/**
+ * @class Sgp4Catalog
+ * @brief Class to propagate many objects in a TLE catalog with SGP4 method
+ * @details The secular and periodic coefficients of near-earth objects are stored in the structure-of-arrays layout, and all near-earth objects
+ *          are propagated in a single loop without the per-object elsetrec access.
+ *          Deep-space objects (period >= 225 min) are propagated with the original sgp4 function since they need the resonance integrator.
+ *          The outputs are position and velocity in the TEME frame, which are treated as the inertial frame in Sgp4OrbitPropagation.
+ */
+class Sgp4Catalog {
+ public:
+  /**
+   * @fn Sgp4Catalog
+   * @brief Constructor
+   * @param [in] gravity_constant_setting: Gravity constant setting for SGP4
+   */
+  explicit Sgp4Catalog(const gravconsttype gravity_constant_setting = wgs72);
+
+  /**
+   * @fn ReadTleFile
+   * @brief Read all objects in the TLE file. The name line before the two lines is optional.
+   * @param [in] file_name: Path of the TLE file
+   * @return Number of objects read from the file
+   */
+  size_t ReadTleFile(const std::string file_name);
+  /**
+   * @fn AddTle
+   * @brief Add an object with two line elements
+   * @param [in] name: Name of the object
+   * @param [in] line1: First line of the TLE
+   * @param [in] line2: Second line of the TLE
+   * @return True when the object is added
+   */
+  bool AddTle(const std::string name, const std::string line1, const std::string line2);
+
+  /**
+   * @fn Propagate
+   * @brief Propagate all objects to the epoch
+   * @param [in] current_time_jd: Target epoch in Julian day
+   * @param [in] number_of_threads: Number of threads to propagate objects
+   */
+  void Propagate(const double current_time_jd, const size_t number_of_threads = 1);
+
+  // Getter
+  /**
+   * @fn GetNumberOfObjects
+   * @brief Return number of objects in the catalog
+   */
+  inline size_t GetNumberOfObjects() const { return names_.size(); }
+  /**
+   * @fn GetNumberOfDeepSpaceObjects
+   * @brief Return number of deep-space objects propagated with the original sgp4 function
+   */
+  inline size_t GetNumberOfDeepSpaceObjects() const { return deep_space_records_.size(); }
+  /**
+   * @fn GetName
+   * @brief Return name of the object
+   * @param [in] object_id: Index of the object
+   */
+  inline const std::string& GetName(const size_t object_id) const { return names_[object_id]; }
+  /**
+   * @fn GetSatelliteNumber
+   * @brief Return NORAD catalog number of the object
+   * @param [in] object_id: Index of the object
+   */
+  inline long GetSatelliteNumber(const size_t object_id) const { return satellite_numbers_[object_id]; }
+  /**
+   * @fn GetPositionList_i_m
+   * @brief Return position list of all objects in the TEME frame [m]
+   * @note The position of the object which failed at the last propagation is NaN
+   */
+  inline const std::vector<libra::Vector<3>>& GetPositionList_i_m() const { return position_list_i_m_; }
+  /**
+   * @fn GetVelocityList_i_m_s
+   * @brief Return velocity list of all objects in the TEME frame [m/s]
+   * @note The velocity of the object which failed at the last propagation is NaN
+   */
+  inline const std::vector<libra::Vector<3>>& GetVelocityList_i_m_s() const { return velocity_list_i_m_s_; }
+  /**
+   * @fn GetError
+   * @brief Return SGP4 error code of the object at the last propagation (0: no error). The first detected error is kept.
+   * @param [in] object_id: Index of the object
+   */
+  inline int GetError(const size_t object_id) const { return error_list_[object_id]; }
+
+ private:
+  gravconsttype gravity_constant_setting_;  //!< Gravity constant setting for SGP4
+
+  // Information of all objects
+  std::vector<std::string> names_;                     //!< Name list
+  std::vector<long> satellite_numbers_;                //!< NORAD catalog number list
+  std::vector<libra::Vector<3>> position_list_i_m_;    //!< Position list in the TEME frame [m]
+  std::vector<libra::Vector<3>> velocity_list_i_m_s_;  //!< Velocity list in the TEME frame [m/s]
+  std::vector<int> error_list_;                        //!< SGP4 error code list
+
+  /**
+   * @struct NearEarthArrays
+   * @brief SGP4 coefficients of near-earth objects in the structure-of-arrays layout
+   * @note Member names follow elsetrec
+   */
+  struct NearEarthArrays {
+    std::vector<size_t> object_id;  //!< Index of the object in the catalog
+    std::vector<int> isimp;         //!< Flag for the simplified drag model of low perigee objects
+    std::vector<double> jdsatepoch, no, ecco, inclo, mo, argpo, nodeo, bstar;
+    std::vector<double> mdot, argpdot, nodedot, nodecf, cc1, cc4, cc5, t2cof, t3cof, t4cof, t5cof, omgcof, xmcof, eta, delmo, d2, d3, d4, sinmao;
+    std::vector<double> aycof, xlcof, con41, x1mth2, x7thm1;
+  };
+  NearEarthArrays near_earth_;  //!< Coefficients of near-earth objects
+
+  std::vector<size_t> deep_space_object_ids_;  //!< Index of deep-space objects in the catalog
+  std::vector<elsetrec> deep_space_records_;   //!< SGP4 records of deep-space objects
+
+  /**
+   * @fn PropagateNearEarth
+   * @brief Propagate near-earth objects in the range
+   * @param [in] current_time_jd: Target epoch in Julian day
+   * @param [in] begin: First index of the near-earth arrays
+   * @param [in] end: Last index + 1 of the near-earth arrays
+   */
+  void PropagateNearEarth(const double current_time_jd, const size_t begin, const size_t end);
+  /**
+   * @fn PropagateDeepSpace
+   * @brief Propagate deep-space objects in the range with the original sgp4 function
+   * @param [in] current_time_jd: Target epoch in Julian day
+   * @param [in] begin: First index of the deep-space records
+   * @param [in] end: Last index + 1 of the deep-space records
+   */
+  void PropagateDeepSpace(const double current_time_jd, const size_t begin, const size_t end);
+  /**
+   * @fn SetFailedState
+   * @brief Set the error code and set the position and velocity to NaN so that the state of the previous epoch is not used
+   * @param [in] object_id: Index of the object
+   * @param [in] error: SGP4 error code
+   */
+  void SetFailedState(const size_t object_id, const int error);
+};
+
+#endif  // S2E_LIBRARY_ORBIT_SGP4_CATALOG_HPP_
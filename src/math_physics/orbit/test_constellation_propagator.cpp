@@ -0,0 +1,133 @@
+/**
+ * @file test_constellation_propagator.cpp
+ * @brief Test codes for ConstellationPropagator class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "constellation_propagator.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = environment::earth_gravitational_constant_m3_s2;
+const double kEarthRadius_m = environment::earth_equatorial_radius_m;
+const double kC20 = -4.84165371736e-4;  // Normalized C20 of EGM96
+
+/**
+ * @brief Make geopotential coefficients up to degree 2 with only C20
+ */
+GravityPotential MakeJ2Potential() {
+  std::vector<std::vector<double>> c(3, std::vector<double>(3, 0.0));
+  std::vector<std::vector<double>> s(3, std::vector<double>(3, 0.0));
+  c[2][0] = kC20;
+  return GravityPotential(2, c, s);
+}
+
+/**
+ * @brief Add a spacecraft on a circular orbit
+ */
+void AddCircularOrbit(ConstellationPropagator& propagator, const double radius_m, const double inclination_rad, const double raan_rad,
+                      const double ballistic_coefficient_m2_kg = 0.0) {
+  const double speed_m_s = sqrt(kGravityConstant_m3_s2 / radius_m);
+  libra::Vector<3> position_i_m;
+  position_i_m[0] = radius_m * cos(raan_rad);
+  position_i_m[1] = radius_m * sin(raan_rad);
+  position_i_m[2] = 0.0;
+  libra::Vector<3> velocity_i_m_s;
+  velocity_i_m_s[0] = -speed_m_s * cos(inclination_rad) * sin(raan_rad);
+  velocity_i_m_s[1] = speed_m_s * cos(inclination_rad) * cos(raan_rad);
+  velocity_i_m_s[2] = speed_m_s * sin(inclination_rad);
+  propagator.AddSpacecraft(position_i_m, velocity_i_m_s, ballistic_coefficient_m2_kg);
+}
+}  // namespace
+
+/**
+ * @brief Test for the two-body propagation
+ */
+TEST(ConstellationPropagator, TwoBody) {
+  ConstellationPropagator propagator(GravityPotential(), 10.0);
+  const double radius_m = 7000.0e3;
+  AddCircularOrbit(propagator, radius_m, 0.3, 0.0);
+  AddCircularOrbit(propagator, radius_m, 1.7, 2.0);
+  const libra::Vector<3> initial_position_i_m = propagator.GetPosition_i_m(1);
+
+  // Propagate one period with the simulation steps which are not multiple of the integration step
+  const double period_s = 2.0 * M_PI * sqrt(pow(radius_m, 3.0) / kGravityConstant_m3_s2);
+  const libra::Matrix<3, 3> dcm_i_to_ecef = libra::MakeIdentityMatrix<3>();
+  const libra::Vector<3> sun_direction_i(0.0);
+  for (double time_s = 7.0; time_s < period_s; time_s += 7.0) {
+    propagator.Propagate(time_s, dcm_i_to_ecef, sun_direction_i);
+  }
+  propagator.Propagate(period_s, dcm_i_to_ecef, sun_direction_i);
+
+  EXPECT_DOUBLE_EQ(period_s, propagator.GetCurrentTime_s());
+  for (size_t i = 0; i < 2; i++) {
+    EXPECT_NEAR(radius_m, propagator.GetPosition_i_m(i).CalcNorm(), 1.0e-3);
+    EXPECT_NEAR(sqrt(kGravityConstant_m3_s2 / radius_m), propagator.GetVelocity_i_m_s(i).CalcNorm(), 1.0e-6);
+  }
+  const libra::Vector<3> difference_m = propagator.GetPosition_i_m(1) - initial_position_i_m;
+  EXPECT_NEAR(0.0, difference_m.CalcNorm(), 1.0e-2);
+}
+
+/**
+ * @brief Test for the nodal regression by J2
+ */
+TEST(ConstellationPropagator, J2NodalRegression) {
+  ConstellationPropagator propagator(MakeJ2Potential(), 20.0);
+  const double radius_m = 7000.0e3;
+  const double inclinations_rad[] = {0.5, 1.2, 1.7, 2.5};
+  for (const double inclination_rad : inclinations_rad) {
+    AddCircularOrbit(propagator, radius_m, inclination_rad, 0.0);
+  }
+
+  // Propagate ten periods with the rotating earth
+  const double period_s = 2.0 * M_PI * sqrt(pow(radius_m, 3.0) / kGravityConstant_m3_s2);
+  const double end_time_s = 10.0 * period_s;
+  libra::Matrix<3, 3> dcm_i_to_ecef = libra::MakeIdentityMatrix<3>();
+  const libra::Vector<3> sun_direction_i(0.0);
+  const double step_s = 60.0;
+  for (double time_s = step_s; time_s <= end_time_s + step_s; time_s += step_s) {
+    const double rotation_angle_rad = environment::earth_mean_angular_velocity_rad_s * propagator.GetCurrentTime_s();
+    dcm_i_to_ecef[0][0] = cos(rotation_angle_rad);
+    dcm_i_to_ecef[0][1] = sin(rotation_angle_rad);
+    dcm_i_to_ecef[1][0] = -sin(rotation_angle_rad);
+    dcm_i_to_ecef[1][1] = cos(rotation_angle_rad);
+    propagator.Propagate(std::min(time_s, end_time_s), dcm_i_to_ecef, sun_direction_i);
+  }
+
+  const double j2 = -sqrt(5.0) * kC20;
+  const double mean_motion_rad_s = 2.0 * M_PI / period_s;
+  for (size_t i = 0; i < 4; i++) {
+    const libra::Vector<3> angular_momentum = libra::OuterProduct(propagator.GetPosition_i_m(i), propagator.GetVelocity_i_m_s(i));
+    const double raan_rad = atan2(angular_momentum[0], -angular_momentum[1]);
+    const double expected_raan_rad = -1.5 * mean_motion_rad_s * j2 * pow(kEarthRadius_m / radius_m, 2.0) * cos(inclinations_rad[i]) * end_time_s;
+    EXPECT_NEAR(expected_raan_rad, raan_rad, 0.03 * fabs(expected_raan_rad) + 1.0e-5);
+  }
+}
+
+/**
+ * @brief Test for the air drag
+ */
+TEST(ConstellationPropagator, Drag) {
+  ConstellationPropagator propagator(MakeJ2Potential(), 10.0, "STANDARD");
+  const double radius_m = kEarthRadius_m + 300.0e3;
+  AddCircularOrbit(propagator, radius_m, 0.9, 0.0, 0.0);
+  AddCircularOrbit(propagator, radius_m, 0.9, 0.0, 0.02);
+  AddCircularOrbit(propagator, radius_m, 0.9, 0.0, 0.02);
+
+  const libra::Matrix<3, 3> dcm_i_to_ecef = libra::MakeIdentityMatrix<3>();
+  const libra::Vector<3> sun_direction_i(0.0);
+  propagator.Propagate(6000.0, dcm_i_to_ecef, sun_direction_i);
+
+  // Specific orbital energy decreases with the drag
+  std::vector<double> energy_m2_s2;
+  for (size_t i = 0; i < 3; i++) {
+    energy_m2_s2.push_back(0.5 * pow(propagator.GetVelocity_i_m_s(i).CalcNorm(), 2.0) -
+                           kGravityConstant_m3_s2 / propagator.GetPosition_i_m(i).CalcNorm());
+  }
+  EXPECT_LT(energy_m2_s2[1], energy_m2_s2[0] - 1.0);
+  // Same spacecraft have the same result
+  for (size_t axis = 0; axis < 3; axis++) {
+    EXPECT_DOUBLE_EQ(propagator.GetPosition_i_m(1)[axis], propagator.GetPosition_i_m(2)[axis]);
+  }
+}
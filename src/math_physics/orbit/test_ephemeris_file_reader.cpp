@@ -0,0 +1,128 @@
+/**
+ * @file test_ephemeris_file_reader.cpp
+ * @brief Test codes for EphemerisFileReader class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include "ephemeris_file_reader.hpp"
+
+/**
+ * @brief Write a CSV ephemeris of x = sin(w t) and v = w cos(w t) with a non-numeric column like the log file of S2E
+ */
+static void WriteTestEphemeris(const std::string file_name, const size_t number_of_records, const double step_s, const double angular_velocity_rad_s) {
+  std::ofstream file(file_name);
+  file << "elapsed_time[s],time[UTC],x[m],v[m/s]," << std::endl;
+  file.precision(17);
+  for (size_t i = 0; i < number_of_records; i++) {
+    const double time_s = i * step_s;
+    file << time_s << ",2020/01/01 00:00:00," << sin(angular_velocity_rad_s * time_s) << ","
+         << angular_velocity_rad_s * cos(angular_velocity_rad_s * time_s) << "," << std::endl;
+  }
+}
+
+/**
+ * @brief Test for the text file reading and the interpolation
+ */
+TEST(EphemerisFileReader, TextInterpolation) {
+  const std::string file_name = "test_ephemeris_file_reader.csv";
+  const double step_s = 60.0;
+  const double angular_velocity_rad_s = 2.0 * M_PI / 5400.0;
+  WriteTestEphemeris(file_name, 1000, step_s, angular_velocity_rad_s);
+
+  // Small cache to check the seeking
+  EphemerisFileReader ephemeris(file_name, "elapsed_time[s]", {"x[m]", "v[m/s]"}, 32);
+  ASSERT_TRUE(ephemeris.IsOpened());
+  EXPECT_EQ(EphemerisFileFormat::kText, ephemeris.GetFileFormat());
+  EXPECT_EQ(1000, ephemeris.GetNumberOfRecords());
+  EXPECT_DOUBLE_EQ(0.0, ephemeris.GetStartTime_s());
+  EXPECT_DOUBLE_EQ(999 * step_s, ephemeris.GetEndTime_s());
+
+  // Sequential and random access
+  const double times_s[] = {0.0, 30.0, 1234.5, 1300.0, 45678.9, 1000.0, 59940.0};
+  for (const double time_s : times_s) {
+    const size_t record_id = ephemeris.FindRecord(time_s);
+    EXPECT_LE(ephemeris.GetTime_s(record_id), time_s);
+    EXPECT_LE(time_s, ephemeris.GetTime_s(record_id + 1));
+
+    const double x = sin(angular_velocity_rad_s * time_s);
+    const double v = angular_velocity_rad_s * cos(angular_velocity_rad_s * time_s);
+    EXPECT_NEAR(x, ephemeris.CalcLagrange(0, time_s, 8), 1e-9);
+    double derivative;
+    EXPECT_NEAR(x, ephemeris.CalcHermite(0, 1, time_s, derivative), 1e-5);
+    EXPECT_NEAR(v, derivative, 1e-6);
+  }
+
+  remove(file_name.c_str());
+}
+
+/**
+ * @brief Test for the binary file conversion
+ */
+TEST(EphemerisFileReader, Binary) {
+  const std::string text_file_name = "test_ephemeris_file_reader_binary.csv";
+  const std::string binary_file_name = "test_ephemeris_file_reader.bin";
+  const double angular_velocity_rad_s = 2.0 * M_PI / 5400.0;
+  WriteTestEphemeris(text_file_name, 500, 10.0, angular_velocity_rad_s);
+  EXPECT_EQ(500, ConvertEphemerisTextToBinary(text_file_name, binary_file_name));
+
+  EphemerisFileReader text(text_file_name, "elapsed_time[s]", {"v[m/s]", "x[m]"}, 64);
+  EphemerisFileReader binary(binary_file_name, "elapsed_time[s]", {"v[m/s]", "x[m]"}, 64);
+  ASSERT_TRUE(binary.IsOpened());
+  EXPECT_EQ(EphemerisFileFormat::kBinary, binary.GetFileFormat());
+  EXPECT_EQ(text.GetNumberOfRecords(), binary.GetNumberOfRecords());
+  for (size_t record_id = 0; record_id < 500; record_id += 37) {
+    EXPECT_DOUBLE_EQ(text.GetTime_s(record_id), binary.GetTime_s(record_id));
+    EXPECT_DOUBLE_EQ(text.GetData(record_id, 0), binary.GetData(record_id, 0));
+    EXPECT_DOUBLE_EQ(text.GetData(record_id, 1), binary.GetData(record_id, 1));
+  }
+  EXPECT_DOUBLE_EQ(text.CalcLagrange(1, 3210.0, 6), binary.CalcLagrange(1, 3210.0, 6));
+
+  remove(text_file_name.c_str());
+  remove(binary_file_name.c_str());
+}
+
+/**
+ * @brief Test for the missing file and column
+ */
+TEST(EphemerisFileReader, Missing) {
+  const std::string file_name = "test_ephemeris_file_reader_missing.csv";
+  WriteTestEphemeris(file_name, 10, 1.0, 1.0);
+
+  EphemerisFileReader missing_column(file_name, "elapsed_time[s]", {"y[m]"});
+  EXPECT_FALSE(missing_column.IsOpened());
+  EphemerisFileReader missing_file("not_existing_ephemeris.csv", "elapsed_time[s]", {"x[m]"});
+  EXPECT_FALSE(missing_file.IsOpened());
+
+  remove(file_name.c_str());
+}
+
+/**
+ * @brief Test for the rejection of the duplicated and unsorted epochs
+ */
+TEST(EphemerisFileReader, DuplicatedTime) {
+  const std::string file_name = "test_ephemeris_file_reader_duplicated.csv";
+  std::ofstream file(file_name);
+  file << "elapsed_time[s],x[m]," << std::endl;
+  file << "0.0,1.0," << std::endl;
+  file << "10.0,2.0," << std::endl;
+  file << "10.0,3.0," << std::endl;
+  file << "20.0,4.0," << std::endl;
+  file.close();
+  EphemerisFileReader duplicated(file_name, "elapsed_time[s]", {"x[m]"});
+  EXPECT_FALSE(duplicated.IsOpened());
+
+  file.open(file_name);
+  file << "elapsed_time[s],x[m]," << std::endl;
+  file << "0.0,1.0," << std::endl;
+  file << "20.0,2.0," << std::endl;
+  file << "10.0,3.0," << std::endl;
+  file.close();
+  EphemerisFileReader unsorted(file_name, "elapsed_time[s]", {"x[m]"});
+  EXPECT_FALSE(unsorted.IsOpened());
+
+  remove(file_name.c_str());
+}
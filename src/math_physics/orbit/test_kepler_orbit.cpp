@@ -0,0 +1,74 @@
+/**
+ * @file test_kepler_orbit.cpp
+ * @brief Test codes for KeplerOrbit class and Kepler equation solver with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../math/constants.hpp"
+#include "kepler_orbit.hpp"
+
+/**
+ * @brief Test for SolveKeplerEquation function with various eccentricity
+ */
+TEST(KeplerOrbit, SolveKeplerEquation) {
+  const double eccentricity_list[] = {0.0, 1.0e-3, 0.1, 0.5, 0.9, 0.99, 0.999};
+  for (const double e : eccentricity_list) {
+    for (double mean_anomaly_rad = -10.0; mean_anomaly_rad <= 10.0; mean_anomaly_rad += 0.01) {
+      const double u_rad = SolveKeplerEquation(e, mean_anomaly_rad);
+      EXPECT_NEAR(mean_anomaly_rad, u_rad - e * sin(u_rad), 1e-14 * std::max(1.0, std::abs(mean_anomaly_rad)));
+      // Same revolution as the mean anomaly
+      EXPECT_LE(std::abs(u_rad - mean_anomaly_rad), libra::pi);
+    }
+  }
+}
+
+/**
+ * @brief Test for batch SolveKeplerEquation function
+ */
+TEST(KeplerOrbit, SolveKeplerEquationBatch) {
+  std::vector<double> eccentricity_list;
+  std::vector<double> mean_anomaly_list_rad;
+  for (size_t i = 0; i < 100; i++) {
+    eccentricity_list.push_back(0.0099 * i);
+    mean_anomaly_list_rad.push_back(0.1 * i - 5.0);
+  }
+
+  std::vector<double> eccentric_anomaly_list_rad;
+  SolveKeplerEquation(eccentricity_list, mean_anomaly_list_rad, eccentric_anomaly_list_rad);
+  EXPECT_EQ(100, eccentric_anomaly_list_rad.size());
+  for (size_t i = 0; i < 100; i++) {
+    EXPECT_DOUBLE_EQ(SolveKeplerEquation(eccentricity_list[i], mean_anomaly_list_rad[i]), eccentric_anomaly_list_rad[i]);
+  }
+}
+
+/**
+ * @brief Test for CalcKeplerOrbits function compared with KeplerOrbit class
+ */
+TEST(KeplerOrbit, CalcKeplerOrbits) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double epoch_jday = 2460000.0;
+
+  std::vector<OrbitalElements> orbital_elements_list;
+  std::vector<double> time_list_jday;
+  for (size_t i = 0; i < 20; i++) {
+    orbital_elements_list.push_back(OrbitalElements(epoch_jday, 7.0e6 + 1.0e6 * i, 0.04 * i, 0.1 * i, 0.3 * i, 0.2 * i));
+    time_list_jday.push_back(epoch_jday + 0.37 * i);
+  }
+
+  std::vector<libra::Vector<3>> position_list_i_m;
+  std::vector<libra::Vector<3>> velocity_list_i_m_s;
+  CalcKeplerOrbits(gravity_constant_m3_s2, orbital_elements_list, time_list_jday, position_list_i_m, velocity_list_i_m_s);
+  ASSERT_EQ(20, position_list_i_m.size());
+  ASSERT_EQ(20, velocity_list_i_m_s.size());
+
+  for (size_t i = 0; i < 20; i++) {
+    KeplerOrbit kepler_orbit(gravity_constant_m3_s2, orbital_elements_list[i]);
+    kepler_orbit.CalcOrbit(time_list_jday[i]);
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(kepler_orbit.GetPosition_i_m()[axis], position_list_i_m[i][axis], 1e-6);
+      EXPECT_NEAR(kepler_orbit.GetVelocity_i_m_s()[axis], velocity_list_i_m_s[i][axis], 1e-9);
+    }
+  }
+}
@@ -0,0 +1,182 @@
+/**
+ * @file test_mean_element_orbit.cpp
+ * @brief Test codes for MeanElementOrbit class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../numerical_integration/runge_kutta_4.hpp"
+#include "kepler_orbit.hpp"
+#include "mean_element_orbit.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = 3.986004415e14;
+const double kEarthRadius_m = 6378136.3;
+const std::vector<double> kZonalCoefficients = {1.08262668e-3, -2.53265649e-6, -1.61962159e-6, -2.27296083e-7};
+
+/**
+ * @class CowellOde
+ * @brief Equation of motion with the same perturbations as the mean element model
+ */
+class CowellOde : public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  CowellOde(const MeanElementOrbit& model) : model_(model) {}
+  virtual libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& state) const {
+    UNUSED(time_s);
+    libra::Vector<3> position_i_m, velocity_i_m_s;
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = state[i];
+      velocity_i_m_s[i] = state[i + 3];
+    }
+    const double r_m = position_i_m.CalcNorm();
+    libra::Vector<3> acceleration_i_m_s2 = model_.CalcPerturbationAcceleration_i_m_s2(position_i_m, velocity_i_m_s);
+    acceleration_i_m_s2 -= (kGravityConstant_m3_s2 / (r_m * r_m * r_m)) * position_i_m;
+
+    libra::Vector<6> derivative;
+    for (size_t i = 0; i < 3; i++) {
+      derivative[i] = velocity_i_m_s[i];
+      derivative[i + 3] = acceleration_i_m_s2[i];
+    }
+    return derivative;
+  }
+
+ private:
+  const MeanElementOrbit& model_;
+};
+}  // namespace
+
+/**
+ * @brief Test for conversion between position/velocity and equinoctial elements
+ */
+TEST(MeanElementOrbit, ConvertEquinoctialElements) {
+  const double eccentricity_list[] = {0.0, 0.001, 0.3, 0.8};
+  const double inclination_list_rad[] = {0.0, 0.9, 2.5};
+  for (const double e : eccentricity_list) {
+    for (const double inclination_rad : inclination_list_rad) {
+      OrbitalElements oe(2460000.0, 8.0e6, e, inclination_rad, 1.0, 2.0);
+      KeplerOrbit kepler_orbit(kGravityConstant_m3_s2, oe);
+      kepler_orbit.CalcOrbit(2460000.1);
+
+      libra::Vector<6> elements =
+          ConvertPositionVelocityToEquinoctialElements(kGravityConstant_m3_s2, kepler_orbit.GetPosition_i_m(), kepler_orbit.GetVelocity_i_m_s());
+      EXPECT_NEAR(8.0e6, elements[0], 1e-6);
+      EXPECT_NEAR(e, sqrt(elements[1] * elements[1] + elements[2] * elements[2]), 1e-12);
+      EXPECT_NEAR(tan(inclination_rad / 2.0), sqrt(elements[3] * elements[3] + elements[4] * elements[4]), 1e-12);
+
+      libra::Vector<3> position_i_m, velocity_i_m_s;
+      ConvertEquinoctialElementsToPositionVelocity(kGravityConstant_m3_s2, elements, position_i_m, velocity_i_m_s);
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_NEAR(kepler_orbit.GetPosition_i_m()[axis], position_i_m[axis], 1e-6);
+        EXPECT_NEAR(kepler_orbit.GetVelocity_i_m_s()[axis], velocity_i_m_s[axis], 1e-9);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the averaged J2 rate compared with the secular nodal regression
+ */
+TEST(MeanElementOrbit, J2NodalRegression) {
+  MeanElementOrbit model(kGravityConstant_m3_s2, kEarthRadius_m, {kZonalCoefficients[0]});
+  const double a_m = 7.0e6;
+  const double e = 0.01;
+  const double inclination_rad = 0.9;
+  const double raan_rad = 0.5;
+
+  libra::Vector<6> mean_elements;
+  mean_elements[0] = a_m;
+  mean_elements[1] = e * cos(raan_rad + 1.0);
+  mean_elements[2] = e * sin(raan_rad + 1.0);
+  mean_elements[3] = tan(inclination_rad / 2.0) * cos(raan_rad);
+  mean_elements[4] = tan(inclination_rad / 2.0) * sin(raan_rad);
+  mean_elements[5] = 0.3;
+  const libra::Vector<6> rate = model.CalcAveragedRate(mean_elements);
+
+  const double h = mean_elements[3];
+  const double k = mean_elements[4];
+  const double raan_rate_rad_s = (h * rate[4] - k * rate[3]) / (h * h + k * k);
+  const double mean_motion_rad_s = sqrt(kGravityConstant_m3_s2 / pow(a_m, 3.0));
+  const double p_m = a_m * (1.0 - e * e);
+  const double expected_raan_rate_rad_s = -1.5 * mean_motion_rad_s * kZonalCoefficients[0] * pow(kEarthRadius_m / p_m, 2.0) * cos(inclination_rad);
+  EXPECT_NEAR(expected_raan_rate_rad_s, raan_rate_rad_s, 1e-4 * std::abs(expected_raan_rate_rad_s));
+  // No secular change of the semi-major axis by the zonal harmonics
+  EXPECT_NEAR(0.0, rate[0], 1e-9);
+}
+
+/**
+ * @brief Test for the averaged drag rate compared with the decay of the circular orbit
+ */
+TEST(MeanElementOrbit, DragDecay) {
+  MeanElementOrbit model(kGravityConstant_m3_s2, kEarthRadius_m, {});
+  const double ballistic_coefficient_m2_kg = 0.01;
+  const double air_density_kg_m3 = 1.0e-12;
+  model.SetDragParameters(ballistic_coefficient_m2_kg, libra::Vector<3>(0.0), [&](const libra::Vector<3>&) { return air_density_kg_m3; });
+
+  const double a_m = 6.8e6;
+  libra::Vector<6> mean_elements(0.0);
+  mean_elements[0] = a_m;
+  mean_elements[3] = 0.3;
+  const libra::Vector<6> rate = model.CalcAveragedRate(mean_elements);
+
+  const double expected_rate_m_s = -ballistic_coefficient_m2_kg * air_density_kg_m3 * sqrt(kGravityConstant_m3_s2 * a_m);
+  EXPECT_NEAR(expected_rate_m_s, rate[0], 1e-6 * std::abs(expected_rate_m_s));
+}
+
+/**
+ * @brief Test for propagation with hour steps compared with the Cowell propagation
+ */
+TEST(MeanElementOrbit, CompareWithCowell) {
+  MeanElementOrbit model(kGravityConstant_m3_s2, kEarthRadius_m, kZonalCoefficients);
+
+  OrbitalElements oe(2460000.0, 7.0e6, 0.01, 0.9, 0.5, 1.0);
+  KeplerOrbit kepler_orbit(kGravityConstant_m3_s2, oe);
+  kepler_orbit.CalcOrbit(2460000.0);
+  const libra::Vector<3> initial_position_i_m = kepler_orbit.GetPosition_i_m();
+  const libra::Vector<3> initial_velocity_i_m_s = kepler_orbit.GetVelocity_i_m_s();
+
+  // Cowell propagation
+  CowellOde cowell_ode(model);
+  libra::numerical_integration::RungeKutta4<6> cowell(5.0, cowell_ode);
+  libra::Vector<6> initial_state;
+  for (size_t i = 0; i < 3; i++) {
+    initial_state[i] = initial_position_i_m[i];
+    initial_state[i + 3] = initial_velocity_i_m_s[i];
+  }
+  cowell.SetState(0.0, initial_state);
+  const double end_time_s = 86400.0;
+  for (size_t i = 0; i < (size_t)(end_time_s / 5.0); i++) {
+    cowell.Integrate();
+  }
+
+  // Mean element propagation
+  const libra::Vector<6> osculating_elements =
+      ConvertPositionVelocityToEquinoctialElements(kGravityConstant_m3_s2, initial_position_i_m, initial_velocity_i_m_s);
+  const libra::Vector<6> initial_mean_elements = model.ConvertOsculatingToMean(osculating_elements);
+  MeanElementShortPeriodTerms short_period_terms;
+  model.CalcAveragedRate(initial_mean_elements, &short_period_terms);
+  const libra::Vector<6> reconstructed_elements = initial_mean_elements + short_period_terms.CalcVariation(initial_mean_elements[5]);
+  for (size_t i = 0; i < 6; i++) {
+    EXPECT_NEAR(osculating_elements[i], reconstructed_elements[i], 1e-6 * std::max(1.0, std::abs(osculating_elements[i])));
+  }
+
+  libra::numerical_integration::RungeKutta4<6> mean_element_integrator(3600.0, model);
+  mean_element_integrator.SetState(0.0, initial_mean_elements);
+  for (size_t i = 0; i < (size_t)(end_time_s / 3600.0); i++) {
+    mean_element_integrator.Integrate();
+  }
+  const libra::Vector<6> mean_elements = mean_element_integrator.GetState();
+  model.CalcAveragedRate(mean_elements, &short_period_terms);
+
+  libra::Vector<3> osculating_position_i_m, velocity_i_m_s;
+  ConvertEquinoctialElementsToPositionVelocity(kGravityConstant_m3_s2, mean_elements + short_period_terms.CalcVariation(mean_elements[5]),
+                                               osculating_position_i_m, velocity_i_m_s);
+
+  libra::Vector<3> cowell_position_i_m;
+  for (size_t i = 0; i < 3; i++) {
+    cowell_position_i_m[i] = cowell.GetState()[i];
+  }
+  const double osculating_error_m = (osculating_position_i_m - cowell_position_i_m).CalcNorm();
+  // The error is dominated by the second order secular effect of J2 which is not included in the first order averaging
+  EXPECT_LT(osculating_error_m, 1.5e3);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file test_sgp4_catalog.cpp
+ * @brief Test codes for Sgp4Catalog class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "sgp4/sgp4io.h"
+#include "sgp4_catalog.hpp"
+
+namespace {
+// Near-earth object (ISS)
+const std::string kNearEarthLine1 = "1 25544U 98067A   08264.51782528 -.00002182  00000-0 -11606-4 0  2927";
+const std::string kNearEarthLine2 = "2 25544  51.6416 247.4627 0006703 130.5360 325.0288 15.72125391563537";
+// Deep-space object (Molniya)
+const std::string kDeepSpaceLine1 = "1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813";
+const std::string kDeepSpaceLine2 = "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656";
+
+/**
+ * @brief Propagate the object with the original sgp4 function
+ */
+void PropagateReference(const std::string line1, const std::string line2, const double elapsed_time_min, double position_i_km[3],
+                        double velocity_i_km_s[3]) {
+  char tle1[130];
+  char tle2[130];
+  strncpy(tle1, line1.c_str(), sizeof(tle1));
+  strncpy(tle2, line2.c_str(), sizeof(tle2));
+  elsetrec record;
+  double start_mfe, stop_mfe, delta_min;
+  twoline2rv(tle1, tle2, 'c', 0, wgs72, start_mfe, stop_mfe, delta_min, record);
+  sgp4(wgs72, record, elapsed_time_min, position_i_km, velocity_i_km_s);
+}
+}  // namespace
+
+/**
+ * @brief Test for AddTle function
+ */
+TEST(Sgp4Catalog, AddTle) {
+  Sgp4Catalog catalog;
+  EXPECT_TRUE(catalog.AddTle("ISS", kNearEarthLine1, kNearEarthLine2));
+  EXPECT_TRUE(catalog.AddTle("MOLNIYA", kDeepSpaceLine1, kDeepSpaceLine2));
+
+  EXPECT_EQ(2, catalog.GetNumberOfObjects());
+  EXPECT_EQ(1, catalog.GetNumberOfDeepSpaceObjects());
+  EXPECT_EQ("ISS", catalog.GetName(0));
+  EXPECT_EQ(25544, catalog.GetSatelliteNumber(0));
+  EXPECT_EQ(8195, catalog.GetSatelliteNumber(1));
+}
+
+/**
+ * @brief Test for Propagate function compared with the original sgp4 function
+ */
+TEST(Sgp4Catalog, Propagate) {
+  Sgp4Catalog catalog;
+  catalog.AddTle("ISS", kNearEarthLine1, kNearEarthLine2);
+  catalog.AddTle("MOLNIYA", kDeepSpaceLine1, kDeepSpaceLine2);
+  const double near_earth_epoch_jd = 2454730.01782528;  // 2008 day 264.51782528
+  const double deep_space_epoch_jd = 2453911.83215444;  // 2006 day 176.33215444
+
+  for (double elapsed_time_min = 0.0; elapsed_time_min <= 1440.0; elapsed_time_min += 120.0) {
+    // The epoch of the deep-space object is used as the reference time
+    const double current_time_jd = deep_space_epoch_jd + elapsed_time_min / 1440.0;
+    catalog.Propagate(current_time_jd);
+
+    double position_i_km[3], velocity_i_km_s[3];
+    PropagateReference(kNearEarthLine1, kNearEarthLine2, (current_time_jd - near_earth_epoch_jd) * 1440.0, position_i_km, velocity_i_km_s);
+    EXPECT_EQ(0, catalog.GetError(0));
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(position_i_km[axis] * 1000.0, catalog.GetPositionList_i_m()[0][axis], 1e-3);
+      EXPECT_NEAR(velocity_i_km_s[axis] * 1000.0, catalog.GetVelocityList_i_m_s()[0][axis], 1e-6);
+    }
+
+    // The tolerance includes the round-off error of the elapsed time calculated from the Julian day
+    PropagateReference(kDeepSpaceLine1, kDeepSpaceLine2, elapsed_time_min, position_i_km, velocity_i_km_s);
+    EXPECT_EQ(0, catalog.GetError(1));
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(position_i_km[axis] * 1000.0, catalog.GetPositionList_i_m()[1][axis], 0.1);
+      EXPECT_NEAR(velocity_i_km_s[axis] * 1000.0, catalog.GetVelocityList_i_m_s()[1][axis], 1e-4);
+    }
+  }
+}
+
+/**
+ * @brief Test for Propagate function with multiple threads
+ */
+TEST(Sgp4Catalog, PropagateMultiThread) {
+  Sgp4Catalog single_thread_catalog;
+  Sgp4Catalog multi_thread_catalog;
+  for (size_t i = 0; i < 10; i++) {
+    single_thread_catalog.AddTle("ISS", kNearEarthLine1, kNearEarthLine2);
+    single_thread_catalog.AddTle("MOLNIYA", kDeepSpaceLine1, kDeepSpaceLine2);
+    multi_thread_catalog.AddTle("ISS", kNearEarthLine1, kNearEarthLine2);
+    multi_thread_catalog.AddTle("MOLNIYA", kDeepSpaceLine1, kDeepSpaceLine2);
+  }
+
+  const double current_time_jd = 2454731.5;
+  single_thread_catalog.Propagate(current_time_jd);
+  multi_thread_catalog.Propagate(current_time_jd, 4);
+  for (size_t i = 0; i < single_thread_catalog.GetNumberOfObjects(); i++) {
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_DOUBLE_EQ(single_thread_catalog.GetPositionList_i_m()[i][axis], multi_thread_catalog.GetPositionList_i_m()[i][axis]);
+      EXPECT_DOUBLE_EQ(single_thread_catalog.GetVelocityList_i_m_s()[i][axis], multi_thread_catalog.GetVelocityList_i_m_s()[i][axis]);
+    }
+  }
+}
+
+/**
+ * @brief Test for Propagate function for a decayed object
+ */
+TEST(Sgp4Catalog, PropagateDecayedObject) {
+  // ISS with a large drag term
+  const std::string decaying_line1 = "1 25544U 98067A   08264.51782528 -.00002182  00000-0  50000-2 0  2927";
+  const double near_earth_epoch_jd = 2454730.01782528;  // 2008 day 264.51782528
+  Sgp4Catalog catalog;
+  catalog.AddTle("ISS", kNearEarthLine1, kNearEarthLine2);
+  catalog.AddTle("DECAYING", decaying_line1, kNearEarthLine2);
+
+  // The state at the previous epoch is not kept for the failed object
+  catalog.Propagate(near_earth_epoch_jd);
+  EXPECT_EQ(0, catalog.GetError(1));
+  catalog.Propagate(near_earth_epoch_jd + 365.0);
+  EXPECT_EQ(0, catalog.GetError(0));
+  EXPECT_EQ(1, catalog.GetError(1));
+  for (size_t axis = 0; axis < 3; axis++) {
+    EXPECT_FALSE(std::isnan(catalog.GetPositionList_i_m()[0][axis]));
+    EXPECT_TRUE(std::isnan(catalog.GetPositionList_i_m()[1][axis]));
+    EXPECT_TRUE(std::isnan(catalog.GetVelocityList_i_m_s()[1][axis]));
+  }
+
+  // The object is propagated again at the valid epoch
+  catalog.Propagate(near_earth_epoch_jd);
+  EXPECT_EQ(0, catalog.GetError(1));
+  EXPECT_FALSE(std::isnan(catalog.GetPositionList_i_m()[1][0]));
+}
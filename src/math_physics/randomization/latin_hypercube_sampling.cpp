@@ -0,0 +1,39 @@
+/**
+ * @file latin_hypercube_sampling.cpp
+ * @brief Class to generate samples with Latin hypercube sampling
+ */
+
+#include "latin_hypercube_sampling.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace libra {
+
+LatinHypercubeSampling::LatinHypercubeSampling(const size_t number_of_samples, const size_t number_of_dimensions, const uint32_t seed)
+    : number_of_samples_(number_of_samples) {
+  std::mt19937 randomizer(seed);
+  std::uniform_real_distribution<> uniform_distribution(0.0, 1.0);
+
+  samples_.resize(number_of_dimensions);
+  std::vector<size_t> strata(number_of_samples);
+  for (size_t d = 0; d < number_of_dimensions; d++) {
+    // Random permutation of the strata
+    for (size_t i = 0; i < number_of_samples; i++) strata[i] = i;
+    std::shuffle(strata.begin(), strata.end(), randomizer);
+
+    samples_[d].resize(number_of_samples);
+    for (size_t i = 0; i < number_of_samples; i++) {
+      double offset = uniform_distribution(randomizer);
+      if (offset <= 0.0) offset = 0.5;  // Avoid the boundary of the range
+      samples_[d][i] = ((double)strata[i] + offset) / (double)number_of_samples;
+    }
+  }
+}
+
+double LatinHypercubeSampling::GetSample(const size_t sample_id, const size_t dimension_id) const {
+  if (dimension_id >= samples_.size() || sample_id >= number_of_samples_) return 0.5;
+  return samples_[dimension_id][sample_id];
+}
+
+}  // namespace libra
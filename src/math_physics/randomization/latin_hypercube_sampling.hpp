@@ -0,0 +1,60 @@
+/**
+ * @file latin_hypercube_sampling.hpp
+ * @brief Class to generate samples with Latin hypercube sampling
+ * @note Ref: M. D. McKay, R. J. Beckman, and W. J. Conover, A Comparison of Three Methods for Selecting Values of Input Variables in the Analysis
+ *            of Output from a Computer Code, Technometrics 21, 239-245, 1979.
+ */
+
+#ifndef S2E_LIBRARY_RANDOMIZATION_LATIN_HYPERCUBE_SAMPLING_HPP_
+#define S2E_LIBRARY_RANDOMIZATION_LATIN_HYPERCUBE_SAMPLING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class LatinHypercubeSampling
+ * @brief Class to generate samples with Latin hypercube sampling
+ * @details The range (0, 1) of each dimension is divided into the number of samples strata, and each stratum has exactly one sample.
+ */
+class LatinHypercubeSampling {
+ public:
+  /**
+   * @fn LatinHypercubeSampling
+   * @brief Constructor
+   * @param [in] number_of_samples: Number of samples
+   * @param [in] number_of_dimensions: Number of dimensions
+   * @param [in] seed: Seed of randomization
+   */
+  LatinHypercubeSampling(const size_t number_of_samples, const size_t number_of_dimensions, const uint32_t seed);
+
+  /**
+   * @fn GetSample
+   * @brief Return sample
+   * @param [in] sample_id: Index of the sample
+   * @param [in] dimension_id: Index of the dimension
+   * @return Sample value in (0, 1). 0.5 is returned for out of range indexes.
+   */
+  double GetSample(const size_t sample_id, const size_t dimension_id) const;
+
+  /**
+   * @fn GetNumberOfSamples
+   * @brief Return number of samples
+   */
+  inline size_t GetNumberOfSamples() const { return number_of_samples_; }
+  /**
+   * @fn GetNumberOfDimensions
+   * @brief Return number of dimensions
+   */
+  inline size_t GetNumberOfDimensions() const { return samples_.size(); }
+
+ private:
+  size_t number_of_samples_;                  //!< Number of samples
+  std::vector<std::vector<double>> samples_;  //!< Samples of each dimension
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_RANDOMIZATION_LATIN_HYPERCUBE_SAMPLING_HPP_
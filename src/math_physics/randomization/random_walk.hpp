@@ -35,6 +35,18 @@ class RandomWalk : public libra::OrdinaryDifferentialEquation<N> {
    */
   virtual void DerivativeFunction(double x, const libra::Vector<N>& state, libra::Vector<N>& rhs);
 
+  // Override OrdinaryDifferentialEquation
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the random walk state and the randomizer state into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the random walk state and the randomizer state from the checkpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
   libra::Vector<N> limit_;                  //!< Limit of random walk
   libra::NormalRand normal_randomizer_[N];  //!< Random walk excitation noise
@@ -32,4 +32,20 @@ void RandomWalk<N>::DerivativeFunction(double x, const libra::Vector<N>& state,
   }
 }
 
+template <size_t N>
+void RandomWalk<N>::SaveCheckpoint(CheckpointWriter& writer) const {
+  libra::OrdinaryDifferentialEquation<N>::SaveCheckpoint(writer);
+  for (size_t i = 0; i < N; ++i) {
+    writer.Write(normal_randomizer_[i]);
+  }
+}
+
+template <size_t N>
+void RandomWalk<N>::LoadCheckpoint(CheckpointReader& reader) {
+  libra::OrdinaryDifferentialEquation<N>::LoadCheckpoint(reader);
+  for (size_t i = 0; i < N; ++i) {
+    reader.Read(normal_randomizer_[i]);
+  }
+}
+
 #endif  // S2E_LIBRARY_RANDOMIZATION_RANDOM_WALK_TEMPLATE_FUNCTIONS_HPP_
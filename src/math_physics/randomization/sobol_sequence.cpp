@@ -0,0 +1,186 @@
+/**
+ * @file sobol_sequence.cpp
+ * @brief Class to generate Sobol low-discrepancy sequence
+ */
+
+#include "sobol_sequence.hpp"
+
+#include <random>
+
+namespace libra {
+
+namespace {
+
+/**
+ * @brief Initial direction numbers m_k of Joe and Kuo (new-joe-kuo-6.21201) for the dimensions from 2 to 21
+ */
+const std::vector<std::vector<uint32_t>> kJoeKuoInitialDirectionNumbers = {
+    {1},
+    {1, 3},
+    {1, 3, 1},
+    {1, 1, 1},
+    {1, 1, 3, 3},
+    {1, 3, 5, 13},
+    {1, 1, 5, 5, 17},
+    {1, 1, 5, 5, 5},
+    {1, 1, 7, 11, 19},
+    {1, 1, 5, 1, 1},
+    {1, 1, 1, 3, 11},
+    {1, 3, 5, 5, 31},
+    {1, 3, 3, 9, 7, 49},
+    {1, 1, 1, 15, 21, 21},
+    {1, 3, 1, 13, 27, 49},
+    {1, 1, 1, 15, 7, 5},
+    {1, 3, 1, 15, 13, 25},
+    {1, 1, 5, 5, 19, 61},
+    {1, 3, 7, 11, 23, 15, 103},
+    {1, 3, 7, 13, 13, 15, 69},
+};
+
+/**
+ * @fn MultiplyPolynomialModulo
+ * @brief Multiply two polynomials over GF(2) with modulo of the polynomial
+ */
+uint64_t MultiplyPolynomialModulo(uint64_t a, uint64_t b, const uint64_t polynomial, const unsigned int degree) {
+  uint64_t result = 0;
+  while (b != 0) {
+    if (b & 1) result ^= a;
+    b >>= 1;
+    a <<= 1;
+    if (a & (1ull << degree)) a ^= polynomial;
+  }
+  return result;
+}
+
+/**
+ * @fn PowerOfX
+ * @brief Calculate x^exponent modulo of the polynomial over GF(2)
+ */
+uint64_t PowerOfX(uint64_t exponent, const uint64_t polynomial, const unsigned int degree) {
+  uint64_t result = 1;
+  uint64_t base = (degree == 1) ? (2 ^ polynomial) : 2;  // x mod polynomial
+  while (exponent != 0) {
+    if (exponent & 1) result = MultiplyPolynomialModulo(result, base, polynomial, degree);
+    base = MultiplyPolynomialModulo(base, base, polynomial, degree);
+    exponent >>= 1;
+  }
+  return result;
+}
+
+/**
+ * @fn IsPrimitivePolynomial
+ * @brief Judge the polynomial over GF(2) is primitive or not
+ */
+bool IsPrimitivePolynomial(const uint64_t polynomial, const unsigned int degree) {
+  const uint64_t order = (1ull << degree) - 1;
+  if (PowerOfX(order, polynomial, degree) != 1) return false;
+
+  uint64_t remaining = order;
+  for (uint64_t factor = 2; factor * factor <= remaining; factor++) {
+    if (remaining % factor != 0) continue;
+    if (PowerOfX(order / factor, polynomial, degree) == 1) return false;
+    while (remaining % factor == 0) remaining /= factor;
+  }
+  if (remaining > 1) {
+    if (PowerOfX(order / remaining, polynomial, degree) == 1) return false;
+  }
+  return true;
+}
+
+/**
+ * @fn CalcParity
+ * @brief Return parity of the bits
+ */
+uint32_t CalcParity(uint32_t x) {
+  x ^= x >> 16;
+  x ^= x >> 8;
+  x ^= x >> 4;
+  x ^= x >> 2;
+  x ^= x >> 1;
+  return x & 1;
+}
+
+}  // namespace
+
+SobolSequence::SobolSequence(const size_t number_of_dimensions) {
+  const size_t kBits = kNumberOfBits;
+  direction_numbers_.resize(number_of_dimensions);
+  digital_shift_.assign(number_of_dimensions, 0);
+  if (number_of_dimensions == 0) return;
+
+  // First dimension: van der Corput sequence
+  for (size_t k = 0; k < kBits; k++) {
+    direction_numbers_[0][k] = 1u << (kBits - 1 - k);
+  }
+
+  // Fixed seed to generate direction numbers not in the table
+  std::mt19937 direction_number_randomizer(20080101);
+
+  size_t dimension_id = 1;
+  for (unsigned int degree = 1; dimension_id < number_of_dimensions; degree++) {
+    for (uint64_t a = 0; a < (1ull << (degree - 1)) && dimension_id < number_of_dimensions; a++) {
+      const uint64_t polynomial = (1ull << degree) | (a << 1) | 1ull;
+      if (!IsPrimitivePolynomial(polynomial, degree)) continue;
+
+      // Initial direction numbers
+      std::vector<uint32_t> m(degree);
+      if (dimension_id - 1 < kJoeKuoInitialDirectionNumbers.size()) {
+        m = kJoeKuoInitialDirectionNumbers[dimension_id - 1];
+      } else {
+        for (unsigned int k = 0; k < degree; k++) {
+          m[k] = 2 * (direction_number_randomizer() % (1u << k)) + 1;  // Odd number less than 2^(k+1)
+        }
+      }
+
+      // Recurrence of the direction numbers
+      std::array<uint32_t, kNumberOfBits>& v = direction_numbers_[dimension_id];
+      for (size_t k = 0; k < kBits; k++) {
+        if (k < degree) {
+          v[k] = m[k] << (kBits - 1 - k);
+        } else {
+          v[k] = v[k - degree] ^ (v[k - degree] >> degree);
+          for (unsigned int i = 1; i < degree; i++) {
+            if ((a >> (degree - 1 - i)) & 1) v[k] ^= v[k - i];
+          }
+        }
+      }
+      dimension_id++;
+    }
+  }
+}
+
+void SobolSequence::Scramble(const uint32_t seed) {
+  const size_t kBits = kNumberOfBits;
+  std::mt19937 randomizer(seed);
+  for (size_t d = 0; d < direction_numbers_.size(); d++) {
+    // Random lower triangular matrix with unit diagonal. The k-th digit corresponds to the (31 - k)-th bit.
+    std::array<uint32_t, kNumberOfBits> scramble_matrix;
+    for (size_t k = 0; k < kBits; k++) {
+      const uint32_t upper_digit_mask = (k == 0) ? 0u : (0xffffffffu << (kBits - k));
+      scramble_matrix[k] = ((uint32_t)randomizer() & upper_digit_mask) | (1u << (kBits - 1 - k));
+    }
+
+    for (size_t j = 0; j < kBits; j++) {
+      uint32_t scrambled = 0;
+      for (size_t k = 0; k < kBits; k++) {
+        scrambled |= CalcParity(scramble_matrix[k] & direction_numbers_[d][j]) << (kBits - 1 - k);
+      }
+      direction_numbers_[d][j] = scrambled;
+    }
+    digital_shift_[d] = (uint32_t)randomizer();
+  }
+}
+
+double SobolSequence::GetSample(const uint32_t sample_id, const size_t dimension_id) const {
+  if (dimension_id >= direction_numbers_.size()) return 0.5;
+
+  uint32_t x = digital_shift_[dimension_id];
+  uint32_t index = sample_id;
+  for (size_t k = 0; index != 0; k++, index >>= 1) {
+    if (index & 1) x ^= direction_numbers_[dimension_id][k];
+  }
+  // Shift half of the resolution to avoid 0
+  return ((double)x + 0.5) / 4294967296.0;
+}
+
+}  // namespace libra
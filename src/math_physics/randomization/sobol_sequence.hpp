@@ -0,0 +1,63 @@
+/**
+ * @file sobol_sequence.hpp
+ * @brief Class to generate Sobol low-discrepancy sequence
+ * @note Ref: S. Joe and F. Y. Kuo, Constructing Sobol sequences with better two-dimensional projections, SIAM J. Sci. Comput. 30, 2635-2654, 2008.
+ *            J. Matousek, On the L2-discrepancy for anchored boxes, J. Complexity 14, 527-556, 1998.
+ */
+
+#ifndef S2E_LIBRARY_RANDOMIZATION_SOBOL_SEQUENCE_HPP_
+#define S2E_LIBRARY_RANDOMIZATION_SOBOL_SEQUENCE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class SobolSequence
+ * @brief Class to generate Sobol low-discrepancy sequence with the linear matrix scrambling and the digital shift
+ * @note Direction numbers of Joe and Kuo are used up to 21 dimensions. Higher dimensions use deterministic pseudo-random direction numbers.
+ */
+class SobolSequence {
+ public:
+  static const size_t kNumberOfBits = 32;  //!< Number of bits of each sample
+
+  /**
+   * @fn SobolSequence
+   * @brief Constructor without scrambling
+   * @param [in] number_of_dimensions: Number of dimensions
+   */
+  explicit SobolSequence(const size_t number_of_dimensions);
+
+  /**
+   * @fn Scramble
+   * @brief Scramble the sequence with random linear matrix scrambling and digital shift
+   * @param [in] seed: Seed of randomization
+   */
+  void Scramble(const uint32_t seed);
+
+  /**
+   * @fn GetSample
+   * @brief Return sample of the sequence
+   * @param [in] sample_id: Index of the sample
+   * @param [in] dimension_id: Index of the dimension
+   * @return Sample value in (0, 1)
+   */
+  double GetSample(const uint32_t sample_id, const size_t dimension_id) const;
+
+  /**
+   * @fn GetNumberOfDimensions
+   * @brief Return number of dimensions
+   */
+  inline size_t GetNumberOfDimensions() const { return direction_numbers_.size(); }
+
+ private:
+  std::vector<std::array<uint32_t, kNumberOfBits>> direction_numbers_;  //!< Direction numbers of each dimension
+  std::vector<uint32_t> digital_shift_;                                 //!< Digital shift of each dimension
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_RANDOMIZATION_SOBOL_SEQUENCE_HPP_
@@ -0,0 +1,50 @@
+/**
+ * @file test_latin_hypercube_sampling.cpp
+ * @brief Test codes for LatinHypercubeSampling class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "latin_hypercube_sampling.hpp"
+
+/**
+ * @brief Test for stratification of each dimension
+ */
+TEST(LatinHypercubeSampling, Stratification) {
+  const size_t number_of_samples = 100;
+  const size_t number_of_dimensions = 5;
+  libra::LatinHypercubeSampling latin_hypercube(number_of_samples, number_of_dimensions, 42);
+
+  EXPECT_EQ(number_of_samples, latin_hypercube.GetNumberOfSamples());
+  EXPECT_EQ(number_of_dimensions, latin_hypercube.GetNumberOfDimensions());
+  for (size_t d = 0; d < number_of_dimensions; d++) {
+    std::vector<size_t> count(number_of_samples, 0);
+    for (size_t i = 0; i < number_of_samples; i++) {
+      const double sample = latin_hypercube.GetSample(i, d);
+      EXPECT_LT(0.0, sample);
+      EXPECT_GT(1.0, sample);
+      count[(size_t)(sample * number_of_samples)]++;
+    }
+    for (size_t i = 0; i < number_of_samples; i++) {
+      EXPECT_EQ(1, count[i]);
+    }
+  }
+
+  // Out of range
+  EXPECT_DOUBLE_EQ(0.5, latin_hypercube.GetSample(number_of_samples, 0));
+  EXPECT_DOUBLE_EQ(0.5, latin_hypercube.GetSample(0, number_of_dimensions));
+}
+
+/**
+ * @brief Test for reproducibility with the same seed
+ */
+TEST(LatinHypercubeSampling, Reproducibility) {
+  libra::LatinHypercubeSampling latin_hypercube_1(10, 3, 7);
+  libra::LatinHypercubeSampling latin_hypercube_2(10, 3, 7);
+  for (size_t d = 0; d < 3; d++) {
+    for (size_t i = 0; i < 10; i++) {
+      EXPECT_DOUBLE_EQ(latin_hypercube_1.GetSample(i, d), latin_hypercube_2.GetSample(i, d));
+    }
+  }
+}
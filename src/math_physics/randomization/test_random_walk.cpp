@@ -0,0 +1,53 @@
+/**
+ * @file test_random_walk.cpp
+ * @brief Test codes for RandomWalk class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "random_walk.hpp"
+
+/**
+ * @brief Test for resuming from the checkpoint
+ */
+TEST(RandomWalk, ResumeFromCheckpoint) {
+  const libra::Vector<3> standard_deviation(0.1);
+  const libra::Vector<3> limit(1.0);
+  RandomWalk<3> random_walk(0.1, standard_deviation, limit);
+  for (size_t i = 0; i < 100; i++) {
+    ++random_walk;
+  }
+
+  std::stringstream stream;
+  CheckpointWriter writer(stream);
+  random_walk.SaveCheckpoint(writer);
+  EXPECT_TRUE(writer.IsGood());
+
+  // Different seeds and states are overwritten by the checkpoint
+  RandomWalk<3> restored_random_walk(0.1, standard_deviation, limit);
+  CheckpointReader reader(stream);
+  restored_random_walk.LoadCheckpoint(reader);
+  EXPECT_TRUE(reader.IsGood());
+
+  const libra::Vector<3>& state = static_cast<const RandomWalk<3>&>(random_walk).GetState();
+  const libra::Vector<3>& restored_state = static_cast<const RandomWalk<3>&>(restored_random_walk).GetState();
+  for (size_t i = 0; i < 100; i++) {
+    ++random_walk;
+    ++restored_random_walk;
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_EQ(state[j], restored_state[j]);
+    }
+  }
+}
+
+/**
+ * @brief Test for truncated checkpoint
+ */
+TEST(RandomWalk, TruncatedCheckpoint) {
+  std::stringstream stream("short");
+  CheckpointReader reader(stream);
+  RandomWalk<3> random_walk(0.1, libra::Vector<3>(0.1), libra::Vector<3>(1.0));
+  random_walk.LoadCheckpoint(reader);
+  EXPECT_FALSE(reader.IsGood());
+}
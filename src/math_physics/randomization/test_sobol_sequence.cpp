@@ -0,0 +1,74 @@
+/**
+ * @file test_sobol_sequence.cpp
+ * @brief Test codes for SobolSequence class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "sobol_sequence.hpp"
+
+/**
+ * @brief Test for first samples without scrambling
+ */
+TEST(SobolSequence, FirstSamples) {
+  const double accuracy = 1.0e-9;
+  libra::SobolSequence sobol(3);
+
+  EXPECT_EQ(3, sobol.GetNumberOfDimensions());
+  for (size_t d = 0; d < 3; d++) {
+    EXPECT_NEAR(0.0, sobol.GetSample(0, d), accuracy);
+    EXPECT_NEAR(0.5, sobol.GetSample(1, d), accuracy);
+  }
+  EXPECT_NEAR(0.25, sobol.GetSample(2, 0), accuracy);
+  EXPECT_NEAR(0.75, sobol.GetSample(2, 1), accuracy);
+  EXPECT_NEAR(0.75, sobol.GetSample(2, 2), accuracy);
+  EXPECT_NEAR(0.75, sobol.GetSample(3, 0), accuracy);
+  EXPECT_NEAR(0.25, sobol.GetSample(3, 1), accuracy);
+  EXPECT_NEAR(0.25, sobol.GetSample(3, 2), accuracy);
+  EXPECT_NEAR(0.625, sobol.GetSample(6, 2), accuracy);
+}
+
+/**
+ * @brief Test for one dimensional stratification with and without scrambling
+ */
+TEST(SobolSequence, Stratification) {
+  const size_t number_of_dimensions = 40;
+  const size_t number_of_samples = 256;
+  libra::SobolSequence sobol(number_of_dimensions);
+
+  for (size_t scramble = 0; scramble < 2; scramble++) {
+    if (scramble == 1) sobol.Scramble(1234);
+    for (size_t d = 0; d < number_of_dimensions; d++) {
+      std::vector<size_t> count(number_of_samples, 0);
+      for (uint32_t i = 0; i < number_of_samples; i++) {
+        const double sample = sobol.GetSample(i, d);
+        EXPECT_LT(0.0, sample);
+        EXPECT_GT(1.0, sample);
+        count[(size_t)(sample * number_of_samples)]++;
+      }
+      for (size_t i = 0; i < number_of_samples; i++) {
+        EXPECT_EQ(1, count[i]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for two dimensional stratification of the first two dimensions after scrambling
+ */
+TEST(SobolSequence, TwoDimensionalStratification) {
+  const size_t number_of_grids = 16;
+  libra::SobolSequence sobol(2);
+  sobol.Scramble(5678);
+
+  std::vector<size_t> count(number_of_grids * number_of_grids, 0);
+  for (uint32_t i = 0; i < number_of_grids * number_of_grids; i++) {
+    const size_t x = (size_t)(sobol.GetSample(i, 0) * number_of_grids);
+    const size_t y = (size_t)(sobol.GetSample(i, 1) * number_of_grids);
+    count[x * number_of_grids + y]++;
+  }
+  for (size_t i = 0; i < number_of_grids * number_of_grids; i++) {
+    EXPECT_EQ(1, count[i]);
+  }
+}
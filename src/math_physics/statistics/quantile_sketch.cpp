@@ -0,0 +1,72 @@
+/**
+ * @file quantile_sketch.cpp
+ * @brief Mergeable quantile sketch with relative accuracy guarantee
+ */
+
+#include "quantile_sketch.hpp"
+
+#include <cmath>
+
+namespace libra {
+
+QuantileSketch::QuantileSketch(const double relative_accuracy) : relative_accuracy_(relative_accuracy), count_(0), zero_count_(0) {
+  if (relative_accuracy_ <= 0.0 || relative_accuracy_ >= 1.0) relative_accuracy_ = 0.01;
+  log_gamma_ = log((1.0 + relative_accuracy_) / (1.0 - relative_accuracy_));
+}
+
+void QuantileSketch::Add(const double value) {
+  if (std::isnan(value)) return;
+  count_++;
+  if (value > kMinimumIndexableValue) {
+    positive_buckets_[CalcIndex(value)]++;
+  } else if (value < -kMinimumIndexableValue) {
+    negative_buckets_[CalcIndex(-value)]++;
+  } else {
+    zero_count_++;
+  }
+}
+
+void QuantileSketch::Merge(const QuantileSketch& other) {
+  if (other.relative_accuracy_ != relative_accuracy_) return;
+  count_ += other.count_;
+  zero_count_ += other.zero_count_;
+  for (auto bucket : other.positive_buckets_) {
+    positive_buckets_[bucket.first] += bucket.second;
+  }
+  for (auto bucket : other.negative_buckets_) {
+    negative_buckets_[bucket.first] += bucket.second;
+  }
+}
+
+double QuantileSketch::GetQuantile(const double quantile) const {
+  if (count_ == 0) return 0.0;
+  double q = quantile;
+  if (q < 0.0) q = 0.0;
+  if (q > 1.0) q = 1.0;
+  const double rank = q * (double)(count_ - 1);
+
+  // Negative values in ascending order (descending absolute value)
+  double cumulative_count = 0.0;
+  for (auto bucket = negative_buckets_.rbegin(); bucket != negative_buckets_.rend(); ++bucket) {
+    cumulative_count += (double)bucket->second;
+    if (cumulative_count > rank) return -CalcValue(bucket->first);
+  }
+  cumulative_count += (double)zero_count_;
+  if (cumulative_count > rank) return 0.0;
+  for (auto bucket : positive_buckets_) {
+    cumulative_count += (double)bucket.second;
+    if (cumulative_count > rank) return CalcValue(bucket.first);
+  }
+  // Not reached since the total count is larger than the rank
+  return 0.0;
+}
+
+int QuantileSketch::CalcIndex(const double absolute_value) const { return (int)ceil(log(absolute_value) / log_gamma_); }
+
+double QuantileSketch::CalcValue(const int index) const {
+  // Middle of the bucket (gamma^(i-1), gamma^i] in the relative error sense
+  const double gamma = exp(log_gamma_);
+  return 2.0 * pow(gamma, index) / (gamma + 1.0);
+}
+
+}  // namespace libra
@@ -0,0 +1,86 @@
+/**
+ * @file quantile_sketch.hpp
+ * @brief Mergeable quantile sketch with relative accuracy guarantee
+ * @note Ref: C. Masson, J. E. Rim, and H. K. Lee, DDSketch: A Fast and Fully-Mergeable Quantile Sketch with Relative-Error Guarantees, 2019.
+ */
+
+#ifndef S2E_LIBRARY_STATISTICS_QUANTILE_SKETCH_HPP_
+#define S2E_LIBRARY_STATISTICS_QUANTILE_SKETCH_HPP_
+
+#include <cstddef>
+#include <map>
+
+namespace libra {
+
+/**
+ * @class QuantileSketch
+ * @brief Mergeable quantile sketch with relative accuracy guarantee
+ * @details Samples are counted in logarithmically spaced buckets. The estimated quantile has the relative error less than the relative accuracy.
+ */
+class QuantileSketch {
+ public:
+  /**
+   * @fn QuantileSketch
+   * @brief Constructor
+   * @param [in] relative_accuracy: Relative accuracy of the estimated quantile (0, 1)
+   */
+  explicit QuantileSketch(const double relative_accuracy = 0.01);
+
+  /**
+   * @fn Add
+   * @brief Add a sample
+   * @param [in] value: Sample value
+   */
+  void Add(const double value);
+  /**
+   * @fn Merge
+   * @brief Merge other sketch
+   * @note Sketches with different relative accuracy are not merged
+   * @param [in] other: Other sketch
+   */
+  void Merge(const QuantileSketch& other);
+
+  // Getter
+  /**
+   * @fn GetCount
+   * @brief Return number of samples
+   */
+  inline size_t GetCount() const { return count_; }
+  /**
+   * @fn GetRelativeAccuracy
+   * @brief Return relative accuracy
+   */
+  inline double GetRelativeAccuracy() const { return relative_accuracy_; }
+  /**
+   * @fn GetQuantile
+   * @brief Return estimated quantile
+   * @param [in] quantile: Quantile [0, 1]
+   * @return Estimated value. Zero is returned when no sample is added.
+   */
+  double GetQuantile(const double quantile) const;
+
+ private:
+  static constexpr double kMinimumIndexableValue = 1.0e-300;  //!< Absolute values less than this are counted as zero
+
+  double relative_accuracy_;                //!< Relative accuracy
+  double log_gamma_;                        //!< Logarithm of the bucket ratio gamma = (1 + accuracy) / (1 - accuracy)
+  size_t count_;                            //!< Number of samples
+  size_t zero_count_;                       //!< Number of samples counted as zero
+  std::map<int, size_t> positive_buckets_;  //!< Number of positive samples in each bucket
+  std::map<int, size_t> negative_buckets_;  //!< Number of negative samples in each bucket with the index of the absolute value
+
+  /**
+   * @fn CalcIndex
+   * @brief Return bucket index of the absolute value
+   */
+  int CalcIndex(const double absolute_value) const;
+  /**
+   * @fn CalcValue
+   * @brief Return representative absolute value of the bucket
+   */
+  double CalcValue(const int index) const;
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_STATISTICS_QUANTILE_SKETCH_HPP_
@@ -0,0 +1,79 @@
+/**
+ * @file streaming_statistics.cpp
+ * @brief Class to calculate mean and covariance of vector samples in a streaming manner
+ */
+
+#include "streaming_statistics.hpp"
+
+namespace libra {
+
+StreamingStatistics::StreamingStatistics() : count_(0) {}
+
+void StreamingStatistics::Update(const std::vector<double>& sample) {
+  if (count_ == 0) {
+    const size_t dimension = sample.size();
+    mean_.assign(dimension, 0.0);
+    co_moment_.assign(dimension, std::vector<double>(dimension, 0.0));
+    minimum_ = sample;
+    maximum_ = sample;
+  } else if (sample.size() != mean_.size()) {
+    return;
+  }
+
+  count_++;
+  const size_t dimension = mean_.size();
+  std::vector<double> delta_before(dimension);
+  for (size_t i = 0; i < dimension; i++) {
+    delta_before[i] = sample[i] - mean_[i];
+    mean_[i] += delta_before[i] / (double)count_;
+    if (sample[i] < minimum_[i]) minimum_[i] = sample[i];
+    if (sample[i] > maximum_[i]) maximum_[i] = sample[i];
+  }
+  // Welford's update with the deviations before and after the mean update
+  for (size_t i = 0; i < dimension; i++) {
+    for (size_t j = 0; j < dimension; j++) {
+      co_moment_[i][j] += delta_before[i] * (sample[j] - mean_[j]);
+    }
+  }
+}
+
+void StreamingStatistics::Merge(const StreamingStatistics& other) {
+  if (other.count_ == 0) return;
+  if (count_ == 0) {
+    *this = other;
+    return;
+  }
+  if (other.mean_.size() != mean_.size()) return;
+
+  const size_t dimension = mean_.size();
+  const double count_a = (double)count_;
+  const double count_b = (double)other.count_;
+  const double count = count_a + count_b;
+  std::vector<double> delta(dimension);
+  for (size_t i = 0; i < dimension; i++) {
+    delta[i] = other.mean_[i] - mean_[i];
+  }
+  for (size_t i = 0; i < dimension; i++) {
+    for (size_t j = 0; j < dimension; j++) {
+      co_moment_[i][j] += other.co_moment_[i][j] + delta[i] * delta[j] * count_a * count_b / count;
+    }
+    mean_[i] += delta[i] * count_b / count;
+    if (other.minimum_[i] < minimum_[i]) minimum_[i] = other.minimum_[i];
+    if (other.maximum_[i] > maximum_[i]) maximum_[i] = other.maximum_[i];
+  }
+  count_ += other.count_;
+}
+
+std::vector<std::vector<double>> StreamingStatistics::GetCovariance() const {
+  const size_t dimension = mean_.size();
+  std::vector<std::vector<double>> covariance(dimension, std::vector<double>(dimension, 0.0));
+  if (count_ < 2) return covariance;
+  for (size_t i = 0; i < dimension; i++) {
+    for (size_t j = 0; j < dimension; j++) {
+      covariance[i][j] = co_moment_[i][j] / (double)(count_ - 1);
+    }
+  }
+  return covariance;
+}
+
+}  // namespace libra
@@ -0,0 +1,84 @@
+/**
+ * @file streaming_statistics.hpp
+ * @brief Class to calculate mean and covariance of vector samples in a streaming manner
+ * @note Ref: T. F. Chan, G. H. Golub, and R. J. LeVeque, Updating Formulae and a Pairwise Algorithm for Computing Sample Variances, 1979.
+ */
+
+#ifndef S2E_LIBRARY_STATISTICS_STREAMING_STATISTICS_HPP_
+#define S2E_LIBRARY_STATISTICS_STREAMING_STATISTICS_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace libra {
+
+/**
+ * @class StreamingStatistics
+ * @brief Class to calculate mean, covariance, minimum and maximum of vector samples without storing the samples
+ * @details The statistics of two instances can be merged to combine separately executed sample sets.
+ */
+class StreamingStatistics {
+ public:
+  /**
+   * @fn StreamingStatistics
+   * @brief Constructor
+   */
+  StreamingStatistics();
+
+  /**
+   * @fn Update
+   * @brief Add a sample
+   * @note The dimension is fixed by the first sample. Samples with other dimensions are ignored.
+   * @param [in] sample: Sample vector
+   */
+  void Update(const std::vector<double>& sample);
+  /**
+   * @fn Merge
+   * @brief Merge statistics of other sample set
+   * @param [in] other: Statistics of other sample set with the same dimension
+   */
+  void Merge(const StreamingStatistics& other);
+
+  // Getter
+  /**
+   * @fn GetCount
+   * @brief Return number of samples
+   */
+  inline size_t GetCount() const { return count_; }
+  /**
+   * @fn GetDimension
+   * @brief Return dimension of the sample vector
+   */
+  inline size_t GetDimension() const { return mean_.size(); }
+  /**
+   * @fn GetMean
+   * @brief Return mean vector
+   */
+  inline const std::vector<double>& GetMean() const { return mean_; }
+  /**
+   * @fn GetMinimum
+   * @brief Return element-wise minimum
+   */
+  inline const std::vector<double>& GetMinimum() const { return minimum_; }
+  /**
+   * @fn GetMaximum
+   * @brief Return element-wise maximum
+   */
+  inline const std::vector<double>& GetMaximum() const { return maximum_; }
+  /**
+   * @fn GetCovariance
+   * @brief Return unbiased sample covariance matrix. Zero matrix is returned when the number of samples is less than two.
+   */
+  std::vector<std::vector<double>> GetCovariance() const;
+
+ private:
+  size_t count_;                                //!< Number of samples
+  std::vector<double> mean_;                    //!< Mean vector
+  std::vector<std::vector<double>> co_moment_;  //!< Sum of the products of the deviations from the mean
+  std::vector<double> minimum_;                 //!< Element-wise minimum
+  std::vector<double> maximum_;                 //!< Element-wise maximum
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_STATISTICS_STREAMING_STATISTICS_HPP_
@@ -0,0 +1,54 @@
+/**
+ * @file test_quantile_sketch.cpp
+ * @brief Test codes for QuantileSketch class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "quantile_sketch.hpp"
+
+/**
+ * @brief Test for quantiles of uniformly spaced samples
+ */
+TEST(QuantileSketch, Quantile) {
+  const double relative_accuracy = 0.01;
+  libra::QuantileSketch sketch(relative_accuracy);
+
+  // -500, -499, ..., 500
+  for (int i = -500; i <= 500; i++) {
+    sketch.Add((double)i);
+  }
+  EXPECT_EQ(1001, sketch.GetCount());
+  EXPECT_NEAR(0.0, sketch.GetQuantile(0.5), 1.0e-12);
+  EXPECT_NEAR(400.0, sketch.GetQuantile(0.9), 400.0 * relative_accuracy);
+  EXPECT_NEAR(490.0, sketch.GetQuantile(0.99), 490.0 * relative_accuracy);
+  EXPECT_NEAR(-400.0, sketch.GetQuantile(0.1), 400.0 * relative_accuracy);
+  EXPECT_NEAR(500.0, sketch.GetQuantile(1.0), 500.0 * relative_accuracy);
+  EXPECT_NEAR(-500.0, sketch.GetQuantile(0.0), 500.0 * relative_accuracy);
+}
+
+/**
+ * @brief Test for merge of two sketches
+ */
+TEST(QuantileSketch, Merge) {
+  libra::QuantileSketch all, first, second;
+  for (int i = 1; i <= 1000; i++) {
+    all.Add((double)i);
+    if (i % 3 == 0) {
+      first.Add((double)i);
+    } else {
+      second.Add((double)i);
+    }
+  }
+  first.Merge(second);
+
+  EXPECT_EQ(all.GetCount(), first.GetCount());
+  for (double q = 0.0; q <= 1.0; q += 0.05) {
+    EXPECT_DOUBLE_EQ(all.GetQuantile(q), first.GetQuantile(q));
+  }
+
+  // Sketch with different accuracy is not merged
+  libra::QuantileSketch other(0.05);
+  other.Add(1.0);
+  first.Merge(other);
+  EXPECT_EQ(all.GetCount(), first.GetCount());
+}
@@ -0,0 +1,70 @@
+/**
+ * @file test_streaming_statistics.cpp
+ * @brief Test codes for StreamingStatistics class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "streaming_statistics.hpp"
+
+/**
+ * @brief Test for mean, covariance, minimum, and maximum
+ */
+TEST(StreamingStatistics, Update) {
+  const double accuracy = 1.0e-12;
+  libra::StreamingStatistics statistics;
+
+  const std::vector<std::vector<double>> samples = {{1.0, 2.0}, {3.0, 1.0}, {5.0, 6.0}, {-1.0, 3.0}};
+  for (auto sample : samples) {
+    statistics.Update(sample);
+  }
+  // Ignore sample with different dimension
+  statistics.Update(std::vector<double>{1.0});
+
+  EXPECT_EQ(4, statistics.GetCount());
+  EXPECT_EQ(2, statistics.GetDimension());
+  EXPECT_NEAR(2.0, statistics.GetMean()[0], accuracy);
+  EXPECT_NEAR(3.0, statistics.GetMean()[1], accuracy);
+  EXPECT_NEAR(-1.0, statistics.GetMinimum()[0], accuracy);
+  EXPECT_NEAR(6.0, statistics.GetMaximum()[1], accuracy);
+
+  // Unbiased covariance: sum of (x - mean)(y - mean) / (n - 1)
+  const std::vector<std::vector<double>> covariance = statistics.GetCovariance();
+  EXPECT_NEAR(20.0 / 3.0, covariance[0][0], accuracy);
+  EXPECT_NEAR(14.0 / 3.0, covariance[1][1], accuracy);
+  EXPECT_NEAR(8.0 / 3.0, covariance[0][1], accuracy);
+  EXPECT_NEAR(8.0 / 3.0, covariance[1][0], accuracy);
+}
+
+/**
+ * @brief Test for merge of two sample sets
+ */
+TEST(StreamingStatistics, Merge) {
+  const double accuracy = 1.0e-12;
+  libra::StreamingStatistics all, first, second;
+
+  for (size_t i = 0; i < 100; i++) {
+    const std::vector<double> sample{(double)i * 0.1, sin((double)i), (double)(i % 7)};
+    all.Update(sample);
+    if (i < 30) {
+      first.Update(sample);
+    } else {
+      second.Update(sample);
+    }
+  }
+  first.Merge(second);
+
+  EXPECT_EQ(all.GetCount(), first.GetCount());
+  const std::vector<std::vector<double>> covariance_all = all.GetCovariance();
+  const std::vector<std::vector<double>> covariance_merged = first.GetCovariance();
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(all.GetMean()[i], first.GetMean()[i], accuracy);
+    EXPECT_NEAR(all.GetMinimum()[i], first.GetMinimum()[i], accuracy);
+    EXPECT_NEAR(all.GetMaximum()[i], first.GetMaximum()[i], accuracy);
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_NEAR(covariance_all[i][j], covariance_merged[i][j], accuracy);
+    }
+  }
+}
@@ -0,0 +1,235 @@
+/**
+ * @file s2e_throughput.cpp
+ * @brief The main file of the end-to-end throughput benchmark of S2E
+ * @details Usage: S2E_THROUGHPUT [--report <csv file>] [--baseline <csv file>] [--tolerance <ratio>] [simulation base ini files...]
+ *          The benchmark scenarios in INI_FILE_DIR_FROM_EXE/benchmark are executed when no ini file is given. The result of each scenario is written
+ *          in the CSV format. When the baseline file (a report of a previous execution) is given, the program fails when the simulated seconds per
+ *          wall second of a scenario is smaller than (1 - tolerance) times the baseline. The report has the build type and the machine, and the
+ *          baseline recorded with another build type is rejected because the throughput of the debug build is not comparable.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "simulation_sample/case/throughput_benchmark_case.hpp"
+
+/**
+ * @struct ThroughputResult
+ * @brief Result of a benchmark scenario
+ */
+struct ThroughputResult {
+  std::string scenario_name;                                      //!< Name of the scenario
+  size_t number_of_spacecraft;                                    //!< Number of the simulated spacecraft
+  double simulated_time_s;                                        //!< Simulated time [s]
+  double wall_time_s;                                             //!< Wall clock time of the main routine [s]
+  std::vector<std::pair<std::string, double>> subsystem_times_s;  //!< Execution time of each subsystem [s]
+};
+
+/**
+ * @fn GetBuildType
+ * @brief Return the build type (CMake configuration) of the benchmark
+ */
+std::string GetBuildType() {
+  const std::string build_type = S2E_BUILD_TYPE;
+  return build_type.empty() ? "None" : build_type;
+}
+
+/**
+ * @fn GetMachineName
+ * @brief Return the CPU model and the number of hardware threads of the machine
+ */
+std::string GetMachineName() {
+  std::string cpu_model = "unknown CPU";
+  std::ifstream cpu_information("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpu_information, line)) {
+    if (line.rfind("model name", 0) != 0) continue;
+    const size_t separator = line.find(':');
+    if (separator != std::string::npos) cpu_model = line.substr(line.find_first_not_of(' ', separator + 1));
+    break;
+  }
+  std::string machine_name = cpu_model + " x " + std::to_string(std::thread::hardware_concurrency()) + " threads";
+  // The comma is the delimiter of the report
+  for (auto& character : machine_name) {
+    if (character == ',') character = ' ';
+  }
+  return machine_name;
+}
+
+/**
+ * @fn RunScenario
+ * @brief Execute the benchmark scenario and measure the throughput
+ * @param [in] initialize_base_file: Simulation base file of the scenario
+ * @return Result of the scenario
+ */
+ThroughputResult RunScenario(const std::string initialize_base_file) {
+  ThroughputBenchmarkCase simulation_case(initialize_base_file);
+  simulation_case.Initialize();
+
+  // The initialization is excluded from the measurement
+  ExecutionCost::SetAccountingEnabled(true);
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  simulation_case.Main();
+  const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  ExecutionCost::SetAccountingEnabled(false);
+
+  ThroughputResult result;
+  result.scenario_name = simulation_case.GetScenarioName();
+  result.number_of_spacecraft = simulation_case.GetNumberOfSpacecraft();
+  result.simulated_time_s = simulation_case.GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s();
+  result.wall_time_s = std::chrono::duration<double>(end - start).count();
+  result.subsystem_times_s = simulation_case.GetSubsystemTimes_s();
+  return result;
+}
+
+/**
+ * @fn WriteReport
+ * @brief Write the results in the CSV format
+ * @param [in] results: Results of the scenarios
+ * @param [out] stream: Output stream
+ */
+void WriteReport(const std::vector<ThroughputResult>& results, std::ostream& stream) {
+  if (results.empty()) return;
+  stream << "scenario,number_of_spacecraft,simulated_time[s],wall_time[s],simulated_seconds_per_wall_second";
+  for (const auto& subsystem_time_s : results.front().subsystem_times_s) {
+    stream << "," << subsystem_time_s.first << "[s]";
+  }
+  stream << ",build_type,machine" << std::endl;
+  const std::string build_type = GetBuildType();
+  const std::string machine_name = GetMachineName();
+  for (const auto& result : results) {
+    stream << result.scenario_name << "," << result.number_of_spacecraft << "," << result.simulated_time_s << "," << result.wall_time_s << ","
+           << result.simulated_time_s / result.wall_time_s;
+    for (const auto& subsystem_time_s : result.subsystem_times_s) {
+      stream << "," << subsystem_time_s.second;
+    }
+    stream << "," << build_type << "," << machine_name << std::endl;
+  }
+}
+
+/**
+ * @fn ReadBaseline
+ * @brief Read the simulated seconds per wall second of each scenario from the report of a previous execution
+ * @param [in] file_name: Baseline file
+ * @param [out] baseline: Simulated seconds per wall second of each scenario
+ * @param [out] build_type: Build type of the baseline ("None" when the file has no build type)
+ * @return True when the file is read
+ */
+bool ReadBaseline(const std::string file_name, std::map<std::string, double>& baseline, std::string& build_type) {
+  std::ifstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] throughput benchmark: cannot open the baseline file " << file_name << std::endl;
+    return false;
+  }
+
+  std::string line;
+  std::getline(file, line);
+  std::vector<std::string> header;
+  std::stringstream header_stream(line);
+  std::string cell;
+  while (std::getline(header_stream, cell, ',')) header.push_back(cell);
+  size_t speed_column = header.size();
+  size_t build_type_column = header.size();
+  for (size_t i = 0; i < header.size(); i++) {
+    if (header[i] == "simulated_seconds_per_wall_second") speed_column = i;
+    if (header[i] == "build_type") build_type_column = i;
+  }
+  if (header.empty() || header[0] != "scenario" || speed_column == header.size()) {
+    std::cerr << "[WARNING] throughput benchmark: " << file_name << " is not a throughput report." << std::endl;
+    return false;
+  }
+
+  build_type = "None";
+  while (std::getline(file, line)) {
+    std::vector<std::string> cells;
+    std::stringstream line_stream(line);
+    while (std::getline(line_stream, cell, ',')) cells.push_back(cell);
+    if (cells.size() <= speed_column) continue;
+    baseline[cells[0]] = std::stod(cells[speed_column]);
+    if (build_type_column < cells.size()) build_type = cells[build_type_column];
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  std::string report_file;
+  std::string baseline_file;
+  double tolerance = 0.2;
+  std::vector<std::string> ini_files;
+
+  // Parsing arguments
+  for (int i = 1; i < argc; i++) {
+    const std::string argument(argv[i]);
+    if ((argument == "--report" || argument == "--baseline" || argument == "--tolerance") && i + 1 < argc) {
+      const std::string value(argv[++i]);
+      if (argument == "--report") report_file = value;
+      if (argument == "--baseline") baseline_file = value;
+      if (argument == "--tolerance") tolerance = std::stod(value);
+    } else if (argument.rfind("--", 0) == 0) {
+      std::cout << "Usage: S2E_THROUGHPUT [--report <csv file>] [--baseline <csv file>] [--tolerance <ratio>] [simulation base ini files...]"
+                << std::endl;
+      return EXIT_FAILURE;
+    } else {
+      ini_files.push_back(argument);
+    }
+  }
+  if (ini_files.empty()) {
+    const std::string benchmark_path = std::string(INI_FILE_DIR_FROM_EXE) + "/benchmark/";
+    ini_files.push_back(benchmark_path + "two_body_simulation_base.ini");
+    ini_files.push_back(benchmark_path + "full_leo_simulation_base.ini");
+    ini_files.push_back(benchmark_path + "formation_simulation_base.ini");
+    ini_files.push_back(benchmark_path + "thermal_heavy_simulation_base.ini");
+  }
+
+  // Execution
+  std::vector<ThroughputResult> results;
+  for (const auto& ini_file : ini_files) {
+    std::cout << "Starting throughput benchmark: " << ini_file << std::endl;
+    results.push_back(RunScenario(ini_file));
+  }
+
+  // Report
+  std::cout << std::endl;
+  WriteReport(results, std::cout);
+  if (!report_file.empty()) {
+    std::ofstream report(report_file);
+    if (!report.is_open()) {
+      std::cerr << "[WARNING] throughput benchmark: cannot open " << report_file << std::endl;
+    } else {
+      WriteReport(results, report);
+    }
+  }
+
+  // Threshold check
+  if (baseline_file.empty()) return EXIT_SUCCESS;
+  std::map<std::string, double> baseline;
+  std::string baseline_build_type;
+  if (!ReadBaseline(baseline_file, baseline, baseline_build_type)) return EXIT_FAILURE;
+  if (baseline_build_type != GetBuildType()) {
+    std::cerr << "[WARNING] throughput benchmark: the baseline was recorded with the " << baseline_build_type << " build, but this is the "
+              << GetBuildType() << " build. Build with the same type or record a new baseline with --report." << std::endl;
+    return EXIT_FAILURE;
+  }
+  bool is_passed = true;
+  for (const auto& result : results) {
+    const auto baseline_speed = baseline.find(result.scenario_name);
+    if (baseline_speed == baseline.end()) {
+      std::cerr << "[WARNING] throughput benchmark: no baseline for " << result.scenario_name << std::endl;
+      continue;
+    }
+    const double speed = result.simulated_time_s / result.wall_time_s;
+    const double threshold = (1.0 - tolerance) * baseline_speed->second;
+    const bool is_regressed = speed < threshold;
+    std::cout << (is_regressed ? "[REGRESSED] " : "[PASSED] ") << result.scenario_name << ": " << speed << " (threshold " << threshold << ")"
+              << std::endl;
+    if (is_regressed) is_passed = false;
+  }
+  return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -5,9 +5,20 @@
 
 #include "simulation_case.hpp"
 
+#include <cmath>
+#include <fstream>
 #include <logger/initialize_log.hpp>
+#include <math_physics/randomization/global_randomization.hpp>
 #include <setting_file_reader/initialize_file_access.hpp>
 #include <string>
+#include <utilities/allocation_tracker.hpp>
+#include <utilities/execution_cost.hpp>
+#include <utilities/profiler.hpp>
+
+namespace {
+const uint32_t kCheckpointMagicNumber = 0x53324543;  //!< Magic number of the checkpoint file ("S2EC")
+const uint32_t kCheckpointVersion = 3;               //!< Format version of the checkpoint file
+}  // namespace
 
 SimulationCase::SimulationCase(const std::string initialize_base_file) {
   // Initialize Log
@@ -52,23 +63,54 @@ void SimulationCase::Initialize() {
 
 void SimulationCase::Main() {
   global_environment_->Reset();  // for MonteCarlo Simulation
-  while (!global_environment_->GetSimulationTime().GetState().finish) {
+  SimulationTime& simulation_time = global_environment_->GetSimulationTime();
+  if (is_checkpoint_requested_) {
+    // Stop the main loop at the checkpoint save time
+    const int64_t checkpoint_step = (int64_t)ceil(checkpoint_save_time_s_ / simulation_time.GetSimulationStep_s() - 1.0e-9);
+    simulation_time.GetEventScheduler().AddWakeUpEvent(checkpoint_step);
+  }
+  while (!simulation_time.GetState().finish) {
+    // Checkpoint
+    if (is_checkpoint_requested_ && simulation_time.GetElapsedTime_s() >= checkpoint_save_time_s_) {
+      SaveCheckpoint(checkpoint_file_name_);
+      is_checkpoint_requested_ = false;
+    }
+
     // Logging
-    if (global_environment_->GetSimulationTime().GetState().log_output) {
+    if (simulation_time.GetState().log_output) {
+      ScopedExecutionCost scoped_cost(logging_cost_);
       simulation_configuration_.main_logger_->WriteValues();
     }
 
     // Global Environment Update
-    global_environment_->Update();
+    {
+      ScopedExecutionCost scoped_cost(global_environment_cost_);
+      global_environment_->Update();
+    }
 
     // Target Objects Update
-    UpdateTargetObjects();
+    {
+      ScopedExecutionCost scoped_cost(target_objects_cost_);
+      UpdateTargetObjects();
+    }
+
+    // User events
+    simulation_time.GetEventScheduler().Execute(simulation_time.GetStepCount());
 
     // Debug output
-    if (global_environment_->GetSimulationTime().GetState().disp_output) {
-      std::cout << "Progress: " << global_environment_->GetSimulationTime().GetProgressionRate() << "%\r";
+    if (simulation_time.GetState().disp_output) {
+      std::cout << "Progress: " << simulation_time.GetProgressionRate() << "%\r";
     }
   }
+
+#ifdef USE_PROFILER
+  const std::string log_path = simulation_configuration_.main_logger_->GetLogPath();
+  Profiler::GetInstance().WriteChromeTrace(log_path + "profile_trace.json");
+  Profiler::GetInstance().WriteSummary(log_path + "profile_summary.csv");
+#endif
+#ifdef USE_ALLOCATION_TRACKER
+  AllocationTracker::WriteSummary(simulation_configuration_.main_logger_->GetLogPath() + "allocation_summary.csv");
+#endif
 }
 
 std::string SimulationCase::GetLogHeader() const {
@@ -83,6 +125,62 @@ std::string SimulationCase::GetLogValue() const {
   return str_tmp;
 }
 
+bool SimulationCase::SaveCheckpoint(const std::string file_name) const {
+  std::ofstream file(file_name, std::ios::binary);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] checkpoint: cannot open " << file_name << std::endl;
+    return false;
+  }
+
+  CheckpointWriter writer(file);
+  writer.Write(kCheckpointMagicNumber);
+  writer.Write(kCheckpointVersion);
+  writer.Write(global_randomization);
+  global_environment_->SaveCheckpoint(writer);
+  SaveCheckpointTargetObjects(writer);
+
+  if (!writer.IsGood()) {
+    std::cerr << "[WARNING] checkpoint: failed to write " << file_name << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool SimulationCase::LoadCheckpoint(const std::string file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] checkpoint: cannot open " << file_name << std::endl;
+    return false;
+  }
+
+  CheckpointReader reader(file);
+  uint32_t magic_number = 0;
+  uint32_t version = 0;
+  reader.Read(magic_number);
+  reader.Read(version);
+  if (!reader.IsGood() || magic_number != kCheckpointMagicNumber || version != kCheckpointVersion) {
+    std::cerr << "[WARNING] checkpoint: " << file_name << " is not a supported checkpoint file." << std::endl;
+    return false;
+  }
+
+  reader.Read(global_randomization);
+  global_environment_->LoadCheckpoint(reader);
+  LoadCheckpointTargetObjects(reader);
+
+  if (!reader.IsGood()) {
+    std::cerr << "[WARNING] checkpoint: " << file_name
+              << " is truncated or does not match the current configuration. The simulation state is inconsistent." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void SimulationCase::SetCheckpointSaveTime(const double save_time_s, const std::string file_name) {
+  is_checkpoint_requested_ = true;
+  checkpoint_save_time_s_ = save_time_s;
+  checkpoint_file_name_ = file_name;
+}
+
 void SimulationCase::InitializeSimulationConfiguration(const std::string initialize_base_file) {
   // Initialize
   IniAccess simulation_base_ini = IniAccess(initialize_base_file);
@@ -101,6 +199,18 @@ void SimulationCase::InitializeSimulationConfiguration(const std::string initial
   simulation_configuration_.inter_sc_communication_file_ = simulation_base_ini.ReadString(section, "inter_sat_comm_file");
   simulation_configuration_.gnss_file_ = simulation_base_ini.ReadString(section, "gnss_file");
 
+  // Execution cost accounting
+  simulation_configuration_.is_execution_cost_accounting_enabled_ = simulation_base_ini.ReadEnable(section, "execution_cost_accounting");
+  if (simulation_configuration_.is_execution_cost_accounting_enabled_) {
+    double budget_ratio = simulation_base_ini.ReadDouble(section, "execution_cost_budget_ratio");
+    if (budget_ratio <= 0.0) {
+      std::cerr << "[WARNING] execution cost: the budget ratio must be positive. The ratio is set as 1.0." << std::endl;
+      budget_ratio = 1.0;
+    }
+    simulation_configuration_.execution_cost_budget_ratio_ = budget_ratio;
+  }
+  ExecutionCost::SetAccountingEnabled(simulation_configuration_.is_execution_cost_accounting_enabled_);
+
   // Global Environment
   global_environment_ = new GlobalEnvironment(&simulation_configuration_);
   global_environment_->LogSetup(*(simulation_configuration_.main_logger_));
@@ -9,6 +9,9 @@
 #include <environment/global/global_environment.hpp>
 #include <logger/loggable.hpp>
 #include <simulation/monte_carlo_simulation/monte_carlo_simulation_executor.hpp>
+#include <utilities/checkpoint.hpp>
+#include <utilities/execution_cost.hpp>
+#include <utilities/macros.hpp>
 
 #include "../simulation_configuration.hpp"
 class Logger;
@@ -62,6 +65,31 @@ class SimulationCase : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Checkpoint
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the current simulation state into a binary checkpoint file
+   * @note The checkpoint is taken at the top of the main loop, so call this function before the first step or use SetCheckpointSaveTime
+   * @param [in] file_name: Path of the checkpoint file
+   * @return True when the checkpoint is written successfully
+   */
+  bool SaveCheckpoint(const std::string file_name) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the simulation state from a binary checkpoint file
+   * @note Call this function after Initialize with the same initialize files as the saved simulation. Main resumes from the restored time.
+   * @param [in] file_name: Path of the checkpoint file
+   * @return True when the checkpoint is read successfully
+   */
+  bool LoadCheckpoint(const std::string file_name);
+  /**
+   * @fn SetCheckpointSaveTime
+   * @brief Request to save the checkpoint in the main routine
+   * @param [in] save_time_s: Elapsed time to save the checkpoint [sec]
+   * @param [in] file_name: Path of the checkpoint file
+   */
+  void SetCheckpointSaveTime(const double save_time_s, const std::string file_name);
+
   // Getter
   /**
    * @fn GetSimulationConfiguration
@@ -73,11 +101,34 @@ class SimulationCase : public ILoggable {
    * @brief Return global environment
    */
   inline const GlobalEnvironment& GetGlobalEnvironment() const { return *global_environment_; }
+  /**
+   * @fn GetGlobalEnvironmentCost
+   * @brief Return measured execution cost of the global environment update in the main routine
+   */
+  inline const ExecutionCost& GetGlobalEnvironmentCost() const { return global_environment_cost_; }
+  /**
+   * @fn GetTargetObjectsCost
+   * @brief Return measured execution cost of the target objects update in the main routine
+   */
+  inline const ExecutionCost& GetTargetObjectsCost() const { return target_objects_cost_; }
+  /**
+   * @fn GetLoggingCost
+   * @brief Return measured execution cost of the log output in the main routine
+   */
+  inline const ExecutionCost& GetLoggingCost() const { return logging_cost_; }
 
  protected:
   SimulationConfiguration simulation_configuration_;  //!< Simulation setting
   GlobalEnvironment* global_environment_;             //!< Global Environment
 
+  bool is_checkpoint_requested_ = false;  //!< Flag to save the checkpoint in the main routine
+  double checkpoint_save_time_s_ = 0.0;   //!< Elapsed time to save the checkpoint [sec]
+  std::string checkpoint_file_name_;      //!< Path of the checkpoint file
+
+  ExecutionCost global_environment_cost_;  //!< Execution cost of the global environment update
+  ExecutionCost target_objects_cost_;      //!< Execution cost of the target objects update
+  ExecutionCost logging_cost_;             //!< Execution cost of the log output
+
   /**
    * @fn InitializeSimulationConfiguration
    * @brief Initialize simulation configuration
@@ -96,6 +147,19 @@ class SimulationCase : public ILoggable {
    * @brief Virtual function to update target objects(spacecraft and ground station)
    */
   virtual void UpdateTargetObjects() = 0;
+
+  /**
+   * @fn SaveCheckpointTargetObjects
+   * @brief Virtual function to write the state of target objects(spacecraft and ground station) into the checkpoint
+   * @details Users need to override this function to save the state of target objects
+   */
+  virtual void SaveCheckpointTargetObjects(CheckpointWriter& writer) const { UNUSED(writer); }
+  /**
+   * @fn LoadCheckpointTargetObjects
+   * @brief Virtual function to restore the state of target objects(spacecraft and ground station) from the checkpoint
+   * @details Users need to override this function to restore the state of target objects with the same order as SaveCheckpointTargetObjects
+   */
+  virtual void LoadCheckpointTargetObjects(CheckpointReader& reader) { UNUSED(reader); }
 };
 
 #endif  // S2E_SIMULATION_CASE_SIMULATION_CASE_HPP_
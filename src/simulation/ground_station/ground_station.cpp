@@ -90,3 +90,17 @@ std::string GroundStation::GetLogValue() const {
   str_tmp += WriteVector(position_i_m_);
   return str_tmp;
 }
+
+void GroundStation::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(position_i_m_);
+  for (unsigned int i = 0; i < number_of_spacecraft_; i++) {
+    writer.Write(is_visible_.at(i));
+  }
+}
+
+void GroundStation::LoadCheckpoint(CheckpointReader& reader) {
+  reader.Read(position_i_m_);
+  for (unsigned int i = 0; i < number_of_spacecraft_; i++) {
+    reader.Read(is_visible_[i]);
+  }
+}
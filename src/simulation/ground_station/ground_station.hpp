@@ -9,6 +9,7 @@
 #include <math_physics/geodesy/geodetic_position.hpp>
 #include <math_physics/math/vector.hpp>
 #include <simulation/spacecraft/spacecraft.hpp>
+#include <utilities/checkpoint.hpp>
 
 #include "../simulation_configuration.hpp"
 
@@ -16,7 +17,7 @@
  * @class GroundStation
  * @brief Base class of ground station
  */
-class GroundStation : public ILoggable {
+class GroundStation : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn GroundStation
@@ -57,6 +58,18 @@ class GroundStation : public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   // Getters
   /**
    * @fn GetGroundStationId
@@ -5,7 +5,9 @@
 
 #include "initialize_monte_carlo_parameters.hpp"
 
+#include <cmath>
 #include <math_physics/math/constants.hpp>
+#include <math_physics/math/s2e_math.hpp>
 
 using namespace std;
 
@@ -13,6 +15,13 @@ random_device InitializedMonteCarloParameters::randomizer_;
 mt19937 InitializedMonteCarloParameters::mt_;
 uniform_real_distribution<>* InitializedMonteCarloParameters::uniform_distribution_;
 normal_distribution<>* InitializedMonteCarloParameters::normal_distribution_;
+InitializedMonteCarloParameters::SamplingMethod InitializedMonteCarloParameters::sampling_method_ = kPseudoRandom;
+size_t InitializedMonteCarloParameters::number_of_samples_ = 0;
+size_t InitializedMonteCarloParameters::number_of_sampling_dimensions_ = 0;
+size_t InitializedMonteCarloParameters::sample_id_ = 0;
+size_t InitializedMonteCarloParameters::sampling_dimension_id_ = 0;
+libra::SobolSequence* InitializedMonteCarloParameters::sobol_sequence_ = nullptr;
+libra::LatinHypercubeSampling* InitializedMonteCarloParameters::latin_hypercube_sampling_ = nullptr;
 
 InitializedMonteCarloParameters::InitializedMonteCarloParameters() {
   // Generate object when the first execution
@@ -26,6 +35,7 @@ InitializedMonteCarloParameters::InitializedMonteCarloParameters() {
 
   // No randomization when SetRandomConfiguration is not called（No setting in MCSim.ini）
   randomization_type_ = kNoRandomization;
+  sampling_dimension_offset_ = 0;
 }
 
 void InitializedMonteCarloParameters::SetSeed(unsigned long seed, bool is_deterministic) {
@@ -34,10 +44,58 @@ void InitializedMonteCarloParameters::SetSeed(unsigned long seed, bool is_determ
   } else {
     InitializedMonteCarloParameters::mt_.seed(InitializedMonteCarloParameters::randomizer_());
   }
+  // Scramble the quasi-random samples with the new seed
+  InitializeSampler();
+}
+
+void InitializedMonteCarloParameters::SetSamplingMethod(const SamplingMethod sampling_method, const size_t number_of_samples,
+                                                        const size_t number_of_dimensions) {
+  sampling_method_ = sampling_method;
+  number_of_samples_ = number_of_samples;
+  number_of_sampling_dimensions_ = number_of_dimensions;
+  InitializeSampler();
+}
+
+void InitializedMonteCarloParameters::InitializeSampler() {
+  delete sobol_sequence_;
+  sobol_sequence_ = nullptr;
+  delete latin_hypercube_sampling_;
+  latin_hypercube_sampling_ = nullptr;
+
+  switch (sampling_method_) {
+    case kSobolSequence:
+      sobol_sequence_ = new libra::SobolSequence(number_of_sampling_dimensions_);
+      sobol_sequence_->Scramble((uint32_t)InitializedMonteCarloParameters::mt_());
+      break;
+    case kLatinHypercube:
+      latin_hypercube_sampling_ =
+          new libra::LatinHypercubeSampling(number_of_samples_, number_of_sampling_dimensions_, (uint32_t)InitializedMonteCarloParameters::mt_());
+      break;
+    default:
+      break;
+  }
+}
+
+size_t InitializedMonteCarloParameters::GetNumberOfSamplingDimensions() const {
+  switch (randomization_type_) {
+    case kCartesianUniform:
+    case kCartesianNormal:
+      return mean_or_min_.size();
+    case kCircularNormalUniform:
+    case kCircularNormalNormal:
+      return 2;
+    case kSphericalNormalUniformUniform:
+    case kSphericalNormalNormal:
+    case kQuaternionUniform:
+    case kQuaternionNormal:
+      return 3;
+    default:
+      return 0;
+  }
 }
 
 void InitializedMonteCarloParameters::GetRandomizedScalar(double& destination) const {
-  if (randomization_type_ == kNoRandomization) {
+  if (randomization_type_ == kNoRandomization || randomized_value_.empty()) {
     ;
   } else if (1 > randomized_value_.size()) {
     throw "Too few randomization configuration parameters.";
@@ -47,7 +105,7 @@ void InitializedMonteCarloParameters::GetRandomizedScalar(double& destination) c
 }
 
 void InitializedMonteCarloParameters::GetRandomizedQuaternion(libra::Quaternion& destination) const {
-  if (randomization_type_ == kNoRandomization) {
+  if (randomization_type_ == kNoRandomization || randomized_value_.empty()) {
     ;
   } else if (4 > randomized_value_.size()) {
     throw "Too few randomization configuration parameters.";
@@ -61,6 +119,7 @@ void InitializedMonteCarloParameters::GetRandomizedQuaternion(libra::Quaternion&
 }
 
 void InitializedMonteCarloParameters::Randomize() {
+  sampling_dimension_id_ = sampling_dimension_offset_;
   switch (randomization_type_) {
     case kNoRandomization:
       GenerateNoRandomization();
@@ -94,11 +153,89 @@ void InitializedMonteCarloParameters::Randomize() {
   }
 }
 
+size_t InitializedMonteCarloParameters::GetNumberOfSigmaPointDimensions() const {
+  size_t number_of_dimensions = 0;
+  switch (randomization_type_) {
+    case kCartesianNormal:
+      for (size_t i = 0; i < mean_or_min_.size() && i < sigma_or_max_.size(); i++) {
+        if (sigma_or_max_[i] > 0.0) number_of_dimensions++;
+      }
+      break;
+    case kQuaternionNormal:
+      if (sigma_or_max_.size() > 0 && sigma_or_max_[0] > 0.0) number_of_dimensions = 3;
+      break;
+    default:
+      break;
+  }
+  return number_of_dimensions;
+}
+
+void InitializedMonteCarloParameters::GenerateSigmaPoint(const size_t dimension_id, const double scaled_offset) {
+  randomized_value_.clear();
+  switch (randomization_type_) {
+    case kCartesianNormal: {
+      size_t uncertain_dimension_id = 0;
+      for (size_t i = 0; i < mean_or_min_.size(); i++) {
+        double value = mean_or_min_[i];
+        if (i < sigma_or_max_.size() && sigma_or_max_[i] > 0.0) {
+          if (uncertain_dimension_id == dimension_id) value += scaled_offset * sigma_or_max_[i];
+          uncertain_dimension_id++;
+        }
+        randomized_value_.push_back(value);
+      }
+      break;
+    }
+    case kQuaternionNormal: {
+      // Rotation around each axis of the default frame
+      // The random sampling rotates around a uniformly distributed axis with θ ~ N(0, σ), so the variance of the rotation vector on each axis is
+      // σ^2 / 3. The sigma points are scaled to propagate the same covariance.
+      libra::Vector<3> rotation_axis(0.0);
+      double rotation_angle_rad = 0.0;
+      if (dimension_id < 3 && sigma_or_max_.size() > 0) {
+        rotation_axis[dimension_id] = 1.0;
+        rotation_angle_rad = scaled_offset * sigma_or_max_[0] / sqrt(3.0);
+      } else {
+        rotation_axis[0] = 1.0;
+      }
+      libra::Quaternion temp_q(rotation_axis, rotation_angle_rad);
+      for (size_t i = 0; i < 4; i++) {
+        randomized_value_.push_back(temp_q[i]);
+      }
+      break;
+    }
+    default:
+      // Distributions without the sigma point support output the default value
+      GenerateNoRandomization();
+      break;
+  }
+}
+
+double InitializedMonteCarloParameters::GenerateUniformSample() {
+  if (sampling_dimension_id_ < number_of_sampling_dimensions_) {
+    const size_t dimension_id = sampling_dimension_id_++;
+    if (sobol_sequence_ != nullptr) {
+      return sobol_sequence_->GetSample((uint32_t)sample_id_, dimension_id);
+    } else if (latin_hypercube_sampling_ != nullptr && sample_id_ < latin_hypercube_sampling_->GetNumberOfSamples()) {
+      return latin_hypercube_sampling_->GetSample(sample_id_, dimension_id);
+    }
+  }
+  // Redraw the boundary of the range since the inverse cumulative distribution function diverges at 0
+  double sample = 0.0;
+  while (sample <= 0.0 || sample >= 1.0) {
+    sample = (*InitializedMonteCarloParameters::uniform_distribution_)(InitializedMonteCarloParameters::mt_);
+  }
+  return sample;
+}
+
 double InitializedMonteCarloParameters::Generate1dUniform(double lb, double ub) {
-  return lb + (*InitializedMonteCarloParameters::uniform_distribution_)(InitializedMonteCarloParameters::mt_) * (ub - lb);
+  return lb + InitializedMonteCarloParameters::GenerateUniformSample() * (ub - lb);
 }
 
 double InitializedMonteCarloParameters::Generate1dNormal(double mean, double std) {
+  if (sampling_method_ != kPseudoRandom) {
+    // Map the quasi-random uniform sample through the inverse cumulative distribution function
+    return mean + libra::CalcInverseStandardNormalCdf(InitializedMonteCarloParameters::GenerateUniformSample()) * (std);
+  }
   return mean + (*InitializedMonteCarloParameters::normal_distribution_)(InitializedMonteCarloParameters::mt_) * (std);
 }
 
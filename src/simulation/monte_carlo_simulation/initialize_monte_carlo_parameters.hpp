@@ -9,6 +9,8 @@
 #include <cmath>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/math/vector.hpp>
+#include <math_physics/randomization/latin_hypercube_sampling.hpp>
+#include <math_physics/randomization/sobol_sequence.hpp>
 #include <random>
 #include <string>
 #include <vector>
@@ -35,6 +37,16 @@ class InitializedMonteCarloParameters {
     kQuaternionNormal,               //!< Angle from the default quaternion θ follows normal distribution
   };
 
+  /**
+   * @enum SamplingMethod
+   * @brief Generation method of the uniform samples used in all randomization types
+   */
+  enum SamplingMethod {
+    kPseudoRandom,    //!< Pseudo-random numbers of the Mersenne twister
+    kSobolSequence,   //!< Scrambled Sobol low-discrepancy sequence
+    kLatinHypercube,  //!< Latin hypercube sampling
+  };
+
   /**
    * @fn InitializedMonteCarloParameters
    * @brief Constructor
@@ -47,6 +59,24 @@ class InitializedMonteCarloParameters {
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
    */
   static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  /**
+   * @fn SetSamplingMethod
+   * @brief Set generation method of the uniform samples
+   * @param [in] sampling_method: Sampling method
+   * @param [in] number_of_samples: Number of samples (cases) in the campaign
+   * @param [in] number_of_dimensions: Total number of sampling dimensions of all parameters
+   */
+  static void SetSamplingMethod(const SamplingMethod sampling_method, const size_t number_of_samples, const size_t number_of_dimensions);
+  /**
+   * @fn SetSampleId
+   * @brief Set index of the sample used in the next randomization
+   */
+  static inline void SetSampleId(const size_t sample_id) { sample_id_ = sample_id; }
+  /**
+   * @fn SetSamplingDimensionOffset
+   * @brief Set index of the first sampling dimension used by this parameter
+   */
+  inline void SetSamplingDimensionOffset(const size_t sampling_dimension_offset) { sampling_dimension_offset_ = sampling_dimension_offset; }
   /**
    * @fn SetRandomConfiguration
    * @brief Set randomization parameters
@@ -72,6 +102,17 @@ class InitializedMonteCarloParameters {
    * @brief Get randomized value results
    */
   void GetRandomizedScalar(double& destination) const;
+  /**
+   * @fn GetNumberOfSigmaPointDimensions
+   * @brief Return number of uncertain dimensions handled by the sigma point generation
+   * @note CartesianNormal: elements with positive sigma, QuaternionNormal: three rotation angles, Others: zero
+   */
+  size_t GetNumberOfSigmaPointDimensions() const;
+  /**
+   * @fn GetNumberOfSamplingDimensions
+   * @brief Return number of uniform samples used in one randomization
+   */
+  size_t GetNumberOfSamplingDimensions() const;
 
   // Calculation
   /**
@@ -79,12 +120,22 @@ class InitializedMonteCarloParameters {
    * @brief Randomize values with randomization parameters
    */
   void Randomize();
+  /**
+   * @fn GenerateSigmaPoint
+   * @brief Generate deterministic value shifted from the mean value along one uncertain dimension
+   * @param [in] dimension_id: Index of the shifted dimension. The mean value is generated when it is out of the range.
+   * @param [in] scaled_offset: Offset normalized by the standard deviation
+   * @note Parameters with other randomization types keep the default value of the destination.
+   *       QuaternionNormal is shifted by the rotation angle σ/√3 around each axis to match the covariance of the random sampling.
+   */
+  void GenerateSigmaPoint(const size_t dimension_id, const double scaled_offset);
 
  private:
   std::vector<double> randomized_value_;  //!< Randomized value
 
   std::vector<double> mean_or_min_;   //!< mean or minimum value. Refer comment in Generate[RandomizationType] function.
   std::vector<double> sigma_or_max_;  //!< standard deviation or maximum value. Refer comment in Generate[RandomizationType] function.
+  size_t sampling_dimension_offset_;  //!< Index of the first sampling dimension used by this parameter
 
   // For randomization
   RandomizationType randomization_type_;                           //!< Randomization type
@@ -93,6 +144,26 @@ class InitializedMonteCarloParameters {
   static std::uniform_real_distribution<>* uniform_distribution_;  //!< Uniform random number generator
   static std::normal_distribution<>* normal_distribution_;         //!< Normal random number generator
 
+  // For quasi-random sampling
+  static SamplingMethod sampling_method_;                           //!< Generation method of the uniform samples
+  static size_t number_of_samples_;                                 //!< Number of samples in the campaign
+  static size_t number_of_sampling_dimensions_;                     //!< Total number of sampling dimensions
+  static size_t sample_id_;                                         //!< Index of the current sample
+  static size_t sampling_dimension_id_;                             //!< Index of the next sampling dimension
+  static libra::SobolSequence* sobol_sequence_;                     //!< Sobol sequence generator
+  static libra::LatinHypercubeSampling* latin_hypercube_sampling_;  //!< Latin hypercube sample generator
+
+  /**
+   * @fn InitializeSampler
+   * @brief Generate quasi-random sample generator with the seed from the deterministic random number generator
+   */
+  static void InitializeSampler();
+  /**
+   * @fn GenerateUniformSample
+   * @brief Generate uniform sample in (0, 1) with the selected sampling method
+   */
+  static double GenerateUniformSample();
+
   /**
    * @fn Generate1dUniform
    * @brief Generate 1-dimensional uniform distribution random number
@@ -221,7 +292,7 @@ void InitializedMonteCarloParameters::SetRandomConfiguration(const libra::Vector
 
 template <size_t NumElement>
 void InitializedMonteCarloParameters::GetRandomizedVector(libra::Vector<NumElement>& destination) const {
-  if (randomization_type_ == kNoRandomization) {
+  if (randomization_type_ == kNoRandomization || randomized_value_.empty()) {
     ;
   } else if (NumElement > randomized_value_.size()) {
     throw "Too few randomization configuration parameters.";
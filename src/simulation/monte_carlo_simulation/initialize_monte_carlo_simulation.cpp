@@ -91,5 +91,48 @@ MonteCarloSimulationExecutor* InitMonteCarloSimulation(std::string file_name) {
     monte_carlo_simulator->AddInitializedMonteCarloParameter(so_str, ip_str, mean_or_min, sigma_or_max, random_type);
   }
 
+  // Dispersion mode
+  section = "MONTE_CARLO_EXECUTION";
+  const std::string dispersion_mode = ini_file.ReadString(section, "dispersion_mode");
+  if (dispersion_mode == "UNSCENTED_TRANSFORM") {
+    const double alpha = ini_file.ReadDouble(section, "unscented_transform_alpha");
+    const double beta = ini_file.ReadDouble(section, "unscented_transform_beta");
+    const double kappa = ini_file.ReadDouble(section, "unscented_transform_kappa");
+    monte_carlo_simulator->SetUnscentedTransformMode(alpha, beta, kappa);
+  } else {
+    const std::string sampling_method = ini_file.ReadString(section, "sampling_method");
+    if (sampling_method == "SOBOL_SEQUENCE") {
+      monte_carlo_simulator->SetSamplingMethod(InitializedMonteCarloParameters::kSobolSequence);
+    } else if (sampling_method == "LATIN_HYPERCUBE") {
+      monte_carlo_simulator->SetSamplingMethod(InitializedMonteCarloParameters::kLatinHypercube);
+    } else {
+      monte_carlo_simulator->SetSamplingMethod(InitializedMonteCarloParameters::kPseudoRandom);
+    }
+  }
+
+  // Streaming statistics channels
+  section = "MONTE_CARLO_STATISTICS";
+  std::vector<std::string> channel_names = ini_file.ReadStrVector(section, "channel");
+  for (auto channel_name : channel_names) {
+    std::string key_name = channel_name + MonteCarloSimulationExecutor::separator_ + "reduction";
+    std::vector<MonteCarloStatistics::ReductionType> reductions;
+    for (auto reduction : ini_file.ReadStrVector(section, key_name.c_str())) {
+      if (reduction == "FINAL_VALUE")
+        reductions.push_back(MonteCarloStatistics::kFinalValue);
+      else if (reduction == "MAXIMUM")
+        reductions.push_back(MonteCarloStatistics::kMaximum);
+      else if (reduction == "MINIMUM")
+        reductions.push_back(MonteCarloStatistics::kMinimum);
+    }
+
+    key_name = channel_name + MonteCarloSimulationExecutor::separator_ + "epoch_s";
+    std::vector<double> epochs_s;
+    for (auto epoch_s : ini_file.ReadStrVector(section, key_name.c_str())) {
+      epochs_s.push_back(std::stod(epoch_s));
+    }
+
+    monte_carlo_simulator->AddStatisticsChannel(channel_name, reductions, epochs_s);
+  }
+
   return monte_carlo_simulator;
 }
@@ -5,6 +5,8 @@
 
 #include "monte_carlo_simulation_executor.hpp"
 
+#include <iostream>
+
 using std::string;
 
 MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long total_num_of_executions)
@@ -12,6 +14,7 @@ MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long to
   number_of_executions_done_ = 0;
   enabled_ = total_number_of_executions_ > 1 ? true : false;
   save_log_history_flag_ = !enabled_;
+  dispersion_mode_ = kRandomSampling;
 }
 
 bool MonteCarloSimulationExecutor::WillExecuteNextCase() {
@@ -28,7 +31,8 @@ void MonteCarloSimulationExecutor::AtTheBeginningOfEachCase() {
 }
 
 void MonteCarloSimulationExecutor::AtTheEndOfEachCase() {
-  // Write CSV output of the simulation results
+  // Accumulate the simulation results into the streaming statistics
+  statistics_.FinishCase();
   number_of_executions_done_++;
 }
 
@@ -61,11 +65,77 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterQuaternion(s
 }
 
 void MonteCarloSimulationExecutor::RandomizeAllParameters() {
+  if (dispersion_mode_ == kUnscentedTransform) {
+    // Shift only one uncertain dimension of all parameters for each sigma point
+    const size_t sigma_point_id = (size_t)number_of_executions_done_;
+    const size_t shifted_dimension = unscented_transform_.GetShiftedDimension(sigma_point_id);
+    const double scaled_offset = unscented_transform_.GetScaledOffset(sigma_point_id);
+    size_t dimension_offset = 0;
+    for (auto ip : init_parameter_list_) {
+      const size_t number_of_dimensions = ip.second->GetNumberOfSigmaPointDimensions();
+      if (shifted_dimension >= dimension_offset && shifted_dimension < dimension_offset + number_of_dimensions) {
+        ip.second->GenerateSigmaPoint(shifted_dimension - dimension_offset, scaled_offset);
+      } else {
+        ip.second->GenerateSigmaPoint(number_of_dimensions, 0.0);
+      }
+      dimension_offset += number_of_dimensions;
+    }
+    return;
+  }
+
+  InitializedMonteCarloParameters::SetSampleId((size_t)number_of_executions_done_);
   for (auto ip : init_parameter_list_) {
     ip.second->Randomize();
   }
 }
 
+void MonteCarloSimulationExecutor::SetSamplingMethod(const InitializedMonteCarloParameters::SamplingMethod sampling_method) {
+  // Assign independent sampling dimensions to each parameter
+  size_t number_of_dimensions = 0;
+  for (auto ip : init_parameter_list_) {
+    ip.second->SetSamplingDimensionOffset(number_of_dimensions);
+    number_of_dimensions += ip.second->GetNumberOfSamplingDimensions();
+  }
+  InitializedMonteCarloParameters::SetSamplingMethod(sampling_method, (size_t)total_number_of_executions_, number_of_dimensions);
+}
+
+void MonteCarloSimulationExecutor::SetUnscentedTransformMode(const double alpha, const double beta, const double kappa) {
+  size_t number_of_dimensions = 0;
+  for (auto ip : init_parameter_list_) {
+    const size_t ip_dimensions = ip.second->GetNumberOfSigmaPointDimensions();
+    if (ip_dimensions == 0) {
+      std::cerr << "[WARNING] Monte-Carlo simulation: " << ip.first
+                << " is not normal distributed and the default value is used in the unscented transform mode." << std::endl;
+    }
+    number_of_dimensions += ip_dimensions;
+  }
+
+  dispersion_mode_ = kUnscentedTransform;
+  unscented_transform_ = UnscentedTransform(alpha, beta, kappa);
+  unscented_transform_.SetNumberOfDimensions(number_of_dimensions);
+  total_number_of_executions_ = unscented_transform_.GetNumberOfSigmaPoints();
+}
+
+void MonteCarloSimulationExecutor::SetDispersionOutput(const string name, const double value) {
+  if (!enabled_ || dispersion_mode_ != kUnscentedTransform) return;
+  unscented_transform_.SetOutput((size_t)number_of_executions_done_, name, std::vector<double>{value});
+}
+
+void MonteCarloSimulationExecutor::SetStatisticsValue(const string& name, const double elapsed_time_s, const double value) {
+  if (statistics_.GetNumberOfChannels() == 0) return;
+  statistics_.SetValue(name, elapsed_time_s, std::vector<double>{value});
+}
+
+void MonteCarloSimulationExecutor::WriteStatisticsSummary(const string file_name) const {
+  if (statistics_.GetNumberOfChannels() == 0) return;
+  statistics_.WriteSummary(file_name);
+}
+
+void MonteCarloSimulationExecutor::WriteDispersionStatistics(const string file_name) const {
+  if (!enabled_ || dispersion_mode_ != kUnscentedTransform) return;
+  unscented_transform_.WriteStatistics(file_name);
+}
+
 void MonteCarloSimulationExecutor::SetSeed(unsigned long seed, bool is_deterministic) {
   InitializedMonteCarloParameters::SetSeed(seed, is_deterministic);
 }
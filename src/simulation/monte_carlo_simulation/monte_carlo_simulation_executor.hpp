@@ -11,17 +11,32 @@
 #include <string>
 // #include "simulation_object.hpp"
 #include "initialize_monte_carlo_parameters.hpp"
+#include "monte_carlo_statistics.hpp"
+#include "unscented_transform.hpp"
 
 /**
  * @class MonteCarloSimulationExecutor
  * @brief Monte-Carlo Simulation Executor class
  */
 class MonteCarloSimulationExecutor {
+ public:
+  /**
+   * @enum DispersionMode
+   * @brief Generation method of the dispersed simulation cases
+   */
+  enum DispersionMode {
+    kRandomSampling,      //!< Random sampling following the randomization type of each parameter
+    kUnscentedTransform,  //!< Deterministic 2n+1 sigma points generated from the normal distributed parameters
+  };
+
  private:
   unsigned long long total_number_of_executions_;  //!< Total number of execution simulation case
   unsigned long long number_of_executions_done_;   //!< Number of executed case
   bool enabled_;                                   //!< Flag to execute Monte-Carlo Simulation or not
   bool save_log_history_flag_;                     //!< Flag to store the log for each case or not
+  DispersionMode dispersion_mode_;                 //!< Generation method of the dispersed simulation cases
+  UnscentedTransform unscented_transform_;         //!< Sigma point generator used in the unscented transform mode
+  MonteCarloStatistics statistics_;                //!< Streaming statistics aggregator of the output channels
 
   std::map<std::string, InitializedMonteCarloParameters*> init_parameter_list_;  //!< List of InitializedMonteCarloParameters read from MCSim.ini
 
@@ -55,8 +70,84 @@ class MonteCarloSimulationExecutor {
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
    */
   static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  /**
+   * @fn SetUnscentedTransformMode
+   * @brief Switch to the unscented transform mode and set the total number of execution to the number of sigma points
+   * @note Call this after all InitializedMonteCarloParameters are added
+   * @param [in] alpha: Spread parameter of the sigma points
+   * @param [in] beta: Parameter to incorporate prior knowledge of the distribution
+   * @param [in] kappa: Secondary scaling parameter
+   */
+  void SetUnscentedTransformMode(const double alpha, const double beta, const double kappa);
+  /**
+   * @fn SetSamplingMethod
+   * @brief Set generation method of the uniform samples used in the random sampling mode
+   * @note Call this after all InitializedMonteCarloParameters are added and the total number of execution is set
+   * @param [in] sampling_method: Sampling method
+   */
+  void SetSamplingMethod(const InitializedMonteCarloParameters::SamplingMethod sampling_method);
+  /**
+   * @fn SetDispersionOutput
+   * @brief Set output value of the current case to calculate the mean and covariance
+   * @note Only used in the unscented transform mode
+   * @param [in] name: Name of the output channel
+   * @param [in] value: Output value
+   */
+  template <size_t NumElement>
+  void SetDispersionOutput(const std::string name, const libra::Vector<NumElement>& value);
+  /**
+   * @fn SetDispersionOutput
+   * @brief Set output value of the current case to calculate the mean and covariance
+   * @note Only used in the unscented transform mode
+   * @param [in] name: Name of the output channel
+   * @param [in] value: Output value
+   */
+  void SetDispersionOutput(const std::string name, const double value);
+  /**
+   * @fn AddStatisticsChannel
+   * @brief Register a channel of the streaming statistics over the cases
+   * @param [in] name: Name of the channel
+   * @param [in] reductions: Reduction types except kEpochValue
+   * @param [in] epochs_s: Elapsed times of the kEpochValue reductions [s]
+   */
+  inline void AddStatisticsChannel(const std::string name, const std::vector<MonteCarloStatistics::ReductionType> reductions,
+                                   const std::vector<double> epochs_s) {
+    statistics_.AddChannel(name, reductions, epochs_s);
+  }
+  /**
+   * @fn SetStatisticsValue
+   * @brief Set value of the statistics channel at the elapsed time in the current case
+   * @param [in] name: Name of the channel
+   * @param [in] elapsed_time_s: Elapsed time of the case [s]
+   * @param [in] value: Channel value
+   */
+  template <size_t NumElement>
+  void SetStatisticsValue(const std::string& name, const double elapsed_time_s, const libra::Vector<NumElement>& value);
+  /**
+   * @fn SetStatisticsValue
+   * @brief Set value of the statistics channel at the elapsed time in the current case
+   * @param [in] name: Name of the channel
+   * @param [in] elapsed_time_s: Elapsed time of the case [s]
+   * @param [in] value: Channel value
+   */
+  void SetStatisticsValue(const std::string& name, const double elapsed_time_s, const double value);
 
   // Getter
+  /**
+   * @fn GetDispersionMode
+   * @brief Return generation method of the dispersed simulation cases
+   */
+  inline DispersionMode GetDispersionMode() const { return dispersion_mode_; }
+  /**
+   * @fn GetUnscentedTransform
+   * @brief Return sigma point generator to access the mean and covariance of the outputs
+   */
+  inline const UnscentedTransform& GetUnscentedTransform() const { return unscented_transform_; }
+  /**
+   * @fn GetStatistics
+   * @brief Return streaming statistics aggregator of the output channels
+   */
+  inline const MonteCarloStatistics& GetStatistics() const { return statistics_; }
   /**
    * @fn ISEnabled
    * @brief Return execute flag
@@ -134,6 +225,21 @@ class MonteCarloSimulationExecutor {
    * @brief Randomize all initialized parameter
    */
   void RandomizeAllParameters();
+
+  /**
+   * @fn WriteDispersionStatistics
+   * @brief Write mean and covariance of the dispersion outputs into a CSV file
+   * @note Only used in the unscented transform mode
+   * @param [in] file_name: Path of the output file
+   */
+  void WriteDispersionStatistics(const std::string file_name) const;
+
+  /**
+   * @fn WriteStatisticsSummary
+   * @brief Write summary of the streaming statistics channels into a CSV file
+   * @param [in] file_name: Path of the output file
+   */
+  void WriteStatisticsSummary(const std::string file_name) const;
 };
 
 template <size_t NumElement>
@@ -149,6 +255,26 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterVector(std::
   }
 }
 
+template <size_t NumElement>
+void MonteCarloSimulationExecutor::SetDispersionOutput(const std::string name, const libra::Vector<NumElement>& value) {
+  if (!enabled_ || dispersion_mode_ != kUnscentedTransform) return;
+  std::vector<double> output;
+  for (size_t i = 0; i < NumElement; i++) {
+    output.push_back(value[i]);
+  }
+  unscented_transform_.SetOutput((size_t)number_of_executions_done_, name, output);
+}
+
+template <size_t NumElement>
+void MonteCarloSimulationExecutor::SetStatisticsValue(const std::string& name, const double elapsed_time_s, const libra::Vector<NumElement>& value) {
+  if (statistics_.GetNumberOfChannels() == 0) return;
+  std::vector<double> channel_value(NumElement);
+  for (size_t i = 0; i < NumElement; i++) {
+    channel_value[i] = value[i];
+  }
+  statistics_.SetValue(name, elapsed_time_s, channel_value);
+}
+
 template <size_t NumElement1, size_t NumElement2>
 void MonteCarloSimulationExecutor::AddInitializedMonteCarloParameter(std::string so_name, std::string init_monte_carlo_parameter_name,
                                                                      const libra::Vector<NumElement1>& mean_or_min,
@@ -0,0 +1,161 @@
+/**
+ * @file monte_carlo_statistics.cpp
+ * @brief Streaming statistics aggregator of the output channels over Monte-Carlo simulation cases
+ */
+
+#include "monte_carlo_statistics.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+const std::vector<double> MonteCarloStatistics::kQuantiles = {0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99};
+
+MonteCarloStatistics::MonteCarloStatistics(const double relative_accuracy) : relative_accuracy_(relative_accuracy) {}
+
+void MonteCarloStatistics::AddChannel(const std::string name, const std::vector<ReductionType> reductions, const std::vector<double> epochs_s) {
+  if (channels_.find(name) != channels_.end()) {
+    std::cerr << "[WARNING] Monte-Carlo statistics: channel " << name << " is already registered." << std::endl;
+    return;
+  }
+
+  std::vector<ReductionPoint> reduction_points;
+  ReductionPoint reduction_point;
+  reduction_point.epoch_s = 0.0;
+  reduction_point.is_case_value_set = false;
+  for (auto reduction : reductions) {
+    if (reduction == kEpochValue) continue;
+    reduction_point.type = reduction;
+    reduction_points.push_back(reduction_point);
+  }
+  for (auto epoch_s : epochs_s) {
+    reduction_point.type = kEpochValue;
+    reduction_point.epoch_s = epoch_s;
+    reduction_points.push_back(reduction_point);
+  }
+  channels_[name] = reduction_points;
+}
+
+void MonteCarloStatistics::SetValue(const std::string& name, const double elapsed_time_s, const std::vector<double>& value) {
+  auto channel = channels_.find(name);
+  if (channel == channels_.end()) return;
+
+  for (auto& reduction_point : channel->second) {
+    switch (reduction_point.type) {
+      case kFinalValue:
+        reduction_point.case_value = value;
+        reduction_point.is_case_value_set = true;
+        break;
+      case kMaximum:
+      case kMinimum:
+        if (!reduction_point.is_case_value_set || reduction_point.case_value.size() != value.size()) {
+          reduction_point.case_value = value;
+          reduction_point.is_case_value_set = true;
+        } else {
+          for (size_t i = 0; i < value.size(); i++) {
+            if (reduction_point.type == kMaximum && value[i] > reduction_point.case_value[i]) reduction_point.case_value[i] = value[i];
+            if (reduction_point.type == kMinimum && value[i] < reduction_point.case_value[i]) reduction_point.case_value[i] = value[i];
+          }
+        }
+        break;
+      case kEpochValue:
+        if (!reduction_point.is_case_value_set && elapsed_time_s >= reduction_point.epoch_s) {
+          reduction_point.case_value = value;
+          reduction_point.is_case_value_set = true;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void MonteCarloStatistics::FinishCase() {
+  for (auto& channel : channels_) {
+    for (auto& reduction_point : channel.second) {
+      if (!reduction_point.is_case_value_set) continue;
+      const std::vector<double>& case_value = reduction_point.case_value;
+      reduction_point.statistics.Update(case_value);
+      if (reduction_point.sketches.empty()) {
+        reduction_point.sketches.assign(case_value.size(), libra::QuantileSketch(relative_accuracy_));
+      }
+      for (size_t i = 0; i < case_value.size() && i < reduction_point.sketches.size(); i++) {
+        reduction_point.sketches[i].Add(case_value[i]);
+      }
+      reduction_point.is_case_value_set = false;
+    }
+  }
+}
+
+void MonteCarloStatistics::Merge(const MonteCarloStatistics& other) {
+  for (auto& channel : channels_) {
+    auto other_channel = other.channels_.find(channel.first);
+    if (other_channel == other.channels_.end() || other_channel->second.size() != channel.second.size()) continue;
+    for (size_t i = 0; i < channel.second.size(); i++) {
+      ReductionPoint& reduction_point = channel.second[i];
+      const ReductionPoint& other_reduction_point = other_channel->second[i];
+      reduction_point.statistics.Merge(other_reduction_point.statistics);
+      if (reduction_point.sketches.empty()) {
+        reduction_point.sketches = other_reduction_point.sketches;
+      } else if (reduction_point.sketches.size() == other_reduction_point.sketches.size()) {
+        for (size_t j = 0; j < reduction_point.sketches.size(); j++) {
+          reduction_point.sketches[j].Merge(other_reduction_point.sketches[j]);
+        }
+      }
+    }
+  }
+}
+
+void MonteCarloStatistics::WriteSummary(const std::string file_name) const {
+  std::ofstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] Monte-Carlo statistics: cannot open " << file_name << std::endl;
+    return;
+  }
+
+  file << "channel,reduction,epoch_s,element,count,mean,standard_deviation,minimum,maximum";
+  for (auto quantile : kQuantiles) {
+    file << ",p" << quantile * 100.0;
+  }
+  file << ",covariance" << std::endl;
+
+  file << std::setprecision(15);
+  for (auto& channel : channels_) {
+    for (auto& reduction_point : channel.second) {
+      const libra::StreamingStatistics& statistics = reduction_point.statistics;
+      if (statistics.GetCount() == 0) continue;
+      const std::vector<std::vector<double>> covariance = statistics.GetCovariance();
+
+      std::string reduction_name;
+      switch (reduction_point.type) {
+        case kFinalValue:
+          reduction_name = "final_value";
+          break;
+        case kMaximum:
+          reduction_name = "maximum";
+          break;
+        case kMinimum:
+          reduction_name = "minimum";
+          break;
+        case kEpochValue:
+          reduction_name = "epoch_value";
+          break;
+        default:
+          break;
+      }
+
+      for (size_t i = 0; i < statistics.GetDimension(); i++) {
+        file << channel.first << "," << reduction_name << "," << reduction_point.epoch_s << "," << i << "," << statistics.GetCount() << ",";
+        file << statistics.GetMean()[i] << "," << sqrt(covariance[i][i]) << "," << statistics.GetMinimum()[i] << "," << statistics.GetMaximum()[i];
+        for (auto quantile : kQuantiles) {
+          file << "," << reduction_point.sketches[i].GetQuantile(quantile);
+        }
+        for (size_t j = 0; j < statistics.GetDimension(); j++) {
+          file << "," << covariance[i][j];
+        }
+        file << std::endl;
+      }
+    }
+  }
+}
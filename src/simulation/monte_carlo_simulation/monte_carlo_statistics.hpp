@@ -0,0 +1,100 @@
+/**
+ * @file monte_carlo_statistics.hpp
+ * @brief Streaming statistics aggregator of the output channels over Monte-Carlo simulation cases
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_STATISTICS_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_STATISTICS_HPP_
+
+#include <map>
+#include <math_physics/statistics/quantile_sketch.hpp>
+#include <math_physics/statistics/streaming_statistics.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class MonteCarloStatistics
+ * @brief Streaming statistics aggregator of the output channels over Monte-Carlo simulation cases
+ * @details Each channel is reduced into values at the reduction points in each case,
+ *          and the mean, covariance, and quantiles of the reduced values are accumulated over the cases without storing the case results.
+ */
+class MonteCarloStatistics {
+ public:
+  /**
+   * @enum ReductionType
+   * @brief Reduction of a channel in each case
+   */
+  enum ReductionType {
+    kFinalValue,  //!< Last value in the case
+    kMaximum,     //!< Element-wise maximum over the case
+    kMinimum,     //!< Element-wise minimum over the case
+    kEpochValue,  //!< First value at or after the specified epoch
+  };
+
+  /**
+   * @fn MonteCarloStatistics
+   * @brief Constructor
+   * @param [in] relative_accuracy: Relative accuracy of the quantile sketches
+   */
+  explicit MonteCarloStatistics(const double relative_accuracy = 0.01);
+
+  /**
+   * @fn AddChannel
+   * @brief Register a channel
+   * @param [in] name: Name of the channel
+   * @param [in] reductions: Reduction types except kEpochValue
+   * @param [in] epochs_s: Elapsed times of the kEpochValue reductions [s]
+   */
+  void AddChannel(const std::string name, const std::vector<ReductionType> reductions, const std::vector<double> epochs_s);
+  /**
+   * @fn SetValue
+   * @brief Set value of the channel at the elapsed time. Values of unregistered channels are ignored.
+   * @param [in] name: Name of the channel
+   * @param [in] elapsed_time_s: Elapsed time of the case [s]
+   * @param [in] value: Channel value
+   */
+  void SetValue(const std::string& name, const double elapsed_time_s, const std::vector<double>& value);
+  /**
+   * @fn FinishCase
+   * @brief Accumulate the reduced values of the current case and reset the case
+   */
+  void FinishCase();
+  /**
+   * @fn Merge
+   * @brief Merge statistics of other campaign with the same channel definition
+   */
+  void Merge(const MonteCarloStatistics& other);
+  /**
+   * @fn WriteSummary
+   * @brief Write summary of all channels into a CSV file
+   * @param [in] file_name: Path of the output file
+   */
+  void WriteSummary(const std::string file_name) const;
+
+  /**
+   * @fn GetNumberOfChannels
+   * @brief Return number of registered channels
+   */
+  inline size_t GetNumberOfChannels() const { return channels_.size(); }
+
+ private:
+  /**
+   * @struct ReductionPoint
+   * @brief Statistics of a reduced value
+   */
+  struct ReductionPoint {
+    ReductionType type;                           //!< Reduction type
+    double epoch_s;                               //!< Elapsed time of the kEpochValue reduction [s]
+    libra::StreamingStatistics statistics;        //!< Mean and covariance of the reduced value over cases
+    std::vector<libra::QuantileSketch> sketches;  //!< Quantile sketches of each element over cases
+    std::vector<double> case_value;               //!< Reduced value in the current case
+    bool is_case_value_set;                       //!< Flag to show the reduced value is set in the current case
+  };
+
+  double relative_accuracy_;                                     //!< Relative accuracy of the quantile sketches
+  std::map<std::string, std::vector<ReductionPoint>> channels_;  //!< Reduction points of the registered channels
+
+  static const std::vector<double> kQuantiles;  //!< Quantiles written in the summary
+};
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_STATISTICS_HPP_
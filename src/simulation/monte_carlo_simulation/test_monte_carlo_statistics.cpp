@@ -0,0 +1,112 @@
+/**
+ * @file test_monte_carlo_statistics.cpp
+ * @brief Test codes for MonteCarloStatistics class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "monte_carlo_statistics.hpp"
+
+namespace {
+/**
+ * @fn ReadSummary
+ * @brief Read rows of the summary CSV file without the header line
+ * @param [in] file_name: Path of the summary file
+ */
+std::vector<std::vector<std::string>> ReadSummary(const std::string file_name) {
+  std::vector<std::vector<std::string>> rows;
+  std::ifstream file(file_name);
+  std::string line;
+  std::getline(file, line);
+  while (std::getline(file, line)) {
+    std::vector<std::string> row;
+    std::stringstream line_stream(line);
+    std::string field;
+    while (std::getline(line_stream, field, ',')) row.push_back(field);
+    rows.push_back(row);
+  }
+  return rows;
+}
+
+/**
+ * @fn RunCases
+ * @brief Run cases of the channel {k + t, -k} at t = 0, 1, ..., 10 [s] for the case number k
+ * @param [in] statistics: Statistics to accumulate the cases
+ * @param [in] first_case: First case number
+ * @param [in] last_case: Last case number
+ */
+void RunCases(MonteCarloStatistics& statistics, const int first_case, const int last_case) {
+  for (int k = first_case; k <= last_case; k++) {
+    for (int t = 0; t <= 10; t++) {
+      statistics.SetValue("state", (double)t, {(double)(k + t), (double)(-k)});
+      statistics.SetValue("unregistered", (double)t, {1.0});
+    }
+    statistics.FinishCase();
+  }
+}
+}  // namespace
+
+/**
+ * @brief Test for the mean, variance, and quantiles of the reduced values over the merged cases
+ */
+TEST(MonteCarloStatistics, Summary) {
+  const double relative_accuracy = 0.01;
+  const std::vector<MonteCarloStatistics::ReductionType> reductions = {MonteCarloStatistics::kFinalValue, MonteCarloStatistics::kMaximum,
+                                                                       MonteCarloStatistics::kMinimum};
+  MonteCarloStatistics first(relative_accuracy);
+  MonteCarloStatistics second(relative_accuracy);
+  first.AddChannel("state", reductions, {5.0});
+  second.AddChannel("state", reductions, {5.0});
+  EXPECT_EQ(1u, first.GetNumberOfChannels());
+
+  // Case numbers k = 0, 1, ..., 100 in two campaigns
+  RunCases(first, 0, 49);
+  RunCases(second, 50, 100);
+  // Case without values is not counted
+  first.FinishCase();
+  first.Merge(second);
+
+  const std::string file_name = "test_monte_carlo_statistics.csv";
+  first.WriteSummary(file_name);
+  const std::vector<std::vector<std::string>> rows = ReadSummary(file_name);
+  remove(file_name.c_str());
+
+  // Final value, maximum, minimum, and epoch value for two elements
+  ASSERT_EQ(8u, rows.size());
+  const std::string reduction_names[] = {"final_value", "maximum", "minimum", "epoch_value"};
+  const double offsets[] = {10.0, 10.0, 0.0, 5.0};
+  const double quantiles[] = {0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99};
+  // Sample variance of 0, 1, ..., 100
+  const double variance = 101.0 * 102.0 / 12.0;
+  for (size_t reduction_id = 0; reduction_id < 4; reduction_id++) {
+    for (size_t element = 0; element < 2; element++) {
+      const std::vector<std::string>& row = rows[reduction_id * 2 + element];
+      ASSERT_EQ(18u, row.size());
+      EXPECT_EQ("state", row[0]);
+      EXPECT_EQ(reduction_names[reduction_id], row[1]);
+      EXPECT_EQ(element, std::stoul(row[3]));
+      EXPECT_EQ(101, std::stoi(row[4]));
+
+      // Element 0 is k + offset, and element 1 is -k
+      const double sign = element == 0 ? 1.0 : -1.0;
+      const double offset = element == 0 ? offsets[reduction_id] : 0.0;
+      EXPECT_NEAR(offset + sign * 50.0, std::stod(row[5]), 1.0e-9);
+      EXPECT_NEAR(variance, std::stod(row[6]) * std::stod(row[6]), 1.0e-9);
+      EXPECT_NEAR(offset + (element == 0 ? 0.0 : -100.0), std::stod(row[7]), 1.0e-9);
+      EXPECT_NEAR(offset + (element == 0 ? 100.0 : 0.0), std::stod(row[8]), 1.0e-9);
+      for (size_t i = 0; i < 7; i++) {
+        const double expected = element == 0 ? offset + quantiles[i] * 100.0 : -100.0 + quantiles[i] * 100.0;
+        // Margin for the rounding at the bound of the relative accuracy
+        EXPECT_NEAR(expected, std::stod(row[9 + i]), fabs(expected) * relative_accuracy + 1.0e-9);
+      }
+      EXPECT_NEAR(variance, std::stod(row[16 + element]), 1.0e-9);
+      EXPECT_NEAR(-variance, std::stod(row[17 - element]), 1.0e-9);
+    }
+  }
+}
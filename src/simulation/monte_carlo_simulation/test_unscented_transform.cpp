@@ -0,0 +1,117 @@
+/**
+ * @file test_unscented_transform.cpp
+ * @brief Test codes for UnscentedTransform class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "unscented_transform.hpp"
+
+/**
+ * @brief Test for the sum of the weights
+ */
+TEST(UnscentedTransform, Weights) {
+  const double alpha_list[] = {1.0, 0.5, 1e-3};
+  const double beta_list[] = {2.0, 0.0, 2.0};
+  const double kappa_list[] = {0.0, 1.0, 3.0};
+  const size_t number_of_dimensions = 3;
+
+  for (size_t test_id = 0; test_id < 3; test_id++) {
+    const double alpha = alpha_list[test_id];
+    const double beta = beta_list[test_id];
+    UnscentedTransform unscented_transform(alpha, beta, kappa_list[test_id]);
+    unscented_transform.SetNumberOfDimensions(number_of_dimensions);
+    EXPECT_EQ(2 * number_of_dimensions + 1, unscented_transform.GetNumberOfSigmaPoints());
+
+    double mean_weight_sum = 0.0;
+    double covariance_weight_sum = 0.0;
+    for (size_t i = 0; i < unscented_transform.GetNumberOfSigmaPoints(); i++) {
+      mean_weight_sum += unscented_transform.GetMeanWeight(i);
+      covariance_weight_sum += unscented_transform.GetCovarianceWeight(i);
+    }
+    EXPECT_NEAR(1.0, mean_weight_sum, 1e-9);
+    EXPECT_NEAR(1.0 + (1.0 - alpha * alpha + beta), covariance_weight_sum, 1e-9);
+  }
+}
+
+/**
+ * @brief Test for the mean and covariance of a linear map
+ */
+TEST(UnscentedTransform, LinearMap) {
+  const size_t n = 3;
+  const double mean[n] = {1.0, -2.0, 0.5};
+  const double sigma[n] = {1.0, 2.0, 0.5};
+  const double a[2][n] = {{1.0, 2.0, -1.0}, {0.5, 0.0, 3.0}};
+  const double b[2] = {10.0, -5.0};
+
+  UnscentedTransform unscented_transform(0.5, 2.0, 1.0);
+  unscented_transform.SetNumberOfDimensions(n);
+  for (size_t i = 0; i < unscented_transform.GetNumberOfSigmaPoints(); i++) {
+    double x[n];
+    for (size_t j = 0; j < n; j++) x[j] = mean[j];
+    const size_t shifted_dimension = unscented_transform.GetShiftedDimension(i);
+    if (shifted_dimension < n) x[shifted_dimension] += unscented_transform.GetScaledOffset(i) * sigma[shifted_dimension];
+
+    std::vector<double> y(2, 0.0);
+    for (size_t k = 0; k < 2; k++) {
+      y[k] = b[k];
+      for (size_t j = 0; j < n; j++) y[k] += a[k][j] * x[j];
+    }
+    unscented_transform.SetOutput(i, "y", y);
+  }
+
+  const std::vector<double> calculated_mean = unscented_transform.CalcMean("y");
+  const std::vector<std::vector<double>> calculated_covariance = unscented_transform.CalcCovariance("y");
+  ASSERT_EQ(2u, calculated_mean.size());
+  ASSERT_EQ(2u, calculated_covariance.size());
+  for (size_t k = 0; k < 2; k++) {
+    double expected_mean = b[k];
+    for (size_t j = 0; j < n; j++) expected_mean += a[k][j] * mean[j];
+    EXPECT_NEAR(expected_mean, calculated_mean[k], 1e-9);
+
+    for (size_t l = 0; l < 2; l++) {
+      // A P A^T with diagonal P
+      double expected_covariance = 0.0;
+      for (size_t j = 0; j < n; j++) expected_covariance += a[k][j] * sigma[j] * sigma[j] * a[l][j];
+      EXPECT_NEAR(expected_covariance, calculated_covariance[k][l], 1e-9);
+    }
+  }
+}
+
+/**
+ * @brief Test for the indexing of the outputs
+ */
+TEST(UnscentedTransform, OutputIndex) {
+  UnscentedTransform unscented_transform;
+  unscented_transform.SetNumberOfDimensions(2);
+  const size_t number_of_sigma_points = unscented_transform.GetNumberOfSigmaPoints();
+  EXPECT_EQ(5u, number_of_sigma_points);
+
+  for (size_t i = 0; i < number_of_sigma_points; i++) {
+    unscented_transform.SetOutput(i, "x", std::vector<double>{(double)i, 2.0 * i});
+  }
+  // Out of range sigma point is ignored
+  unscented_transform.SetOutput(number_of_sigma_points, "x", std::vector<double>{-1.0, -1.0});
+
+  for (size_t i = 0; i < number_of_sigma_points; i++) {
+    const std::vector<double> output = unscented_transform.GetOutput(i, "x");
+    ASSERT_EQ(2u, output.size());
+    EXPECT_DOUBLE_EQ((double)i, output[0]);
+    EXPECT_DOUBLE_EQ(2.0 * i, output[1]);
+  }
+  EXPECT_TRUE(unscented_transform.GetOutput(number_of_sigma_points, "x").empty());
+  EXPECT_TRUE(unscented_transform.GetOutput(0, "unknown").empty());
+
+  // The mean sigma point and the positive and negative shifts of each dimension
+  EXPECT_EQ(2u, unscented_transform.GetShiftedDimension(0));
+  EXPECT_DOUBLE_EQ(0.0, unscented_transform.GetScaledOffset(0));
+  for (size_t i = 1; i <= 2; i++) {
+    EXPECT_EQ(i - 1, unscented_transform.GetShiftedDimension(i));
+    EXPECT_EQ(i - 1, unscented_transform.GetShiftedDimension(i + 2));
+    EXPECT_GT(unscented_transform.GetScaledOffset(i), 0.0);
+    EXPECT_DOUBLE_EQ(-unscented_transform.GetScaledOffset(i), unscented_transform.GetScaledOffset(i + 2));
+  }
+
+  // Changing the dimension clears the outputs
+  unscented_transform.SetNumberOfDimensions(1);
+  EXPECT_TRUE(unscented_transform.GetOutput(0, "x").empty());
+}
@@ -0,0 +1,126 @@
+/**
+ * @file unscented_transform.cpp
+ * @brief Sigma point generation and statistics calculation with the unscented transform
+ */
+
+#include "unscented_transform.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+UnscentedTransform::UnscentedTransform(const double alpha, const double beta, const double kappa) : alpha_(alpha), beta_(beta), kappa_(kappa) {
+  SetNumberOfDimensions(0);
+}
+
+void UnscentedTransform::SetNumberOfDimensions(const size_t number_of_dimensions) {
+  number_of_dimensions_ = number_of_dimensions;
+  outputs_.clear();
+
+  if (number_of_dimensions_ == 0) {
+    // Only the mean sigma point
+    scale_ = 0.0;
+    mean_weight_0_ = 1.0;
+    covariance_weight_0_ = 1.0;
+    weight_ = 0.0;
+    return;
+  }
+
+  const double n = (double)number_of_dimensions_;
+  const double n_plus_lambda = alpha_ * alpha_ * (n + kappa_);
+  if (n_plus_lambda <= 0.0) {
+    throw "Invalid unscented transform parameters. alpha^2 * (n + kappa) should be positive.";
+  }
+  const double lambda = n_plus_lambda - n;
+
+  scale_ = sqrt(n_plus_lambda);
+  mean_weight_0_ = lambda / n_plus_lambda;
+  covariance_weight_0_ = mean_weight_0_ + (1.0 - alpha_ * alpha_ + beta_);
+  weight_ = 0.5 / n_plus_lambda;
+}
+
+size_t UnscentedTransform::GetShiftedDimension(const size_t sigma_point_id) const {
+  if (sigma_point_id == 0 || sigma_point_id > 2 * number_of_dimensions_) return number_of_dimensions_;
+  return (sigma_point_id - 1) % number_of_dimensions_;
+}
+
+double UnscentedTransform::GetScaledOffset(const size_t sigma_point_id) const {
+  if (sigma_point_id == 0 || sigma_point_id > 2 * number_of_dimensions_) return 0.0;
+  return sigma_point_id <= number_of_dimensions_ ? scale_ : -scale_;
+}
+
+void UnscentedTransform::SetOutput(const size_t sigma_point_id, const std::string name, const std::vector<double>& value) {
+  if (sigma_point_id >= GetNumberOfSigmaPoints()) return;
+  std::vector<std::vector<double>>& output = outputs_[name];
+  output.resize(GetNumberOfSigmaPoints());
+  output[sigma_point_id] = value;
+}
+
+std::vector<double> UnscentedTransform::GetOutput(const size_t sigma_point_id, const std::string name) const {
+  const auto output = outputs_.find(name);
+  if (output == outputs_.end() || sigma_point_id >= output->second.size()) return std::vector<double>();
+  return output->second[sigma_point_id];
+}
+
+std::vector<double> UnscentedTransform::CalcMean(const std::string name) const {
+  std::vector<double> mean;
+  if (outputs_.find(name) == outputs_.end()) return mean;
+  const std::vector<std::vector<double>>& output = outputs_.at(name);
+
+  const size_t dimension = output[0].size();
+  for (size_t i = 0; i < GetNumberOfSigmaPoints(); i++) {
+    if (output[i].size() != dimension) {
+      std::cerr << "[WARNING] unscented transform: output " << name << " of the sigma point " << i << " is missing." << std::endl;
+      return std::vector<double>();
+    }
+  }
+
+  mean.assign(dimension, 0.0);
+  for (size_t i = 0; i < GetNumberOfSigmaPoints(); i++) {
+    for (size_t j = 0; j < dimension; j++) {
+      mean[j] += GetMeanWeight(i) * output[i][j];
+    }
+  }
+  return mean;
+}
+
+std::vector<std::vector<double>> UnscentedTransform::CalcCovariance(const std::string name) const {
+  std::vector<std::vector<double>> covariance;
+  const std::vector<double> mean = CalcMean(name);
+  if (mean.empty()) return covariance;
+  const std::vector<std::vector<double>>& output = outputs_.at(name);
+
+  const size_t dimension = mean.size();
+  covariance.assign(dimension, std::vector<double>(dimension, 0.0));
+  for (size_t i = 0; i < GetNumberOfSigmaPoints(); i++) {
+    for (size_t j = 0; j < dimension; j++) {
+      for (size_t k = 0; k < dimension; k++) {
+        covariance[j][k] += GetCovarianceWeight(i) * (output[i][j] - mean[j]) * (output[i][k] - mean[k]);
+      }
+    }
+  }
+  return covariance;
+}
+
+void UnscentedTransform::WriteStatistics(const std::string file_name) const {
+  std::ofstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] unscented transform: cannot open " << file_name << std::endl;
+    return;
+  }
+
+  file << "channel,element,mean,covariance" << std::endl;
+  file << std::setprecision(15);
+  for (auto output : outputs_) {
+    const std::vector<double> mean = CalcMean(output.first);
+    const std::vector<std::vector<double>> covariance = CalcCovariance(output.first);
+    for (size_t i = 0; i < mean.size(); i++) {
+      file << output.first << "," << i << "," << mean[i];
+      for (size_t j = 0; j < mean.size(); j++) {
+        file << "," << covariance[i][j];
+      }
+      file << std::endl;
+    }
+  }
+}
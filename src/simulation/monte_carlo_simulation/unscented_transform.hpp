@@ -0,0 +1,122 @@
+/**
+ * @file unscented_transform.hpp
+ * @brief Sigma point generation and statistics calculation with the unscented transform
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_UNSCENTED_TRANSFORM_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_UNSCENTED_TRANSFORM_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @class UnscentedTransform
+ * @brief Sigma point generation and statistics calculation with the scaled unscented transform
+ * @note  For n uncertain dimensions, 2n+1 sigma points are generated.
+ *        Sigma point 0 is the mean, sigma point i (1 <= i <= n) is shifted to +sqrt(n + lambda) sigma along the dimension (i - 1),
+ *        and sigma point i (n + 1 <= i <= 2n) is shifted to -sqrt(n + lambda) sigma along the dimension (i - n - 1).
+ */
+class UnscentedTransform {
+ public:
+  /**
+   * @fn UnscentedTransform
+   * @brief Constructor
+   * @param [in] alpha: Spread parameter of the sigma points
+   * @param [in] beta: Parameter to incorporate prior knowledge of the distribution (2 is optimal for the normal distribution)
+   * @param [in] kappa: Secondary scaling parameter
+   */
+  UnscentedTransform(const double alpha = 1.0, const double beta = 2.0, const double kappa = 0.0);
+
+  // Setter
+  /**
+   * @fn SetNumberOfDimensions
+   * @brief Set number of uncertain dimensions and calculate weights
+   */
+  void SetNumberOfDimensions(const size_t number_of_dimensions);
+
+  // Getter
+  /**
+   * @fn GetNumberOfDimensions
+   * @brief Return number of uncertain dimensions
+   */
+  inline size_t GetNumberOfDimensions() const { return number_of_dimensions_; }
+  /**
+   * @fn GetNumberOfSigmaPoints
+   * @brief Return number of sigma points (2n+1)
+   */
+  inline size_t GetNumberOfSigmaPoints() const { return 2 * number_of_dimensions_ + 1; }
+  /**
+   * @fn GetMeanWeight
+   * @brief Return weight to calculate the mean value
+   * @param [in] sigma_point_id: Sigma point index
+   */
+  inline double GetMeanWeight(const size_t sigma_point_id) const { return sigma_point_id == 0 ? mean_weight_0_ : weight_; }
+  /**
+   * @fn GetCovarianceWeight
+   * @brief Return weight to calculate the covariance
+   * @param [in] sigma_point_id: Sigma point index
+   */
+  inline double GetCovarianceWeight(const size_t sigma_point_id) const { return sigma_point_id == 0 ? covariance_weight_0_ : weight_; }
+  /**
+   * @fn GetShiftedDimension
+   * @brief Return index of the dimension shifted in the sigma point. Return number of dimensions for the mean sigma point.
+   * @param [in] sigma_point_id: Sigma point index
+   */
+  size_t GetShiftedDimension(const size_t sigma_point_id) const;
+  /**
+   * @fn GetScaledOffset
+   * @brief Return offset of the sigma point normalized by the standard deviation
+   * @param [in] sigma_point_id: Sigma point index
+   */
+  double GetScaledOffset(const size_t sigma_point_id) const;
+
+  // Statistics
+  /**
+   * @fn SetOutput
+   * @brief Store output value of the sigma point
+   * @param [in] sigma_point_id: Sigma point index
+   * @param [in] name: Name of the output channel
+   * @param [in] value: Output value
+   */
+  void SetOutput(const size_t sigma_point_id, const std::string name, const std::vector<double>& value);
+  /**
+   * @fn GetOutput
+   * @brief Return output value of the sigma point. Return an empty vector when the value is not stored.
+   * @param [in] sigma_point_id: Sigma point index
+   * @param [in] name: Name of the output channel
+   */
+  std::vector<double> GetOutput(const size_t sigma_point_id, const std::string name) const;
+  /**
+   * @fn CalcMean
+   * @brief Return weighted mean of the output channel
+   * @param [in] name: Name of the output channel
+   */
+  std::vector<double> CalcMean(const std::string name) const;
+  /**
+   * @fn CalcCovariance
+   * @brief Return weighted covariance of the output channel
+   * @param [in] name: Name of the output channel
+   */
+  std::vector<std::vector<double>> CalcCovariance(const std::string name) const;
+  /**
+   * @fn WriteStatistics
+   * @brief Write mean and covariance of all output channels into a CSV file
+   * @param [in] file_name: Path of the output file
+   */
+  void WriteStatistics(const std::string file_name) const;
+
+ private:
+  double alpha_;                 //!< Spread parameter of the sigma points
+  double beta_;                  //!< Parameter to incorporate prior knowledge of the distribution
+  double kappa_;                 //!< Secondary scaling parameter
+  size_t number_of_dimensions_;  //!< Number of uncertain dimensions
+  double scale_;                 //!< Sigma point offset normalized by the standard deviation sqrt(n + lambda)
+  double mean_weight_0_;         //!< Weight of the mean sigma point to calculate the mean value
+  double covariance_weight_0_;   //!< Weight of the mean sigma point to calculate the covariance
+  double weight_;                //!< Weight of the other sigma points
+
+  std::map<std::string, std::vector<std::vector<double>>> outputs_;  //!< Output values of each channel for each sigma point
+};
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_UNSCENTED_TRANSFORM_HPP_
@@ -0,0 +1,284 @@
+/**
+ * @file conjunction_screening.cpp
+ * @brief Class to screen close approaches among many objects
+ */
+
+#include "conjunction_screening.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <unordered_map>
+
+namespace {
+
+const int64_t kCellIndexBits = 21;                                 //!< Number of bits to express the cell index of each axis
+const int64_t kCellIndexMask = (int64_t(1) << kCellIndexBits) - 1;  //!< Bit mask of the cell index
+
+/**
+ * @fn CalcCellKey
+ * @brief Pack the cell indices of three axes into a key of the spatial hash
+ */
+inline int64_t CalcCellKey(const int64_t x, const int64_t y, const int64_t z) {
+  return ((x & kCellIndexMask) << (2 * kCellIndexBits)) | ((y & kCellIndexMask) << kCellIndexBits) | (z & kCellIndexMask);
+}
+
+/**
+ * @fn CalcRangeRate
+ * @brief Return inner product of the relative position and velocity, whose sign is the same as the range rate
+ */
+inline double CalcRangeRate(const libra::Vector<3>& relative_position, const libra::Vector<3>& relative_velocity) {
+  return InnerProduct(relative_position, relative_velocity);
+}
+
+}  // namespace
+
+ConjunctionScreening::ConjunctionScreening(const double screening_distance_m, const double gravity_constant_m3_s2, const double filter_margin_m,
+                                           const double path_filter_minimum_angle_rad)
+    : screening_distance_m_(screening_distance_m),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      filter_margin_m_(filter_margin_m),
+      path_filter_minimum_angle_rad_(path_filter_minimum_angle_rad) {}
+
+std::vector<ConjunctionEvent> ConjunctionScreening::Screen(const double time_s, const std::vector<libra::Vector<3>>& position_list_i_m,
+                                                           const std::vector<libra::Vector<3>>& velocity_list_i_m_s) {
+  std::vector<ConjunctionEvent> events;
+  number_of_candidate_pairs_ = 0;
+  number_of_refined_pairs_ = 0;
+
+  const size_t number_of_objects = position_list_i_m.size();
+  if (velocity_list_i_m_s.size() != number_of_objects) {
+    std::cerr << "[WARNING] conjunction screening: sizes of the position and velocity lists are different." << std::endl;
+    return events;
+  }
+  if (previous_position_list_i_m_.size() != number_of_objects || time_s <= previous_time_s_) {
+    // First step or the object list is changed
+    previous_time_s_ = time_s;
+    previous_position_list_i_m_ = position_list_i_m;
+    previous_velocity_list_i_m_s_ = velocity_list_i_m_s;
+    return events;
+  }
+  const double step_width_s = time_s - previous_time_s_;
+
+  // Cell size of the spatial hash
+  // A pair whose closest approach in this step is within the screening distance must be in the neighboring cells at this step
+  double max_speed_m_s = 0.0;
+  for (size_t i = 0; i < number_of_objects; i++) {
+    max_speed_m_s = std::max(max_speed_m_s, velocity_list_i_m_s[i].CalcNorm());
+    max_speed_m_s = std::max(max_speed_m_s, previous_velocity_list_i_m_s_[i].CalcNorm());
+  }
+  const double cell_size_m = screening_distance_m_ + 2.0 * max_speed_m_s * step_width_s;
+
+  // Build the spatial hash
+  std::unordered_map<int64_t, std::vector<size_t>> grid;
+  std::vector<int64_t> cell_index_list(3 * number_of_objects);
+  for (size_t i = 0; i < number_of_objects; i++) {
+    for (size_t axis = 0; axis < 3; axis++) {
+      cell_index_list[3 * i + axis] = (int64_t)std::floor(position_list_i_m[i][axis] / cell_size_m);
+    }
+    grid[CalcCellKey(cell_index_list[3 * i], cell_index_list[3 * i + 1], cell_index_list[3 * i + 2])].push_back(i);
+  }
+
+  // Orbit geometry for the filters
+  std::vector<OrbitGeometry> geometry_list(number_of_objects);
+  for (size_t i = 0; i < number_of_objects; i++) {
+    geometry_list[i] = CalcOrbitGeometry(position_list_i_m[i], velocity_list_i_m_s[i]);
+  }
+
+  for (size_t i = 0; i < number_of_objects; i++) {
+    for (int64_t dx = -1; dx <= 1; dx++) {
+      for (int64_t dy = -1; dy <= 1; dy++) {
+        for (int64_t dz = -1; dz <= 1; dz++) {
+          const auto cell = grid.find(CalcCellKey(cell_index_list[3 * i] + dx, cell_index_list[3 * i + 1] + dy, cell_index_list[3 * i + 2] + dz));
+          if (cell == grid.end()) continue;
+
+          for (size_t j : cell->second) {
+            if (j <= i) continue;
+            number_of_candidate_pairs_++;
+
+            // Orbital filters
+            if (!PassApogeePerigeeFilter(geometry_list[i], geometry_list[j])) continue;
+            if (!PassOrbitPathFilter(geometry_list[i], geometry_list[j])) continue;
+
+            // The closest approach exists in this step when the range rate changes from negative to positive
+            const double previous_range_rate = CalcRangeRate(previous_position_list_i_m_[j] - previous_position_list_i_m_[i],
+                                                             previous_velocity_list_i_m_s_[j] - previous_velocity_list_i_m_s_[i]);
+            const double current_range_rate =
+                CalcRangeRate(position_list_i_m[j] - position_list_i_m[i], velocity_list_i_m_s[j] - velocity_list_i_m_s[i]);
+            if (previous_range_rate >= 0.0 || current_range_rate < 0.0) continue;
+
+            number_of_refined_pairs_++;
+            ConjunctionEvent event;
+            RefineClosestApproach(i, j, time_s, position_list_i_m, velocity_list_i_m_s, event);
+            if (event.miss_distance_m <= screening_distance_m_) {
+              events.push_back(event);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Sort by time of closest approach for the readability of the output
+  std::sort(events.begin(), events.end(), [](const ConjunctionEvent& lhs, const ConjunctionEvent& rhs) {
+    return lhs.time_of_closest_approach_s < rhs.time_of_closest_approach_s;
+  });
+  events_.insert(events_.end(), events.begin(), events.end());
+
+  previous_time_s_ = time_s;
+  previous_position_list_i_m_ = position_list_i_m;
+  previous_velocity_list_i_m_s_ = velocity_list_i_m_s;
+  return events;
+}
+
+void ConjunctionScreening::Reset() {
+  previous_time_s_ = 0.0;
+  previous_position_list_i_m_.clear();
+  previous_velocity_list_i_m_s_.clear();
+  events_.clear();
+  number_of_candidate_pairs_ = 0;
+  number_of_refined_pairs_ = 0;
+}
+
+void ConjunctionScreening::WriteEvents(const std::string file_name) const {
+  std::ofstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] conjunction screening: cannot open " << file_name << std::endl;
+    return;
+  }
+
+  file << "first_object_id,second_object_id,time_of_closest_approach[s],miss_distance[m],relative_speed[m/s],"
+          "relative_position_x[m],relative_position_y[m],relative_position_z[m]"
+       << std::endl;
+  file << std::setprecision(15);
+  for (auto event : events_) {
+    file << event.first_object_id << "," << event.second_object_id << "," << event.time_of_closest_approach_s << "," << event.miss_distance_m << ","
+         << event.relative_speed_m_s;
+    for (size_t axis = 0; axis < 3; axis++) {
+      file << "," << event.relative_position_i_m[axis];
+    }
+    file << std::endl;
+  }
+}
+
+ConjunctionScreening::OrbitGeometry ConjunctionScreening::CalcOrbitGeometry(const libra::Vector<3>& position_i_m,
+                                                                            const libra::Vector<3>& velocity_i_m_s) const {
+  OrbitGeometry geometry;
+  geometry.is_valid = false;
+  geometry.perigee_radius_m = 0.0;
+  geometry.apogee_radius_m = std::numeric_limits<double>::infinity();
+  geometry.semi_latus_rectum_m = 0.0;
+  geometry.normal_i = libra::Vector<3>(0.0);
+  geometry.eccentricity_i = libra::Vector<3>(0.0);
+
+  const double radius_m = position_i_m.CalcNorm();
+  const libra::Vector<3> angular_momentum_i_m2_s = OuterProduct(position_i_m, velocity_i_m_s);
+  const double angular_momentum_m2_s = angular_momentum_i_m2_s.CalcNorm();
+  if (radius_m <= 0.0 || angular_momentum_m2_s <= 0.0 || gravity_constant_m3_s2_ <= 0.0) return geometry;
+
+  geometry.normal_i = (1.0 / angular_momentum_m2_s) * angular_momentum_i_m2_s;
+  geometry.eccentricity_i = (1.0 / gravity_constant_m3_s2_) * OuterProduct(velocity_i_m_s, angular_momentum_i_m2_s) - (1.0 / radius_m) * position_i_m;
+  geometry.semi_latus_rectum_m = angular_momentum_m2_s * angular_momentum_m2_s / gravity_constant_m3_s2_;
+
+  const double eccentricity = geometry.eccentricity_i.CalcNorm();
+  geometry.perigee_radius_m = geometry.semi_latus_rectum_m / (1.0 + eccentricity);
+  if (eccentricity < 1.0) {
+    geometry.apogee_radius_m = geometry.semi_latus_rectum_m / (1.0 - eccentricity);
+  }
+  geometry.is_valid = true;
+  return geometry;
+}
+
+bool ConjunctionScreening::PassApogeePerigeeFilter(const OrbitGeometry& first, const OrbitGeometry& second) const {
+  if (!first.is_valid || !second.is_valid) return true;
+
+  const double gap_m = std::max(first.perigee_radius_m, second.perigee_radius_m) - std::min(first.apogee_radius_m, second.apogee_radius_m);
+  return gap_m <= screening_distance_m_ + filter_margin_m_;
+}
+
+bool ConjunctionScreening::PassOrbitPathFilter(const OrbitGeometry& first, const OrbitGeometry& second) const {
+  if (!first.is_valid || !second.is_valid) return true;
+
+  // Line of the mutual nodes
+  libra::Vector<3> node_direction_i = OuterProduct(first.normal_i, second.normal_i);
+  const double sin_relative_inclination = node_direction_i.CalcNorm();
+  if (sin_relative_inclination < sin(path_filter_minimum_angle_rad_)) return true;
+  node_direction_i = (1.0 / sin_relative_inclination) * node_direction_i;
+
+  // Radius of each orbit at the mutual nodes: r = p / (1 + e cos(nu))
+  for (double sign : {1.0, -1.0}) {
+    const libra::Vector<3> direction_i = sign * node_direction_i;
+    const double first_denominator = 1.0 + InnerProduct(first.eccentricity_i, direction_i);
+    const double second_denominator = 1.0 + InnerProduct(second.eccentricity_i, direction_i);
+    // The direction is not on the non-elliptic orbit
+    if (first_denominator <= 0.0 || second_denominator <= 0.0) return true;
+
+    const double first_radius_m = first.semi_latus_rectum_m / first_denominator;
+    const double second_radius_m = second.semi_latus_rectum_m / second_denominator;
+    if (fabs(first_radius_m - second_radius_m) <= screening_distance_m_ + filter_margin_m_) return true;
+  }
+  return false;
+}
+
+void ConjunctionScreening::RefineClosestApproach(const size_t first_object_id, const size_t second_object_id, const double time_s,
+                                                 const std::vector<libra::Vector<3>>& position_list_i_m,
+                                                 const std::vector<libra::Vector<3>>& velocity_list_i_m_s, ConjunctionEvent& event) const {
+  const double step_width_s = time_s - previous_time_s_;
+  const libra::Vector<3> p0 = previous_position_list_i_m_[second_object_id] - previous_position_list_i_m_[first_object_id];
+  const libra::Vector<3> v0 = step_width_s * (previous_velocity_list_i_m_s_[second_object_id] - previous_velocity_list_i_m_s_[first_object_id]);
+  const libra::Vector<3> p1 = position_list_i_m[second_object_id] - position_list_i_m[first_object_id];
+  const libra::Vector<3> v1 = step_width_s * (velocity_list_i_m_s[second_object_id] - velocity_list_i_m_s[first_object_id]);
+
+  // Cubic Hermite interpolation of the relative position with the normalized time s in [0, 1]
+  auto interpolate_position = [&](const double s) {
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    return (2.0 * s3 - 3.0 * s2 + 1.0) * p0 + (s3 - 2.0 * s2 + s) * v0 + (-2.0 * s3 + 3.0 * s2) * p1 + (s3 - s2) * v1;
+  };
+  // Derivative with respect to s
+  auto interpolate_velocity = [&](const double s) {
+    const double s2 = s * s;
+    return (6.0 * s2 - 6.0 * s) * p0 + (3.0 * s2 - 4.0 * s + 1.0) * v0 + (-6.0 * s2 + 6.0 * s) * p1 + (3.0 * s2 - 2.0 * s) * v1;
+  };
+  auto range_rate = [&](const double s) { return InnerProduct(interpolate_position(s), interpolate_velocity(s)); };
+
+  // Root-finding of the range rate with the Illinois method
+  double s_lower = 0.0;
+  double s_upper = 1.0;
+  double f_lower = range_rate(s_lower);
+  double f_upper = range_rate(s_upper);
+  double s = 0.5;
+  const size_t kMaxIteration = 100;
+  const double kTolerance = 1.0e-12;
+  // The range rate is converged when it is small relative to the values at the edges of the step
+  const double range_rate_tolerance = kTolerance * std::max(fabs(f_lower), fabs(f_upper));
+  int last_updated_side = 0;
+  for (size_t iteration = 0; iteration < kMaxIteration; iteration++) {
+    s = (f_upper - f_lower) != 0.0 ? (s_lower * f_upper - s_upper * f_lower) / (f_upper - f_lower) : 0.5 * (s_lower + s_upper);
+    const double f = range_rate(s);
+    if (fabs(f) <= range_rate_tolerance || s_upper - s_lower < kTolerance) break;
+    if (f < 0.0) {
+      s_lower = s;
+      f_lower = f;
+      if (last_updated_side == -1) f_upper *= 0.5;
+      last_updated_side = -1;
+    } else {
+      s_upper = s;
+      f_upper = f;
+      if (last_updated_side == 1) f_lower *= 0.5;
+      last_updated_side = 1;
+    }
+  }
+
+  const libra::Vector<3> relative_position_i_m = interpolate_position(s);
+  event.first_object_id = first_object_id;
+  event.second_object_id = second_object_id;
+  event.time_of_closest_approach_s = previous_time_s_ + s * step_width_s;
+  event.miss_distance_m = relative_position_i_m.CalcNorm();
+  event.relative_speed_m_s = interpolate_velocity(s).CalcNorm() / step_width_s;
+  event.relative_position_i_m = relative_position_i_m;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file conjunction_screening.hpp
+ * @brief Class to screen close approaches among many objects
+ */
+
+#ifndef S2E_SIMULATION_MULTIPLE_SPACECRAFT_CONJUNCTION_SCREENING_HPP_
+#define S2E_SIMULATION_MULTIPLE_SPACECRAFT_CONJUNCTION_SCREENING_HPP_
+
+#include <math_physics/math/vector.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ConjunctionEvent
+ * @brief Information of a close approach between two objects
+ */
+struct ConjunctionEvent {
+  size_t first_object_id;                  //!< ID of the first object (smaller ID)
+  size_t second_object_id;                 //!< ID of the second object (larger ID)
+  double time_of_closest_approach_s;       //!< Time of closest approach [s]
+  double miss_distance_m;                  //!< Distance at the closest approach [m]
+  double relative_speed_m_s;               //!< Relative speed at the closest approach [m/s]
+  libra::Vector<3> relative_position_i_m;  //!< Relative position of the second object from the first object at the closest approach [m]
+};
+
+/**
+ * @class ConjunctionScreening
+ * @brief Class to screen close approaches among many objects such as spacecraft and catalog objects
+ * @details Objects are given as position and velocity lists in the inertial frame at each screening step.
+ *          Candidate pairs are collected with a uniform-grid spatial hash, and filtered with the apogee/perigee filter and the orbit path filter.
+ *          The closest approach between the previous and the current steps is detected by the sign change of the range rate,
+ *          and the time of closest approach is refined by root-finding on the cubic Hermite interpolation of the relative state.
+ */
+class ConjunctionScreening {
+ public:
+  /**
+   * @fn ConjunctionScreening
+   * @brief Constructor
+   * @param [in] screening_distance_m: Threshold of the miss distance to report the event [m]
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the central body for the orbital filters [m3/s2]
+   * @param [in] filter_margin_m: Additional margin of the orbital filters to absorb the variation of the osculating orbit by perturbations [m]
+   * @param [in] path_filter_minimum_angle_rad: Minimum relative inclination to apply the orbit path filter [rad]
+   */
+  ConjunctionScreening(const double screening_distance_m, const double gravity_constant_m3_s2, const double filter_margin_m = 10.0e3,
+                       const double path_filter_minimum_angle_rad = 0.1);
+
+  /**
+   * @fn Screen
+   * @brief Screen close approaches between the previous step and this step
+   * @note The number and the order of objects must be the same for all steps. The first call only stores the states.
+   * @param [in] time_s: Current time [s]
+   * @param [in] position_list_i_m: Position list of objects in the inertial frame [m]
+   * @param [in] velocity_list_i_m_s: Velocity list of objects in the inertial frame [m/s]
+   * @return Events detected in this step
+   */
+  std::vector<ConjunctionEvent> Screen(const double time_s, const std::vector<libra::Vector<3>>& position_list_i_m,
+                                       const std::vector<libra::Vector<3>>& velocity_list_i_m_s);
+  /**
+   * @fn Reset
+   * @brief Clear the stored states and events
+   */
+  void Reset();
+  /**
+   * @fn WriteEvents
+   * @brief Write all detected events into a CSV file
+   * @param [in] file_name: Path of the output file
+   */
+  void WriteEvents(const std::string file_name) const;
+
+  // Getter
+  /**
+   * @fn GetEvents
+   * @brief Return all events detected after the last reset
+   */
+  inline const std::vector<ConjunctionEvent>& GetEvents() const { return events_; }
+  /**
+   * @fn GetNumberOfCandidatePairs
+   * @brief Return number of pairs picked up by the spatial hash in the last step
+   */
+  inline size_t GetNumberOfCandidatePairs() const { return number_of_candidate_pairs_; }
+  /**
+   * @fn GetNumberOfRefinedPairs
+   * @brief Return number of pairs passed all filters and refined in the last step
+   */
+  inline size_t GetNumberOfRefinedPairs() const { return number_of_refined_pairs_; }
+
+ private:
+  double screening_distance_m_;           //!< Threshold of the miss distance to report the event [m]
+  double gravity_constant_m3_s2_;         //!< Gravity constant of the central body [m3/s2]
+  double filter_margin_m_;                //!< Additional margin of the orbital filters [m]
+  double path_filter_minimum_angle_rad_;  //!< Minimum relative inclination to apply the orbit path filter [rad]
+
+  double previous_time_s_ = 0.0;                                //!< Time of the previous step [s]
+  std::vector<libra::Vector<3>> previous_position_list_i_m_;    //!< Position list at the previous step [m]
+  std::vector<libra::Vector<3>> previous_velocity_list_i_m_s_;  //!< Velocity list at the previous step [m/s]
+
+  std::vector<ConjunctionEvent> events_;  //!< Detected events
+  size_t number_of_candidate_pairs_ = 0;  //!< Number of pairs picked up by the spatial hash in the last step
+  size_t number_of_refined_pairs_ = 0;    //!< Number of pairs passed all filters in the last step
+
+  /**
+   * @struct OrbitGeometry
+   * @brief Osculating orbit geometry used in the filters
+   */
+  struct OrbitGeometry {
+    bool is_valid;                    //!< False for degenerated orbits such as radial trajectories
+    double perigee_radius_m;          //!< Perigee radius [m]
+    double apogee_radius_m;           //!< Apogee radius [m] (infinity for non-elliptic orbits)
+    double semi_latus_rectum_m;       //!< Semi-latus rectum [m]
+    libra::Vector<3> normal_i;        //!< Unit vector of the orbit normal
+    libra::Vector<3> eccentricity_i;  //!< Eccentricity vector
+  };
+
+  /**
+   * @fn CalcOrbitGeometry
+   * @brief Calculate osculating orbit geometry from the position and velocity
+   */
+  OrbitGeometry CalcOrbitGeometry(const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s) const;
+  /**
+   * @fn PassApogeePerigeeFilter
+   * @brief Return false when the radial ranges of two orbits are separated more than the screening distance
+   */
+  bool PassApogeePerigeeFilter(const OrbitGeometry& first, const OrbitGeometry& second) const;
+  /**
+   * @fn PassOrbitPathFilter
+   * @brief Return false when the radial distance between two orbit paths at both mutual nodes exceeds the screening distance
+   * @note The filter is skipped for nearly coplanar orbits since the mutual nodes are not well-defined.
+   *       The closest points of the paths are assumed to be near the mutual nodes, so the filter margin should be large enough for the relative
+   *       inclination close to path_filter_minimum_angle_rad.
+   */
+  bool PassOrbitPathFilter(const OrbitGeometry& first, const OrbitGeometry& second) const;
+  /**
+   * @fn RefineClosestApproach
+   * @brief Find the time of closest approach with the cubic Hermite interpolation of the relative state
+   * @param [in] first_object_id: ID of the first object
+   * @param [in] second_object_id: ID of the second object
+   * @param [in] time_s: Current time [s]
+   * @param [in] position_list_i_m: Current position list [m]
+   * @param [in] velocity_list_i_m_s: Current velocity list [m/s]
+   * @param [out] event: Event information
+   */
+  void RefineClosestApproach(const size_t first_object_id, const size_t second_object_id, const double time_s,
+                             const std::vector<libra::Vector<3>>& position_list_i_m, const std::vector<libra::Vector<3>>& velocity_list_i_m_s,
+                             ConjunctionEvent& event) const;
+};
+
+#endif  // S2E_SIMULATION_MULTIPLE_SPACECRAFT_CONJUNCTION_SCREENING_HPP_
@@ -1,10 +1,16 @@
 /**
  * @file inter_spacecraft_communication.cpp
- * @brief Base class of inter satellite communication
+ * @brief Message bus of the inter satellite communication
  */
 
 #include "inter_spacecraft_communication.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <logger/log_utility.hpp>
+#include <math_physics/math/constants.hpp>
 #include <utilities/macros.hpp>
 
 InterSpacecraftCommunication::InterSpacecraftCommunication(const SimulationConfiguration* simulation_configuration) {
@@ -12,3 +18,336 @@ InterSpacecraftCommunication::InterSpacecraftCommunication(const SimulationConfi
 }
 
 InterSpacecraftCommunication::~InterSpacecraftCommunication() {}
+
+size_t InterSpacecraftCommunication::RegisterLink(const size_t source_spacecraft_id, const size_t destination_spacecraft_id,
+                                                  const InterSpacecraftLinkParameters parameters, const Antenna* tx_antenna,
+                                                  const Antenna* rx_antenna) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const std::pair<size_t, size_t> key(source_spacecraft_id, destination_spacecraft_id);
+  if (link_index_map_.count(key) > 0) {
+    std::cerr << "[WARNING] Inter spacecraft communication: the link from " << source_spacecraft_id << " to " << destination_spacecraft_id
+              << " is already registered." << std::endl;
+    return link_index_map_[key];
+  }
+  if ((tx_antenna == nullptr) != (rx_antenna == nullptr)) {
+    std::cerr << "[WARNING] Inter spacecraft communication: both antennas are needed for the link budget. The data rate in the parameters is used."
+              << std::endl;
+    tx_antenna = nullptr;
+    rx_antenna = nullptr;
+  }
+
+  Link link;
+  link.source_spacecraft_id = source_spacecraft_id;
+  link.destination_spacecraft_id = destination_spacecraft_id;
+  link.parameters = parameters;
+  link.tx_antenna = tx_antenna;
+  link.rx_antenna = rx_antenna;
+  links_.push_back(link);
+  link_index_map_[key] = links_.size() - 1;
+  return links_.size() - 1;
+}
+
+bool InterSpacecraftCommunication::Send(const size_t source_spacecraft_id, const size_t destination_spacecraft_id,
+                                        std::shared_ptr<const std::vector<unsigned char>> payload) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const auto itr = link_index_map_.find(std::make_pair(source_spacecraft_id, destination_spacecraft_id));
+  if (itr == link_index_map_.end()) return false;
+  return Enqueue(links_[itr->second], std::move(payload));
+}
+
+size_t InterSpacecraftCommunication::Broadcast(const size_t source_spacecraft_id, std::shared_ptr<const std::vector<unsigned char>> payload) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  size_t number_of_accepted_links = 0;
+  for (auto& link : links_) {
+    if (link.source_spacecraft_id != source_spacecraft_id) continue;
+    if (Enqueue(link, payload)) number_of_accepted_links++;
+  }
+  return number_of_accepted_links;
+}
+
+std::vector<InterSpacecraftMessage> InterSpacecraftCommunication::Receive(const size_t destination_spacecraft_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::vector<InterSpacecraftMessage> messages;
+  for (auto& link : links_) {
+    if (link.destination_spacecraft_id != destination_spacecraft_id) continue;
+    std::move(link.receive_queue.begin(), link.receive_queue.end(), std::back_inserter(messages));
+    link.receive_queue.clear();
+  }
+  std::stable_sort(messages.begin(), messages.end(),
+                   [](const InterSpacecraftMessage& lhs, const InterSpacecraftMessage& rhs) { return lhs.delivery_time_s < rhs.delivery_time_s; });
+  return messages;
+}
+
+void InterSpacecraftCommunication::Update(const double elapsed_time_s, const RelativeInformation& relative_information) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  current_time_s_ = elapsed_time_s;
+  for (auto& link : links_) {
+    UpdateLinkState(link, relative_information);
+    UpdateQueues(link, elapsed_time_s);
+  }
+}
+
+void InterSpacecraftCommunication::Update(const double elapsed_time_s, const std::vector<InterSpacecraftLinkState>& link_states) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (link_states.size() != links_.size()) {
+    std::cerr << "[WARNING] Inter spacecraft communication: the number of the link states does not match. The links are not updated." << std::endl;
+    return;
+  }
+  current_time_s_ = elapsed_time_s;
+  for (size_t link_id = 0; link_id < links_.size(); link_id++) {
+    InterSpacecraftLinkState& state = links_[link_id].state;
+    state.is_available = link_states[link_id].is_available;
+    state.range_m = link_states[link_id].range_m;
+    state.propagation_delay_s = link_states[link_id].propagation_delay_s;
+    state.cn0_dBHz = link_states[link_id].cn0_dBHz;
+    state.data_rate_bps = link_states[link_id].data_rate_bps;
+    // A link without the data rate cannot transmit
+    if (state.data_rate_bps <= 0.0) state.is_available = false;
+    UpdateQueues(links_[link_id], elapsed_time_s);
+  }
+}
+
+size_t InterSpacecraftCommunication::GetTransmitQueueLength(const size_t link_id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return links_[link_id].transmit_queue.size();
+}
+
+void InterSpacecraftCommunication::UpdateQueues(Link& link, const double elapsed_time_s) {
+  // Transmission
+  if (link.state.is_available) {
+    while (!link.transmit_queue.empty()) {
+      InterSpacecraftMessage& message = link.transmit_queue.front();
+      const double start_time_s = std::max(link.transmitter_busy_until_s, message.send_time_s);
+      if (start_time_s > elapsed_time_s) break;
+      const double transmission_time_s = 8.0 * message.payload->size() / link.state.data_rate_bps;
+      link.transmitter_busy_until_s = start_time_s + transmission_time_s;
+      message.delivery_time_s = link.transmitter_busy_until_s + link.state.propagation_delay_s;
+      // A later message can arrive earlier when the delay decreases, so the message is inserted in the order of the delivery time
+      const auto position = std::upper_bound(link.in_flight_queue.begin(), link.in_flight_queue.end(), message.delivery_time_s,
+                                             [](const double delivery_time_s, const InterSpacecraftMessage& queued_message) {
+                                               return delivery_time_s < queued_message.delivery_time_s;
+                                             });
+      link.in_flight_queue.insert(position, std::move(message));
+      link.transmit_queue.pop_front();
+    }
+  } else {
+    // The transmitter waits for the link
+    link.transmitter_busy_until_s = std::max(link.transmitter_busy_until_s, elapsed_time_s);
+  }
+
+  // Delivery of all arrived messages
+  while (!link.in_flight_queue.empty() && link.in_flight_queue.front().delivery_time_s <= elapsed_time_s) {
+    if (link.receive_queue.size() < link.parameters.queue_capacity) {
+      link.receive_queue.push_back(std::move(link.in_flight_queue.front()));
+      link.state.number_of_delivered_messages++;
+    } else {
+      link.state.number_of_dropped_messages++;
+    }
+    link.in_flight_queue.pop_front();
+  }
+}
+
+bool InterSpacecraftCommunication::Enqueue(Link& link, std::shared_ptr<const std::vector<unsigned char>> payload) {
+  if (payload == nullptr) return false;
+  if (link.transmit_queue.size() >= link.parameters.queue_capacity) {
+    link.state.number_of_dropped_messages++;
+    return false;
+  }
+
+  InterSpacecraftMessage message;
+  message.source_spacecraft_id = link.source_spacecraft_id;
+  message.destination_spacecraft_id = link.destination_spacecraft_id;
+  message.send_time_s = current_time_s_;
+  message.delivery_time_s = 0.0;
+  message.payload = std::move(payload);
+  link.transmit_queue.push_back(std::move(message));
+  link.state.number_of_sent_messages++;
+  return true;
+}
+
+void InterSpacecraftCommunication::UpdateLinkState(Link& link, const RelativeInformation& relative_information) {
+  InterSpacecraftLinkState& state = link.state;
+  state.range_m = relative_information.GetRelativeDistance_m(link.destination_spacecraft_id, link.source_spacecraft_id);
+  state.propagation_delay_s = state.range_m / environment::speed_of_light_m_s;
+  state.is_available = false;
+  state.cn0_dBHz = 0.0;
+  state.data_rate_bps = 0.0;
+  if (state.range_m > link.parameters.maximum_range_m) return;
+
+  // Line of sight: the closest point of the segment between the spacecraft must be outside the blocking sphere
+  const Dynamics& source_dynamics = *relative_information.GetReferenceSatDynamics(link.source_spacecraft_id);
+  const Dynamics& destination_dynamics = *relative_information.GetReferenceSatDynamics(link.destination_spacecraft_id);
+  const libra::Vector<3> source_position_i_m = source_dynamics.GetOrbit().GetPosition_i_m();
+  const libra::Vector<3> relative_position_i_m =
+      relative_information.GetRelativePosition_i_m(link.destination_spacecraft_id, link.source_spacecraft_id);
+  if (state.range_m > 0.0) {
+    double ratio = -libra::InnerProduct(source_position_i_m, relative_position_i_m) / (state.range_m * state.range_m);
+    ratio = std::min(std::max(ratio, 0.0), 1.0);
+    const libra::Vector<3> closest_position_i_m = source_position_i_m + ratio * relative_position_i_m;
+    if (closest_position_i_m.CalcNorm() < link.parameters.blocking_radius_m) return;
+  }
+
+  // Data rate
+  if (link.tx_antenna == nullptr) {
+    state.data_rate_bps = link.parameters.data_rate_bps;
+  } else {
+    if (!link.tx_antenna->IsTransmitter() || !link.rx_antenna->IsReceiver()) return;
+    state.cn0_dBHz = CalcCn0_dBHz(link, source_dynamics, destination_dynamics, state.range_m);
+    const InterSpacecraftLinkParameters& parameters = link.parameters;
+    const double margin_for_bitrate_dB =
+        state.cn0_dBHz - (parameters.ebn0_dB + parameters.hardware_deterioration_dB + parameters.coding_gain_dB) - parameters.margin_requirement_dB;
+    state.data_rate_bps = std::min(pow(10.0, margin_for_bitrate_dB / 10.0), link.tx_antenna->GetBitrate_bps());
+    // A link with less than 1 bps is regarded as disconnected
+    if (state.data_rate_bps < 1.0) state.data_rate_bps = 0.0;
+  }
+  state.is_available = state.data_rate_bps > 0.0;
+}
+
+double InterSpacecraftCommunication::CalcCn0_dBHz(const Link& link, const Dynamics& source_dynamics, const Dynamics& destination_dynamics,
+                                                  const double range_m) const {
+  // Free space path loss
+  const double range_km = std::max(range_m, 1.0) / 1000.0;
+  const double loss_space_dB = -20.0 * log10(4.0 * libra::pi * range_km / (300.0 / link.tx_antenna->GetFrequency_MHz() / 1000.0));
+
+  // Destination direction on the TX antenna frame
+  libra::Vector<3> source_to_destination_i = destination_dynamics.GetOrbit().GetPosition_i_m() - source_dynamics.GetOrbit().GetPosition_i_m();
+  source_to_destination_i = source_to_destination_i.CalcNormalizedVector();
+  const libra::Quaternion q_i_to_tx_antenna = link.tx_antenna->GetQuaternion_b2c() * source_dynamics.GetAttitude().GetQuaternion_i2b();
+  const libra::Vector<3> destination_direction_on_tx_frame = q_i_to_tx_antenna.FrameConversion(source_to_destination_i);
+  const double theta_on_tx_antenna_rad = acos(destination_direction_on_tx_frame[2]);
+  const double phi_on_tx_antenna_rad = atan2(destination_direction_on_tx_frame[1], destination_direction_on_tx_frame[0]);
+
+  // Source direction on the RX antenna frame
+  const libra::Vector<3> destination_to_source_i = -1.0 * source_to_destination_i;
+  const libra::Quaternion q_i_to_rx_antenna = link.rx_antenna->GetQuaternion_b2c() * destination_dynamics.GetAttitude().GetQuaternion_i2b();
+  const libra::Vector<3> source_direction_on_rx_frame = q_i_to_rx_antenna.FrameConversion(destination_to_source_i);
+  const double theta_on_rx_antenna_rad = acos(source_direction_on_rx_frame[2]);
+  const double phi_on_rx_antenna_rad = atan2(source_direction_on_rx_frame[1], source_direction_on_rx_frame[0]);
+
+  // Calc CN0
+  return link.tx_antenna->CalcTxEirp_dBW(theta_on_tx_antenna_rad, phi_on_tx_antenna_rad) + loss_space_dB + link.parameters.loss_polarization_dB +
+         link.parameters.loss_others_dB + link.rx_antenna->CalcRxGt_dB_K(theta_on_rx_antenna_rad, phi_on_rx_antenna_rad) -
+         10.0 * log10(environment::boltzmann_constant_J_K);
+}
+
+std::string InterSpacecraftCommunication::GetLogHeader() const {
+  std::string str_tmp = "";
+
+  for (const auto& link : links_) {
+    const std::string head = "isl_" + std::to_string(link.source_spacecraft_id) + "_to_" + std::to_string(link.destination_spacecraft_id) + "_";
+    str_tmp += WriteScalar(head + "available", "-");
+    str_tmp += WriteScalar(head + "range", "m");
+    str_tmp += WriteScalar(head + "data_rate", "bps");
+    str_tmp += WriteScalar(head + "transmit_queue", "-");
+    str_tmp += WriteScalar(head + "dropped_messages", "-");
+  }
+
+  return str_tmp;
+}
+
+std::string InterSpacecraftCommunication::GetLogValue() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string str_tmp = "";
+
+  for (const auto& link : links_) {
+    str_tmp += WriteScalar(link.state.is_available);
+    str_tmp += WriteScalar(link.state.range_m);
+    str_tmp += WriteScalar(link.state.data_rate_bps);
+    str_tmp += WriteScalar(link.transmit_queue.size());
+    str_tmp += WriteScalar(link.state.number_of_dropped_messages);
+  }
+
+  return str_tmp;
+}
+
+/**
+ * @fn WriteMessages
+ * @brief Write the messages including the payload into the checkpoint
+ */
+static void WriteMessages(CheckpointWriter& writer, const std::deque<InterSpacecraftMessage>& messages) {
+  writer.Write((uint64_t)messages.size());
+  for (const auto& message : messages) {
+    writer.Write((uint64_t)message.source_spacecraft_id);
+    writer.Write((uint64_t)message.destination_spacecraft_id);
+    writer.Write(message.send_time_s);
+    writer.Write(message.delivery_time_s);
+    writer.Write(*message.payload);
+  }
+}
+
+/**
+ * @fn ReadMessages
+ * @brief Read the messages written by WriteMessages
+ */
+static void ReadMessages(CheckpointReader& reader, std::deque<InterSpacecraftMessage>& messages) {
+  uint64_t size = 0;
+  reader.Read(size);
+  messages.clear();
+  for (uint64_t i = 0; i < size && reader.IsGood(); i++) {
+    InterSpacecraftMessage message;
+    uint64_t id = 0;
+    reader.Read(id);
+    message.source_spacecraft_id = (size_t)id;
+    reader.Read(id);
+    message.destination_spacecraft_id = (size_t)id;
+    reader.Read(message.send_time_s);
+    reader.Read(message.delivery_time_s);
+    std::vector<unsigned char> payload;
+    reader.Read(payload);
+    message.payload = std::make_shared<const std::vector<unsigned char>>(std::move(payload));
+    messages.push_back(std::move(message));
+  }
+}
+
+void InterSpacecraftCommunication::SaveCheckpoint(CheckpointWriter& writer) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  writer.Write(current_time_s_);
+  writer.Write((uint64_t)links_.size());
+  for (const auto& link : links_) {
+    writer.Write((uint64_t)link.source_spacecraft_id);
+    writer.Write((uint64_t)link.destination_spacecraft_id);
+    writer.Write(link.state);
+    writer.Write(link.transmitter_busy_until_s);
+    WriteMessages(writer, link.transmit_queue);
+    WriteMessages(writer, link.in_flight_queue);
+    WriteMessages(writer, link.receive_queue);
+  }
+}
+
+void InterSpacecraftCommunication::LoadCheckpoint(CheckpointReader& reader) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  reader.Read(current_time_s_);
+  uint64_t number_of_links = 0;
+  reader.Read(number_of_links);
+  if (!reader.IsGood()) return;
+  if (number_of_links != links_.size()) {
+    std::cerr << "[WARNING] Inter spacecraft communication: the number of links in the checkpoint does not match." << std::endl;
+    reader.SetFailed();
+    return;
+  }
+  for (auto& link : links_) {
+    uint64_t source_spacecraft_id = 0;
+    uint64_t destination_spacecraft_id = 0;
+    reader.Read(source_spacecraft_id);
+    reader.Read(destination_spacecraft_id);
+    if (!reader.IsGood()) return;
+    if (source_spacecraft_id != link.source_spacecraft_id || destination_spacecraft_id != link.destination_spacecraft_id) {
+      std::cerr << "[WARNING] Inter spacecraft communication: the links in the checkpoint do not match." << std::endl;
+      reader.SetFailed();
+      return;
+    }
+    reader.Read(link.state);
+    reader.Read(link.transmitter_busy_until_s);
+    ReadMessages(reader, link.transmit_queue);
+    ReadMessages(reader, link.in_flight_queue);
+    ReadMessages(reader, link.receive_queue);
+  }
+}
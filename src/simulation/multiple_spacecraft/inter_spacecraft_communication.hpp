@@ -1,18 +1,83 @@
 /**
- * @file inter_spacecraft_communication.h
- * @brief Base class of inter satellite communication
+ * @file inter_spacecraft_communication.hpp
+ * @brief Message bus of the inter satellite communication
  */
 
 #ifndef S2E_SIMULATION_MULTIPLE_SPACECRAFT_INTER_SPACECRAFT_COMMUNICATION_HPP_
 #define S2E_SIMULATION_MULTIPLE_SPACECRAFT_INTER_SPACECRAFT_COMMUNICATION_HPP_
 
+#include <components/real/communication/antenna.hpp>
+#include <deque>
+#include <environment/global/physical_constants.hpp>
+#include <logger/loggable.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utilities/checkpoint.hpp>
+#include <utility>
+#include <vector>
+
 #include "../simulation_configuration.hpp"
+#include "relative_information.hpp"
+
+/**
+ * @struct InterSpacecraftMessage
+ * @brief Message transferred between spacecraft
+ * @note The payload is shared and immutable. The bytes are not copied when the message is queued, broadcasted, and handed to the components.
+ */
+struct InterSpacecraftMessage {
+  size_t source_spacecraft_id;                                //!< ID of the source spacecraft
+  size_t destination_spacecraft_id;                           //!< ID of the destination spacecraft
+  double send_time_s;                                         //!< Elapsed time when the message is queued [s]
+  double delivery_time_s;                                     //!< Elapsed time when the message arrives at the destination [s]
+  std::shared_ptr<const std::vector<unsigned char>> payload;  //!< Payload data
+};
+
+/**
+ * @struct InterSpacecraftLinkParameters
+ * @brief Parameters of a link between spacecraft
+ * @note The definitions of the losses and the requirements are same with GroundStationCalculator
+ */
+struct InterSpacecraftLinkParameters {
+  size_t queue_capacity = 64;                                                   //!< Maximum number of messages in each queue of the link
+  double maximum_range_m = 1.0e9;                                               //!< Maximum communication range [m]
+  double blocking_radius_m = environment::earth_equatorial_radius_m + 100.0e3;  //!< Radius of the central body blocking the line of sight [m]
+  double data_rate_bps = 1.0e6;                                                 //!< Data rate used when the antennas are not given [bps]
+  double loss_polarization_dB = 0.0;                                            //!< Loss by the polarization [dB]
+  double loss_others_dB = 0.0;                                                  //!< Other losses such as pointing [dB]
+  double ebn0_dB = 0.0;                                                         //!< Required Eb/N0 [dB]
+  double hardware_deterioration_dB = 0.0;                                       //!< Hardware deterioration [dB]
+  double coding_gain_dB = 0.0;                                                  //!< Coding gain [dB]
+  double margin_requirement_dB = 0.0;                                           //!< Required margin [dB]
+};
+
+/**
+ * @struct InterSpacecraftLinkState
+ * @brief State and statistics of a link evaluated at Update
+ */
+struct InterSpacecraftLinkState {
+  bool is_available = false;                //!< Flag of the link availability
+  double range_m = 0.0;                     //!< Distance between the spacecraft [m]
+  double propagation_delay_s = 0.0;         //!< Light time delay [s]
+  double cn0_dBHz = 0.0;                    //!< Carrier to noise density ratio [dBHz]
+  double data_rate_bps = 0.0;               //!< Data rate of the link [bps]
+  size_t number_of_sent_messages = 0;       //!< Number of accepted messages
+  size_t number_of_delivered_messages = 0;  //!< Number of messages delivered to the receive queue
+  size_t number_of_dropped_messages = 0;    //!< Number of messages dropped by the full queues
+};
 
 /**
  * @class InterSpacecraftCommunication
- * @brief Base class of inter satellite communication
+ * @brief Message bus of the inter satellite communication
+ * @details Each directed link between two spacecraft has bounded transmit and receive queues. At Update, the range and the light time delay
+ *          are calculated with RelativeInformation, and the availability and the data rate are evaluated with the line of sight, the maximum
+ *          range, and the link budget of the antennas. The queued messages are transmitted sequentially with the data rate, and they are moved to
+ *          the receive queue when the transmission time plus the delay has passed. Since the delay changes with the range, the messages in flight
+ *          are kept in the order of the delivery time. Messages which do not fit in the full queues are dropped.
+ *          The messages are delivered with the resolution of the Update interval. Send and Receive can be called during the parallel update of
+ *          the spacecraft.
  */
-class InterSpacecraftCommunication {
+class InterSpacecraftCommunication : public ILoggable, public ICheckpointable {
  public:
   /**
    * @fn InterSpacecraftCommunication
@@ -25,7 +90,155 @@ class InterSpacecraftCommunication {
    */
   ~InterSpacecraftCommunication();
 
+  /**
+   * @fn RegisterLink
+   * @brief Register a directed link between spacecraft
+   * @note When the antennas are not given, the link budget is not evaluated and the data rate in the parameters is used.
+   * @param [in] source_spacecraft_id: ID of the source spacecraft
+   * @param [in] destination_spacecraft_id: ID of the destination spacecraft
+   * @param [in] parameters: Parameters of the link
+   * @param [in] tx_antenna: Transmitter antenna on the source spacecraft
+   * @param [in] rx_antenna: Receiver antenna on the destination spacecraft
+   * @return Index of the link
+   */
+  size_t RegisterLink(const size_t source_spacecraft_id, const size_t destination_spacecraft_id, const InterSpacecraftLinkParameters parameters,
+                      const Antenna* tx_antenna = nullptr, const Antenna* rx_antenna = nullptr);
+  /**
+   * @fn Send
+   * @brief Queue a message on the link at the time of the last Update
+   * @param [in] source_spacecraft_id: ID of the source spacecraft
+   * @param [in] destination_spacecraft_id: ID of the destination spacecraft
+   * @param [in] payload: Payload data
+   * @return False when the link is not registered or the transmit queue is full
+   */
+  bool Send(const size_t source_spacecraft_id, const size_t destination_spacecraft_id, std::shared_ptr<const std::vector<unsigned char>> payload);
+  /**
+   * @fn Broadcast
+   * @brief Queue a message on all links from the source spacecraft with the shared payload
+   * @param [in] source_spacecraft_id: ID of the source spacecraft
+   * @param [in] payload: Payload data
+   * @return Number of links which accepted the message
+   */
+  size_t Broadcast(const size_t source_spacecraft_id, std::shared_ptr<const std::vector<unsigned char>> payload);
+  /**
+   * @fn Receive
+   * @brief Take the delivered messages for the destination spacecraft
+   * @param [in] destination_spacecraft_id: ID of the destination spacecraft
+   * @return Delivered messages sorted by the delivery time
+   */
+  std::vector<InterSpacecraftMessage> Receive(const size_t destination_spacecraft_id);
+  /**
+   * @fn Update
+   * @brief Update the link states, transmit the queued messages, and deliver the arrived messages
+   * @note Call after Update of RelativeInformation
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   * @param [in] relative_information: Relative information of the spacecraft
+   */
+  void Update(const double elapsed_time_s, const RelativeInformation& relative_information);
+  /**
+   * @fn Update
+   * @brief Update the link states with the given states, transmit the queued messages, and deliver the arrived messages
+   * @note Use this function when the links are evaluated outside, e.g. with a contact plan. The availability, the range, the propagation delay,
+   *       C/N0, and the data rate are copied from the given states, and the message statistics are kept.
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   * @param [in] link_states: States of all links in the order of the registration
+   */
+  void Update(const double elapsed_time_s, const std::vector<InterSpacecraftLinkState>& link_states);
+
+  // Getter
+  /**
+   * @fn GetNumberOfLinks
+   * @brief Return number of the registered links
+   */
+  inline size_t GetNumberOfLinks() const { return links_.size(); }
+  /**
+   * @fn GetLinkState
+   * @brief Return state of the link
+   * @param [in] link_id: Index of the link
+   */
+  inline const InterSpacecraftLinkState& GetLinkState(const size_t link_id) const { return links_[link_id].state; }
+  /**
+   * @fn GetTransmitQueueLength
+   * @brief Return number of messages waiting for the transmission on the link
+   * @param [in] link_id: Index of the link
+   */
+  size_t GetTransmitQueueLength(const size_t link_id) const;
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const;
+
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the queued messages and the link states into the checkpoint
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the queued messages and the link states from the checkpoint
+   * @note The same links must be registered before the loading. Otherwise, the reader is marked as failed.
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
  private:
+  /**
+   * @struct Link
+   * @brief Directed link between spacecraft
+   */
+  struct Link {
+    size_t source_spacecraft_id;                         //!< ID of the source spacecraft
+    size_t destination_spacecraft_id;                    //!< ID of the destination spacecraft
+    InterSpacecraftLinkParameters parameters;            //!< Parameters of the link
+    const Antenna* tx_antenna;                           //!< Transmitter antenna on the source spacecraft
+    const Antenna* rx_antenna;                           //!< Receiver antenna on the destination spacecraft
+    InterSpacecraftLinkState state;                      //!< State of the link
+    double transmitter_busy_until_s = 0.0;               //!< End time of the last transmission [s]
+    std::deque<InterSpacecraftMessage> transmit_queue;   //!< Messages waiting for the transmission
+    std::deque<InterSpacecraftMessage> in_flight_queue;  //!< Transmitted messages before the arrival sorted by the delivery time
+    std::deque<InterSpacecraftMessage> receive_queue;    //!< Arrived messages before Receive
+  };
+
+  std::vector<Link> links_;                                     //!< Registered links
+  std::map<std::pair<size_t, size_t>, size_t> link_index_map_;  //!< Index of the link from (source ID, destination ID)
+  double current_time_s_ = 0.0;                                 //!< Elapsed time at the last Update [s]
+  mutable std::mutex mutex_;                                    //!< Mutex of the queues for the spacecraft updated in parallel
+
+  /**
+   * @fn Enqueue
+   * @brief Queue a message on the link without locking
+   * @return False when the transmit queue is full
+   */
+  bool Enqueue(Link& link, std::shared_ptr<const std::vector<unsigned char>> payload);
+  /**
+   * @fn UpdateLinkState
+   * @brief Evaluate the range, the line of sight, and the link budget of the link
+   */
+  void UpdateLinkState(Link& link, const RelativeInformation& relative_information);
+  /**
+   * @fn UpdateQueues
+   * @brief Transmit the queued messages and deliver the arrived messages of the link
+   * @param [in] link: Target link
+   * @param [in] elapsed_time_s: Elapsed time of the simulation [s]
+   */
+  void UpdateQueues(Link& link, const double elapsed_time_s);
+  /**
+   * @fn CalcCn0_dBHz
+   * @brief Calculate the carrier to noise density ratio of the link with the antennas
+   * @param [in] link: Target link
+   * @param [in] source_dynamics: Dynamics of the source spacecraft
+   * @param [in] destination_dynamics: Dynamics of the destination spacecraft
+   * @param [in] range_m: Distance between the spacecraft [m]
+   */
+  double CalcCn0_dBHz(const Link& link, const Dynamics& source_dynamics, const Dynamics& destination_dynamics, const double range_m) const;
 };
 
 #endif  // S2E_SIMULATION_MULTIPLE_SPACECRAFT_INTER_SPACECRAFT_COMMUNICATION_HPP_
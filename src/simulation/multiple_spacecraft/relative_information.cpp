@@ -5,36 +5,30 @@
 
 #include "relative_information.hpp"
 
+#include <algorithm>
+
 RelativeInformation::RelativeInformation() {}
 
 RelativeInformation::~RelativeInformation() {}
 
 void RelativeInformation::Update() {
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < dynamics_database_.size(); reference_spacecraft_id++) {
-      // Position
-      libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id] = target_sat_pos_i - reference_sat_pos_i;
-      relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id);
-
-      // Distance
-      relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id] =
-          relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id].CalcNorm();
-
-      // Velocity
-      libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id] = target_sat_vel_i - reference_sat_vel_i;
-      relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id);
-
-      // Attitude Quaternion
-      relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeAttitudeQuaternion(target_spacecraft_id, reference_spacecraft_id);
-    }
+  for (size_t spacecraft_id = 0; spacecraft_id < dynamics_database_.size(); spacecraft_id++) {
+    const Dynamics* dynamics = dynamics_database_.at(spacecraft_id);
+    // The state of the spacecraft without dynamics is given by SetSpacecraftState
+    if (dynamics == nullptr) continue;
+    position_list_i_m_[spacecraft_id] = dynamics->GetOrbit().GetPosition_i_m();
+    velocity_list_i_m_s_[spacecraft_id] = dynamics->GetOrbit().GetVelocity_i_m_s();
+    quaternion_list_i2b_[spacecraft_id] = dynamics->GetAttitude().GetQuaternion_i2b();
   }
+  // Invalidate all cached values
+  update_count_++;
+}
+
+void RelativeInformation::SetSpacecraftState(const size_t spacecraft_id, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s,
+                                             const libra::Quaternion quaternion_i2b) {
+  position_list_i_m_[spacecraft_id] = position_i_m;
+  velocity_list_i_m_s_[spacecraft_id] = velocity_i_m_s;
+  quaternion_list_i2b_[spacecraft_id] = quaternion_i2b;
 }
 
 void RelativeInformation::RegisterDynamicsInfo(const size_t spacecraft_id, const Dynamics* dynamics) {
@@ -44,37 +38,35 @@ void RelativeInformation::RegisterDynamicsInfo(const size_t spacecraft_id, const
 
 void RelativeInformation::RemoveDynamicsInfo(const size_t spacecraft_id) {
   dynamics_database_.erase(spacecraft_id);
+  registered_pairs_.erase(std::remove_if(registered_pairs_.begin(), registered_pairs_.end(),
+                                         [spacecraft_id](const std::pair<size_t, size_t>& pair) {
+                                           return pair.first == spacecraft_id || pair.second == spacecraft_id;
+                                         }),
+                          registered_pairs_.end());
   ResizeLists();
 }
 
+void RelativeInformation::RegisterPair(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
+  const std::pair<size_t, size_t> pair(target_spacecraft_id, reference_spacecraft_id);
+  if (std::find(registered_pairs_.begin(), registered_pairs_.end(), pair) != registered_pairs_.end()) return;
+  registered_pairs_.push_back(pair);
+}
+
 std::string RelativeInformation::GetLogHeader() const {
   std::string str_tmp = "";
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(
-          "satellite" + std::to_string(target_spacecraft_id) + "_position_from_satellite" + std::to_string(reference_spacecraft_id), "i", "m", 3);
-    }
-  }
+  log_pairs_ = GetLogPairs();
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(
-          "satellite" + std::to_string(target_spacecraft_id) + "_velocity_from_satellite" + std::to_string(reference_spacecraft_id), "i", "m/s", 3);
-    }
+  for (auto pair : log_pairs_) {
+    str_tmp += WriteVector("satellite" + std::to_string(pair.first) + "_position_from_satellite" + std::to_string(pair.second), "i", "m", 3);
   }
-
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(
-          "satellite" + std::to_string(target_spacecraft_id) + "_position_from_satellite" + std::to_string(reference_spacecraft_id), "rtn", "m", 3);
-    }
+  for (auto pair : log_pairs_) {
+    str_tmp += WriteVector("satellite" + std::to_string(pair.first) + "_velocity_from_satellite" + std::to_string(pair.second), "i", "m/s", 3);
   }
-
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(
-          "satellite" + std::to_string(target_spacecraft_id) + "_velocity_from_satellite" + std::to_string(reference_spacecraft_id), "rtn", "m/s", 3);
-    }
+  for (auto pair : log_pairs_) {
+    str_tmp += WriteVector("satellite" + std::to_string(pair.first) + "_position_from_satellite" + std::to_string(pair.second), "rtn", "m", 3);
+  }
+  for (auto pair : log_pairs_) {
+    str_tmp += WriteVector("satellite" + std::to_string(pair.first) + "_velocity_from_satellite" + std::to_string(pair.second), "rtn", "m/s", 3);
   }
 
   return str_tmp;
@@ -82,28 +74,23 @@ std::string RelativeInformation::GetLogHeader() const {
 
 std::string RelativeInformation::GetLogValue() const {
   std::string str_tmp = "";
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativePosition_i_m(target_spacecraft_id, reference_spacecraft_id));
-    }
+  // Zero is logged for the spacecraft removed after the log header is written
+  const size_t number_of_spacecraft = dynamics_database_.size();
+  auto is_removed = [number_of_spacecraft](const std::pair<size_t, size_t>& pair) {
+    return pair.first >= number_of_spacecraft || pair.second >= number_of_spacecraft;
+  };
+
+  for (auto pair : log_pairs_) {
+    str_tmp += WriteVector(is_removed(pair) ? libra::Vector<3>(0.0) : GetRelativePosition_i_m(pair.first, pair.second));
   }
-
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativeVelocity_i_m_s(target_spacecraft_id, reference_spacecraft_id));
-    }
+  for (auto pair : log_pairs_) {
+    str_tmp += WriteVector(is_removed(pair) ? libra::Vector<3>(0.0) : GetRelativeVelocity_i_m_s(pair.first, pair.second));
   }
-
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id));
-    }
+  for (auto pair : log_pairs_) {
+    str_tmp += WriteVector(is_removed(pair) ? libra::Vector<3>(0.0) : GetRelativePosition_rtn_m(pair.first, pair.second));
   }
-
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id));
-    }
+  for (auto pair : log_pairs_) {
+    str_tmp += WriteVector(is_removed(pair) ? libra::Vector<3>(0.0) : GetRelativeVelocity_rtn_m_s(pair.first, pair.second));
   }
 
   return str_tmp;
@@ -111,55 +98,132 @@ std::string RelativeInformation::GetLogValue() const {
 
 void RelativeInformation::LogSetup(Logger& logger) { logger.AddLogList(this); }
 
-libra::Quaternion RelativeInformation::CalcRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
-  // Observer SC Body frame(obs_sat) -> ECI frame(i)
-  libra::Quaternion q_reference_i2b = dynamics_database_.at(reference_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
-  libra::Quaternion q_reference_b2i = q_reference_i2b.Conjugate();
+libra::Quaternion RelativeInformation::GetRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  if (target_spacecraft_id == reference_spacecraft_id) return libra::Quaternion(0.0, 0.0, 0.0, 1.0);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const size_t larger_spacecraft_id = std::max(target_spacecraft_id, reference_spacecraft_id);
+  const size_t smaller_spacecraft_id = std::min(target_spacecraft_id, reference_spacecraft_id);
+  const size_t index = GetLowerTriangleIndex(larger_spacecraft_id, smaller_spacecraft_id);
+
+  if (attitude_update_count_list_[index] != update_count_) {
+    // Larger ID body frame -> ECI frame -> Smaller ID body frame
+    relative_attitude_quaternion_list_[index] = quaternion_list_i2b_[larger_spacecraft_id] * quaternion_list_i2b_[smaller_spacecraft_id].Conjugate();
+    attitude_update_count_list_[index] = update_count_;
+  }
 
-  // ECI frame(i) -> Target SC body frame(main_sat)
-  libra::Quaternion q_target_i2b = dynamics_database_.at(target_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
+  if (target_spacecraft_id > reference_spacecraft_id) return relative_attitude_quaternion_list_[index];
+  return relative_attitude_quaternion_list_[index].Conjugate();
+}
 
-  return q_target_i2b * q_reference_b2i;
+libra::Vector<3> RelativeInformation::GetRelativePosition_i_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  if (target_spacecraft_id == reference_spacecraft_id) return libra::Vector<3>(0.0);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (target_spacecraft_id > reference_spacecraft_id) {
+    return relative_position_list_i_m_[EvaluateInertialInformation(target_spacecraft_id, reference_spacecraft_id)];
+  }
+  return -relative_position_list_i_m_[EvaluateInertialInformation(reference_spacecraft_id, target_spacecraft_id)];
 }
 
-libra::Vector<3> RelativeInformation::CalcRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+libra::Vector<3> RelativeInformation::GetRelativeVelocity_i_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  if (target_spacecraft_id == reference_spacecraft_id) return libra::Vector<3>(0.0);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (target_spacecraft_id > reference_spacecraft_id) {
+    return relative_velocity_list_i_m_s_[EvaluateInertialInformation(target_spacecraft_id, reference_spacecraft_id)];
+  }
+  return -relative_velocity_list_i_m_s_[EvaluateInertialInformation(reference_spacecraft_id, target_spacecraft_id)];
+}
 
-  // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
+double RelativeInformation::GetRelativeDistance_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  if (target_spacecraft_id == reference_spacecraft_id) return 0.0;
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const size_t larger_spacecraft_id = std::max(target_spacecraft_id, reference_spacecraft_id);
+  const size_t smaller_spacecraft_id = std::min(target_spacecraft_id, reference_spacecraft_id);
+  return relative_distance_list_m_[EvaluateInertialInformation(larger_spacecraft_id, smaller_spacecraft_id)];
+}
+
+libra::Vector<3> RelativeInformation::GetRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  if (target_spacecraft_id == reference_spacecraft_id) return libra::Vector<3>(0.0);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return relative_position_list_rtn_m_[EvaluateRtnInformation(target_spacecraft_id, reference_spacecraft_id)];
+}
+
+libra::Vector<3> RelativeInformation::GetRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  if (target_spacecraft_id == reference_spacecraft_id) return libra::Vector<3>(0.0);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return relative_velocity_list_rtn_m_s_[EvaluateRtnInformation(target_spacecraft_id, reference_spacecraft_id)];
+}
+
+std::vector<std::pair<size_t, size_t>> RelativeInformation::GetLogPairs() const {
+  if (!registered_pairs_.empty()) return registered_pairs_;
 
-  libra::Vector<3> relative_pos_rtn = q_i2rtn.FrameConversion(relative_pos_i);
-  return relative_pos_rtn;
+  std::vector<std::pair<size_t, size_t>> log_pairs;
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      log_pairs.push_back(std::make_pair(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+  return log_pairs;
 }
 
-libra::Vector<3> RelativeInformation::CalcRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+size_t RelativeInformation::EvaluateInertialInformation(const size_t larger_spacecraft_id, const size_t smaller_spacecraft_id) const {
+  const size_t index = GetLowerTriangleIndex(larger_spacecraft_id, smaller_spacecraft_id);
+  if (inertial_update_count_list_[index] == update_count_) return index;
+
+  relative_position_list_i_m_[index] = position_list_i_m_[larger_spacecraft_id] - position_list_i_m_[smaller_spacecraft_id];
+  relative_velocity_list_i_m_s_[index] = velocity_list_i_m_s_[larger_spacecraft_id] - velocity_list_i_m_s_[smaller_spacecraft_id];
+  relative_distance_list_m_[index] = relative_position_list_i_m_[index].CalcNorm();
+  inertial_update_count_list_[index] = update_count_;
+  return index;
+}
+
+size_t RelativeInformation::EvaluateRtnInformation(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
+  const size_t index = target_spacecraft_id * dynamics_database_.size() + reference_spacecraft_id;
+  if (rtn_update_count_list_[index] == update_count_) return index;
 
   // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
+  EvaluateRtnFrame(reference_spacecraft_id);
+  const libra::Vector<3> relative_position_i_m = position_list_i_m_[target_spacecraft_id] - position_list_i_m_[reference_spacecraft_id];
+  const libra::Vector<3> relative_velocity_i_m_s = velocity_list_i_m_s_[target_spacecraft_id] - velocity_list_i_m_s_[reference_spacecraft_id] -
+                                                   cross(rtn_angular_velocity_list_i_rad_s_[reference_spacecraft_id], relative_position_i_m);
+  const libra::Quaternion& q_i2rtn = quaternion_list_i2rtn_[reference_spacecraft_id];
+  relative_position_list_rtn_m_[index] = q_i2rtn.FrameConversion(relative_position_i_m);
+  relative_velocity_list_rtn_m_s_[index] = q_i2rtn.FrameConversion(relative_velocity_i_m_s);
+  rtn_update_count_list_[index] = update_count_;
+  return index;
+}
 
-  // Rotation vector of RTN frame
-  libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> rot_vec_rtn_i = cross(reference_sat_pos_i, reference_sat_vel_i);
-  double r2_ref = reference_sat_pos_i.CalcNorm() * reference_sat_pos_i.CalcNorm();
-  rot_vec_rtn_i /= r2_ref;
-  libra::Vector<3> relative_vel_i = target_sat_vel_i - reference_sat_vel_i - cross(rot_vec_rtn_i, relative_pos_i);
+void RelativeInformation::EvaluateRtnFrame(const size_t spacecraft_id) const {
+  if (rtn_frame_update_count_list_[spacecraft_id] == update_count_) return;
+
+  const libra::Vector<3>& position_i_m = position_list_i_m_[spacecraft_id];
+  const libra::Vector<3>& velocity_i_m_s = velocity_list_i_m_s_[spacecraft_id];
+  quaternion_list_i2rtn_[spacecraft_id] = Orbit::CalcQuaternion_i2lvlh(position_i_m, velocity_i_m_s);
 
-  libra::Vector<3> relative_vel_rtn = q_i2rtn.FrameConversion(relative_vel_i);
-  return relative_vel_rtn;
+  // Rotation vector of RTN frame
+  double r2_m2 = position_i_m.CalcNorm() * position_i_m.CalcNorm();
+  rtn_angular_velocity_list_i_rad_s_[spacecraft_id] = cross(position_i_m, velocity_i_m_s);
+  rtn_angular_velocity_list_i_rad_s_[spacecraft_id] /= r2_m2;
+  rtn_frame_update_count_list_[spacecraft_id] = update_count_;
 }
 
 void RelativeInformation::ResizeLists() {
-  size_t size = dynamics_database_.size();
-  relative_position_list_i_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_velocity_list_i_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_distance_list_m_.assign(size, std::vector<double>(size, 0.0));
-  relative_position_list_rtn_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_velocity_list_rtn_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_attitude_quaternion_list_.assign(size, std::vector<libra::Quaternion>(size, libra::Quaternion(0, 0, 0, 1)));
+  const size_t size = dynamics_database_.size();
+  position_list_i_m_.assign(size, libra::Vector<3>(0.0));
+  velocity_list_i_m_s_.assign(size, libra::Vector<3>(0.0));
+  quaternion_list_i2b_.assign(size, libra::Quaternion(0.0, 0.0, 0.0, 1.0));
+  quaternion_list_i2rtn_.assign(size, libra::Quaternion(0.0, 0.0, 0.0, 1.0));
+  rtn_angular_velocity_list_i_rad_s_.assign(size, libra::Vector<3>(0.0));
+  rtn_frame_update_count_list_.assign(size, update_count_);
+
+  // Values before the first update are zero as the cache is marked as valid
+  const size_t lower_triangle_size = size * (size - 1) / 2;
+  relative_position_list_i_m_.assign(lower_triangle_size, libra::Vector<3>(0.0));
+  relative_velocity_list_i_m_s_.assign(lower_triangle_size, libra::Vector<3>(0.0));
+  relative_distance_list_m_.assign(lower_triangle_size, 0.0);
+  inertial_update_count_list_.assign(lower_triangle_size, update_count_);
+  relative_attitude_quaternion_list_.assign(lower_triangle_size, libra::Quaternion(0.0, 0.0, 0.0, 1.0));
+  attitude_update_count_list_.assign(lower_triangle_size, update_count_);
+  relative_position_list_rtn_m_.assign(size * size, libra::Vector<3>(0.0));
+  relative_velocity_list_rtn_m_s_.assign(size * size, libra::Vector<3>(0.0));
+  rtn_update_count_list_.assign(size * size, update_count_);
 }
@@ -6,7 +6,10 @@
 #ifndef S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
 #define S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
 
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../../dynamics/dynamics.hpp"
 #include "../../logger/loggable.hpp"
@@ -31,7 +34,8 @@ class RelativeInformation : public ILoggable {
 
   /**
    * @fn Update
-   * @brief Update all relative information
+   * @brief Take a snapshot of the spacecraft states and invalidate the relative information of the previous step
+   * @note The relative information of each pair is calculated when it is accessed for the first time in the step.
    */
   void Update();
   /**
@@ -41,12 +45,31 @@ class RelativeInformation : public ILoggable {
    * @param [in] dynamics: Dynamics information of the target spacecraft
    */
   void RegisterDynamicsInfo(const size_t spacecraft_id, const Dynamics* dynamics);
+  /**
+   * @fn SetSpacecraftState
+   * @brief Set the state of the spacecraft registered without dynamics information
+   * @note The relative information evaluated before is kept until the next Update.
+   * @param [in] spacecraft_id: ID of target spacecraft
+   * @param [in] position_i_m: Position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Velocity in the inertial frame [m/s]
+   * @param [in] quaternion_i2b: Attitude quaternion from the inertial frame to the body frame
+   */
+  void SetSpacecraftState(const size_t spacecraft_id, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s,
+                          const libra::Quaternion quaternion_i2b);
   /**
    * @fn RegisterDynamicsInfo
    * @brief Remove dynamics information of target spacecraft
    * @param [in] spacecraft_id: ID of target spacecraft
    */
   void RemoveDynamicsInfo(const size_t spacecraft_id);
+  /**
+   * @fn RegisterPair
+   * @brief Register a pair of spacecraft whose relative information is used
+   * @note When pairs are registered, only the registered pairs are logged. Otherwise, all pairs in the lower triangle are logged.
+   * @param [in] target_spacecraft_id: ID of target spacecraft
+   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   */
+  void RegisterPair(const size_t target_spacecraft_id, const size_t reference_spacecraft_id);
 
   // Override classes for ILoggable
   /**
@@ -57,6 +80,7 @@ class RelativeInformation : public ILoggable {
   /**
    * @fn GetLogValue
    * @brief Override function of GetLogValue
+   * @note The pairs fixed at GetLogHeader are logged to keep the columns consistent with the header
    */
   virtual std::string GetLogValue() const;
 
@@ -73,54 +97,47 @@ class RelativeInformation : public ILoggable {
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline libra::Quaternion GetRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id];
-  }
+  libra::Quaternion GetRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
   /**
    * @fn GetRelativePosition_i_m
    * @brief Return relative position of the target spacecraft with respect to the reference spacecraft in the inertial frame and unit [m]
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativePosition_i_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id];
-  }
+  libra::Vector<3> GetRelativePosition_i_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
   /**
    * @fn GetRelativeVelocity_i_m
    * @brief Return relative velocity of the target spacecraft with respect to the reference spacecraft in the inertial frame and unit [m]
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativeVelocity_i_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id];
-  }
+  libra::Vector<3> GetRelativeVelocity_i_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
   /**
    * @fn GetRelativeDistance_m
    * @brief Return relative distance between the target spacecraft and the reference spacecraft in unit [m]
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline double GetRelativeDistance_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id];
-  };
+  double GetRelativeDistance_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
   /**
    * @fn GetRelativePosition_rtn_m
    * @brief Return relative position of the target spacecraft with respect to the reference spacecraft in the RTN frame of the reference spacecraft
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id];
-  }
+  libra::Vector<3> GetRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
   /**
    * @fn GetRelativeVelocity_rtn_m_s
    * @brief Return relative velocity of the target spacecraft with respect to the reference spacecraft in the RTN frame of the reference spacecraft
    * @param [in] target_spacecraft_id: ID of target spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  inline libra::Vector<3> GetRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const {
-    return relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id];
-  }
+  libra::Vector<3> GetRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
+  /**
+   * @fn GetRegisteredPairs
+   * @brief Return registered pairs of spacecraft as (target ID, reference ID)
+   */
+  inline const std::vector<std::pair<size_t, size_t>>& GetRegisteredPairs() const { return registered_pairs_; }
 
   /**
    * @fn GetReferenceSatDynamics
@@ -133,35 +150,68 @@ class RelativeInformation : public ILoggable {
 
  private:
   std::map<const size_t, const Dynamics*> dynamics_database_;  //!< Dynamics database of all spacecraft
+  std::vector<std::pair<size_t, size_t>> registered_pairs_;     //!< Registered pairs of spacecraft as (target ID, reference ID)
+  mutable std::vector<std::pair<size_t, size_t>> log_pairs_;    //!< Pairs to be logged. They are fixed when the log header is written.
+
+  // Snapshot of the spacecraft states at Update
+  std::vector<libra::Vector<3>> position_list_i_m_;     //!< Position list in the inertial frame in unit [m]
+  std::vector<libra::Vector<3>> velocity_list_i_m_s_;   //!< Velocity list in the inertial frame in unit [m/s]
+  std::vector<libra::Quaternion> quaternion_list_i2b_;  //!< Attitude quaternion list from the inertial frame to the body frame
 
-  std::vector<std::vector<libra::Vector<3>>> relative_position_list_i_m_;          //!< Relative position list in the inertial frame in unit [m]
-  std::vector<std::vector<libra::Vector<3>>> relative_velocity_list_i_m_s_;        //!< Relative velocity list in the inertial frame in unit [m/s]
-  std::vector<std::vector<libra::Vector<3>>> relative_position_list_rtn_m_;        //!< Relative position list in the RTN frame in unit [m]
-  std::vector<std::vector<libra::Vector<3>>> relative_velocity_list_rtn_m_s_;      //!< Relative velocity list in the RTN frame in unit [m/s]
-  std::vector<std::vector<double>> relative_distance_list_m_;                      //!< Relative distance list in unit [m]
-  std::vector<std::vector<libra::Quaternion>> relative_attitude_quaternion_list_;  //!< Relative attitude quaternion list
+  // Cache of the relative information. Values are evaluated when they are accessed for the first time in the step.
+  // The inertial values and the attitude are stored only for the lower triangle (target ID > reference ID) since they are antisymmetric.
+  // The RTN values depend on the RTN frame of the reference spacecraft, and they are stored for all pairs.
+  size_t update_count_ = 0;                                                   //!< Update counter to judge the validity of the cache
+  mutable std::vector<libra::Quaternion> quaternion_list_i2rtn_;              //!< Quaternion list from the inertial frame to the RTN frame
+  mutable std::vector<libra::Vector<3>> rtn_angular_velocity_list_i_rad_s_;   //!< Angular velocity list of the RTN frame [rad/s]
+  mutable std::vector<size_t> rtn_frame_update_count_list_;                   //!< Update counter when the RTN frame is evaluated
+  mutable std::vector<libra::Vector<3>> relative_position_list_i_m_;          //!< Relative position list in the inertial frame in unit [m]
+  mutable std::vector<libra::Vector<3>> relative_velocity_list_i_m_s_;        //!< Relative velocity list in the inertial frame in unit [m/s]
+  mutable std::vector<double> relative_distance_list_m_;                      //!< Relative distance list in unit [m]
+  mutable std::vector<size_t> inertial_update_count_list_;                    //!< Update counter when the inertial values are evaluated
+  mutable std::vector<libra::Quaternion> relative_attitude_quaternion_list_;  //!< Relative attitude quaternion list
+  mutable std::vector<size_t> attitude_update_count_list_;                    //!< Update counter when the attitude is evaluated
+  mutable std::vector<libra::Vector<3>> relative_position_list_rtn_m_;        //!< Relative position list in the RTN frame in unit [m]
+  mutable std::vector<libra::Vector<3>> relative_velocity_list_rtn_m_s_;      //!< Relative velocity list in the RTN frame in unit [m/s]
+  mutable std::vector<size_t> rtn_update_count_list_;                         //!< Update counter when the RTN values are evaluated
+  mutable std::mutex cache_mutex_;                                            //!< Mutex of the cache for the spacecraft updated in parallel
 
   /**
-   * @fn CalcRelativeAttitudeQuaternion
-   * @brief Calculate and return the relative attitude quaternion
-   * @param [in] target_spacecraft_id: ID of the spacecraft
-   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   * @fn GetLowerTriangleIndex
+   * @brief Return index of the pair in the lower triangle list
+   * @param [in] larger_spacecraft_id: Larger ID of the pair
+   * @param [in] smaller_spacecraft_id: Smaller ID of the pair
+   */
+  inline size_t GetLowerTriangleIndex(const size_t larger_spacecraft_id, const size_t smaller_spacecraft_id) const {
+    return larger_spacecraft_id * (larger_spacecraft_id - 1) / 2 + smaller_spacecraft_id;
+  }
+  /**
+   * @fn GetLogPairs
+   * @brief Return pairs to be logged. Registered pairs or all pairs in the lower triangle are returned.
    */
-  libra::Quaternion CalcRelativeAttitudeQuaternion(const size_t target_spacecraft_id, const size_t reference_spacecraft_id);
+  std::vector<std::pair<size_t, size_t>> GetLogPairs() const;
   /**
-   * @fn CalcRelativePosition_rtn_m
-   * @brief Calculate and return the relative position in RTN frame
-   * @param [in] target_spacecraft_id: ID of the spacecraft
-   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   * @fn EvaluateInertialInformation
+   * @brief Evaluate relative position, velocity, and distance of the pair in the lower triangle if they are not evaluated in the step
+   * @param [in] larger_spacecraft_id: Larger ID of the pair
+   * @param [in] smaller_spacecraft_id: Smaller ID of the pair
+   * @return Index of the pair in the lower triangle list
    */
-  libra::Vector<3> CalcRelativePosition_rtn_m(const size_t target_spacecraft_id, const size_t reference_spacecraft_id);
+  size_t EvaluateInertialInformation(const size_t larger_spacecraft_id, const size_t smaller_spacecraft_id) const;
   /**
-   * @fn CalcRelativeVelocity_rtn_m_s
-   * @brief Calculate and return the relative velocity in RTN frame
+   * @fn EvaluateRtnInformation
+   * @brief Evaluate relative position and velocity in the RTN frame if they are not evaluated in the step
    * @param [in] target_spacecraft_id: ID of the spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   * @return Index of the pair in the RTN list
+   */
+  size_t EvaluateRtnInformation(const size_t target_spacecraft_id, const size_t reference_spacecraft_id) const;
+  /**
+   * @fn EvaluateRtnFrame
+   * @brief Evaluate the RTN frame of the spacecraft if it is not evaluated in the step
+   * @param [in] spacecraft_id: ID of the spacecraft
    */
-  libra::Vector<3> CalcRelativeVelocity_rtn_m_s(const size_t target_spacecraft_id, const size_t reference_spacecraft_id);
+  void EvaluateRtnFrame(const size_t spacecraft_id) const;
 
   /**
    * @fn ResizeLists
@@ -0,0 +1,89 @@
+/**
+ * @file spacecraft_update_executor.cpp
+ * @brief Executor to update multiple spacecraft in parallel
+ */
+
+#include "spacecraft_update_executor.hpp"
+
+SpacecraftUpdateExecutor::SpacecraftUpdateExecutor(const size_t number_of_threads) {
+  for (size_t i = 1; i < number_of_threads; i++) {
+    workers_.emplace_back(&SpacecraftUpdateExecutor::WorkerLoop, this);
+  }
+}
+
+SpacecraftUpdateExecutor::~SpacecraftUpdateExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopping_ = true;
+  }
+  start_condition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void SpacecraftUpdateExecutor::AddSpacecraft(Spacecraft* spacecraft) {
+  const bool is_relative_orbit = spacecraft->GetDynamics().GetOrbit().GetPropagateMode() == OrbitPropagateMode::kRelativeOrbit;
+  AddSpacecraft(spacecraft, is_relative_orbit ? 1 : 0);
+}
+
+void SpacecraftUpdateExecutor::AddSpacecraft(Spacecraft* spacecraft, const size_t stage) {
+  AddTask([spacecraft](const SimulationTime* simulation_time) { spacecraft->Update(simulation_time); }, stage);
+}
+
+void SpacecraftUpdateExecutor::AddTask(const std::function<void(const SimulationTime*)> task, const size_t stage) {
+  if (stages_.size() <= stage) stages_.resize(stage + 1);
+  stages_[stage].push_back(task);
+}
+
+void SpacecraftUpdateExecutor::Update(const SimulationTime* simulation_time) {
+  for (const auto& stage : stages_) {
+    // Serial update when the parallelization does not help
+    if (workers_.empty() || stage.size() <= 1) {
+      for (const auto& task : stage) {
+        task(simulation_time);
+      }
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_ = &stage;
+      simulation_time_ = simulation_time;
+      next_task_id_ = 0;
+      number_of_running_workers_ = workers_.size();
+      generation_++;
+    }
+    start_condition_.notify_all();
+    RunTasks();
+
+    // Barrier before the next stage
+    std::unique_lock<std::mutex> lock(mutex_);
+    finish_condition_.wait(lock, [this] { return number_of_running_workers_ == 0; });
+  }
+}
+
+void SpacecraftUpdateExecutor::WorkerLoop() {
+  size_t finished_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_condition_.wait(lock, [&] { return is_stopping_ || generation_ != finished_generation; });
+      if (is_stopping_) return;
+      finished_generation = generation_;
+    }
+
+    RunTasks();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    number_of_running_workers_--;
+    if (number_of_running_workers_ == 0) finish_condition_.notify_one();
+  }
+}
+
+void SpacecraftUpdateExecutor::RunTasks() {
+  const size_t number_of_tasks = tasks_->size();
+  for (size_t task_id = next_task_id_++; task_id < number_of_tasks; task_id = next_task_id_++) {
+    (*tasks_)[task_id](simulation_time_);
+  }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file spacecraft_update_executor.hpp
+ * @brief Executor to update multiple spacecraft in parallel
+ */
+
+#ifndef S2E_SIMULATION_MULTIPLE_SPACECRAFT_SPACECRAFT_UPDATE_EXECUTOR_HPP_
+#define S2E_SIMULATION_MULTIPLE_SPACECRAFT_SPACECRAFT_UPDATE_EXECUTOR_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../spacecraft/spacecraft.hpp"
+
+/**
+ * @class SpacecraftUpdateExecutor
+ * @brief Executor to update multiple spacecraft in parallel with a thread pool
+ * @details The spacecraft are updated in stages. All spacecraft in a stage are updated in parallel, and the next stage starts after all updates
+ *          in the stage are finished. Spacecraft with the relative orbit are automatically put in the second stage since they read the orbit of
+ *          the reference spacecraft. RelativeInformation and InterSpacecraftCommunication should be updated after Update of this class.
+ *          Random generators are held by each component and seeded at the construction, so results do not depend on the number of threads.
+ *          Other objects which are independent of each other in a stage can be updated together as tasks.
+ * @note Users must not share mutable objects between spacecraft in a stage except through RelativeInformation.
+ */
+class SpacecraftUpdateExecutor {
+ public:
+  /**
+   * @fn SpacecraftUpdateExecutor
+   * @brief Constructor
+   * @param [in] number_of_threads: Number of threads including the calling thread (1 means the serial update)
+   */
+  explicit SpacecraftUpdateExecutor(const size_t number_of_threads);
+  /**
+   * @fn ~SpacecraftUpdateExecutor
+   * @brief Destructor to join the worker threads
+   */
+  ~SpacecraftUpdateExecutor();
+
+  /**
+   * @fn AddSpacecraft
+   * @brief Add a spacecraft. The stage is 1 for the relative orbit and 0 for others.
+   * @param [in] spacecraft: Spacecraft
+   */
+  void AddSpacecraft(Spacecraft* spacecraft);
+  /**
+   * @fn AddSpacecraft
+   * @brief Add a spacecraft to the stage
+   * @param [in] spacecraft: Spacecraft
+   * @param [in] stage: Stage to update the spacecraft. The stages are updated in ascending order.
+   */
+  void AddSpacecraft(Spacecraft* spacecraft, const size_t stage);
+  /**
+   * @fn AddTask
+   * @brief Add a task to the stage
+   * @param [in] task: Function to update an object with the simulation time
+   * @param [in] stage: Stage to execute the task. The stages are executed in ascending order.
+   */
+  void AddTask(const std::function<void(const SimulationTime*)> task, const size_t stage);
+
+  /**
+   * @fn Update
+   * @brief Update all spacecraft and wait for the completion
+   * @param [in] simulation_time: Simulation time
+   */
+  void Update(const SimulationTime* simulation_time);
+
+  // Getter
+  /**
+   * @fn GetNumberOfThreads
+   * @brief Return number of threads including the calling thread
+   */
+  inline size_t GetNumberOfThreads() const { return workers_.size() + 1; }
+
+ private:
+  std::vector<std::vector<std::function<void(const SimulationTime*)>>> stages_;  //!< Task list of each stage
+  std::vector<std::thread> workers_;                                            //!< Worker threads
+
+  // Shared state with the workers
+  std::mutex mutex_;                                 //!< Mutex of the shared state
+  std::condition_variable start_condition_;          //!< Condition to start the workers
+  std::condition_variable finish_condition_;         //!< Condition to notify the completion of the workers
+  const std::vector<std::function<void(const SimulationTime*)>>* tasks_ = nullptr;  //!< Task list in the current stage
+  const SimulationTime* simulation_time_ = nullptr;                                 //!< Simulation time in the current update
+  std::atomic<size_t> next_task_id_{0};                                             //!< Index of the next task to execute
+  size_t number_of_running_workers_ = 0;                                            //!< Number of workers which have not finished the current stage
+  size_t generation_ = 0;                                                           //!< Counter of the stage executions to wake up the workers
+  bool is_stopping_ = false;                                                        //!< Flag to stop the workers
+
+  /**
+   * @fn WorkerLoop
+   * @brief Main loop of the worker threads
+   */
+  void WorkerLoop();
+  /**
+   * @fn RunTasks
+   * @brief Execute tasks in the current stage until no task remains
+   */
+  void RunTasks();
+};
+
+#endif  // S2E_SIMULATION_MULTIPLE_SPACECRAFT_SPACECRAFT_UPDATE_EXECUTOR_HPP_
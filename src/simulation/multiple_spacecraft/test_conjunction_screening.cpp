@@ -0,0 +1,124 @@
+/**
+ * @file test_conjunction_screening.cpp
+ * @brief Test codes for ConjunctionScreening class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <utility>
+
+#include "conjunction_screening.hpp"
+
+namespace {
+const double kGravityConstant_m3_s2 = 3.986004418e14;  //!< Gravity constant of the Earth [m3/s2]
+}  // namespace
+
+/**
+ * @brief Test for the spatial hash compared with the brute-force screening of all pairs
+ * @note The objects move on straight lines, so the cubic Hermite interpolation is exact and the closest approach is derived analytically.
+ *       The orbital filters are disabled with the large filter margin.
+ */
+TEST(ConjunctionScreening, SpatialHashMatchesBruteForce) {
+  const size_t number_of_objects = 300;
+  const double screening_distance_m = 2.0e3;
+  const double step_width_s = 1.0;
+  const size_t number_of_steps = 5;
+
+  std::mt19937 random_engine(20241018);
+  std::uniform_real_distribution<double> position_distribution(-30.0e3, 30.0e3);
+  std::uniform_real_distribution<double> velocity_distribution(-1.0e3, 1.0e3);
+  std::vector<libra::Vector<3>> initial_position_list_i_m(number_of_objects);
+  std::vector<libra::Vector<3>> velocity_list_i_m_s(number_of_objects);
+  for (size_t i = 0; i < number_of_objects; i++) {
+    for (size_t axis = 0; axis < 3; axis++) {
+      initial_position_list_i_m[i][axis] = position_distribution(random_engine);
+      velocity_list_i_m_s[i][axis] = velocity_distribution(random_engine);
+    }
+    initial_position_list_i_m[i][0] += 7000.0e3;
+  }
+
+  // Screening with the spatial hash
+  ConjunctionScreening screening(screening_distance_m, kGravityConstant_m3_s2, 1.0e12);
+  std::vector<libra::Vector<3>> position_list_i_m(number_of_objects);
+  for (size_t step = 0; step <= number_of_steps; step++) {
+    const double time_s = step * step_width_s;
+    for (size_t i = 0; i < number_of_objects; i++) {
+      position_list_i_m[i] = initial_position_list_i_m[i] + time_s * velocity_list_i_m_s[i];
+    }
+    screening.Screen(time_s, position_list_i_m, velocity_list_i_m_s);
+  }
+
+  // Brute-force screening of all pairs
+  std::map<std::pair<size_t, size_t>, std::pair<double, double>> expected_events;  // (time of closest approach, miss distance)
+  for (size_t i = 0; i < number_of_objects; i++) {
+    for (size_t j = i + 1; j < number_of_objects; j++) {
+      const libra::Vector<3> relative_position_i_m = initial_position_list_i_m[j] - initial_position_list_i_m[i];
+      const libra::Vector<3> relative_velocity_i_m_s = velocity_list_i_m_s[j] - velocity_list_i_m_s[i];
+      const double relative_speed_m_s = relative_velocity_i_m_s.CalcNorm();
+      if (relative_speed_m_s <= 0.0) continue;
+      const double time_of_closest_approach_s =
+          -InnerProduct(relative_position_i_m, relative_velocity_i_m_s) / (relative_speed_m_s * relative_speed_m_s);
+      if (time_of_closest_approach_s <= 0.0 || time_of_closest_approach_s > number_of_steps * step_width_s) continue;
+      const double miss_distance_m = (relative_position_i_m + time_of_closest_approach_s * relative_velocity_i_m_s).CalcNorm();
+      if (miss_distance_m > screening_distance_m) continue;
+      expected_events[std::make_pair(i, j)] = std::make_pair(time_of_closest_approach_s, miss_distance_m);
+    }
+  }
+
+  ASSERT_FALSE(expected_events.empty());
+  EXPECT_EQ(expected_events.size(), screening.GetEvents().size());
+  for (const auto& event : screening.GetEvents()) {
+    const auto expected_event = expected_events.find(std::make_pair(event.first_object_id, event.second_object_id));
+    ASSERT_NE(expected_event, expected_events.end());
+    EXPECT_NEAR(expected_event->second.first, event.time_of_closest_approach_s, 1.0e-6);
+    EXPECT_NEAR(expected_event->second.second, event.miss_distance_m, 1.0e-3);
+  }
+}
+
+/**
+ * @brief Test for the time of closest approach of two circular orbits crossing at the mutual node
+ * @note The orbits have the radius difference of the expected miss distance, and both objects pass the mutual node at the same time.
+ */
+TEST(ConjunctionScreening, CircularOrbitClosestApproach) {
+  const double radius_m = 7000.0e3;
+  const double miss_distance_m = 100.0;
+  const double relative_inclination_rad = 1.0;
+  const double time_of_closest_approach_s = 123.4;
+  const double step_width_s = 10.0;
+
+  // Position and velocity on the circular orbit passing the X axis at the time of closest approach
+  auto calc_state = [&](const double radius, const double inclination_rad, const double time_s, libra::Vector<3>& position_i_m,
+                        libra::Vector<3>& velocity_i_m_s) {
+    const double mean_motion_rad_s = sqrt(kGravityConstant_m3_s2 / (radius * radius * radius));
+    const double phase_rad = mean_motion_rad_s * (time_s - time_of_closest_approach_s);
+    position_i_m[0] = radius * cos(phase_rad);
+    position_i_m[1] = radius * sin(phase_rad) * cos(inclination_rad);
+    position_i_m[2] = radius * sin(phase_rad) * sin(inclination_rad);
+    velocity_i_m_s[0] = -radius * mean_motion_rad_s * sin(phase_rad);
+    velocity_i_m_s[1] = radius * mean_motion_rad_s * cos(phase_rad) * cos(inclination_rad);
+    velocity_i_m_s[2] = radius * mean_motion_rad_s * cos(phase_rad) * sin(inclination_rad);
+  };
+
+  ConjunctionScreening screening(1.0e3, kGravityConstant_m3_s2);
+  std::vector<libra::Vector<3>> position_list_i_m(2);
+  std::vector<libra::Vector<3>> velocity_list_i_m_s(2);
+  for (size_t step = 0; step <= 30; step++) {
+    const double time_s = step * step_width_s;
+    calc_state(radius_m, 0.0, time_s, position_list_i_m[0], velocity_list_i_m_s[0]);
+    calc_state(radius_m + miss_distance_m, relative_inclination_rad, time_s, position_list_i_m[1], velocity_list_i_m_s[1]);
+    screening.Screen(time_s, position_list_i_m, velocity_list_i_m_s);
+  }
+
+  ASSERT_EQ(1u, screening.GetEvents().size());
+  const ConjunctionEvent& event = screening.GetEvents().front();
+  EXPECT_EQ(0u, event.first_object_id);
+  EXPECT_EQ(1u, event.second_object_id);
+  EXPECT_NEAR(time_of_closest_approach_s, event.time_of_closest_approach_s, 1.0e-3);
+  EXPECT_NEAR(miss_distance_m, event.miss_distance_m, 1.0e-2);
+  EXPECT_NEAR(miss_distance_m, event.relative_position_i_m[0], 1.0e-2);
+  // Relative speed at the node: 2 v sin(i / 2) for the same speed
+  const double speed_m_s = sqrt(kGravityConstant_m3_s2 / radius_m);
+  EXPECT_NEAR(2.0 * speed_m_s * sin(relative_inclination_rad / 2.0), event.relative_speed_m_s, 1.0);
+}
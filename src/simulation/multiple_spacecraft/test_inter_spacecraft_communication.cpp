@@ -0,0 +1,140 @@
+/**
+ * @file test_inter_spacecraft_communication.cpp
+ * @brief Test codes for InterSpacecraftCommunication class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "inter_spacecraft_communication.hpp"
+
+namespace {
+/**
+ * @fn MakeLinkState
+ * @brief Make an available link state
+ */
+InterSpacecraftLinkState MakeLinkState(const double propagation_delay_s, const double data_rate_bps = 8.0e3) {
+  InterSpacecraftLinkState state;
+  state.is_available = true;
+  state.propagation_delay_s = propagation_delay_s;
+  state.data_rate_bps = data_rate_bps;
+  return state;
+}
+
+/**
+ * @fn MakePayload
+ * @brief Make a payload of a byte
+ */
+std::shared_ptr<const std::vector<unsigned char>> MakePayload(const unsigned char value) {
+  return std::make_shared<const std::vector<unsigned char>>(1, value);
+}
+}  // namespace
+
+/**
+ * @brief Test for the delivery when a later message arrives earlier by the decrease of the delay
+ */
+TEST(InterSpacecraftCommunication, DeliverAllArrivedMessages) {
+  InterSpacecraftCommunication communication(nullptr);
+  communication.RegisterLink(0, 1, InterSpacecraftLinkParameters());
+
+  // The first message is delayed by 10 s, and the second message sent 1 s later is delayed by 2 s
+  EXPECT_TRUE(communication.Send(0, 1, MakePayload(1)));
+  communication.Update(0.0, std::vector<InterSpacecraftLinkState>{MakeLinkState(10.0)});
+  communication.Update(1.0, std::vector<InterSpacecraftLinkState>{MakeLinkState(2.0)});
+  EXPECT_TRUE(communication.Send(0, 1, MakePayload(2)));
+  communication.Update(1.0, std::vector<InterSpacecraftLinkState>{MakeLinkState(2.0)});
+
+  communication.Update(5.0, std::vector<InterSpacecraftLinkState>{MakeLinkState(2.0)});
+  std::vector<InterSpacecraftMessage> messages = communication.Receive(1);
+  ASSERT_EQ(1u, messages.size());
+  EXPECT_EQ(2, (*messages[0].payload)[0]);
+  EXPECT_NEAR(3.001, messages[0].delivery_time_s, 1.0e-9);
+
+  communication.Update(11.0, std::vector<InterSpacecraftLinkState>{MakeLinkState(2.0)});
+  messages = communication.Receive(1);
+  ASSERT_EQ(1u, messages.size());
+  EXPECT_EQ(1, (*messages[0].payload)[0]);
+  EXPECT_NEAR(10.001, messages[0].delivery_time_s, 1.0e-9);
+  EXPECT_EQ(2u, communication.GetLinkState(0).number_of_delivered_messages);
+}
+
+/**
+ * @brief Test for the messages of multiple links and the unavailable link
+ */
+TEST(InterSpacecraftCommunication, MultipleLinks) {
+  InterSpacecraftCommunication communication(nullptr);
+  InterSpacecraftLinkParameters parameters;
+  parameters.queue_capacity = 2;
+  communication.RegisterLink(0, 2, parameters);
+  communication.RegisterLink(1, 2, parameters);
+  communication.RegisterLink(0, 1, parameters);
+
+  EXPECT_EQ(2u, communication.Broadcast(0, MakePayload(0)));
+  EXPECT_TRUE(communication.Send(1, 2, MakePayload(1)));
+  EXPECT_TRUE(communication.Send(1, 2, MakePayload(1)));
+  // Full transmit queue
+  EXPECT_FALSE(communication.Send(1, 2, MakePayload(1)));
+  // Not registered link
+  EXPECT_FALSE(communication.Send(2, 0, MakePayload(2)));
+
+  InterSpacecraftLinkState unavailable_state = MakeLinkState(0.0);
+  unavailable_state.is_available = false;
+  const std::vector<InterSpacecraftLinkState> link_states{MakeLinkState(0.5), MakeLinkState(0.1), unavailable_state};
+  communication.Update(0.0, link_states);
+  communication.Update(1.0, link_states);
+
+  const std::vector<InterSpacecraftMessage> messages = communication.Receive(2);
+  ASSERT_EQ(3u, messages.size());
+  // Sorted by the delivery time
+  EXPECT_EQ(1u, messages[0].source_spacecraft_id);
+  EXPECT_EQ(1u, messages[1].source_spacecraft_id);
+  EXPECT_EQ(0u, messages[2].source_spacecraft_id);
+  EXPECT_EQ(1u, communication.GetLinkState(1).number_of_dropped_messages);
+  EXPECT_TRUE(communication.Receive(1).empty());
+  EXPECT_EQ(1u, communication.GetTransmitQueueLength(2));
+}
+
+/**
+ * @brief Test for resuming from the checkpoint
+ */
+TEST(InterSpacecraftCommunication, ResumeFromCheckpoint) {
+  InterSpacecraftCommunication communication(nullptr);
+  communication.RegisterLink(0, 1, InterSpacecraftLinkParameters());
+  communication.Send(0, 1, MakePayload(7));
+  communication.Update(0.0, std::vector<InterSpacecraftLinkState>{MakeLinkState(5.0)});
+
+  std::stringstream stream;
+  CheckpointWriter writer(stream);
+  communication.SaveCheckpoint(writer);
+  EXPECT_TRUE(writer.IsGood());
+  const std::string checkpoint = stream.str();
+
+  // The message in flight is restored
+  InterSpacecraftCommunication restored_communication(nullptr);
+  restored_communication.RegisterLink(0, 1, InterSpacecraftLinkParameters());
+  std::stringstream restored_stream(checkpoint);
+  CheckpointReader reader(restored_stream);
+  restored_communication.LoadCheckpoint(reader);
+  EXPECT_TRUE(reader.IsGood());
+  restored_communication.Update(6.0, std::vector<InterSpacecraftLinkState>{MakeLinkState(5.0)});
+  const std::vector<InterSpacecraftMessage> messages = restored_communication.Receive(1);
+  ASSERT_EQ(1u, messages.size());
+  EXPECT_EQ(7, (*messages[0].payload)[0]);
+
+  // Different number of links
+  InterSpacecraftCommunication more_links(nullptr);
+  more_links.RegisterLink(0, 1, InterSpacecraftLinkParameters());
+  more_links.RegisterLink(1, 0, InterSpacecraftLinkParameters());
+  std::stringstream more_links_stream(checkpoint);
+  CheckpointReader more_links_reader(more_links_stream);
+  more_links.LoadCheckpoint(more_links_reader);
+  EXPECT_FALSE(more_links_reader.IsGood());
+
+  // Different link
+  InterSpacecraftCommunication other_link(nullptr);
+  other_link.RegisterLink(1, 0, InterSpacecraftLinkParameters());
+  std::stringstream other_link_stream(checkpoint);
+  CheckpointReader other_link_reader(other_link_stream);
+  other_link.LoadCheckpoint(other_link_reader);
+  EXPECT_FALSE(other_link_reader.IsGood());
+}
@@ -0,0 +1,243 @@
+/**
+ * @file test_relative_information.cpp
+ * @brief Test codes for RelativeInformation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "relative_information.hpp"
+
+namespace {
+const size_t kNumberOfSpacecraft = 4;  //!< Number of spacecraft in the tests
+
+/**
+ * @struct SpacecraftState
+ * @brief State of a spacecraft
+ */
+struct SpacecraftState {
+  libra::Vector<3> position_i_m;     //!< Position in the inertial frame [m]
+  libra::Vector<3> velocity_i_m_s;   //!< Velocity in the inertial frame [m/s]
+  libra::Quaternion quaternion_i2b;  //!< Attitude quaternion from the inertial frame to the body frame
+};
+
+/**
+ * @fn MakeState
+ * @brief Make a LEO state which differs for each spacecraft and step
+ * @param [in] spacecraft_id: ID of the spacecraft
+ * @param [in] step: Step of the state
+ */
+SpacecraftState MakeState(const size_t spacecraft_id, const size_t step) {
+  const double offset = 1.0 + 0.1 * spacecraft_id + 0.37 * step;
+  SpacecraftState state;
+  state.position_i_m[0] = 6900.0e3 + 1.0e3 * offset;
+  state.position_i_m[1] = -200.0e3 * offset;
+  state.position_i_m[2] = 300.0e3 * offset * offset;
+  state.velocity_i_m_s[0] = 10.0 * offset;
+  state.velocity_i_m_s[1] = 4500.0 + 3.0 * offset;
+  state.velocity_i_m_s[2] = 6000.0 - 5.0 * offset;
+  libra::Vector<3> rotation_axis;
+  rotation_axis[0] = 1.0;
+  rotation_axis[1] = offset;
+  rotation_axis[2] = -0.5;
+  state.quaternion_i2b = libra::Quaternion(rotation_axis.CalcNormalizedVector(), 0.3 * offset);
+  return state;
+}
+
+/**
+ * @fn SetStates
+ * @brief Set the states of the step to all spacecraft and update the relative information
+ */
+void SetStates(RelativeInformation& relative_information, const size_t number_of_spacecraft, const size_t step) {
+  for (size_t spacecraft_id = 0; spacecraft_id < number_of_spacecraft; spacecraft_id++) {
+    const SpacecraftState state = MakeState(spacecraft_id, step);
+    relative_information.SetSpacecraftState(spacecraft_id, state.position_i_m, state.velocity_i_m_s, state.quaternion_i2b);
+  }
+  relative_information.Update();
+}
+
+/**
+ * @fn CalcRelativeRtn
+ * @brief Calculate the relative position and velocity in the RTN frame of the reference spacecraft directly
+ */
+void CalcRelativeRtn(const SpacecraftState& target, const SpacecraftState& reference, libra::Vector<3>& position_rtn_m,
+                     libra::Vector<3>& velocity_rtn_m_s) {
+  const double radius_m = reference.position_i_m.CalcNorm();
+  const libra::Vector<3> angular_velocity_i_rad_s = (1.0 / (radius_m * radius_m)) * cross(reference.position_i_m, reference.velocity_i_m_s);
+  const libra::Vector<3> relative_position_i_m = target.position_i_m - reference.position_i_m;
+  const libra::Vector<3> relative_velocity_i_m_s =
+      target.velocity_i_m_s - reference.velocity_i_m_s - cross(angular_velocity_i_rad_s, relative_position_i_m);
+  const libra::Quaternion quaternion_i2rtn = Orbit::CalcQuaternion_i2lvlh(reference.position_i_m, reference.velocity_i_m_s);
+  position_rtn_m = quaternion_i2rtn.FrameConversion(relative_position_i_m);
+  velocity_rtn_m_s = quaternion_i2rtn.FrameConversion(relative_velocity_i_m_s);
+}
+
+/**
+ * @fn ExpectVectorNear
+ * @brief Expect the vectors are near
+ */
+void ExpectVectorNear(const libra::Vector<3>& expected, const libra::Vector<3>& actual, const double tolerance) {
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(expected[i], actual[i], tolerance);
+  }
+}
+
+/**
+ * @fn ExpectMatchDirectCalculation
+ * @brief Expect the relative information of all pairs matches the direct calculation from the states of the step
+ */
+void ExpectMatchDirectCalculation(const RelativeInformation& relative_information, const size_t step) {
+  for (size_t target_id = 0; target_id < kNumberOfSpacecraft; target_id++) {
+    for (size_t reference_id = 0; reference_id < kNumberOfSpacecraft; reference_id++) {
+      const SpacecraftState target = MakeState(target_id, step);
+      const SpacecraftState reference = MakeState(reference_id, step);
+      libra::Vector<3> position_rtn_m, velocity_rtn_m_s;
+      CalcRelativeRtn(target, reference, position_rtn_m, velocity_rtn_m_s);
+      ExpectVectorNear(position_rtn_m, relative_information.GetRelativePosition_rtn_m(target_id, reference_id), 1.0e-6);
+      ExpectVectorNear(velocity_rtn_m_s, relative_information.GetRelativeVelocity_rtn_m_s(target_id, reference_id), 1.0e-9);
+      ExpectVectorNear(target.position_i_m - reference.position_i_m, relative_information.GetRelativePosition_i_m(target_id, reference_id), 0.0);
+      ExpectVectorNear(target.velocity_i_m_s - reference.velocity_i_m_s, relative_information.GetRelativeVelocity_i_m_s(target_id, reference_id),
+                       0.0);
+      EXPECT_DOUBLE_EQ((target.position_i_m - reference.position_i_m).CalcNorm(),
+                       relative_information.GetRelativeDistance_m(target_id, reference_id));
+    }
+  }
+}
+
+/**
+ * @fn RegisterSpacecraft
+ * @brief Register the spacecraft without dynamics information
+ */
+void RegisterSpacecraft(RelativeInformation& relative_information, const size_t number_of_spacecraft) {
+  for (size_t spacecraft_id = 0; spacecraft_id < number_of_spacecraft; spacecraft_id++) {
+    relative_information.RegisterDynamicsInfo(spacecraft_id, nullptr);
+  }
+}
+}  // namespace
+
+/**
+ * @brief Test for the lazy evaluation compared with the direct calculation in different access orders
+ */
+TEST(RelativeInformation, LazyEvaluation) {
+  // The RTN values are accessed first
+  RelativeInformation relative_information;
+  RegisterSpacecraft(relative_information, kNumberOfSpacecraft);
+  SetStates(relative_information, kNumberOfSpacecraft, 0);
+  ExpectMatchDirectCalculation(relative_information, 0);
+
+  // The inertial values are accessed first, and all values are accessed again from the cache
+  RelativeInformation inertial_first_information;
+  RegisterSpacecraft(inertial_first_information, kNumberOfSpacecraft);
+  SetStates(inertial_first_information, kNumberOfSpacecraft, 0);
+  for (size_t target_id = 0; target_id < kNumberOfSpacecraft; target_id++) {
+    for (size_t reference_id = 0; reference_id < kNumberOfSpacecraft; reference_id++) {
+      inertial_first_information.GetRelativeDistance_m(target_id, reference_id);
+    }
+  }
+  ExpectMatchDirectCalculation(inertial_first_information, 0);
+  ExpectMatchDirectCalculation(inertial_first_information, 0);
+
+  // The target on the radial direction of the reference
+  SpacecraftState reference = MakeState(0, 0);
+  const double radial_offset_m = 1.0e3;
+  const libra::Vector<3> target_position_i_m = reference.position_i_m + radial_offset_m * reference.position_i_m.CalcNormalizedVector();
+  relative_information.SetSpacecraftState(1, target_position_i_m, reference.velocity_i_m_s, reference.quaternion_i2b);
+  relative_information.Update();
+  const libra::Vector<3> position_rtn_m = relative_information.GetRelativePosition_rtn_m(1, 0);
+  EXPECT_NEAR(radial_offset_m, position_rtn_m[0], 1.0e-6);
+  EXPECT_NEAR(0.0, position_rtn_m[1], 1.0e-6);
+  EXPECT_NEAR(0.0, position_rtn_m[2], 1.0e-6);
+}
+
+/**
+ * @brief Test for the antisymmetry of the relative information of (i, j) and (j, i)
+ */
+TEST(RelativeInformation, Antisymmetry) {
+  RelativeInformation relative_information;
+  RegisterSpacecraft(relative_information, kNumberOfSpacecraft);
+  SetStates(relative_information, kNumberOfSpacecraft, 0);
+
+  for (size_t i = 0; i < kNumberOfSpacecraft; i++) {
+    for (size_t j = 0; j < kNumberOfSpacecraft; j++) {
+      ExpectVectorNear(-relative_information.GetRelativePosition_i_m(i, j), relative_information.GetRelativePosition_i_m(j, i), 0.0);
+      ExpectVectorNear(-relative_information.GetRelativeVelocity_i_m_s(i, j), relative_information.GetRelativeVelocity_i_m_s(j, i), 0.0);
+      EXPECT_EQ(relative_information.GetRelativeDistance_m(i, j), relative_information.GetRelativeDistance_m(j, i));
+
+      // The relative attitude of (j, i) is the inverse rotation of (i, j)
+      const libra::Quaternion quaternion = relative_information.GetRelativeAttitudeQuaternion(i, j);
+      const libra::Quaternion inverse_quaternion = relative_information.GetRelativeAttitudeQuaternion(j, i);
+      const libra::Quaternion expected_quaternion = MakeState(i, 0).quaternion_i2b * MakeState(j, 0).quaternion_i2b.Conjugate();
+      for (size_t k = 0; k < 4; k++) {
+        EXPECT_DOUBLE_EQ(quaternion.Conjugate()[k], inverse_quaternion[k]);
+        EXPECT_NEAR(i == j ? (k == 3 ? 1.0 : 0.0) : expected_quaternion[k], quaternion[k], 1.0e-12);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the cache invalidated at the next Update
+ */
+TEST(RelativeInformation, InvalidateAtUpdate) {
+  RelativeInformation relative_information;
+  RegisterSpacecraft(relative_information, kNumberOfSpacecraft);
+  SetStates(relative_information, kNumberOfSpacecraft, 0);
+  ExpectMatchDirectCalculation(relative_information, 0);
+
+  // The cached values are kept until the next Update
+  const libra::Vector<3> cached_position_rtn_m = relative_information.GetRelativePosition_rtn_m(2, 1);
+  const double cached_distance_m = relative_information.GetRelativeDistance_m(2, 1);
+  for (size_t spacecraft_id = 0; spacecraft_id < kNumberOfSpacecraft; spacecraft_id++) {
+    const SpacecraftState state = MakeState(spacecraft_id, 1);
+    relative_information.SetSpacecraftState(spacecraft_id, state.position_i_m, state.velocity_i_m_s, state.quaternion_i2b);
+  }
+  ExpectVectorNear(cached_position_rtn_m, relative_information.GetRelativePosition_rtn_m(2, 1), 0.0);
+  EXPECT_EQ(cached_distance_m, relative_information.GetRelativeDistance_m(2, 1));
+
+  // All values including the RTN frame are evaluated with the new states
+  relative_information.Update();
+  ExpectMatchDirectCalculation(relative_information, 1);
+  SetStates(relative_information, kNumberOfSpacecraft, 2);
+  ExpectMatchDirectCalculation(relative_information, 2);
+}
+
+/**
+ * @brief Test for the log of the spacecraft removed after the log header is written
+ */
+TEST(RelativeInformation, RemovedSpacecraftLog) {
+  const size_t number_of_spacecraft = 3;
+  RelativeInformation relative_information;
+  RegisterSpacecraft(relative_information, number_of_spacecraft);
+  SetStates(relative_information, number_of_spacecraft, 0);
+  // Pairs of (1, 0), (2, 0), and (2, 1)
+  const std::string header = relative_information.GetLogHeader();
+  EXPECT_EQ(4u * 3u * 3u, (size_t)std::count(header.begin(), header.end(), ','));
+
+  relative_information.RemoveDynamicsInfo(2);
+  SetStates(relative_information, number_of_spacecraft - 1, 1);
+  std::stringstream stream(relative_information.GetLogValue());
+  std::vector<double> values;
+  std::string value;
+  while (std::getline(stream, value, ',')) {
+    values.push_back(std::stod(value));
+  }
+  ASSERT_EQ(4u * 3u * 3u, values.size());
+
+  // The values of the blocks of the inertial position, the inertial velocity, the RTN position, and the RTN velocity
+  const libra::Vector<3> expected_values[4] = {
+      relative_information.GetRelativePosition_i_m(1, 0), relative_information.GetRelativeVelocity_i_m_s(1, 0),
+      relative_information.GetRelativePosition_rtn_m(1, 0), relative_information.GetRelativeVelocity_rtn_m_s(1, 0)};
+  for (size_t block = 0; block < 4; block++) {
+    for (size_t i = 0; i < 3; i++) {
+      const double expected_value = expected_values[block][i];
+      EXPECT_NEAR(expected_value, values[block * 9 + i], 1.0e-5 * std::abs(expected_value));
+      // Pairs including the removed spacecraft
+      EXPECT_EQ(0.0, values[block * 9 + 3 + i]);
+      EXPECT_EQ(0.0, values[block * 9 + 6 + i]);
+    }
+  }
+}
@@ -0,0 +1,68 @@
+/**
+ * @file test_spacecraft_update_executor.cpp
+ * @brief Test codes for SpacecraftUpdateExecutor class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+#include "spacecraft_update_executor.hpp"
+
+/**
+ * @brief Test for the barrier between the stages
+ * @note Each task of a stage checks that all tasks of the previous stage have finished in the same update
+ */
+TEST(SpacecraftUpdateExecutor, StageBarrier) {
+  const size_t number_of_stages = 3;
+  const size_t number_of_tasks = 32;
+  const size_t number_of_updates = 200;
+
+  for (size_t number_of_threads : {1, 2, 4, 8}) {
+    SpacecraftUpdateExecutor executor(number_of_threads);
+    EXPECT_EQ(number_of_threads, executor.GetNumberOfThreads());
+
+    std::atomic<size_t> finished_tasks[number_of_stages];
+    std::atomic<size_t> number_of_violations{0};
+    for (size_t stage = 0; stage < number_of_stages; stage++) {
+      finished_tasks[stage] = 0;
+    }
+    // The tasks are added in the reverse order of the stages
+    for (size_t i = 0; i < number_of_stages; i++) {
+      const size_t stage = number_of_stages - 1 - i;
+      for (size_t task_id = 0; task_id < number_of_tasks; task_id++) {
+        executor.AddTask(
+            [&, stage, task_id](const SimulationTime* simulation_time) {
+              EXPECT_EQ(nullptr, simulation_time);
+              const size_t update_count = finished_tasks[stage] / number_of_tasks;
+              if (stage > 0 && finished_tasks[stage - 1] != (update_count + 1) * number_of_tasks) number_of_violations++;
+              if (stage + 1 < number_of_stages && finished_tasks[stage + 1] != update_count * number_of_tasks) number_of_violations++;
+              // Uneven work to shuffle the execution order among the threads
+              volatile double work = 0.0;
+              for (size_t k = 0; k < 100 * (task_id % 7); k++) work = work + k;
+              finished_tasks[stage]++;
+            },
+            stage);
+      }
+    }
+
+    for (size_t update = 0; update < number_of_updates; update++) {
+      executor.Update(nullptr);
+      for (size_t stage = 0; stage < number_of_stages; stage++) {
+        ASSERT_EQ((update + 1) * number_of_tasks, finished_tasks[stage]) << "threads: " << number_of_threads;
+      }
+    }
+    EXPECT_EQ(0u, number_of_violations) << "threads: " << number_of_threads;
+  }
+}
+
+/**
+ * @brief Test for the stages without any task
+ */
+TEST(SpacecraftUpdateExecutor, EmptyStages) {
+  SpacecraftUpdateExecutor executor(4);
+  size_t number_of_executions = 0;
+  executor.AddTask([&](const SimulationTime*) { number_of_executions++; }, 2);
+  // Empty stages are skipped
+  executor.Update(nullptr);
+  EXPECT_EQ(1u, number_of_executions);
+}
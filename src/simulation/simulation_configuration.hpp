@@ -28,6 +28,9 @@ struct SimulationConfiguration {
   std::string inter_sc_communication_file_;  //!< File name for inter-satellite communication initialization
   std::string gnss_file_;                    //!< File name for GNSS initialization
 
+  bool is_execution_cost_accounting_enabled_ = false;  //!< Flag to measure and log the execution costs of the components and disturbances
+  double execution_cost_budget_ratio_ = 1.0;           //!< Ratio of the execution cost budget of a component to its update period
+
   /**
    * @fn ~SimulationConfiguration
    * @brief Destructor
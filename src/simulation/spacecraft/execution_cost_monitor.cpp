@@ -0,0 +1,137 @@
+/**
+ * @file execution_cost_monitor.cpp
+ * @brief Class to log the execution costs of the components and the disturbances of a spacecraft
+ */
+
+#include "execution_cost_monitor.hpp"
+
+#include <cctype>
+#include <iostream>
+#include <map>
+#include <typeinfo>
+#include <utilities/profiler.hpp>
+
+namespace {
+/**
+ * @fn MakeLogName
+ * @brief Make the name in the log from the type name. The characters which are not alphanumeric are replaced with underscores.
+ * @param [in] type_name: Type name given by typeid
+ * @param [in] name_counts: Number of the names which have been made for each type
+ */
+std::string MakeLogName(const char* type_name, std::map<std::string, int>& name_counts) {
+  std::string name = MakeReadableName(type_name);
+  for (char& c : name) {
+    if (!isalnum((unsigned char)c)) c = '_';
+  }
+  const int index = name_counts[name]++;
+  return name + std::to_string(index);
+}
+}  // namespace
+
+ExecutionCostMonitor::ExecutionCostMonitor(const ClockGenerator& clock_generator, const std::vector<Disturbance*>& disturbance_list,
+                                           const double component_step_s, const double budget_ratio, const int spacecraft_id)
+    : clock_generator_(clock_generator),
+      disturbance_list_(disturbance_list),
+      component_step_s_(component_step_s),
+      budget_ratio_(budget_ratio),
+      prefix_("spacecraft" + std::to_string(spacecraft_id) + "_cost_") {}
+
+void ExecutionCostMonitor::CheckBudget() {
+  CollectTargets();
+  for (auto& monitored_component : monitored_components_) {
+    CheckComponentBudget(monitored_component);
+  }
+}
+
+std::vector<std::string> ExecutionCostMonitor::GetOverBudgetComponents() const {
+  std::vector<std::string> names;
+  for (const auto& monitored_component : monitored_components_) {
+    if (monitored_component.is_warned) names.push_back(prefix_ + monitored_component.name);
+  }
+  return names;
+}
+
+std::string ExecutionCostMonitor::GetLogHeader() const {
+  CollectTargets();
+
+  std::string str_tmp = "";
+  for (const auto& monitored_component : monitored_components_) {
+    const std::string name = prefix_ + monitored_component.name;
+    str_tmp += WriteScalar(name + "_tick_calls", "-");
+    str_tmp += WriteScalar(name + "_tick_total_time", "s");
+    str_tmp += WriteScalar(name + "_tick_max_time", "s");
+    str_tmp += WriteScalar(name + "_fast_tick_calls", "-");
+    str_tmp += WriteScalar(name + "_fast_tick_total_time", "s");
+    str_tmp += WriteScalar(name + "_fast_tick_max_time", "s");
+  }
+  for (const auto& monitored_disturbance : monitored_disturbances_) {
+    const std::string name = prefix_ + monitored_disturbance.name;
+    str_tmp += WriteScalar(name + "_update_calls", "-");
+    str_tmp += WriteScalar(name + "_update_total_time", "s");
+    str_tmp += WriteScalar(name + "_update_max_time", "s");
+  }
+  return str_tmp;
+}
+
+std::string ExecutionCostMonitor::GetLogValue() const {
+  std::string str_tmp = "";
+  for (const auto& monitored_component : monitored_components_) {
+    const ExecutionCost& tick_cost = monitored_component.component->GetTickCost();
+    const ExecutionCost& fast_tick_cost = monitored_component.component->GetFastTickCost();
+    str_tmp += WriteScalar(tick_cost.GetNumberOfCalls());
+    str_tmp += WriteScalar(tick_cost.GetTotalTime_s());
+    str_tmp += WriteScalar(tick_cost.GetMaxTime_s());
+    str_tmp += WriteScalar(fast_tick_cost.GetNumberOfCalls());
+    str_tmp += WriteScalar(fast_tick_cost.GetTotalTime_s());
+    str_tmp += WriteScalar(fast_tick_cost.GetMaxTime_s());
+  }
+  for (const auto& monitored_disturbance : monitored_disturbances_) {
+    const ExecutionCost& update_cost = monitored_disturbance.disturbance->GetUpdateCost();
+    str_tmp += WriteScalar(update_cost.GetNumberOfCalls());
+    str_tmp += WriteScalar(update_cost.GetTotalTime_s());
+    str_tmp += WriteScalar(update_cost.GetMaxTime_s());
+  }
+  return str_tmp;
+}
+
+void ExecutionCostMonitor::CollectTargets() const {
+  if (is_collected_) return;
+  is_collected_ = true;
+  std::map<std::string, int> name_counts;
+
+  monitored_components_.clear();
+  for (ITickable* tickable : clock_generator_.GetComponents()) {
+    const Component* component = dynamic_cast<const Component*>(tickable);
+    if (component == nullptr) continue;
+    MonitoredComponent monitored_component;
+    monitored_component.component = component;
+    monitored_component.name = MakeLogName(typeid(*component).name(), name_counts);
+    monitored_component.tick_budget_s = budget_ratio_ * component->GetPrescaler() * component_step_s_;
+    monitored_component.fast_tick_budget_s = budget_ratio_ * component->GetFastPrescaler() * component_step_s_;
+    monitored_components_.push_back(monitored_component);
+  }
+
+  monitored_disturbances_.clear();
+  for (const Disturbance* disturbance : disturbance_list_) {
+    MonitoredDisturbance monitored_disturbance;
+    monitored_disturbance.disturbance = disturbance;
+    monitored_disturbance.name = MakeLogName(typeid(*disturbance).name(), name_counts);
+    monitored_disturbances_.push_back(monitored_disturbance);
+  }
+}
+
+void ExecutionCostMonitor::CheckComponentBudget(MonitoredComponent& monitored_component) const {
+  if (monitored_component.is_warned) return;
+
+  const double tick_max_time_s = monitored_component.component->GetTickCost().GetMaxTime_s();
+  const double fast_tick_max_time_s = monitored_component.component->GetFastTickCost().GetMaxTime_s();
+  if (tick_max_time_s > monitored_component.tick_budget_s) {
+    std::cerr << "[WARNING] execution cost: " << prefix_ << monitored_component.name << " Tick took " << tick_max_time_s
+              << " s, which exceeds the budget " << monitored_component.tick_budget_s << " s." << std::endl;
+    monitored_component.is_warned = true;
+  } else if (fast_tick_max_time_s > monitored_component.fast_tick_budget_s) {
+    std::cerr << "[WARNING] execution cost: " << prefix_ << monitored_component.name << " FastTick took " << fast_tick_max_time_s
+              << " s, which exceeds the budget " << monitored_component.fast_tick_budget_s << " s." << std::endl;
+    monitored_component.is_warned = true;
+  }
+}
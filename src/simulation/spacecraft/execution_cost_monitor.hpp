@@ -0,0 +1,111 @@
+/**
+ * @file execution_cost_monitor.hpp
+ * @brief Class to log the execution costs of the components and the disturbances of a spacecraft
+ */
+
+#ifndef S2E_SIMULATION_SPACECRAFT_EXECUTION_COST_MONITOR_HPP_
+#define S2E_SIMULATION_SPACECRAFT_EXECUTION_COST_MONITOR_HPP_
+
+#include <components/base/component.hpp>
+#include <disturbances/disturbance.hpp>
+#include <environment/global/clock_generator.hpp>
+#include <logger/loggable.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class ExecutionCostMonitor
+ * @brief Class to log the execution costs of the components and the disturbances of a spacecraft and to check the budget of the components
+ * @details The number of calls, the cumulative time, and the maximum time of Tick and FastTick of each component and of the calculation of each
+ *          disturbance are logged. The budget of a component is the budget ratio times its update period. When the maximum time exceeds the
+ *          budget, a warning is shown once for each component. The budget is checked after each component update, independently of the log.
+ */
+class ExecutionCostMonitor : public ILoggable {
+ public:
+  /**
+   * @fn ExecutionCostMonitor
+   * @brief Constructor
+   * @param [in] clock_generator: Clock generator of the components
+   * @param [in] disturbance_list: Disturbances of the spacecraft
+   * @param [in] component_step_s: Component update step [s]
+   * @param [in] budget_ratio: Ratio of the budget to the update period of the component
+   * @param [in] spacecraft_id: ID of the spacecraft
+   */
+  ExecutionCostMonitor(const ClockGenerator& clock_generator, const std::vector<Disturbance*>& disturbance_list, const double component_step_s,
+                       const double budget_ratio, const int spacecraft_id);
+  /**
+   * @fn ~ExecutionCostMonitor
+   * @brief Destructor
+   */
+  virtual ~ExecutionCostMonitor() {}
+
+  /**
+   * @fn CheckBudget
+   * @brief Show the warning for the components whose maximum cost exceeds the budget for the first time
+   * @note The components are collected at the first call of this function or GetLogHeader
+   */
+  void CheckBudget();
+  /**
+   * @fn GetOverBudgetComponents
+   * @brief Return names of the components whose maximum cost has exceeded the budget
+   */
+  std::vector<std::string> GetOverBudgetComponents() const;
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   * @note The components are collected at the first call of this function or CheckBudget because they are constructed after the spacecraft base
+   *       class
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const;
+
+ private:
+  /**
+   * @struct MonitoredComponent
+   * @brief Monitored component and its budget
+   */
+  struct MonitoredComponent {
+    const Component* component;  //!< Component
+    std::string name;            //!< Name in the log
+    double tick_budget_s;        //!< Budget of Tick [s]
+    double fast_tick_budget_s;   //!< Budget of FastTick [s]
+    bool is_warned = false;      //!< Flag to show the budget warning has been shown
+  };
+  /**
+   * @struct MonitoredDisturbance
+   * @brief Monitored disturbance
+   */
+  struct MonitoredDisturbance {
+    const Disturbance* disturbance;  //!< Disturbance
+    std::string name;                //!< Name in the log
+  };
+
+  const ClockGenerator& clock_generator_;                             //!< Clock generator of the components
+  const std::vector<Disturbance*>& disturbance_list_;                 //!< Disturbances of the spacecraft
+  const double component_step_s_;                                     //!< Component update step [s]
+  const double budget_ratio_;                                         //!< Ratio of the budget to the update period
+  const std::string prefix_;                                          //!< Prefix of the names in the log
+  mutable std::vector<MonitoredComponent> monitored_components_;      //!< Monitored components
+  mutable std::vector<MonitoredDisturbance> monitored_disturbances_;  //!< Monitored disturbances
+  mutable bool is_collected_ = false;                                 //!< Flag to show the targets have been collected
+
+  /**
+   * @fn CollectTargets
+   * @brief Collect the components and the disturbances if they have not been collected
+   */
+  void CollectTargets() const;
+  /**
+   * @fn CheckComponentBudget
+   * @brief Show the warning when the maximum cost of the component exceeds the budget
+   * @param [in] monitored_component: Monitored component
+   */
+  void CheckComponentBudget(MonitoredComponent& monitored_component) const;
+};
+
+#endif  // S2E_SIMULATION_SPACECRAFT_EXECUTION_COST_MONITOR_HPP_
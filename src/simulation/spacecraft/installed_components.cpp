@@ -18,3 +18,7 @@ libra::Vector<3> InstalledComponents::GenerateTorque_b_Nm() {
 }
 
 void InstalledComponents::LogSetup(Logger& logger) { UNUSED(logger); }
+
+void InstalledComponents::SaveCheckpoint(CheckpointWriter& writer) const { UNUSED(writer); }
+
+void InstalledComponents::LoadCheckpoint(CheckpointReader& reader) { UNUSED(reader); }
@@ -8,6 +8,7 @@
 
 #include <logger/logger.hpp>
 #include <math_physics/math/vector.hpp>
+#include <utilities/checkpoint.hpp>
 
 /**
  * @class InstalledComponents
@@ -47,6 +48,19 @@ class InstalledComponents {
    * @details Users need to override this function to add logger for components
    */
   virtual void LogSetup(Logger& logger);
+
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the internal state of components into the checkpoint
+   * @details Users need to override this function to save the state of components
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the internal state of components from the checkpoint
+   * @details Users need to override this function to restore the state of components with the same order as SaveCheckpoint
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
 };
 
 #endif  // S2E_SIMULATION_SPACECRAFT_INSTALLED_COMPONENTS_HPP_
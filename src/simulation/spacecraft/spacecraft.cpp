@@ -23,6 +23,7 @@ Spacecraft::~Spacecraft() {
   delete local_environment_;
   delete disturbances_;
   delete components_;
+  delete execution_cost_monitor_;
 }
 
 void Spacecraft::Initialize(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
@@ -33,6 +34,13 @@ void Spacecraft::Initialize(const SimulationConfiguration* simulation_configurat
   dynamics_ = new Dynamics(simulation_configuration, &(global_environment->GetSimulationTime()), local_environment_, spacecraft_id, structure_,
                            relative_information);
   disturbances_ = new Disturbances(simulation_configuration, spacecraft_id, structure_, global_environment);
+  if (simulation_configuration->is_execution_cost_accounting_enabled_) {
+    execution_cost_monitor_ = new ExecutionCostMonitor(clock_generator_, disturbances_->GetDisturbanceList(),
+                                                       global_environment->GetSimulationTime().GetComponentStepTime_s(),
+                                                       simulation_configuration->execution_cost_budget_ratio_, spacecraft_id);
+  } else {
+    execution_cost_monitor_ = nullptr;
+  }
 
   simulation_configuration->main_logger_->CopyFileToLogDirectory(simulation_configuration->spacecraft_file_list_[spacecraft_id]);
 
@@ -47,21 +55,37 @@ void Spacecraft::LogSetup(Logger& logger) {
   local_environment_->LogSetup(logger);
   disturbances_->LogSetup(logger);
   components_->LogSetup(logger);
+  if (execution_cost_monitor_ != nullptr) {
+    logger.AddLogList(execution_cost_monitor_);
+  }
 }
 
 void Spacecraft::Update(const SimulationTime* simulation_time) {
   dynamics_->ClearForceTorque();
 
   // Update local environment and disturbance
-  local_environment_->Update(dynamics_, simulation_time);
-  disturbances_->Update(*local_environment_, *dynamics_, simulation_time);
+  {
+    ScopedExecutionCost scoped_cost(local_environment_cost_);
+    local_environment_->Update(dynamics_, simulation_time);
+  }
+  {
+    ScopedExecutionCost scoped_cost(disturbances_cost_);
+    disturbances_->Update(*local_environment_, *dynamics_, simulation_time);
+  }
 
   // Update components
-  clock_generator_.UpdateComponents(simulation_time);
-  components_->ComponentInterference();
+  {
+    ScopedExecutionCost scoped_cost(components_cost_);
+    clock_generator_.UpdateComponents(simulation_time);
+    components_->ComponentInterference();
+  }
+  if (execution_cost_monitor_ != nullptr && simulation_time->GetCompoUpdateFlag()) {
+    execution_cost_monitor_->CheckBudget();
+  }
 
   // Add generated force and torque by disturbances
   dynamics_->AddAcceleration_i_m_s2(disturbances_->GetAcceleration_i_m_s2());
+  dynamics_->AddAccelerationPartialDerivative_i_s2(disturbances_->GetAccelerationPartialDerivative_i_s2());
   dynamics_->AddTorque_b_Nm(disturbances_->GetTorque_b_Nm());
   dynamics_->AddForce_b_N(disturbances_->GetForce_b_N());
 
@@ -74,3 +98,19 @@ void Spacecraft::Update(const SimulationTime* simulation_time) {
 }
 
 void Spacecraft::Clear(void) { dynamics_->ClearForceTorque(); }
+
+void Spacecraft::SaveCheckpoint(CheckpointWriter& writer) const {
+  clock_generator_.SaveCheckpoint(writer);
+  dynamics_->SaveCheckpoint(writer);
+  local_environment_->SaveCheckpoint(writer);
+  disturbances_->SaveCheckpoint(writer);
+  components_->SaveCheckpoint(writer);
+}
+
+void Spacecraft::LoadCheckpoint(CheckpointReader& reader) {
+  clock_generator_.LoadCheckpoint(reader);
+  dynamics_->LoadCheckpoint(reader);
+  local_environment_->LoadCheckpoint(reader);
+  disturbances_->LoadCheckpoint(reader);
+  components_->LoadCheckpoint(reader);
+}
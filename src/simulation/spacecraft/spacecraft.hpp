@@ -11,7 +11,9 @@
 #include <environment/global/clock_generator.hpp>
 #include <environment/local/local_environment.hpp>
 #include <simulation/multiple_spacecraft/relative_information.hpp>
+#include <utilities/checkpoint.hpp>
 
+#include "execution_cost_monitor.hpp"
 #include "installed_components.hpp"
 #include "structure/structure.hpp"
 
@@ -19,7 +21,7 @@
  * @class Spacecraft
  * @brief Base class to express Spacecraft
  */
-class Spacecraft {
+class Spacecraft : public ICheckpointable {
  public:
   /**
    * @fn Spacecraft
@@ -64,6 +66,18 @@ class Spacecraft {
    */
   virtual void LogSetup(Logger& logger);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of ICheckpointable
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of ICheckpointable
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
+
   // Getters
   /**
    * @fn GetDynamics
@@ -95,16 +109,37 @@ class Spacecraft {
    * @brief Get ID of the spacecraft
    */
   inline unsigned int GetSpacecraftId() const { return spacecraft_id_; }
+  /**
+   * @fn GetLocalEnvironmentCost
+   * @brief Get measured execution cost of the local environment update
+   */
+  inline const ExecutionCost& GetLocalEnvironmentCost() const { return local_environment_cost_; }
+  /**
+   * @fn GetDisturbancesCost
+   * @brief Get measured execution cost of the disturbance update
+   */
+  inline const ExecutionCost& GetDisturbancesCost() const { return disturbances_cost_; }
+  /**
+   * @fn GetComponentsCost
+   * @brief Get measured execution cost of the component update
+   */
+  inline const ExecutionCost& GetComponentsCost() const { return components_cost_; }
 
  protected:
-  ClockGenerator clock_generator_;             //!< Origin of clock for the spacecraft
-  Dynamics* dynamics_;                         //!< Dynamics information of the spacecraft
-  RelativeInformation* relative_information_;  //!< Relative information with respect to the other spacecraft
-  LocalEnvironment* local_environment_;        //!< Local environment information around the spacecraft
-  Disturbances* disturbances_;                 //!< Disturbance information acting on the spacecraft
-  Structure* structure_;                       //!< Structure information of the spacecraft
-  InstalledComponents* components_;            //!< Components information installed on the spacecraft
-  const unsigned int spacecraft_id_;           //!< ID of the spacecraft
+  ClockGenerator clock_generator_;                //!< Origin of clock for the spacecraft
+  Dynamics* dynamics_;                            //!< Dynamics information of the spacecraft
+  RelativeInformation* relative_information_;     //!< Relative information with respect to the other spacecraft
+  LocalEnvironment* local_environment_;           //!< Local environment information around the spacecraft
+  Disturbances* disturbances_;                    //!< Disturbance information acting on the spacecraft
+  Structure* structure_;                          //!< Structure information of the spacecraft
+  InstalledComponents* components_;               //!< Components information installed on the spacecraft
+  ExecutionCostMonitor* execution_cost_monitor_;  //!< Monitor of the execution costs (nullptr when the accounting is disabled)
+  const unsigned int spacecraft_id_;              //!< ID of the spacecraft
+
+ private:
+  ExecutionCost local_environment_cost_;  //!< Execution cost of the local environment update
+  ExecutionCost disturbances_cost_;       //!< Execution cost of the disturbance update
+  ExecutionCost components_cost_;         //!< Execution cost of the component update
 };
 
 #endif  // S2E_SIMULATION_SPACECRAFT_SPACECRAFT_HPP_
@@ -0,0 +1,76 @@
+/**
+ * @file test_execution_cost_monitor.cpp
+ * @brief Test codes for ExecutionCostMonitor class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "execution_cost_monitor.hpp"
+
+namespace {
+/**
+ * @class SleepComponent
+ * @brief Component which sleeps in the main routine
+ */
+class SleepComponent : public Component {
+ public:
+  /**
+   * @fn SleepComponent
+   * @brief Constructor
+   * @param [in] prescaler: Frequency scale factor for normal update
+   * @param [in] clock_generator: Clock generator
+   * @param [in] sleep_time_ms: Sleep time in the main routine [ms]
+   */
+  SleepComponent(const unsigned int prescaler, ClockGenerator* clock_generator, const int sleep_time_ms)
+      : Component(prescaler, clock_generator), sleep_time_ms_(sleep_time_ms) {}
+
+ protected:
+  void MainRoutine(const int time_count) override {
+    UNUSED(time_count);
+    std::this_thread::sleep_for(std::chrono::milliseconds(sleep_time_ms_));
+  }
+
+ private:
+  int sleep_time_ms_;  //!< Sleep time in the main routine [ms]
+};
+}  // namespace
+
+/**
+ * @brief Test for the budget of prescaler x component step x ratio checked without the log
+ */
+TEST(ExecutionCostMonitor, BudgetOverrun) {
+  ExecutionCost::SetAccountingEnabled(true);
+  ClockGenerator clock_generator;
+  // Budget of 1 ms and 500 ms
+  SleepComponent over_budget_component(2, &clock_generator, 5);
+  SleepComponent within_budget_component(1000, &clock_generator, 5);
+  const std::vector<Disturbance*> disturbance_list;
+  ExecutionCostMonitor monitor(clock_generator, disturbance_list, 0.001, 0.5, 3);
+
+  monitor.CheckBudget();
+  EXPECT_TRUE(monitor.GetOverBudgetComponents().empty());
+
+  // Only the first Tick of the component is executed at count 0 and 2
+  for (size_t count = 0; count < 3; count++) {
+    clock_generator.TickToComponents();
+    monitor.CheckBudget();
+  }
+  ExecutionCost::SetAccountingEnabled(false);
+
+  EXPECT_EQ(2, over_budget_component.GetTickCost().GetNumberOfCalls());
+  EXPECT_EQ(1, within_budget_component.GetTickCost().GetNumberOfCalls());
+  EXPECT_GE(over_budget_component.GetTickCost().GetMaxTime_s(), 0.005);
+  const std::vector<std::string> over_budget_components = monitor.GetOverBudgetComponents();
+  ASSERT_EQ(1u, over_budget_components.size());
+  EXPECT_EQ(0u, over_budget_components[0].find("spacecraft3_cost_"));
+  EXPECT_NE(std::string::npos, over_budget_components[0].find("SleepComponent"));
+
+  // The log header keeps the collected components
+  const std::string header = monitor.GetLogHeader();
+  EXPECT_NE(std::string::npos, header.find(over_budget_components[0] + "_tick_max_time"));
+  EXPECT_EQ(1u, monitor.GetOverBudgetComponents().size());
+}
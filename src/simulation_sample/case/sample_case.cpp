@@ -32,6 +32,16 @@ void SampleCase::UpdateTargetObjects() {
   sample_ground_station_->Update(global_environment_->GetCelestialInformation().GetEarthRotation(), *sample_spacecraft_);
 }
 
+void SampleCase::SaveCheckpointTargetObjects(CheckpointWriter& writer) const {
+  sample_spacecraft_->SaveCheckpoint(writer);
+  sample_ground_station_->SaveCheckpoint(writer);
+}
+
+void SampleCase::LoadCheckpointTargetObjects(CheckpointReader& reader) {
+  sample_spacecraft_->LoadCheckpoint(reader);
+  sample_ground_station_->LoadCheckpoint(reader);
+}
+
 std::string SampleCase::GetLogHeader() const {
   std::string str_tmp = "";
 
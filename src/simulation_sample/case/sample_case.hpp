@@ -55,6 +55,17 @@ class SampleCase : public SimulationCase {
    * @brief Override function of Main in SimulationCase
    */
   void UpdateTargetObjects();
+
+  /**
+   * @fn SaveCheckpointTargetObjects
+   * @brief Override function of SaveCheckpointTargetObjects in SimulationCase
+   */
+  void SaveCheckpointTargetObjects(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpointTargetObjects
+   * @brief Override function of LoadCheckpointTargetObjects in SimulationCase
+   */
+  void LoadCheckpointTargetObjects(CheckpointReader& reader);
 };
 
 #endif  // S2E_SIMULATION_SAMPLE_CASE_SAMPLE_CASE_HPP_
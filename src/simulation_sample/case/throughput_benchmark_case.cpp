@@ -0,0 +1,197 @@
+/**
+ * @file throughput_benchmark_case.cpp
+ * @brief Simulation case to measure the throughput of the whole simulation with the benchmark scenarios
+ */
+
+#include "throughput_benchmark_case.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <setting_file_reader/initialize_file_access.hpp>
+#include <utility>
+
+namespace {
+/**
+ * @class SpacecraftWithoutComponents
+ * @brief Spacecraft which has only the dynamics, the local environment, and the disturbances
+ */
+class SpacecraftWithoutComponents : public Spacecraft {
+ public:
+  /**
+   * @fn SpacecraftWithoutComponents
+   * @brief Constructor
+   */
+  SpacecraftWithoutComponents(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
+                              const int spacecraft_id, RelativeInformation* relative_information)
+      : Spacecraft(simulation_configuration, global_environment, spacecraft_id, relative_information) {
+    components_ = new InstalledComponents();
+  }
+};
+
+/**
+ * @fn ParseIniLine
+ * @brief Parse a line of the ini file
+ * @param [in] line: Line of the ini file
+ * @param [in/out] section: Current section name which is updated at the section header
+ * @param [out] key: Key name (empty when the line is not a key-value pair)
+ * @param [out] value: Value
+ */
+void ParseIniLine(const std::string& line, std::string& section, std::string& key, std::string& value) {
+  auto trim = [](const std::string& text) {
+    const size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return std::string();
+    return text.substr(begin, text.find_last_not_of(" \t\r") - begin + 1);
+  };
+  key.clear();
+  value.clear();
+  const std::string trimmed_line = trim(line);
+  if (trimmed_line.empty() || trimmed_line.rfind("//", 0) == 0 || trimmed_line[0] == ';' || trimmed_line[0] == '#') return;
+  if (trimmed_line[0] == '[') {
+    section = trimmed_line.substr(1, trimmed_line.find(']') - 1);
+    return;
+  }
+  const size_t separator = trimmed_line.find('=');
+  if (separator == std::string::npos) return;
+  key = trim(trimmed_line.substr(0, separator));
+  value = trim(trimmed_line.substr(separator + 1));
+}
+
+/**
+ * @fn GenerateSpacecraftFile
+ * @brief Generate the spacecraft file by overwriting the values of the template file with the values in the override file
+ * @note The override file has the same sections and keys as the template file, and only the keys to be changed are written in it.
+ * @param [in] template_file: Template spacecraft file
+ * @param [in] override_file: Override file
+ * @param [in] output_file: Generated spacecraft file
+ * @return File path of the spacecraft file to be used (the template file when the generation fails)
+ */
+std::string GenerateSpacecraftFile(const std::string template_file, const std::string override_file, const std::string output_file) {
+  std::ifstream override_stream(override_file);
+  std::ifstream template_stream(template_file);
+  std::ofstream output_stream(output_file);
+  if (!override_stream.is_open() || !template_stream.is_open() || !output_stream.is_open()) {
+    std::cerr << "[WARNING] throughput benchmark: cannot generate " << output_file << " from " << template_file << " and " << override_file
+              << ". The template file is used." << std::endl;
+    return template_file;
+  }
+
+  std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>> overrides;  // (section, key) -> (value, is_applied)
+  std::string line, section, key, value;
+  while (std::getline(override_stream, line)) {
+    ParseIniLine(line, section, key, value);
+    if (!key.empty()) overrides[std::make_pair(section, key)] = std::make_pair(value, false);
+  }
+
+  section.clear();
+  while (std::getline(template_stream, line)) {
+    ParseIniLine(line, section, key, value);
+    const auto override_value = overrides.find(std::make_pair(section, key));
+    if (!key.empty() && override_value != overrides.end()) {
+      output_stream << key << " = " << override_value->second.first << std::endl;
+      override_value->second.second = true;
+    } else {
+      output_stream << line << std::endl;
+    }
+  }
+
+  for (const auto& override_value : overrides) {
+    if (override_value.second.second) continue;
+    std::cerr << "[WARNING] throughput benchmark: " << override_value.first.second << " in [" << override_value.first.first << "] of "
+              << override_file << " is not found in " << template_file << ". It is ignored." << std::endl;
+  }
+  return output_file;
+}
+}  // namespace
+
+ThroughputBenchmarkCase::ThroughputBenchmarkCase(const std::string initialize_base_file) : SimulationCase(initialize_base_file) {
+  IniAccess ini_file(initialize_base_file);
+  scenario_name_ = ini_file.ReadString("THROUGHPUT_BENCHMARK", "scenario_name");
+  is_component_installed_ = ini_file.ReadEnable("THROUGHPUT_BENCHMARK", "install_components");
+
+  // The spacecraft files are generated in the log directory from the template files and the overrides of each spacecraft
+  const std::string log_path = simulation_configuration_.main_logger_->GetLogPath();
+  std::vector<std::string>& spacecraft_file_list = simulation_configuration_.spacecraft_file_list_;
+  for (size_t spacecraft_id = 0; spacecraft_id < spacecraft_file_list.size(); spacecraft_id++) {
+    const std::string key_name = "spacecraft_override_file(" + std::to_string(spacecraft_id) + ")";
+    const std::string override_file = ini_file.ReadString("THROUGHPUT_BENCHMARK", key_name.c_str());
+    if (override_file.empty() || override_file == "NULL") continue;
+    const std::string output_file = log_path + scenario_name_ + "_spacecraft_" + std::to_string(spacecraft_id) + ".ini";
+    spacecraft_file_list[spacecraft_id] = GenerateSpacecraftFile(spacecraft_file_list[spacecraft_id], override_file, output_file);
+  }
+}
+
+ThroughputBenchmarkCase::~ThroughputBenchmarkCase() {
+  for (auto spacecraft : spacecraft_list_) {
+    delete spacecraft;
+  }
+}
+
+void ThroughputBenchmarkCase::InitializeTargetObjects() {
+  // The reference spacecraft of the relative orbit must have the smaller ID
+  for (unsigned int spacecraft_id = 0; spacecraft_id < simulation_configuration_.number_of_simulated_spacecraft_; spacecraft_id++) {
+    Spacecraft* spacecraft;
+    if (is_component_installed_) {
+      spacecraft = new SampleSpacecraft(&simulation_configuration_, global_environment_, spacecraft_id, &relative_information_);
+    } else {
+      spacecraft = new SpacecraftWithoutComponents(&simulation_configuration_, global_environment_, spacecraft_id, &relative_information_);
+    }
+    spacecraft->LogSetup(*(simulation_configuration_.main_logger_));
+    spacecraft_list_.push_back(spacecraft);
+  }
+}
+
+void ThroughputBenchmarkCase::UpdateTargetObjects() {
+  for (auto spacecraft : spacecraft_list_) {
+    spacecraft->Update(&(global_environment_->GetSimulationTime()));
+  }
+  relative_information_.Update();
+}
+
+std::vector<std::pair<std::string, double>> ThroughputBenchmarkCase::GetSubsystemTimes_s() const {
+  double local_environment_s = 0.0;
+  double disturbances_s = 0.0;
+  double components_s = 0.0;
+  double attitude_s = 0.0;
+  double orbit_s = 0.0;
+  double thermal_s = 0.0;
+  for (auto spacecraft : spacecraft_list_) {
+    local_environment_s += spacecraft->GetLocalEnvironmentCost().GetTotalTime_s();
+    disturbances_s += spacecraft->GetDisturbancesCost().GetTotalTime_s();
+    components_s += spacecraft->GetComponentsCost().GetTotalTime_s();
+    attitude_s += spacecraft->GetDynamics().GetAttitudeCost().GetTotalTime_s();
+    orbit_s += spacecraft->GetDynamics().GetOrbitCost().GetTotalTime_s();
+    thermal_s += spacecraft->GetDynamics().GetThermalCost().GetTotalTime_s();
+  }
+  const double measured_s = local_environment_s + disturbances_s + components_s + attitude_s + orbit_s + thermal_s;
+
+  std::vector<std::pair<std::string, double>> subsystem_times_s;
+  subsystem_times_s.push_back(std::make_pair("global_environment", GetGlobalEnvironmentCost().GetTotalTime_s()));
+  subsystem_times_s.push_back(std::make_pair("local_environment", local_environment_s));
+  subsystem_times_s.push_back(std::make_pair("disturbances", disturbances_s));
+  subsystem_times_s.push_back(std::make_pair("components", components_s));
+  subsystem_times_s.push_back(std::make_pair("attitude", attitude_s));
+  subsystem_times_s.push_back(std::make_pair("orbit", orbit_s));
+  subsystem_times_s.push_back(std::make_pair("thermal", thermal_s));
+  // Other parts of the spacecraft update (e.g. the force and torque summation, the relative information)
+  subsystem_times_s.push_back(std::make_pair("other_target_objects", std::max(GetTargetObjectsCost().GetTotalTime_s() - measured_s, 0.0)));
+  subsystem_times_s.push_back(std::make_pair("logging", GetLoggingCost().GetTotalTime_s()));
+  return subsystem_times_s;
+}
+
+std::string ThroughputBenchmarkCase::GetLogHeader() const {
+  std::string str_tmp = "";
+
+  str_tmp += WriteScalar("time", "s");
+
+  return str_tmp;
+}
+
+std::string ThroughputBenchmarkCase::GetLogValue() const {
+  std::string str_tmp = "";
+
+  str_tmp += WriteScalar(global_environment_->GetSimulationTime().GetElapsedTime_s());
+
+  return str_tmp;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file throughput_benchmark_case.hpp
+ * @brief Simulation case to measure the throughput of the whole simulation with the benchmark scenarios
+ */
+
+#ifndef S2E_SIMULATION_SAMPLE_CASE_THROUGHPUT_BENCHMARK_CASE_HPP_
+#define S2E_SIMULATION_SAMPLE_CASE_THROUGHPUT_BENCHMARK_CASE_HPP_
+
+#include <src/simulation/case/simulation_case.hpp>
+#include <src/simulation/multiple_spacecraft/relative_information.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../spacecraft/sample_spacecraft.hpp"
+
+/**
+ * @class ThroughputBenchmarkCase
+ * @brief Simulation case to measure the throughput of the whole simulation with the benchmark scenarios
+ * @details All spacecraft listed in the simulation base file are simulated in the order of the ID without ground stations. The scenario is
+ *          configured with [THROUGHPUT_BENCHMARK] section of the simulation base file. The spacecraft install the sample components only when
+ *          install_components is enabled. When spacecraft_override_file(<id>) is given, the spacecraft file of the ID is generated from the
+ *          spacecraft_file(<id>) as a template with the values in the override file. The execution costs of the subsystems are measured when the
+ *          execution cost accounting is enabled.
+ */
+class ThroughputBenchmarkCase : public SimulationCase {
+ public:
+  /**
+   * @fn ThroughputBenchmarkCase
+   * @brief Constructor
+   * @param [in] initialize_base_file: File path to initialize base file
+   */
+  ThroughputBenchmarkCase(const std::string initialize_base_file);
+  /**
+   * @fn ~ThroughputBenchmarkCase
+   * @brief Destructor
+   */
+  virtual ~ThroughputBenchmarkCase();
+
+  /**
+   * @fn GetLogHeader
+   * @brief Override function of log header setting
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override function of log value setting
+   */
+  virtual std::string GetLogValue() const;
+
+  // Getter
+  /**
+   * @fn GetScenarioName
+   * @brief Return name of the benchmark scenario
+   */
+  inline const std::string& GetScenarioName() const { return scenario_name_; }
+  /**
+   * @fn GetNumberOfSpacecraft
+   * @brief Return number of the simulated spacecraft
+   */
+  inline size_t GetNumberOfSpacecraft() const { return spacecraft_list_.size(); }
+  /**
+   * @fn GetSubsystemTimes_s
+   * @brief Return cumulative execution time of each subsystem summed over all spacecraft [s]
+   * @return Pairs of the subsystem name and the execution time
+   */
+  std::vector<std::pair<std::string, double>> GetSubsystemTimes_s() const;
+
+ private:
+  std::string scenario_name_;                 //!< Name of the benchmark scenario
+  bool is_component_installed_;               //!< Flag to install the sample components
+  std::vector<Spacecraft*> spacecraft_list_;  //!< Simulated spacecraft
+  RelativeInformation relative_information_;  //!< Relative information between the spacecraft
+
+  /**
+   * @fn InitializeTargetObjects
+   * @brief Override function to initialize the spacecraft
+   */
+  void InitializeTargetObjects();
+  /**
+   * @fn UpdateTargetObjects
+   * @brief Override function to update the spacecraft
+   */
+  void UpdateTargetObjects();
+};
+
+#endif  // S2E_SIMULATION_SAMPLE_CASE_THROUGHPUT_BENCHMARK_CASE_HPP_
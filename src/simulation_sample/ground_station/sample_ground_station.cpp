@@ -23,3 +23,13 @@ void SampleGroundStation::Update(const EarthRotation& celestial_rotation, const
   GroundStation::Update(celestial_rotation, spacecraft);
   components_->GetGsCalculator()->Update(spacecraft, spacecraft.GetInstalledComponents().GetAntenna(), *this, *(components_->GetAntenna()));
 }
+
+void SampleGroundStation::SaveCheckpoint(CheckpointWriter& writer) const {
+  GroundStation::SaveCheckpoint(writer);
+  components_->GetGsCalculator()->SaveCheckpoint(writer);
+}
+
+void SampleGroundStation::LoadCheckpoint(CheckpointReader& reader) {
+  GroundStation::LoadCheckpoint(reader);
+  components_->GetGsCalculator()->LoadCheckpoint(reader);
+}
@@ -43,6 +43,16 @@ class SampleGroundStation : public GroundStation {
    * @brief Override function of Update in GroundStation class
    */
   virtual void Update(const EarthRotation& celestial_rotation, const SampleSpacecraft& spacecraft);
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override function of SaveCheckpoint in GroundStation class
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override function of LoadCheckpoint in GroundStation class
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader);
 
  private:
   using GroundStation::Update;
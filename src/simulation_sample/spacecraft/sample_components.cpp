@@ -223,3 +223,41 @@ void SampleComponents::LogSetup(Logger& logger) {
   logger.AddLogList(attitude_observer_);
   logger.AddLogList(orbit_observer_);
 }
+
+void SampleComponents::SaveCheckpoint(CheckpointWriter& writer) const {
+  pcu_->SaveCheckpoint(writer);
+  obc_->SaveCheckpoint(writer);
+  gyro_sensor_->SaveCheckpoint(writer);
+  magnetometer_->SaveCheckpoint(writer);
+  star_sensor_->SaveCheckpoint(writer);
+  sun_sensor_->SaveCheckpoint(writer);
+  gnss_receiver_->SaveCheckpoint(writer);
+  magnetorquer_->SaveCheckpoint(writer);
+  reaction_wheel_->SaveCheckpoint(writer);
+  thruster_->SaveCheckpoint(writer);
+  telescope_->SaveCheckpoint(writer);
+  force_generator_->SaveCheckpoint(writer);
+  torque_generator_->SaveCheckpoint(writer);
+  angular_velocity_observer_->SaveCheckpoint(writer);
+  attitude_observer_->SaveCheckpoint(writer);
+  orbit_observer_->SaveCheckpoint(writer);
+}
+
+void SampleComponents::LoadCheckpoint(CheckpointReader& reader) {
+  pcu_->LoadCheckpoint(reader);
+  obc_->LoadCheckpoint(reader);
+  gyro_sensor_->LoadCheckpoint(reader);
+  magnetometer_->LoadCheckpoint(reader);
+  star_sensor_->LoadCheckpoint(reader);
+  sun_sensor_->LoadCheckpoint(reader);
+  gnss_receiver_->LoadCheckpoint(reader);
+  magnetorquer_->LoadCheckpoint(reader);
+  reaction_wheel_->LoadCheckpoint(reader);
+  thruster_->LoadCheckpoint(reader);
+  telescope_->LoadCheckpoint(reader);
+  force_generator_->LoadCheckpoint(reader);
+  torque_generator_->LoadCheckpoint(reader);
+  angular_velocity_observer_->LoadCheckpoint(reader);
+  attitude_observer_->LoadCheckpoint(reader);
+  orbit_observer_->LoadCheckpoint(reader);
+}
@@ -91,6 +91,16 @@ class SampleComponents : public InstalledComponents {
    * @brief Setup the logger for components
    */
   void LogSetup(Logger& logger) override;
+  /**
+   * @fn SaveCheckpoint
+   * @brief Override SaveCheckpoint function of InstalledComponents
+   */
+  void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Override LoadCheckpoint function of InstalledComponents
+   */
+  void LoadCheckpoint(CheckpointReader& reader) override;
 
   // Getter
   inline Antenna& GetAntenna() const { return *antenna_; }
@@ -21,9 +21,13 @@ class SampleSpacecraft : public Spacecraft {
   /**
    * @fn SampleSpacecraft
    * @brief Constructor
+   * @param [in] simulation_configuration: Simulation configuration
+   * @param [in] global_environment: Global environment
+   * @param [in] spacecraft_id: ID of the spacecraft
+   * @param [in] relative_information: Relative information for the multiple spacecraft simulation
    */
   SampleSpacecraft(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
-                   const unsigned int spacecraft_id);
+                   const unsigned int spacecraft_id, RelativeInformation* relative_information = nullptr);
 
   /**
    * @fn GetInstalledComponents
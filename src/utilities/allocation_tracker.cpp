@@ -0,0 +1,125 @@
+/**
+ * @file allocation_tracker.cpp
+ * @brief Accounting of the heap allocations to find and prevent the allocations in the simulation steps
+ */
+
+#include "allocation_tracker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+
+#include "profiler.hpp"
+
+namespace {
+const int kUntrackedScopeIndex = 0;  //!< Index of the allocations outside the scopes
+const int kOverflowScopeIndex = 1;   //!< Index of the scopes which cannot be registered
+
+// The counters are constant-initialized and do not allocate since they are used in operator new
+std::atomic<const char*> scope_names[AllocationTracker::kMaxNumberOfScopes];        //!< Names of the scopes
+std::atomic<int64_t> scope_allocations[AllocationTracker::kMaxNumberOfScopes];      //!< Number of the allocations of the scopes
+std::atomic<int64_t> scope_allocated_bytes[AllocationTracker::kMaxNumberOfScopes];  //!< Allocated size of the scopes [byte]
+thread_local int current_scope_index = kUntrackedScopeIndex;                        //!< Current scope of the thread
+thread_local int64_t number_of_thread_allocations = 0;                              //!< Number of the allocations of the thread
+}  // namespace
+
+void AllocationTracker::RecordAllocation(const size_t size) {
+  number_of_thread_allocations++;
+  scope_allocations[current_scope_index].fetch_add(1, std::memory_order_relaxed);
+  scope_allocated_bytes[current_scope_index].fetch_add((int64_t)size, std::memory_order_relaxed);
+}
+
+int64_t AllocationTracker::GetNumberOfThreadAllocations() { return number_of_thread_allocations; }
+
+int AllocationTracker::RegisterScope(const char* name) {
+  for (int scope_index = kOverflowScopeIndex + 1; scope_index < kMaxNumberOfScopes; scope_index++) {
+    const char* registered_name = scope_names[scope_index].load(std::memory_order_acquire);
+    if (registered_name == nullptr) {
+      // The expected value is updated with the name registered by another thread when the exchange fails
+      if (scope_names[scope_index].compare_exchange_strong(registered_name, name, std::memory_order_acq_rel)) return scope_index;
+    }
+    if (registered_name == name || strcmp(registered_name, name) == 0) return scope_index;
+  }
+  return kOverflowScopeIndex;
+}
+
+int AllocationTracker::SwapCurrentScope(const int scope_index) {
+  const int previous_scope_index = current_scope_index;
+  current_scope_index = scope_index;
+  return previous_scope_index;
+}
+
+std::vector<AllocationStatistics> AllocationTracker::GetStatistics() {
+  std::vector<AllocationStatistics> statistics_list;
+  for (int scope_index = 0; scope_index < kMaxNumberOfScopes; scope_index++) {
+    const int64_t number_of_allocations = scope_allocations[scope_index].load(std::memory_order_relaxed);
+    if (number_of_allocations == 0) continue;
+
+    AllocationStatistics statistics;
+    if (scope_index == kUntrackedScopeIndex) {
+      statistics.name = "untracked";
+    } else if (scope_index == kOverflowScopeIndex) {
+      statistics.name = "overflow";
+    } else {
+      statistics.name = MakeReadableName(scope_names[scope_index].load(std::memory_order_acquire));
+    }
+    statistics.number_of_allocations = number_of_allocations;
+    statistics.allocated_bytes = scope_allocated_bytes[scope_index].load(std::memory_order_relaxed);
+    statistics_list.push_back(statistics);
+  }
+  std::sort(statistics_list.begin(), statistics_list.end(), [](const AllocationStatistics& lhs, const AllocationStatistics& rhs) {
+    return lhs.number_of_allocations > rhs.number_of_allocations;
+  });
+  return statistics_list;
+}
+
+bool AllocationTracker::WriteSummary(const std::string file_name) {
+  // The statistics are collected before the file is opened to exclude the allocations of the output
+  const std::vector<AllocationStatistics> statistics_list = GetStatistics();
+
+  std::ofstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] allocation tracker: cannot open " << file_name << std::endl;
+    return false;
+  }
+  file << "scope,number_of_allocations,allocated_bytes[byte]" << std::endl;
+  for (const auto& statistics : statistics_list) {
+    file << "\"" << statistics.name << "\"," << statistics.number_of_allocations << "," << statistics.allocated_bytes << std::endl;
+  }
+  return true;
+}
+
+void AllocationTracker::Clear() {
+  for (int scope_index = 0; scope_index < kMaxNumberOfScopes; scope_index++) {
+    scope_allocations[scope_index].store(0, std::memory_order_relaxed);
+    scope_allocated_bytes[scope_index].store(0, std::memory_order_relaxed);
+  }
+}
+
+#ifdef USE_ALLOCATION_TRACKER
+// Replacement of the global allocation functions. The array and nothrow versions are replaced as well since the default implementations are not
+// guaranteed to call the replaced single object version. The aligned versions are not counted.
+void* operator new(std::size_t size) {
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) throw std::bad_alloc();
+  AllocationTracker::RecordAllocation(size);
+  return pointer;
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer != nullptr) AllocationTracker::RecordAllocation(size);
+  return pointer;
+}
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+#endif
@@ -0,0 +1,149 @@
+/**
+ * @file allocation_tracker.hpp
+ * @brief Accounting of the heap allocations to find and prevent the allocations in the simulation steps
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_ALLOCATION_TRACKER_HPP_
+#define S2E_LIBRARY_UTILITIES_ALLOCATION_TRACKER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct AllocationStatistics
+ * @brief Heap allocations counted in a scope
+ */
+struct AllocationStatistics {
+  std::string name;               //!< Name of the scope
+  int64_t number_of_allocations;  //!< Number of the allocations
+  int64_t allocated_bytes;        //!< Total size of the allocations [byte]
+};
+
+/**
+ * @class AllocationTracker
+ * @brief Counter of the heap allocations for each scope
+ * @details The global operator new and delete are replaced to count the allocations when USE_ALLOCATION_TRACKER is defined. Each allocation is
+ *          counted into the innermost scope marked with ALLOCATION_SCOPE in the calling thread, or into the "untracked" scope. The counting itself
+ *          does not allocate. Up to kMaxNumberOfScopes scope names are distinguished and the others are counted into the "overflow" scope.
+ */
+class AllocationTracker {
+ public:
+  static const int kMaxNumberOfScopes = 256;  //!< Maximum number of the scope names
+
+  /**
+   * @fn IsCompiled
+   * @brief Return true when the global operator new and delete are replaced to count the allocations
+   */
+  static constexpr bool IsCompiled() {
+#ifdef USE_ALLOCATION_TRACKER
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * @fn RecordAllocation
+   * @brief Count an allocation into the current scope of the calling thread
+   * @param [in] size: Allocated size [byte]
+   */
+  static void RecordAllocation(const size_t size);
+  /**
+   * @fn GetNumberOfThreadAllocations
+   * @brief Return number of the allocations in the calling thread since the thread started
+   */
+  static int64_t GetNumberOfThreadAllocations();
+
+  /**
+   * @fn RegisterScope
+   * @brief Return the index of the scope name. The name is registered at the first call.
+   * @param [in] name: Name of the scope. The pointer must be valid until the results are read (e.g. string literal or type name given by typeid).
+   */
+  static int RegisterScope(const char* name);
+  /**
+   * @fn SwapCurrentScope
+   * @brief Set the current scope of the calling thread
+   * @param [in] scope_index: Index of the new scope
+   * @return Index of the previous scope
+   */
+  static int SwapCurrentScope(const int scope_index);
+
+  /**
+   * @fn GetStatistics
+   * @brief Return the statistics of the scopes which have allocated, sorted by the number of the allocations
+   * @note Call this function when the simulation threads are not running
+   */
+  static std::vector<AllocationStatistics> GetStatistics();
+  /**
+   * @fn WriteSummary
+   * @brief Write the statistics of the scopes in the CSV format
+   * @param [in] file_name: Output file name
+   * @return True when the file is written
+   */
+  static bool WriteSummary(const std::string file_name);
+  /**
+   * @fn Clear
+   * @brief Clear the statistics of the scopes. The registered names and the thread counts are kept.
+   */
+  static void Clear();
+};
+
+/**
+ * @class ScopedAllocationTracking
+ * @brief Scope which counts the heap allocations from the construction to the destruction into the given name
+ */
+class ScopedAllocationTracking {
+ public:
+  /**
+   * @fn ScopedAllocationTracking
+   * @brief Constructor
+   * @param [in] name: Name of the scope
+   */
+  explicit ScopedAllocationTracking(const char* name)
+      : previous_scope_index_(AllocationTracker::SwapCurrentScope(AllocationTracker::RegisterScope(name))) {}
+  /**
+   * @fn ~ScopedAllocationTracking
+   * @brief Destructor
+   */
+  ~ScopedAllocationTracking() { AllocationTracker::SwapCurrentScope(previous_scope_index_); }
+
+ private:
+  int previous_scope_index_;  //!< Index of the scope of the outside
+};
+
+/**
+ * @fn CountSteadyStateAllocations
+ * @brief Count the heap allocations in a step after the warm-up steps in the calling thread
+ * @details Test helper to check that a simulation step is allocation free, e.g. EXPECT_EQ(0, CountSteadyStateAllocations([&] { ... }));
+ *          The result is always zero when AllocationTracker::IsCompiled() is false.
+ * @param [in] step: Function object of a step
+ * @param [in] number_of_warm_up_steps: Number of the steps executed before the counting to allocate the lazily prepared buffers
+ * @return Number of the allocations in the counted step
+ */
+template <typename Step>
+int64_t CountSteadyStateAllocations(Step&& step, const size_t number_of_warm_up_steps = 1) {
+  for (size_t i = 0; i < number_of_warm_up_steps; i++) {
+    step();
+  }
+  const int64_t number_of_allocations_before = AllocationTracker::GetNumberOfThreadAllocations();
+  step();
+  return AllocationTracker::GetNumberOfThreadAllocations() - number_of_allocations_before;
+}
+
+/**
+ * @def ALLOCATION_SCOPE
+ * @brief Count the heap allocations of the current scope into the name. The instrumentation is compiled only when USE_ALLOCATION_TRACKER is
+ *        defined.
+ * @param [in] name: Name of the scope
+ */
+#define ALLOCATION_CONCATENATE_DETAIL(x, y) x##y
+#define ALLOCATION_CONCATENATE(x, y) ALLOCATION_CONCATENATE_DETAIL(x, y)
+#ifdef USE_ALLOCATION_TRACKER
+#define ALLOCATION_SCOPE(name) ScopedAllocationTracking ALLOCATION_CONCATENATE(scoped_allocation_tracking_, __LINE__)(name)
+#else
+#define ALLOCATION_SCOPE(name)
+#endif
+
+#endif  // S2E_LIBRARY_UTILITIES_ALLOCATION_TRACKER_HPP_
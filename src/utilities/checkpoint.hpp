@@ -0,0 +1,241 @@
+/**
+ * @file checkpoint.hpp
+ * @brief Binary stream classes and interface class to save and restore the simulation state
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_CHECKPOINT_HPP_
+#define S2E_LIBRARY_UTILITIES_CHECKPOINT_HPP_
+
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class CheckpointWriter
+ * @brief Class to write the simulation state into a binary stream
+ * @note Values are written with the native byte order. The checkpoint is assumed to be restored on the same platform and build.
+ */
+class CheckpointWriter {
+ public:
+  /**
+   * @fn CheckpointWriter
+   * @brief Constructor
+   * @param [in] stream: Output binary stream
+   */
+  explicit CheckpointWriter(std::ostream& stream) : stream_(stream) {}
+
+  /**
+   * @fn Write
+   * @brief Write trivially copyable value such as double, int, libra::Vector, libra::Matrix, and libra::Quaternion
+   */
+  template <typename T>
+  inline void Write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written directly.");
+    stream_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  /**
+   * @fn Write
+   * @brief Write array of trivially copyable values
+   */
+  template <typename T>
+  inline void Write(const std::vector<T>& values) {
+    Write((uint64_t)values.size());
+    for (const auto& value : values) {
+      Write(value);
+    }
+  }
+  /**
+   * @fn Write
+   * @brief Write string
+   */
+  inline void Write(const std::string& value) {
+    Write((uint64_t)value.size());
+    stream_.write(value.data(), value.size());
+  }
+
+  /**
+   * @fn IsGood
+   * @brief Return true when all values are written without error
+   */
+  inline bool IsGood() const { return stream_.good(); }
+
+ private:
+  std::ostream& stream_;  //!< Output binary stream
+};
+
+/**
+ * @class CheckpointReader
+ * @brief Class to read the simulation state from a binary stream written by CheckpointWriter
+ */
+class CheckpointReader {
+ public:
+  /**
+   * @fn CheckpointReader
+   * @brief Constructor
+   * @param [in] stream: Input binary stream
+   */
+  explicit CheckpointReader(std::istream& stream) : stream_(stream) {}
+
+  /**
+   * @fn Read
+   * @brief Read trivially copyable value
+   */
+  template <typename T>
+  inline void Read(T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be read directly.");
+    stream_.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+  /**
+   * @fn Read
+   * @brief Read array of trivially copyable values
+   * @note The reader is marked as failed when the stored length exceeds the remaining size of the stream
+   */
+  template <typename T>
+  inline void Read(std::vector<T>& values) {
+    uint64_t size = 0;
+    Read(size);
+    if (!stream_.good()) return;
+    if (size > GetRemainingSize_byte() / sizeof(T)) {
+      SetFailed();
+      return;
+    }
+    values.resize((size_t)size);
+    for (auto& value : values) {
+      Read(value);
+    }
+  }
+  /**
+   * @fn Read
+   * @brief Read string
+   */
+  inline void Read(std::string& value) {
+    uint64_t size = 0;
+    Read(size);
+    if (!stream_.good()) return;
+    if (size > GetRemainingSize_byte()) {
+      SetFailed();
+      return;
+    }
+    value.resize((size_t)size);
+    stream_.read(&value[0], size);
+  }
+
+  /**
+   * @fn IsGood
+   * @brief Return true when all values are read without error
+   */
+  inline bool IsGood() const { return stream_.good(); }
+  /**
+   * @fn SetFailed
+   * @brief Mark the reader as failed, e.g. when the restored state is inconsistent with the current configuration
+   */
+  inline void SetFailed() { stream_.setstate(std::ios::failbit); }
+
+ private:
+  std::istream& stream_;  //!< Input binary stream
+
+  /**
+   * @fn GetRemainingSize_byte
+   * @brief Return the size from the current position to the end of the stream [byte]
+   * @note The maximum value is returned for streams which cannot seek
+   */
+  inline uint64_t GetRemainingSize_byte() {
+    const std::istream::pos_type current_position = stream_.tellg();
+    if (current_position == std::istream::pos_type(-1)) return std::numeric_limits<uint64_t>::max();
+    stream_.seekg(0, std::ios::end);
+    const std::istream::pos_type end_position = stream_.tellg();
+    stream_.seekg(current_position);
+    if (end_position == std::istream::pos_type(-1) || !stream_.good()) {
+      stream_.clear();
+      stream_.seekg(current_position);
+      return std::numeric_limits<uint64_t>::max();
+    }
+    return (uint64_t)(end_position - current_position);
+  }
+};
+
+/**
+ * @class ICheckpointable
+ * @brief Interface class for classes whose internal state is saved in the checkpoint
+ * @note The values must be read in LoadCheckpoint with the same order as written in SaveCheckpoint
+ */
+class ICheckpointable {
+ public:
+  /**
+   * @fn ~ICheckpointable
+   * @brief Destructor
+   */
+  virtual ~ICheckpointable() {}
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the internal state
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveCheckpoint(CheckpointWriter& writer) const = 0;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the internal state
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadCheckpoint(CheckpointReader& reader) = 0;
+};
+
+/**
+ * @fn SaveCheckpointableMap
+ * @brief Write the states of the objects in the map with their keys. Null pointers are skipped.
+ * @param [in] objects: Map of the checkpointable objects
+ * @param [out] writer: Checkpoint writer
+ */
+template <typename Key, typename T>
+void SaveCheckpointableMap(const std::map<Key, T*>& objects, CheckpointWriter& writer) {
+  uint64_t number_of_objects = 0;
+  for (const auto& object : objects) {
+    if (object.second != nullptr) number_of_objects++;
+  }
+  writer.Write(number_of_objects);
+  for (const auto& object : objects) {
+    if (object.second == nullptr) continue;
+    writer.Write(object.first);
+    object.second->SaveCheckpoint(writer);
+  }
+}
+
+/**
+ * @fn LoadCheckpointableMap
+ * @brief Restore the states of the objects in the map written by SaveCheckpointableMap
+ * @note The reader is marked as failed when the stored keys are different from the keys in the map
+ * @param [in,out] objects: Map of the checkpointable objects
+ * @param [in] reader: Checkpoint reader
+ */
+template <typename Key, typename T>
+void LoadCheckpointableMap(std::map<Key, T*>& objects, CheckpointReader& reader) {
+  uint64_t number_of_objects = 0;
+  reader.Read(number_of_objects);
+  if (!reader.IsGood()) return;
+  uint64_t number_of_current_objects = 0;
+  for (const auto& object : objects) {
+    if (object.second != nullptr) number_of_current_objects++;
+  }
+  if (number_of_objects != number_of_current_objects) {
+    reader.SetFailed();
+    return;
+  }
+  for (uint64_t i = 0; i < number_of_objects; i++) {
+    Key key;
+    reader.Read(key);
+    if (!reader.IsGood()) return;
+    const auto object = objects.find(key);
+    if (object == objects.end() || object->second == nullptr) {
+      reader.SetFailed();
+      return;
+    }
+    object->second->LoadCheckpoint(reader);
+  }
+}
+
+#endif  // S2E_LIBRARY_UTILITIES_CHECKPOINT_HPP_
@@ -0,0 +1,111 @@
+/**
+ * @file execution_cost.hpp
+ * @brief Accounting of the measured execution time of the simulation models
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_EXECUTION_COST_HPP_
+#define S2E_LIBRARY_UTILITIES_EXECUTION_COST_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @class ExecutionCost
+ * @brief Accumulator of the execution time of a periodically executed function
+ * @details The accounting is disabled by default and enabled for all accumulators with SetAccountingEnabled before the simulation starts.
+ */
+class ExecutionCost {
+ public:
+  /**
+   * @fn Add
+   * @brief Add an execution
+   * @param [in] time_s: Execution time [s]
+   */
+  inline void Add(const double time_s) {
+    number_of_calls_++;
+    total_time_s_ += time_s;
+    max_time_s_ = std::max(max_time_s_, time_s);
+  }
+  /**
+   * @fn Clear
+   * @brief Clear the accumulated executions
+   */
+  inline void Clear() {
+    number_of_calls_ = 0;
+    total_time_s_ = 0.0;
+    max_time_s_ = 0.0;
+  }
+
+  // Getter
+  /**
+   * @fn GetNumberOfCalls
+   * @brief Return number of the executions
+   */
+  inline int64_t GetNumberOfCalls() const { return number_of_calls_; }
+  /**
+   * @fn GetTotalTime_s
+   * @brief Return cumulative execution time [s]
+   */
+  inline double GetTotalTime_s() const { return total_time_s_; }
+  /**
+   * @fn GetMaxTime_s
+   * @brief Return maximum execution time of an execution [s]
+   */
+  inline double GetMaxTime_s() const { return max_time_s_; }
+  /**
+   * @fn GetMeanTime_s
+   * @brief Return mean execution time [s]
+   */
+  inline double GetMeanTime_s() const { return (number_of_calls_ > 0) ? total_time_s_ / (double)number_of_calls_ : 0.0; }
+
+  /**
+   * @fn IsAccountingEnabled
+   * @brief Return true when the execution time is measured
+   */
+  static inline bool IsAccountingEnabled() { return is_accounting_enabled_; }
+  /**
+   * @fn SetAccountingEnabled
+   * @brief Enable or disable the measurement of the execution time
+   * @note Call this function when the simulation threads are not running
+   */
+  static inline void SetAccountingEnabled(const bool is_accounting_enabled) { is_accounting_enabled_ = is_accounting_enabled; }
+
+ private:
+  int64_t number_of_calls_ = 0;  //!< Number of the executions
+  double total_time_s_ = 0.0;    //!< Cumulative execution time [s]
+  double max_time_s_ = 0.0;      //!< Maximum execution time [s]
+
+  static inline bool is_accounting_enabled_ = false;  //!< Flag to measure the execution time
+};
+
+/**
+ * @class ScopedExecutionCost
+ * @brief Timer which adds the duration from the construction to the destruction into the execution cost when the accounting is enabled
+ */
+class ScopedExecutionCost {
+ public:
+  /**
+   * @fn ScopedExecutionCost
+   * @brief Constructor
+   * @param [in] execution_cost: Execution cost to accumulate
+   */
+  explicit ScopedExecutionCost(ExecutionCost& execution_cost)
+      : execution_cost_(execution_cost), is_enabled_(ExecutionCost::IsAccountingEnabled()) {
+    if (is_enabled_) start_ = std::chrono::steady_clock::now();
+  }
+  /**
+   * @fn ~ScopedExecutionCost
+   * @brief Destructor
+   */
+  ~ScopedExecutionCost() {
+    if (is_enabled_) execution_cost_.Add(std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+  }
+
+ private:
+  ExecutionCost& execution_cost_;                //!< Execution cost to accumulate
+  bool is_enabled_;                              //!< Flag of the measurement
+  std::chrono::steady_clock::time_point start_;  //!< Start time
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_EXECUTION_COST_HPP_
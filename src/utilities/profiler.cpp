@@ -0,0 +1,171 @@
+/**
+ * @file profiler.cpp
+ * @brief Scoped timer instrumentation to profile the simulation
+ */
+
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#ifdef __GNUC__
+#include <cxxabi.h>
+
+#include <cstdlib>
+#endif
+
+std::string MakeReadableName(const char* name) {
+#ifdef __GNUC__
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status == 0 && demangled != nullptr) {
+    std::string readable_name(demangled);
+    free(demangled);
+    return readable_name;
+  }
+#endif
+  return std::string(name);
+}
+
+namespace {
+/**
+ * @fn EscapeJson
+ * @brief Escape the string for JSON
+ */
+std::string EscapeJson(const std::string& text) {
+  std::string escaped;
+  for (const char c : text) {
+    if (c == '"' || c == '\\') escaped += '\\';
+    escaped += c;
+  }
+  return escaped;
+}
+}  // namespace
+
+Profiler& Profiler::GetInstance() {
+  static Profiler profiler;
+  return profiler;
+}
+
+void Profiler::Record(const char* name, const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end) {
+  ThreadBuffer& buffer = GetThreadBuffer();
+  const int64_t duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  ProfileStatistics& statistics = buffer.statistics[name];
+  statistics.count++;
+  statistics.total_ns += duration_ns;
+  statistics.max_ns = std::max(statistics.max_ns, duration_ns);
+
+  if (buffer.events.size() < max_events_per_thread_) {
+    const int64_t start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count();
+    buffer.events.push_back(ProfileEvent{name, start_ns, duration_ns});
+  }
+}
+
+void Profiler::Clear() {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (auto& buffer : buffers_) {
+    buffer->events.clear();
+    buffer->statistics.clear();
+  }
+}
+
+std::map<std::string, ProfileStatistics> Profiler::GetStatistics() const {
+  // Aggregate over the threads and the name pointers
+  std::map<std::string, ProfileStatistics> total_statistics;
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (const auto& buffer : buffers_) {
+    for (const auto& statistics : buffer->statistics) {
+      ProfileStatistics& total = total_statistics[MakeReadableName(statistics.first)];
+      total.count += statistics.second.count;
+      total.total_ns += statistics.second.total_ns;
+      total.max_ns = std::max(total.max_ns, statistics.second.max_ns);
+    }
+  }
+  return total_statistics;
+}
+
+bool Profiler::WriteChromeTrace(const std::string file_name) const {
+  std::ofstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] profiler: cannot open " << file_name << std::endl;
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  std::unordered_map<const char*, std::string> readable_names;
+  file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  bool is_first = true;
+  // Time stamps of the Chrome trace event format are in microseconds
+  auto write_event = [&](const ProfileEvent& event, const char* phase, const int64_t time_ns, const int thread_id) {
+    auto readable_name = readable_names.find(event.name);
+    if (readable_name == readable_names.end()) {
+      readable_name = readable_names.emplace(event.name, EscapeJson(MakeReadableName(event.name))).first;
+    }
+    if (!is_first) file << ",";
+    is_first = false;
+    file << "\n{\"name\":\"" << readable_name->second << "\",\"ph\":\"" << phase << "\",\"pid\":0,\"tid\":" << thread_id
+         << ",\"ts\":" << time_ns * 1.0e-3 << "}";
+  };
+
+  for (const auto& buffer : buffers_) {
+    // The events are recorded at the end of the scopes, so they are sorted by the start time with the outer scope first
+    std::vector<ProfileEvent> events = buffer->events;
+    std::stable_sort(events.begin(), events.end(), [](const ProfileEvent& lhs, const ProfileEvent& rhs) {
+      if (lhs.start_ns != rhs.start_ns) return lhs.start_ns < rhs.start_ns;
+      return lhs.duration_ns > rhs.duration_ns;
+    });
+    std::vector<const ProfileEvent*> open_events;
+    for (const ProfileEvent& event : events) {
+      while (!open_events.empty() && open_events.back()->start_ns + open_events.back()->duration_ns <= event.start_ns) {
+        write_event(*open_events.back(), "E", open_events.back()->start_ns + open_events.back()->duration_ns, buffer->thread_id);
+        open_events.pop_back();
+      }
+      write_event(event, "B", event.start_ns, buffer->thread_id);
+      open_events.push_back(&event);
+    }
+    while (!open_events.empty()) {
+      write_event(*open_events.back(), "E", open_events.back()->start_ns + open_events.back()->duration_ns, buffer->thread_id);
+      open_events.pop_back();
+    }
+  }
+  file << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  return file.good();
+}
+
+bool Profiler::WriteSummary(const std::string file_name) const {
+  std::ofstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "[WARNING] profiler: cannot open " << file_name << std::endl;
+    return false;
+  }
+
+  const std::map<std::string, ProfileStatistics> total_statistics = GetStatistics();
+  std::vector<std::pair<std::string, ProfileStatistics>> sorted_statistics(total_statistics.begin(), total_statistics.end());
+  std::stable_sort(sorted_statistics.begin(), sorted_statistics.end(),
+                   [](const std::pair<std::string, ProfileStatistics>& lhs, const std::pair<std::string, ProfileStatistics>& rhs) {
+                     return lhs.second.total_ns > rhs.second.total_ns;
+                   });
+
+  file << "name,count,total[ms],mean[us],max[us]\n";
+  for (const auto& statistics : sorted_statistics) {
+    const ProfileStatistics& value = statistics.second;
+    file << "\"" << statistics.first << "\"," << value.count << "," << value.total_ns * 1.0e-6 << "," << value.total_ns * 1.0e-3 / value.count << ","
+         << value.max_ns * 1.0e-3 << "\n";
+  }
+  return file.good();
+}
+
+Profiler::ThreadBuffer& Profiler::GetThreadBuffer() {
+  thread_local std::shared_ptr<ThreadBuffer> thread_buffer;
+  if (!thread_buffer) {
+    // The buffer is owned also by the profiler to keep it after the thread exits
+    thread_buffer = std::make_shared<ThreadBuffer>();
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    thread_buffer->thread_id = (int)buffers_.size();
+    buffers_.push_back(thread_buffer);
+  }
+  return *thread_buffer;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file profiler.hpp
+ * @brief Scoped timer instrumentation to profile the simulation
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_PROFILER_HPP_
+#define S2E_LIBRARY_UTILITIES_PROFILER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct ProfileEvent
+ * @brief Execution of a profiled scope
+ */
+struct ProfileEvent {
+  const char* name;     //!< Name of the scope
+  int64_t start_ns;     //!< Start time from the epoch of steady_clock [ns]
+  int64_t duration_ns;  //!< Duration [ns]
+};
+
+/**
+ * @struct ProfileStatistics
+ * @brief Aggregated statistics of a profiled scope
+ */
+struct ProfileStatistics {
+  int64_t count = 0;     //!< Number of executions
+  int64_t total_ns = 0;  //!< Total duration [ns]
+  int64_t max_ns = 0;    //!< Maximum duration [ns]
+};
+
+/**
+ * @class Profiler
+ * @brief Collector of the profiled scopes
+ * @details Each thread records the events and the statistics into its own buffer without locks. The buffers are read when the results are written,
+ *          so the output functions should be called when the simulation threads are not running.
+ */
+class Profiler {
+ public:
+  /**
+   * @fn GetInstance
+   * @brief Return the profiler instance
+   */
+  static Profiler& GetInstance();
+
+  /**
+   * @fn Record
+   * @brief Record an execution of a scope into the buffer of the calling thread
+   * @param [in] name: Name of the scope. The pointer must be valid until the results are written (e.g. string literal).
+   * @param [in] start: Start time
+   * @param [in] end: End time
+   */
+  void Record(const char* name, const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end);
+  /**
+   * @fn SetMaxEventsPerThread
+   * @brief Set maximum number of the trace events kept for each thread. The statistics are recorded after the limit.
+   */
+  inline void SetMaxEventsPerThread(const size_t max_events_per_thread) { max_events_per_thread_ = max_events_per_thread; }
+  /**
+   * @fn Clear
+   * @brief Clear the recorded events and statistics
+   */
+  void Clear();
+
+  /**
+   * @fn GetStatistics
+   * @brief Return the statistics of each scope aggregated over the threads
+   * @return Statistics with the readable name of each scope
+   */
+  std::map<std::string, ProfileStatistics> GetStatistics() const;
+
+  /**
+   * @fn WriteChromeTrace
+   * @brief Write the recorded events in the Chrome trace event format which can be opened with Perfetto or chrome://tracing
+   * @note Each execution is written as a pair of the begin and end events, and the pairs are nested in each thread
+   * @param [in] file_name: Output file name
+   * @return True when the file is written
+   */
+  bool WriteChromeTrace(const std::string file_name) const;
+  /**
+   * @fn WriteSummary
+   * @brief Write the statistics of each scope aggregated over the threads in the CSV format sorted by the total duration
+   * @param [in] file_name: Output file name
+   * @return True when the file is written
+   */
+  bool WriteSummary(const std::string file_name) const;
+
+ private:
+  /**
+   * @struct ThreadBuffer
+   * @brief Buffer of a thread
+   */
+  struct ThreadBuffer {
+    int thread_id;                                                  //!< Sequential ID of the thread
+    std::vector<ProfileEvent> events;                               //!< Recorded events
+    std::unordered_map<const char*, ProfileStatistics> statistics;  //!< Statistics of each scope name pointer
+  };
+
+  size_t max_events_per_thread_ = 1000000;              //!< Maximum number of the trace events of each thread
+  mutable std::mutex buffers_mutex_;                    //!< Mutex of the buffer list
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers_;  //!< Buffers of all threads which recorded
+
+  /**
+   * @fn Profiler
+   * @brief Constructor
+   */
+  Profiler() = default;
+  /**
+   * @fn GetThreadBuffer
+   * @brief Return the buffer of the calling thread. The buffer is registered at the first call in the thread.
+   */
+  ThreadBuffer& GetThreadBuffer();
+};
+
+/**
+ * @fn MakeReadableName
+ * @brief Demangle the name when it is a type name given by typeid
+ * @param [in] name: Name of the scope or the type
+ */
+std::string MakeReadableName(const char* name);
+
+/**
+ * @class ScopedProfile
+ * @brief Timer which records the duration from the construction to the destruction into the profiler
+ */
+class ScopedProfile {
+ public:
+  /**
+   * @fn ScopedProfile
+   * @brief Constructor
+   * @param [in] name: Name of the scope
+   */
+  explicit ScopedProfile(const char* name) : name_(name), start_(std::chrono::steady_clock::now()) {}
+  /**
+   * @fn ~ScopedProfile
+   * @brief Destructor
+   */
+  ~ScopedProfile() { Profiler::GetInstance().Record(name_, start_, std::chrono::steady_clock::now()); }
+
+ private:
+  const char* name_;                             //!< Name of the scope
+  std::chrono::steady_clock::time_point start_;  //!< Start time
+};
+
+/**
+ * @def PROFILE_SCOPE
+ * @brief Record the duration of the current scope into the profiler. The instrumentation is compiled only when USE_PROFILER is defined.
+ * @param [in] name: Name of the scope
+ */
+#define PROFILE_CONCATENATE_DETAIL(x, y) x##y
+#define PROFILE_CONCATENATE(x, y) PROFILE_CONCATENATE_DETAIL(x, y)
+#ifdef USE_PROFILER
+#define PROFILE_SCOPE(name) ScopedProfile PROFILE_CONCATENATE(scoped_profile_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name)
+#endif
+
+#endif  // S2E_LIBRARY_UTILITIES_PROFILER_HPP_
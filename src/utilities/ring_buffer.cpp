@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <vector>
 
 RingBuffer::RingBuffer(int buffer_size) : buffer_size_(buffer_size) {
   buffer_ = new byte[buffer_size];
@@ -44,3 +45,26 @@ int RingBuffer::Read(byte* buffer, const unsigned int offset, const unsigned int
 
   return read_count;
 }
+
+void RingBuffer::SaveCheckpoint(CheckpointWriter& writer) const {
+  writer.Write(std::vector<byte>(buffer_, buffer_ + buffer_size_));
+  writer.Write(read_pointer_);
+  writer.Write(write_pointer_);
+}
+
+void RingBuffer::LoadCheckpoint(CheckpointReader& reader) {
+  std::vector<byte> buffer;
+  unsigned int read_pointer = 0;
+  unsigned int write_pointer = 0;
+  reader.Read(buffer);
+  reader.Read(read_pointer);
+  reader.Read(write_pointer);
+  if (!reader.IsGood()) return;
+  if (buffer.size() != buffer_size_ || read_pointer >= buffer_size_ || write_pointer >= buffer_size_) {
+    reader.SetFailed();
+    return;
+  }
+  memcpy(buffer_, buffer.data(), buffer_size_);
+  read_pointer_ = read_pointer;
+  write_pointer_ = write_pointer;
+}
@@ -6,13 +6,15 @@
 #ifndef S2E_LIBRARY_UTILITIES_RING_BUFFER_HPP_
 #define S2E_LIBRARY_UTILITIES_RING_BUFFER_HPP_
 
+#include "checkpoint.hpp"
+
 typedef unsigned char byte;
 
 /**
  * @class RingBuffer
  * @brief Class to emulate ring buffer
  */
-class RingBuffer {
+class RingBuffer : public ICheckpointable {
  public:
   /**
    * @fn RingBuffer
@@ -45,6 +47,19 @@ class RingBuffer {
    */
   int Read(byte* buffer, const unsigned int offset, const unsigned int data_length);
 
+  // Override ICheckpointable
+  /**
+   * @fn SaveCheckpoint
+   * @brief Write the buffered data and the pointers into the checkpoint
+   */
+  void SaveCheckpoint(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the buffered data and the pointers from the checkpoint
+   * @note The reader is marked as failed when the buffer size is different
+   */
+  void LoadCheckpoint(CheckpointReader& reader) override;
+
  private:
   unsigned int buffer_size_;    //!< Buffer size
   byte* buffer_;                //!< Buffer
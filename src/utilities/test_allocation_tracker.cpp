@@ -0,0 +1,81 @@
+/**
+ * @file test_allocation_tracker.cpp
+ * @brief Test codes for AllocationTracker with GoogleTest
+ * @note The tests are skipped unless USE_ALLOCATION_TRACKER is ON since the allocations are not counted
+ */
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "../math_physics/math/quaternion.hpp"
+#include "../math_physics/numerical_integration/ode_examples.hpp"
+#include "../math_physics/numerical_integration/runge_kutta_4.hpp"
+#include "allocation_tracker.hpp"
+
+/**
+ * @brief Test for counting of the allocations in a step
+ */
+TEST(AllocationTracker, CountSteadyStateAllocations) {
+  if (!AllocationTracker::IsCompiled()) GTEST_SKIP() << "USE_ALLOCATION_TRACKER is OFF";
+
+  std::vector<std::vector<double>> buffers;
+  buffers.reserve(10);
+  const int64_t number_of_allocations = CountSteadyStateAllocations([&] { buffers.emplace_back(10, 0.0); });
+
+  EXPECT_EQ(1, number_of_allocations);
+  EXPECT_EQ(2u, buffers.size());
+}
+
+/**
+ * @brief Test for counting of the allocations into the scope
+ */
+TEST(AllocationTracker, Scope) {
+  if (!AllocationTracker::IsCompiled()) GTEST_SKIP() << "USE_ALLOCATION_TRACKER is OFF";
+
+  const char* scope_name = "AllocationTrackerTest::Scope";
+  std::vector<std::vector<double>> buffers;
+  buffers.reserve(3);
+  {
+    ALLOCATION_SCOPE(scope_name);
+    for (size_t i = 0; i < 3; i++) buffers.emplace_back(10, 0.0);
+  }
+
+  int64_t number_of_allocations = 0;
+  for (const auto& statistics : AllocationTracker::GetStatistics()) {
+    if (statistics.name == scope_name) number_of_allocations = statistics.number_of_allocations;
+  }
+  EXPECT_EQ(3, number_of_allocations);
+}
+
+/**
+ * @brief Test that the integration step with RK4 does not allocate
+ */
+TEST(AllocationTracker, AllocationFreeRk4) {
+  if (!AllocationTracker::IsCompiled()) GTEST_SKIP() << "USE_ALLOCATION_TRACKER is OFF";
+
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  libra::numerical_integration::RungeKutta4<4> rk4_ode(0.1, ode);
+  libra::Vector<4> initial_state(0.0);
+  initial_state[0] = 1.0;
+  initial_state[3] = 1.0;
+  rk4_ode.SetState(0.0, initial_state);
+
+  EXPECT_EQ(0, CountSteadyStateAllocations([&] { rk4_ode.Integrate(); }));
+}
+
+/**
+ * @brief Test that the attitude kinematics with Quaternion does not allocate
+ */
+TEST(AllocationTracker, AllocationFreeQuaternion) {
+  if (!AllocationTracker::IsCompiled()) GTEST_SKIP() << "USE_ALLOCATION_TRACKER is OFF";
+
+  libra::Quaternion quaternion(0.0, 0.0, 0.0, 1.0);
+  libra::Vector<3> angular_velocity_rad_s(0.01);
+  const double step_s = 0.1;
+
+  EXPECT_EQ(0, CountSteadyStateAllocations([&] {
+              const libra::Quaternion derivative = 0.5 * (quaternion * angular_velocity_rad_s);
+              quaternion = (quaternion + step_s * derivative).Normalize();
+            }));
+}
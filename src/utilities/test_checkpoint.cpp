@@ -0,0 +1,110 @@
+/**
+ * @file test_checkpoint.cpp
+ * @brief Test codes for CheckpointWriter and CheckpointReader with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <map>
+#include <sstream>
+
+#include "checkpoint.hpp"
+#include "ring_buffer.hpp"
+
+/**
+ * @brief Test for writing and reading the arrays and the strings
+ */
+TEST(Checkpoint, ReadWrite) {
+  std::stringstream stream;
+  CheckpointWriter writer(stream);
+  writer.Write(1.5);
+  writer.Write(std::vector<int>{1, 2, 3});
+  writer.Write(std::string("checkpoint"));
+  EXPECT_TRUE(writer.IsGood());
+
+  CheckpointReader reader(stream);
+  double value = 0.0;
+  std::vector<int> values;
+  std::string text;
+  reader.Read(value);
+  reader.Read(values);
+  reader.Read(text);
+  EXPECT_TRUE(reader.IsGood());
+  EXPECT_DOUBLE_EQ(1.5, value);
+  ASSERT_EQ(3u, values.size());
+  EXPECT_EQ(3, values[2]);
+  EXPECT_EQ("checkpoint", text);
+}
+
+/**
+ * @brief Test for the array length larger than the remaining size of the stream
+ */
+TEST(Checkpoint, CorruptedLength) {
+  std::stringstream stream;
+  CheckpointWriter writer(stream);
+  writer.Write((uint64_t)1000000000000);
+  writer.Write(1.0);
+
+  CheckpointReader reader(stream);
+  std::vector<double> values;
+  reader.Read(values);
+  EXPECT_FALSE(reader.IsGood());
+  EXPECT_TRUE(values.empty());
+
+  std::stringstream string_stream;
+  CheckpointWriter string_writer(string_stream);
+  string_writer.Write((uint64_t)100);
+  string_writer.Write('a');
+
+  CheckpointReader string_reader(string_stream);
+  std::string text;
+  string_reader.Read(text);
+  EXPECT_FALSE(string_reader.IsGood());
+  EXPECT_TRUE(text.empty());
+}
+
+/**
+ * @brief Test for the map of the checkpointable objects
+ */
+TEST(Checkpoint, CheckpointableMap) {
+  const unsigned char data[] = {1, 2, 3, 4};
+  std::map<int, RingBuffer*> buffers;
+  RingBuffer buffer(8);
+  buffer.Write(data, 0, 4);
+  buffers[2] = &buffer;
+  buffers[5] = nullptr;
+
+  std::stringstream stream;
+  CheckpointWriter writer(stream);
+  SaveCheckpointableMap(buffers, writer);
+  const std::string checkpoint = stream.str();
+
+  // Restore into the map with the same key
+  RingBuffer restored_buffer(8);
+  std::map<int, RingBuffer*> restored_buffers;
+  restored_buffers[2] = &restored_buffer;
+  std::stringstream restored_stream(checkpoint);
+  CheckpointReader reader(restored_stream);
+  LoadCheckpointableMap(restored_buffers, reader);
+  EXPECT_TRUE(reader.IsGood());
+  unsigned char read_data[4] = {0, 0, 0, 0};
+  EXPECT_EQ(4, restored_buffer.Read(read_data, 0, 4));
+  EXPECT_EQ(4, read_data[3]);
+
+  // Different key
+  RingBuffer other_buffer(8);
+  std::map<int, RingBuffer*> other_buffers;
+  other_buffers[3] = &other_buffer;
+  std::stringstream other_stream(checkpoint);
+  CheckpointReader other_reader(other_stream);
+  LoadCheckpointableMap(other_buffers, other_reader);
+  EXPECT_FALSE(other_reader.IsGood());
+
+  // Different buffer size
+  RingBuffer small_buffer(4);
+  std::map<int, RingBuffer*> small_buffers;
+  small_buffers[2] = &small_buffer;
+  std::stringstream small_stream(checkpoint);
+  CheckpointReader small_reader(small_stream);
+  LoadCheckpointableMap(small_buffers, small_reader);
+  EXPECT_FALSE(small_reader.IsGood());
+}
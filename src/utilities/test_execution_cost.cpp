@@ -0,0 +1,67 @@
+/**
+ * @file test_execution_cost.cpp
+ * @brief Test codes for ExecutionCost and ScopedExecutionCost classes with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "execution_cost.hpp"
+
+/**
+ * @brief Test for the accumulation of the executions
+ */
+TEST(ExecutionCost, Accumulation) {
+  ExecutionCost execution_cost;
+  EXPECT_EQ(0, execution_cost.GetNumberOfCalls());
+  EXPECT_DOUBLE_EQ(0.0, execution_cost.GetMeanTime_s());
+
+  execution_cost.Add(0.002);
+  execution_cost.Add(0.005);
+  execution_cost.Add(0.001);
+  EXPECT_EQ(3, execution_cost.GetNumberOfCalls());
+  EXPECT_DOUBLE_EQ(0.008, execution_cost.GetTotalTime_s());
+  EXPECT_DOUBLE_EQ(0.005, execution_cost.GetMaxTime_s());
+  EXPECT_DOUBLE_EQ(0.008 / 3.0, execution_cost.GetMeanTime_s());
+
+  execution_cost.Clear();
+  EXPECT_EQ(0, execution_cost.GetNumberOfCalls());
+  EXPECT_DOUBLE_EQ(0.0, execution_cost.GetTotalTime_s());
+  EXPECT_DOUBLE_EQ(0.0, execution_cost.GetMaxTime_s());
+}
+
+/**
+ * @brief Test for the scoped measurement which is enabled and disabled by the accounting flag
+ */
+TEST(ExecutionCost, ScopedExecutionCost) {
+  ExecutionCost execution_cost;
+  ExecutionCost::SetAccountingEnabled(false);
+  {
+    ScopedExecutionCost scoped_cost(execution_cost);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(0, execution_cost.GetNumberOfCalls());
+
+  ExecutionCost::SetAccountingEnabled(true);
+  ExecutionCost inner_cost;
+  for (size_t i = 0; i < 3; i++) {
+    ScopedExecutionCost scoped_cost(execution_cost);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // The longest execution
+    if (i == 1) {
+      ScopedExecutionCost inner_scoped_cost(inner_cost);
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  ExecutionCost::SetAccountingEnabled(false);
+
+  EXPECT_EQ(3, execution_cost.GetNumberOfCalls());
+  EXPECT_GE(execution_cost.GetTotalTime_s(), 0.013);
+  EXPECT_GE(execution_cost.GetMaxTime_s(), 0.011);
+  EXPECT_LT(execution_cost.GetMaxTime_s(), execution_cost.GetTotalTime_s());
+  // The outer scope includes the inner scope
+  EXPECT_EQ(1, inner_cost.GetNumberOfCalls());
+  EXPECT_GE(inner_cost.GetTotalTime_s(), 0.010);
+  EXPECT_GE(execution_cost.GetMaxTime_s(), inner_cost.GetMaxTime_s());
+}
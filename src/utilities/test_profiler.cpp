@@ -0,0 +1,267 @@
+/**
+ * @file test_profiler.cpp
+ * @brief Test codes for Profiler class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "profiler.hpp"
+
+namespace {
+/**
+ * @struct JsonValue
+ * @brief Value of the JSON document
+ */
+struct JsonValue {
+  enum class Type { kNull, kBoolean, kNumber, kString, kArray, kObject } type = Type::kNull;  //!< Type of the value
+  double number = 0.0;                                                                       //!< Number or boolean value
+  std::string text;                                                                          //!< String value
+  std::vector<JsonValue> array;                                                              //!< Elements of the array
+  std::map<std::string, JsonValue> object;                                                   //!< Members of the object
+};
+
+/**
+ * @class JsonParser
+ * @brief Minimal JSON parser to check the Chrome trace output
+ */
+class JsonParser {
+ public:
+  /**
+   * @fn JsonParser
+   * @brief Constructor
+   * @param [in] text: JSON document
+   */
+  explicit JsonParser(const std::string& text) : text_(text) {}
+  /**
+   * @fn Parse
+   * @brief Parse the whole document
+   * @param [out] value: Parsed value
+   * @return True when the document is valid JSON
+   */
+  bool Parse(JsonValue& value) {
+    if (!ParseValue(value)) return false;
+    SkipSpaces();
+    return position_ == text_.size();
+  }
+
+ private:
+  const std::string& text_;  //!< JSON document
+  size_t position_ = 0;      //!< Current position
+
+  void SkipSpaces() {
+    while (position_ < text_.size() && isspace((unsigned char)text_[position_])) position_++;
+  }
+  bool Consume(const char character) {
+    SkipSpaces();
+    if (position_ >= text_.size() || text_[position_] != character) return false;
+    position_++;
+    return true;
+  }
+  bool ConsumeWord(const std::string& word) {
+    if (text_.compare(position_, word.size(), word) != 0) return false;
+    position_ += word.size();
+    return true;
+  }
+  bool ParseString(std::string& text) {
+    if (!Consume('"')) return false;
+    text.clear();
+    while (position_ < text_.size() && text_[position_] != '"') {
+      if (text_[position_] == '\\') position_++;
+      if (position_ >= text_.size()) return false;
+      text += text_[position_++];
+    }
+    return Consume('"');
+  }
+  bool ParseValue(JsonValue& value) {
+    SkipSpaces();
+    if (position_ >= text_.size()) return false;
+    const char character = text_[position_];
+    if (character == '{') {
+      value.type = JsonValue::Type::kObject;
+      position_++;
+      if (Consume('}')) return true;
+      do {
+        std::string key;
+        if (!ParseString(key) || !Consume(':') || !ParseValue(value.object[key])) return false;
+      } while (Consume(','));
+      return Consume('}');
+    }
+    if (character == '[') {
+      value.type = JsonValue::Type::kArray;
+      position_++;
+      if (Consume(']')) return true;
+      do {
+        value.array.emplace_back();
+        if (!ParseValue(value.array.back())) return false;
+      } while (Consume(','));
+      return Consume(']');
+    }
+    if (character == '"') {
+      value.type = JsonValue::Type::kString;
+      return ParseString(value.text);
+    }
+    if (ConsumeWord("true")) {
+      value.type = JsonValue::Type::kBoolean;
+      value.number = 1.0;
+      return true;
+    }
+    if (ConsumeWord("false")) {
+      value.type = JsonValue::Type::kBoolean;
+      return true;
+    }
+    if (ConsumeWord("null")) return true;
+    value.type = JsonValue::Type::kNumber;
+    const char* begin = text_.c_str() + position_;
+    char* end = nullptr;
+    value.number = strtod(begin, &end);
+    if (end == begin) return false;
+    position_ += end - begin;
+    return true;
+  }
+};
+
+/**
+ * @fn MakeTimePoint
+ * @brief Make a time point of the steady clock
+ * @param [in] time_us: Time from the epoch of the steady clock [us]
+ */
+std::chrono::steady_clock::time_point MakeTimePoint(const int64_t time_us) {
+  const std::chrono::microseconds time_from_epoch(time_us);
+  return std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(time_from_epoch));
+}
+}  // namespace
+
+/**
+ * @brief Test for the count and the total duration of each scope
+ */
+TEST(Profiler, Statistics) {
+  Profiler& profiler = Profiler::GetInstance();
+  profiler.Clear();
+  profiler.Record("test_outer", MakeTimePoint(0), MakeTimePoint(100));
+  profiler.Record("test_inner", MakeTimePoint(10), MakeTimePoint(30));
+  profiler.Record("test_inner", MakeTimePoint(40), MakeTimePoint(90));
+
+  std::map<std::string, ProfileStatistics> statistics = profiler.GetStatistics();
+  ASSERT_EQ(1u, statistics.count("test_outer"));
+  ASSERT_EQ(1u, statistics.count("test_inner"));
+  EXPECT_EQ(1, statistics["test_outer"].count);
+  EXPECT_EQ(100000, statistics["test_outer"].total_ns);
+  EXPECT_EQ(2, statistics["test_inner"].count);
+  EXPECT_EQ(70000, statistics["test_inner"].total_ns);
+  EXPECT_EQ(50000, statistics["test_inner"].max_ns);
+
+  // The statistics of the threads are aggregated
+  std::thread thread([&]() { profiler.Record("test_inner", MakeTimePoint(0), MakeTimePoint(60)); });
+  thread.join();
+  statistics = profiler.GetStatistics();
+  EXPECT_EQ(3, statistics["test_inner"].count);
+  EXPECT_EQ(130000, statistics["test_inner"].total_ns);
+  EXPECT_EQ(60000, statistics["test_inner"].max_ns);
+
+  profiler.Clear();
+  EXPECT_TRUE(profiler.GetStatistics().empty());
+}
+
+/**
+ * @brief Test for the nested scopes measured with ScopedProfile
+ */
+TEST(Profiler, NestedScopes) {
+  Profiler& profiler = Profiler::GetInstance();
+  profiler.Clear();
+  for (size_t i = 0; i < 3; i++) {
+    ScopedProfile outer_scope("test_outer_scope");
+    for (size_t j = 0; j < 2; j++) {
+      ScopedProfile inner_scope("test_inner_scope");
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  }
+
+  std::map<std::string, ProfileStatistics> statistics = profiler.GetStatistics();
+  EXPECT_EQ(3, statistics["test_outer_scope"].count);
+  EXPECT_EQ(6, statistics["test_inner_scope"].count);
+  EXPECT_GE(statistics["test_inner_scope"].total_ns, 6 * 100000);
+  // The outer scope includes the inner scopes
+  EXPECT_GE(statistics["test_outer_scope"].total_ns, statistics["test_inner_scope"].total_ns);
+  EXPECT_GE(statistics["test_outer_scope"].max_ns, 2 * 100000);
+  profiler.Clear();
+}
+
+/**
+ * @brief Test for the Chrome trace output
+ * @note The output must be valid JSON, and the begin and end events must be nested in each thread
+ */
+TEST(Profiler, ChromeTrace) {
+  Profiler& profiler = Profiler::GetInstance();
+  profiler.Clear();
+  // Recorded at the end of the scopes, and the inner scope starts at the same time as the outer scope
+  profiler.Record("test_inner", MakeTimePoint(1000), MakeTimePoint(1030));
+  profiler.Record("test_inner", MakeTimePoint(1030), MakeTimePoint(1030));
+  profiler.Record("test_inner", MakeTimePoint(1040), MakeTimePoint(1090));
+  profiler.Record("test_outer", MakeTimePoint(1000), MakeTimePoint(1100));
+  profiler.Record("test_\"quoted\"", MakeTimePoint(1100), MakeTimePoint(1200));
+  std::thread thread([&]() {
+    ScopedProfile outer_scope("test_thread_outer");
+    ScopedProfile inner_scope("test_thread_inner");
+  });
+  thread.join();
+
+  const std::string file_name = testing::TempDir() + "test_profiler_trace.json";
+  ASSERT_TRUE(profiler.WriteChromeTrace(file_name));
+  std::ifstream file(file_name);
+  std::stringstream stream;
+  stream << file.rdbuf();
+  const std::string text = stream.str();
+
+  JsonValue trace;
+  ASSERT_TRUE(JsonParser(text).Parse(trace)) << text;
+  ASSERT_EQ(JsonValue::Type::kObject, trace.type);
+  const std::vector<JsonValue>& events = trace.object["traceEvents"].array;
+  ASSERT_EQ(14u, events.size());
+
+  // Begin and end events are matched with the stack of each thread
+  std::map<int, std::vector<std::string>> open_scopes;
+  std::map<int, double> last_time_us;
+  std::vector<std::string> main_thread_sequence;
+  const int main_thread_id = (int)events.front().object.at("tid").number;
+  for (const JsonValue& event : events) {
+    const std::string name = event.object.at("name").text;
+    const std::string phase = event.object.at("ph").text;
+    const int thread_id = (int)event.object.at("tid").number;
+    const double time_us = event.object.at("ts").number;
+    if (last_time_us.count(thread_id) > 0) {
+      EXPECT_GE(time_us, last_time_us[thread_id]);
+    }
+    last_time_us[thread_id] = time_us;
+    if (thread_id == main_thread_id) main_thread_sequence.push_back(phase + ":" + name + "@" + std::to_string((int)time_us));
+
+    std::vector<std::string>& stack = open_scopes[thread_id];
+    if (phase == "B") {
+      stack.push_back(name);
+    } else {
+      ASSERT_EQ("E", phase);
+      ASSERT_FALSE(stack.empty());
+      EXPECT_EQ(stack.back(), name);
+      stack.pop_back();
+    }
+  }
+  for (const auto& stack : open_scopes) {
+    EXPECT_TRUE(stack.second.empty());
+  }
+  EXPECT_EQ(2u, open_scopes.size());
+
+  const std::vector<std::string> expected_sequence = {"B:test_outer@1000",    "B:test_inner@1000",    "E:test_inner@1030",
+                                                      "B:test_inner@1030",    "E:test_inner@1030",    "B:test_inner@1040",
+                                                      "E:test_inner@1090",    "E:test_outer@1100",    "B:test_\"quoted\"@1100",
+                                                      "E:test_\"quoted\"@1200"};
+  EXPECT_EQ(expected_sequence, main_thread_sequence);
+  profiler.Clear();
+}